@@ -0,0 +1,299 @@
+#!/usr/bin/env python3
+
+# Generate the Markdown corpus for md4c-bench.
+#
+# Usage: gen-corpus.py [--size KB] OUTPUT_DIR
+#
+# Each document imitates one kind of real-world input (or one kind of stress
+# for the parser). The output is deterministic: The same version of this
+# script always generates the same documents, so that results of md4c-bench
+# may be compared over time.
+
+import argparse
+import os
+import random
+
+
+WORDS = (
+    "the of and to in is was for that with as on by at from this be are or "
+    "it an which have has not but were all can one also more their other "
+    "parser document block inline text value function result table format "
+    "example output input system memory buffer string number language line "
+    "character option library version program feature simple support file "
+    "data code user time list item link image header section reference "
+    "markdown render html quick brown fox jumps over lazy dog lorem ipsum "
+    "dolor sit amet consectetur adipiscing elit sed do eiusmod tempor"
+).split()
+
+LANGUAGES = ( "c", "python", "javascript", "rust", "sh", "json", "" )
+
+ENTITIES = (
+    "&amp;", "&lt;", "&gt;", "&quot;", "&nbsp;", "&copy;", "&reg;", "&trade;",
+    "&hellip;", "&mdash;", "&ndash;", "&laquo;", "&raquo;", "&euro;", "&auml;",
+    "&eacute;", "&ntilde;", "&alpha;", "&Omega;", "&rarr;", "&hearts;",
+    "&#35;", "&#169;", "&#8364;", "&#x27;", "&#x1F600;", "&#X2603;", "&bogus;"
+)
+
+# Common CJK ideographs, hiragana and katakana, and CJK punctuation.
+CJK_CHARS = [ chr(c) for c in range(0x4E00, 0x4E00 + 2000) ] + \
+            [ chr(c) for c in range(0x3041, 0x3097) ] + \
+            [ chr(c) for c in range(0x30A1, 0x30FB) ]
+CJK_PUNCT = ( "、", "。", "，", "「", "」", "（", "）", "！", "？" )
+
+
+def words(rng, n):
+    return " ".join(rng.choice(WORDS) for _ in range(n))
+
+
+def sentence(rng, inline=True):
+    parts = []
+    for _ in range(rng.randint(6, 18)):
+        w = rng.choice(WORDS)
+        r = rng.random() if inline else 1.0
+        if r < 0.04:
+            w = "*" + w + "*"
+        elif r < 0.07:
+            w = "**" + w + "**"
+        elif r < 0.09:
+            w = "`" + w + "()`"
+        elif r < 0.10:
+            w = "[" + w + "](https://example.com/" + w + ")"
+        elif r < 0.11:
+            w = "_" + w + "_"
+        parts.append(w)
+    s = " ".join(parts)
+    return s[0].upper() + s[1:] + rng.choice(( ".", ".", ".", "?", "!", ";" ))
+
+
+def paragraph(rng, n_sentences=None, inline=True):
+    if n_sentences is None:
+        n_sentences = rng.randint(2, 7)
+    text = " ".join(sentence(rng, inline) for _ in range(n_sentences))
+
+    # Wrap the lines at about 78 characters, as humans tend to do.
+    lines = []
+    line = ""
+    for w in text.split(" "):
+        if len(line) + len(w) >= 78:
+            lines.append(line)
+            line = w
+        else:
+            line = (line + " " + w) if line else w
+    lines.append(line)
+    return "\n".join(lines) + "\n\n"
+
+
+def gen_prose(rng):
+    out = []
+    while True:
+        out.append("#" * rng.randint(1, 3) + " " + words(rng, rng.randint(2, 6)).title() + "\n\n")
+        for _ in range(rng.randint(3, 8)):
+            out.append(paragraph(rng))
+            if rng.random() < 0.1:
+                out.append("> " + paragraph(rng, 2).rstrip("\n").replace("\n", "\n> ") + "\n\n")
+        yield "".join(out)
+        out = []
+
+
+def gen_readme(rng):
+    while True:
+        out = []
+        name = rng.choice(WORDS) + "-" + rng.choice(WORDS)
+        out.append("# " + name + "\n\n")
+        for badge in ( "build", "coverage", "license" ):
+            out.append("[![{0}](https://img.example.com/{1}/{0}.svg)](https://ci.example.com/{1})\n".format(badge, name))
+        out.append("\n" + paragraph(rng, 3))
+        out.append("## Installation\n\n")
+        out.append("```sh\ngit clone https://github.com/example/{0}.git\ncd {0}\nmake && sudo make install\n```\n\n".format(name))
+        out.append("## Features\n\n")
+        for _ in range(rng.randint(4, 9)):
+            out.append("* " + sentence(rng) + "\n")
+        out.append("\n## Usage\n\n" + paragraph(rng, 2))
+        out.append("```" + rng.choice(LANGUAGES) + "\n")
+        for _ in range(rng.randint(3, 12)):
+            out.append("    " * rng.randint(0, 2) + words(rng, rng.randint(2, 6)) + "(" + rng.choice(WORDS) + ");\n")
+        out.append("```\n\n")
+        out.append("| Option | Default | Description |\n|--------|:-------:|-------------|\n")
+        for _ in range(rng.randint(3, 8)):
+            out.append("| `--{}` | {} | {} |\n".format(rng.choice(WORDS), rng.randint(0, 100), words(rng, rng.randint(4, 10))))
+        out.append("\n## License\n\nSee <https://opensource.org/licenses/MIT> or contact "
+                   "<maintainer@example.com>.\n\n")
+        yield "".join(out)
+
+
+def gen_tables(rng):
+    while True:
+        n_cols = rng.randint(3, 12)
+        out = []
+        out.append("| " + " | ".join(words(rng, rng.randint(1, 2)) for _ in range(n_cols)) + " |\n")
+        out.append("|" + "|".join(rng.choice(( "---", ":---", "---:", ":---:" )) for _ in range(n_cols)) + "|\n")
+        for _ in range(rng.randint(50, 500)):
+            cells = []
+            for _ in range(n_cols):
+                r = rng.random()
+                if r < 0.4:
+                    cells.append(str(rng.randint(0, 100000)))
+                elif r < 0.5:
+                    cells.append("**" + rng.choice(WORDS) + "**")
+                elif r < 0.55:
+                    cells.append("`a \\| b`")
+                elif r < 0.6:
+                    cells.append("")
+                else:
+                    cells.append(words(rng, rng.randint(1, 4)))
+            out.append("| " + " | ".join(cells) + " |\n")
+        out.append("\n")
+        yield "".join(out)
+
+
+def gen_lists(rng):
+    while True:
+        out = []
+        depth = 0
+        for _ in range(rng.randint(20, 200)):
+            depth = max(0, min(12, depth + rng.choice(( -1, 0, 0, 1, 1 ))))
+            indent = "    " * depth
+            if rng.random() < 0.3:
+                marker = str(rng.randint(1, 9)) + "."
+            else:
+                marker = rng.choice(( "-", "*", "+" ))
+            if depth % 3 == 2  and  rng.random() < 0.3:
+                marker += " [" + rng.choice(( " ", "x" )) + "]"
+            out.append(indent + marker + " " + sentence(rng) + "\n")
+            if rng.random() < 0.15:
+                out.append("\n" + indent + "    " + sentence(rng) + "\n\n")
+        out.append("\n" + paragraph(rng, 1))
+        yield "".join(out)
+
+
+def gen_links(rng):
+    n_refs = 0
+    while True:
+        out = []
+        parts = []
+        for _ in range(rng.randint(20, 60)):
+            w = rng.choice(WORDS)
+            r = rng.random()
+            if r < 0.25:
+                parts.append("[" + w + "][ref" + str(rng.randint(0, n_refs + 20)) + "]")
+            elif r < 0.35:
+                parts.append("[" + w + "]")
+            elif r < 0.5:
+                parts.append("[" + w + "](https://example.com/" + w + "?q=" + str(rng.randint(0, 999)) + " \"" + w + "\")")
+            elif r < 0.55:
+                parts.append("![" + w + "](img/" + w + ".png)")
+            elif r < 0.6:
+                parts.append("<https://example.org/" + w + ">")
+            elif r < 0.65:
+                parts.append("https://www.example.net/" + w)
+            else:
+                parts.append(w)
+        out.append(" ".join(parts) + ".\n\n")
+        for _ in range(rng.randint(5, 20)):
+            out.append("[ref{}]: https://example.com/ref/{} \"Title {}\"\n".format(n_refs, n_refs, n_refs))
+            n_refs += 1
+        for w in rng.sample(WORDS, 3):
+            out.append("[" + w + "]: /wiki/" + w + "\n")
+        out.append("\n")
+        yield "".join(out)
+
+
+def gen_cjk(rng):
+    while True:
+        out = []
+        for _ in range(rng.randint(3, 8)):
+            line = []
+            for _ in range(rng.randint(20, 200)):
+                r = rng.random()
+                if r < 0.08:
+                    line.append(rng.choice(CJK_PUNCT))
+                elif r < 0.1:
+                    line.append("**" + "".join(rng.choice(CJK_CHARS) for _ in range(3)) + "**")
+                elif r < 0.12:
+                    line.append("*" + "".join(rng.choice(CJK_CHARS) for _ in range(2)) + "*")
+                elif r < 0.13:
+                    line.append(" " + rng.choice(WORDS) + " ")
+                else:
+                    line.append(rng.choice(CJK_CHARS))
+            out.append("".join(line) + "\n")
+        out.append("\n")
+        if rng.random() < 0.2:
+            out.append("## " + "".join(rng.choice(CJK_CHARS) for _ in range(6)) + "\n\n")
+        yield "".join(out)
+
+
+def gen_entities(rng):
+    while True:
+        parts = []
+        for _ in range(rng.randint(30, 120)):
+            r = rng.random()
+            if r < 0.35:
+                parts.append(rng.choice(ENTITIES))
+            elif r < 0.45:
+                parts.append("\\" + rng.choice("*_`[]<>&!#\\"))
+            elif r < 0.5:
+                parts.append("a < b & c > d")
+            else:
+                parts.append(rng.choice(WORDS))
+        yield " ".join(parts) + "\n\n"
+
+
+def gen_code(rng):
+    while True:
+        out = []
+        out.append(paragraph(rng, 1))
+        if rng.random() < 0.7:
+            fence = rng.choice(( "```", "~~~", "````" ))
+            out.append(fence + rng.choice(LANGUAGES) + "\n")
+            for _ in range(rng.randint(5, 60)):
+                out.append("    " * rng.randint(0, 3) + rng.choice((
+                        "int {} = {}({}, {});".format(rng.choice(WORDS), rng.choice(WORDS), rng.randint(0, 99), rng.choice(WORDS)),
+                        "if({} < {}) {{".format(rng.choice(WORDS), rng.randint(0, 99)),
+                        "}",
+                        "/* {} */".format(words(rng, 5)),
+                        "return *{} && <{}>;".format(rng.choice(WORDS), rng.choice(WORDS)),
+                        "")) + "\n")
+            out.append(fence + "\n\n")
+        else:
+            for _ in range(rng.randint(3, 20)):
+                out.append("    " + words(rng, rng.randint(2, 8)) + " = [*" + rng.choice(WORDS) + "_];\n")
+            out.append("\n")
+        out.append("Use `" + rng.choice(WORDS) + "()` or ``" + rng.choice(WORDS) + " ` tick`` here.\n\n")
+        yield "".join(out)
+
+
+GENERATORS = (
+    ( "prose.md",       gen_prose ),
+    ( "readme.md",      gen_readme ),
+    ( "tables.md",      gen_tables ),
+    ( "lists.md",       gen_lists ),
+    ( "links.md",       gen_links ),
+    ( "cjk.md",         gen_cjk ),
+    ( "entities.md",    gen_entities ),
+    ( "code.md",        gen_code ),
+)
+
+
+def generate(path, gen, seed, size):
+    rng = random.Random(seed)
+    chunks = []
+    n = 0
+    for chunk in gen(rng):
+        chunks.append(chunk)
+        n += len(chunk.encode("utf-8"))
+        if n >= size:
+            break
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("".join(chunks))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate the corpus for md4c-bench.")
+    parser.add_argument("--size", type=int, default=256,
+            help="approximate size of each document in KB (default 256)")
+    parser.add_argument("output_dir", help="directory to write the documents to")
+    args = parser.parse_args()
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    for seed, (name, gen) in enumerate(GENERATORS):
+        generate(os.path.join(args.output_dir, name), gen, seed + 1, args.size * 1024)
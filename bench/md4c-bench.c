@@ -0,0 +1,576 @@
+/*
+ * MD4C: Markdown parser for C
+ * (https://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2026 Martin Mitáš
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Throughput benchmark of MD4C and MD4C-HTML.
+ *
+ * For each input file, it measures md_parse() (with callbacks doing nothing)
+ * and md_html() (with the output discarded), and counts the allocations
+ * md_parse() makes. Optionally, it measures the overhead of each MD_FLAG_xxx
+ * over plain CommonMark. See bench/run-bench.py for the driver generating
+ * the input corpus and comparing the results with a baseline.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "md4c.h"
+#include "md4c-html.h"
+#include "cmdline.h"
+
+
+
+/* Global options. */
+static unsigned parser_flags = MD_DIALECT_GITHUB;
+static double min_time = 0.2;      /* In seconds, per measurement. */
+static int want_matrix = 0;
+static int want_json = 0;
+
+
+/* All the flags for the overhead matrix. */
+static const struct {
+    const char* name;
+    unsigned flag;
+} flag_list[] = {
+    { "MD_FLAG_COLLAPSEWHITESPACE",         MD_FLAG_COLLAPSEWHITESPACE },
+    { "MD_FLAG_PERMISSIVEATXHEADERS",       MD_FLAG_PERMISSIVEATXHEADERS },
+    { "MD_FLAG_PERMISSIVEURLAUTOLINKS",     MD_FLAG_PERMISSIVEURLAUTOLINKS },
+    { "MD_FLAG_PERMISSIVEEMAILAUTOLINKS",   MD_FLAG_PERMISSIVEEMAILAUTOLINKS },
+    { "MD_FLAG_NOINDENTEDCODEBLOCKS",       MD_FLAG_NOINDENTEDCODEBLOCKS },
+    { "MD_FLAG_NOHTMLBLOCKS",               MD_FLAG_NOHTMLBLOCKS },
+    { "MD_FLAG_NOHTMLSPANS",                MD_FLAG_NOHTMLSPANS },
+    { "MD_FLAG_TABLES",                     MD_FLAG_TABLES },
+    { "MD_FLAG_STRIKETHROUGH",              MD_FLAG_STRIKETHROUGH },
+    { "MD_FLAG_PERMISSIVEWWWAUTOLINKS",     MD_FLAG_PERMISSIVEWWWAUTOLINKS },
+    { "MD_FLAG_TASKLISTS",                  MD_FLAG_TASKLISTS },
+    { "MD_FLAG_LATEXMATHSPANS",             MD_FLAG_LATEXMATHSPANS },
+    { "MD_FLAG_WIKILINKS",                  MD_FLAG_WIKILINKS },
+    { "MD_FLAG_UNDERLINE",                  MD_FLAG_UNDERLINE },
+    { "MD_FLAG_HARD_SOFT_BREAKS",           MD_FLAG_HARD_SOFT_BREAKS },
+    { "MD_FLAG_SPOILERS",                   MD_FLAG_SPOILERS },
+    { "MD_FLAG_SUPERSCRIPTS",               MD_FLAG_SUPERSCRIPTS },
+    { "MD_FLAG_SUBSCRIPTS",                 MD_FLAG_SUBSCRIPTS },
+    { "MD_FLAG_ADMONITIONS",                MD_FLAG_ADMONITIONS },
+    { "MD_FLAG_FOOTNOTES",                  MD_FLAG_FOOTNOTES },
+    { "MD_FLAG_HIGHLIGHT",                  MD_FLAG_HIGHLIGHT },
+    { "MD_FLAG_EARLYBLOCKEMISSION",         MD_FLAG_EARLYBLOCKEMISSION }
+};
+
+#define FLAG_COUNT      (sizeof(flag_list) / sizeof(flag_list[0]))
+
+
+/*************************
+ ***  Input documents  ***
+ *************************/
+
+struct document {
+    const char* path;
+    char* data;
+    size_t size;
+};
+
+static int
+load_document(struct document* doc, const char* path)
+{
+    FILE* f;
+    size_t asize = 64 * 1024;
+    size_t n;
+
+    doc->path = path;
+    doc->size = 0;
+    doc->data = NULL;
+
+    f = fopen(path, "rb");
+    if(f == NULL) {
+        fprintf(stderr, "Cannot open %s.\n", path);
+        return -1;
+    }
+
+    while(1) {
+        if(doc->data == NULL  ||  doc->size >= asize) {
+            char* new_data;
+
+            if(doc->data != NULL)
+                asize += asize / 2;
+            new_data = realloc(doc->data, asize);
+            if(new_data == NULL) {
+                fprintf(stderr, "load_document: realloc() failed.\n");
+                fclose(f);
+                return -1;
+            }
+            doc->data = new_data;
+        }
+
+        n = fread(doc->data + doc->size, 1, asize - doc->size, f);
+        if(n == 0)
+            break;
+        doc->size += n;
+    }
+
+    fclose(f);
+    return 0;
+}
+
+/* Name of the document (the path without directories), for the output. */
+static const char*
+document_name(const struct document* doc)
+{
+    const char* name = doc->path;
+    const char* ptr;
+
+    for(ptr = doc->path; *ptr != '\0'; ptr++) {
+        if(*ptr == '/'  ||  *ptr == '\\')
+            name = ptr + 1;
+    }
+    return name;
+}
+
+
+/*********************
+ ***  Measurement  ***
+ *********************/
+
+static int
+noop_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) type;
+    (void) detail;
+    (void) userdata;
+    return 0;
+}
+
+static int
+noop_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    (void) type;
+    (void) detail;
+    (void) userdata;
+    return 0;
+}
+
+static int
+noop_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    (void) type;
+    (void) text;
+    (void) size;
+    (void) userdata;
+    return 0;
+}
+
+static void
+noop_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    (void) text;
+    (void) size;
+    (void) userdata;
+}
+
+static void
+init_parser(MD_PARSER* parser, unsigned flags)
+{
+    memset(parser, 0, sizeof(MD_PARSER));
+    parser->abi_version = 1;
+    parser->flags = flags;
+    parser->enter_block = noop_block;
+    parser->leave_block = noop_block;
+    parser->enter_span = noop_span;
+    parser->leave_span = noop_span;
+    parser->text = noop_text;
+}
+
+/* Counting allocator. */
+struct alloc_counter {
+    unsigned long n_allocs;
+    unsigned long n_bytes;
+};
+
+static void*
+counting_allocate(size_t size, void* data)
+{
+    struct alloc_counter* counter = (struct alloc_counter*) data;
+
+    counter->n_allocs++;
+    counter->n_bytes += (unsigned long) size;
+    return malloc(size);
+}
+
+static void*
+counting_reallocate(void* ptr, size_t size, void* data)
+{
+    struct alloc_counter* counter = (struct alloc_counter*) data;
+
+    counter->n_allocs++;
+    counter->n_bytes += (unsigned long) size;
+    return realloc(ptr, size);
+}
+
+static void
+counting_release(void* ptr, void* data)
+{
+    (void) data;
+    free(ptr);
+}
+
+/* Each measurement is split into this many rounds, and the fastest one wins.
+ * (Noise from the rest of the system can only make a round slower.) */
+#define MEASURE_ROUNDS      5
+
+/* Run md_parse() (or md_html(), if want_html) over the document repeatedly
+ * for at least min_time / MEASURE_ROUNDS seconds. Returns the time per
+ * iteration in seconds, or a negative value on error. */
+static double
+measure_round(const struct document* doc, unsigned flags, int want_html)
+{
+    MD_PARSER parser;
+    clock_t t0, t1;
+    double elapsed;
+    unsigned long n_iters = 0;
+    int ret;
+
+    init_parser(&parser, flags);
+
+    t0 = clock();
+    do {
+        if(want_html)
+            ret = md_html(doc->data, (MD_SIZE) doc->size, noop_output, NULL, flags, 0);
+        else
+            ret = md_parse(doc->data, (MD_SIZE) doc->size, &parser, NULL);
+        if(ret != 0) {
+            fprintf(stderr, "Parsing %s failed.\n", doc->path);
+            return -1.0;
+        }
+        n_iters++;
+        t1 = clock();
+        elapsed = (double)(t1 - t0) / CLOCKS_PER_SEC;
+    } while(elapsed < min_time / MEASURE_ROUNDS);
+
+    return elapsed / (double) n_iters;
+}
+
+static double
+measure(const struct document* doc, unsigned flags, int want_html)
+{
+    double best = -1.0;
+    double t;
+    int round;
+
+    for(round = 0; round < MEASURE_ROUNDS; round++) {
+        t = measure_round(doc, flags, want_html);
+        if(t < 0.0)
+            return -1.0;
+        if(best < 0.0  ||  t < best)
+            best = t;
+    }
+
+    return best;
+}
+
+/* Measure the overhead (in percents) of md_parse() with the given flags over
+ * md_parse() with base_flags. The rounds of both are interleaved, so that
+ * any slow drift of the machine's speed affects both the same way. */
+static int
+measure_overhead(const struct document* doc, unsigned base_flags, unsigned flags,
+                 double* p_overhead)
+{
+    double best_base = -1.0;
+    double best = -1.0;
+    double t_base, t;
+    int round;
+
+    for(round = 0; round < MEASURE_ROUNDS; round++) {
+        t_base = measure_round(doc, base_flags, 0);
+        t = measure_round(doc, flags, 0);
+        if(t_base < 0.0  ||  t < 0.0)
+            return -1;
+        if(best_base < 0.0  ||  t_base < best_base)
+            best_base = t_base;
+        if(best < 0.0  ||  t < best)
+            best = t;
+    }
+
+    *p_overhead = (best / best_base - 1.0) * 100.0;
+    return 0;
+}
+
+static int
+count_allocs(const struct document* doc, unsigned flags, struct alloc_counter* counter)
+{
+    MD_PARSER parser;
+    MD_ALLOCATOR allocator;
+
+    counter->n_allocs = 0;
+    counter->n_bytes = 0;
+
+    memset(&allocator, 0, sizeof(MD_ALLOCATOR));
+    allocator.allocate = counting_allocate;
+    allocator.reallocate = counting_reallocate;
+    allocator.release = counting_release;
+    allocator.data = counter;
+
+    init_parser(&parser, flags);
+    parser.allocator = &allocator;
+    if(md_parse(doc->data, (MD_SIZE) doc->size, &parser, NULL) != 0) {
+        fprintf(stderr, "Parsing %s failed.\n", doc->path);
+        return -1;
+    }
+    return 0;
+}
+
+
+/*****************
+ ***  Results  ***
+ *****************/
+
+struct result {
+    double parse_time;      /* Per iteration, in seconds. */
+    double html_time;
+    struct alloc_counter allocs;
+    double overhead[FLAG_COUNT];    /* In percents, if want_matrix. */
+};
+
+static double
+mb_per_s(const struct document* doc, double t)
+{
+    return (double) doc->size / t / 1e6;
+}
+
+static double
+ns_per_byte(const struct document* doc, double t)
+{
+    return t * 1e9 / (double) doc->size;
+}
+
+static int
+bench_document(const struct document* doc, struct result* res)
+{
+    unsigned i;
+
+    res->parse_time = measure(doc, parser_flags, 0);
+    res->html_time = measure(doc, parser_flags, 1);
+    if(res->parse_time < 0.0  ||  res->html_time < 0.0)
+        return -1;
+    if(count_allocs(doc, parser_flags, &res->allocs) != 0)
+        return -1;
+
+    if(want_matrix) {
+        for(i = 0; i < FLAG_COUNT; i++) {
+            if(measure_overhead(doc, MD_DIALECT_COMMONMARK, flag_list[i].flag,
+                                &res->overhead[i]) != 0)
+                return -1;
+        }
+    }
+
+    return 0;
+}
+
+static void
+print_text(const struct document* docs, const struct result* results, int n_docs)
+{
+    int i;
+    unsigned j;
+
+    printf("Parser flags: 0x%x, min. time per measurement: %.2f s\n\n",
+                parser_flags, min_time);
+    printf("%-16s %10s %9s %9s %9s %9s %9s %11s\n", "document", "size [B]",
+                "parse", "parse", "html", "html", "allocs", "alloc");
+    printf("%-16s %10s %9s %9s %9s %9s %9s %11s\n", "", "",
+                "[MB/s]", "[ns/B]", "[MB/s]", "[ns/B]", "", "[B]");
+    for(i = 0; i < n_docs; i++) {
+        const struct document* doc = &docs[i];
+        const struct result* res = &results[i];
+
+        printf("%-16s %10lu %9.2f %9.3f %9.2f %9.3f %9lu %11lu\n",
+                document_name(doc), (unsigned long) doc->size,
+                mb_per_s(doc, res->parse_time), ns_per_byte(doc, res->parse_time),
+                mb_per_s(doc, res->html_time), ns_per_byte(doc, res->html_time),
+                res->allocs.n_allocs, res->allocs.n_bytes);
+    }
+
+    if(!want_matrix)
+        return;
+
+    printf("\nOverhead of md_parse() with the flag over CommonMark [%%]:\n\n");
+    printf("%-34s", "flag");
+    for(i = 0; i < n_docs; i++)
+        printf(" %11.11s", document_name(&docs[i]));
+    printf("\n");
+    for(j = 0; j < FLAG_COUNT; j++) {
+        printf("%-34s", flag_list[j].name);
+        for(i = 0; i < n_docs; i++)
+            printf(" %+11.1f", results[i].overhead[j]);
+        printf("\n");
+    }
+}
+
+static void
+print_json(const struct document* docs, const struct result* results, int n_docs)
+{
+    int i;
+    unsigned j;
+
+    /* Note the document names come from the file names we generate, so they
+     * need no escaping. */
+    printf("{\n");
+    printf("  \"parser_flags\": %u,\n", parser_flags);
+    printf("  \"documents\": {\n");
+    for(i = 0; i < n_docs; i++) {
+        const struct document* doc = &docs[i];
+        const struct result* res = &results[i];
+
+        printf("    \"%s\": {\n", document_name(doc));
+        printf("      \"size\": %lu,\n", (unsigned long) doc->size);
+        printf("      \"parse_mb_per_s\": %.3f,\n", mb_per_s(doc, res->parse_time));
+        printf("      \"parse_ns_per_byte\": %.4f,\n", ns_per_byte(doc, res->parse_time));
+        printf("      \"html_mb_per_s\": %.3f,\n", mb_per_s(doc, res->html_time));
+        printf("      \"html_ns_per_byte\": %.4f,\n", ns_per_byte(doc, res->html_time));
+        printf("      \"allocs\": %lu,\n", res->allocs.n_allocs);
+        printf("      \"alloc_bytes\": %lu", res->allocs.n_bytes);
+        if(want_matrix) {
+            printf(",\n      \"flag_overhead_percent\": {\n");
+            for(j = 0; j < FLAG_COUNT; j++) {
+                printf("        \"%s\": %.2f%s\n", flag_list[j].name,
+                        res->overhead[j], (j + 1 < FLAG_COUNT) ? "," : "");
+            }
+            printf("      }");
+        }
+        printf("\n    }%s\n", (i + 1 < n_docs) ? "," : "");
+    }
+    printf("  }\n");
+    printf("}\n");
+}
+
+
+/**********************
+ ***  Main program  ***
+ **********************/
+
+static const CMDLINE_OPTION cmdline_options[] = {
+    { 'F', "flags",                         'F', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 't', "min-time",                      't', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'm', "matrix",                        'm', 0 },
+    { 'j', "json",                          'j', 0 },
+    { 'h', "help",                          'h', 0 },
+    {  0,  NULL,                             0,  0 }
+};
+
+static void
+usage(void)
+{
+    printf(
+        "Usage: md4c-bench [OPTION]... FILE...\n"
+        "Measure throughput of MD4C on the given Markdown files.\n"
+        "\n"
+        "Options:\n"
+        "  -F, --flags=FLAGS    Parser flags (default is MD_DIALECT_GITHUB)\n"
+        "  -t, --min-time=SEC   Minimal time of each measurement (default 0.2)\n"
+        "  -m, --matrix         Measure also overhead of each MD_FLAG_xxx\n"
+        "  -j, --json           Output the results as JSON\n"
+        "  -h, --help           Display this help and exit\n"
+        "\n"
+    );
+}
+
+static const char** input_paths = NULL;
+static int n_input_paths = 0;
+
+static int
+cmdline_callback(int opt, char const* value, void* data)
+{
+    (void) data;   /* unused parameter */
+
+    switch(opt) {
+        case 0:     input_paths[n_input_paths++] = value; break;
+        case 'F':   parser_flags = (unsigned) strtoul(value, NULL, 0); break;
+        case 't':   min_time = atof(value); break;
+        case 'm':   want_matrix = 1; break;
+        case 'j':   want_json = 1; break;
+        case 'h':   usage(); exit(0); break;
+
+        default:
+            fprintf(stderr, "Illegal option: %s\n", value);
+            fprintf(stderr, "Use --help for more info.\n");
+            exit(1);
+            break;
+    }
+
+    return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+    struct document* docs;
+    struct result* results;
+    int i;
+    int ret = 0;
+
+    /* There cannot be more input files than arguments. */
+    input_paths = (const char**) malloc(argc * sizeof(const char*));
+    docs = (struct document*) calloc(argc, sizeof(struct document));
+    results = (struct result*) calloc(argc, sizeof(struct result));
+    if(input_paths == NULL  ||  docs == NULL  ||  results == NULL) {
+        fprintf(stderr, "malloc() failed.\n");
+        exit(1);
+    }
+
+    if(cmdline_read(cmdline_options, argc, argv, cmdline_callback, NULL) != 0) {
+        usage();
+        exit(1);
+    }
+    if(n_input_paths == 0) {
+        usage();
+        exit(1);
+    }
+
+    for(i = 0; i < n_input_paths; i++) {
+        if(load_document(&docs[i], input_paths[i]) != 0) {
+            ret = 1;
+            goto out;
+        }
+        if(!want_json) {
+            fprintf(stderr, "Measuring %s...\n", document_name(&docs[i]));
+            fflush(stderr);
+        }
+        if(bench_document(&docs[i], &results[i]) != 0) {
+            ret = 1;
+            goto out;
+        }
+    }
+
+    if(want_json)
+        print_json(docs, results, n_input_paths);
+    else
+        print_text(docs, results, n_input_paths);
+
+out:
+    for(i = 0; i < n_input_paths; i++)
+        free(docs[i].data);
+    free(docs);
+    free(results);
+    free(input_paths);
+    return ret;
+}
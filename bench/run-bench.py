@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+
+# Run md4c-bench over the generated corpus and report the results.
+#
+# Usage (from the build directory):
+#   run-bench.py [--matrix] [--update-baseline | --compare] [--tolerance PERCENT] ...
+#
+# Optionally, the results may be compared with a baseline. The throughput
+# depends on the machine, so there is no baseline shipped with MD4C: Run this
+# with --update-baseline on your machine before making the change you want to
+# evaluate, and with --compare after it. (The baseline is stored in
+# baseline.json in the current directory unless --baseline says otherwise.)
+#
+# Exit code is non-zero if md4c-bench fails or, with --compare, if any
+# document got slower by more than the tolerance or if md_parse() makes more
+# allocations for it than before.
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+
+argv0_dir = os.path.dirname(os.path.abspath(sys.argv[0]))
+
+# (key, label, True if higher is better)
+METRICS = (
+    ( "parse_ns_per_byte",  "parse [ns/B]",     False ),
+    ( "html_ns_per_byte",   "html [ns/B]",      False ),
+    ( "allocs",             "allocs",           False ),
+)
+
+
+def run_harness(args, corpus_files):
+    cmd = [ args.harness, "--json", "--min-time=" + str(args.min_time) ]
+    if args.flags is not None:
+        cmd.append("--flags=" + args.flags)
+    if args.matrix:
+        cmd.append("--matrix")
+    cmd += corpus_files
+    p = subprocess.run(cmd, stdout=subprocess.PIPE, universal_newlines=True)
+    if p.returncode != 0:
+        sys.exit("md4c-bench failed.")
+    return json.loads(p.stdout)
+
+
+def print_results(results):
+    docs = results["documents"]
+    print("{:<16} {:>10} {:>9} {:>9} {:>9} {:>9} {:>9}".format(
+            "document", "size [B]", "parse", "parse", "html", "html", "allocs"))
+    print("{:<16} {:>10} {:>9} {:>9} {:>9} {:>9} {:>9}".format(
+            "", "", "[MB/s]", "[ns/B]", "[MB/s]", "[ns/B]", ""))
+    for name, d in docs.items():
+        print("{:<16} {:>10} {:>9.2f} {:>9.3f} {:>9.2f} {:>9.3f} {:>9}".format(
+                name, d["size"], d["parse_mb_per_s"], d["parse_ns_per_byte"],
+                d["html_mb_per_s"], d["html_ns_per_byte"], d["allocs"]))
+
+    names = [ name for name, d in docs.items() if "flag_overhead_percent" in d ]
+    if names:
+        print()
+        print("Overhead of md_parse() with the flag over CommonMark [%]:")
+        print()
+        flags = list(docs[names[0]]["flag_overhead_percent"].keys())
+        print("{:<34}".format("flag") + "".join(" {:>11.11}".format(n) for n in names))
+        for flag in flags:
+            print("{:<34}".format(flag) + "".join(
+                    " {:>+11.1f}".format(docs[n]["flag_overhead_percent"][flag]) for n in names))
+
+
+def compare(results, baseline, tolerance):
+    n_regressions = 0
+
+    if results.get("parser_flags") != baseline.get("parser_flags"):
+        print("Warning: The baseline has been measured with different parser flags.")
+
+    print("Comparison with the baseline (tolerance {}%):".format(tolerance))
+    print()
+    print("{:<16} {:<14} {:>12} {:>12} {:>9}".format("document", "metric", "baseline", "now", "change"))
+    for name, d in results["documents"].items():
+        b = baseline["documents"].get(name)
+        if b is None:
+            print("{:<16} (not in the baseline)".format(name))
+            continue
+        if b.get("size") != d.get("size"):
+            print("{:<16} (different document size; regenerate the baseline)".format(name))
+            continue
+        for key, label, higher_is_better in METRICS:
+            old = b[key]
+            new = d[key]
+            change = (new / old - 1.0) * 100.0 if old else 0.0
+            if higher_is_better:
+                change = -change
+
+            verdict = ""
+            if key == "allocs":
+                if new > old:
+                    verdict = "REGRESSION"
+            elif change > tolerance:
+                verdict = "REGRESSION"
+            elif change < -tolerance:
+                verdict = "improvement"
+            if verdict == "REGRESSION":
+                n_regressions += 1
+
+            print("{:<16} {:<14} {:>12.4g} {:>12.4g} {:>+8.1f}% {}".format(
+                    name, label, old, new, change, verdict))
+
+    print()
+    return n_regressions
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Run MD4C throughput benchmark.")
+    parser.add_argument("-H", "--harness", default=os.path.join("bench", "md4c-bench"),
+            help="path to md4c-bench (default bench/md4c-bench)")
+    parser.add_argument("-c", "--corpus-dir", default="bench-corpus",
+            help="directory for the generated corpus (default bench-corpus)")
+    parser.add_argument("-s", "--size", type=int, default=256,
+            help="approximate size of each document in KB (default 256)")
+    parser.add_argument("-b", "--baseline", default="baseline.json",
+            help="baseline JSON file (default baseline.json)")
+    parser.add_argument("-r", "--results", default=None,
+            help="write the results as JSON to this file")
+    parser.add_argument("-F", "--flags", default=None,
+            help="parser flags (default is MD_DIALECT_GITHUB)")
+    parser.add_argument("-t", "--min-time", type=float, default=0.2,
+            help="minimal time of each measurement in seconds (default 0.2)")
+    parser.add_argument("-m", "--matrix", action="store_true",
+            help="measure also overhead of each MD_FLAG_xxx")
+    parser.add_argument("-T", "--tolerance", type=float, default=10.0,
+            help="slowdown in percent considered as a regression (default 10)")
+    parser.add_argument("-u", "--update-baseline", action="store_true",
+            help="store the results as the new baseline")
+    parser.add_argument("-C", "--compare", action="store_true",
+            help="compare the results with the baseline")
+    args = parser.parse_args()
+    if args.update_baseline  and  args.compare:
+        parser.error("--update-baseline and --compare are mutually exclusive")
+
+    subprocess.run([ sys.executable, os.path.join(argv0_dir, "gen-corpus.py"),
+                     "--size", str(args.size), args.corpus_dir ], check=True)
+    corpus_files = sorted(os.path.join(args.corpus_dir, f)
+                          for f in os.listdir(args.corpus_dir) if f.endswith(".md"))
+
+    results = run_harness(args, corpus_files)
+    print_results(results)
+    print()
+
+    if args.results is not None:
+        with open(args.results, "w") as f:
+            json.dump(results, f, indent=2)
+            f.write("\n")
+
+    if args.update_baseline:
+        with open(args.baseline, "w") as f:
+            json.dump(results, f, indent=2)
+            f.write("\n")
+        print("Baseline {} updated.".format(args.baseline))
+        sys.exit(0)
+
+    if not args.compare:
+        sys.exit(0)
+
+    if not os.path.exists(args.baseline):
+        sys.exit("No baseline {} to compare with (use --update-baseline to create it).".format(args.baseline))
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    n_regressions = compare(results, baseline, args.tolerance)
+    if n_regressions > 0:
+        print("{} regression(s) found.".format(n_regressions))
+        sys.exit(1)
+    print("No regressions found.")
@@ -44,6 +44,8 @@ static int want_fullhtml = 0;
 static int want_xhtml = 0;
 static int want_stat = 0;
 static int want_replay_fuzz = 0;
+static int want_profile_blocks = 0;
+static double profile_threshold = 0.0;     /* In seconds. */
 
 static const char* html_title = NULL;
 static const char* css_path = NULL;
@@ -113,22 +115,128 @@ membuf_append(struct membuffer* buf, const char* data, MD_SIZE size)
 }
 
 
-/**********************
- ***  Main program  ***
- **********************/
+/*************************
+ ***  Block profiling  ***
+ *************************/
+
+/* With --profile-blocks, we render via md_html_render_events() so that we can
+ * plug MD_BLOCK_PROFILER into the parser, and we remember the slowest blocks
+ * reported by it.
+ */
+
+#define PROFILE_MAX_BLOCKS      10
+
+struct profile {
+    MD_BLOCK_PROFILER profiler;
+    const MD_CHAR* input;
+    MD_SIZE input_size;
+    unsigned parser_flags;
+
+    /* The slowest blocks, sorted by their time (slowest first). */
+    MD_BLOCK_PROFILE blocks[PROFILE_MAX_BLOCKS];
+    unsigned n_blocks;
+    unsigned n_slow_blocks;
+};
+
+static void
+profile_slow_block(const MD_BLOCK_PROFILE* block, void* data)
+{
+    struct profile* prof = (struct profile*) data;
+    unsigned i;
+
+    prof->n_slow_blocks++;
+
+    if(prof->n_blocks < PROFILE_MAX_BLOCKS)
+        prof->n_blocks++;
+    else if(block->time <= prof->blocks[PROFILE_MAX_BLOCKS-1].time)
+        return;
+
+    for(i = prof->n_blocks - 1; i > 0  &&  prof->blocks[i-1].time < block->time; i--)
+        prof->blocks[i] = prof->blocks[i-1];
+    prof->blocks[i] = *block;
+}
+
+static int
+profile_produce(const MD_PARSER* renderer_parser, void* parser_userdata, void* source)
+{
+    struct profile* prof = (struct profile*) source;
+    MD_PARSER parser = *renderer_parser;
+
+    parser.abi_version = 1;
+    parser.flags = prof->parser_flags;
+    parser.block_profiler = &prof->profiler;
+    return md_parse(prof->input, prof->input_size, &parser, parser_userdata);
+}
 
 static void
-process_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
+profile_process_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
 {
     membuf_append((struct membuffer*) userdata, text, size);
 }
 
+static const char*
+profile_block_type_name(MD_BLOCKTYPE type)
+{
+    switch(type) {
+        case MD_BLOCK_HR:       return "hr";
+        case MD_BLOCK_H:        return "h";
+        case MD_BLOCK_CODE:     return "code";
+        case MD_BLOCK_HTML:     return "html";
+        case MD_BLOCK_P:        return "p";
+        case MD_BLOCK_TABLE:    return "table";
+        default:                return "?";
+    }
+}
+
+/* Param offset is the offset of prof->input in the input file. */
+static void
+profile_report(const struct profile* prof, MD_SIZE offset)
+{
+    unsigned i;
+
+    fprintf(stderr, "Blocks slower than %.3f ms: %u\n",
+                profile_threshold * 1e3, prof->n_slow_blocks);
+    if(prof->n_blocks == 0)
+        return;
+
+    fprintf(stderr, "%10s  %-5s  %-21s  %6s  %8s  %8s  %6s\n",
+                "time [ms]", "type", "offsets", "line", "lines", "marks", "passes");
+    for(i = 0; i < prof->n_blocks; i++) {
+        const MD_BLOCK_PROFILE* block = &prof->blocks[i];
+        const MD_CHAR* ptr;
+        unsigned line_no = 1;
+        char offsets[32];
+
+        /* Counting the lines from the start for each block is not a problem
+         * for the few blocks we report. */
+        for(ptr = prof->input; ptr < prof->input + block->beg; ptr++) {
+            if(*ptr == '\n')
+                line_no++;
+        }
+
+        sprintf(offsets, "%u-%u", (unsigned)(offset + block->beg),
+                    (unsigned)(offset + block->end));
+        fprintf(stderr, "%10.3f  %-5s  %-21s  %6u  %8u  %8u  %6u\n",
+                    block->time * 1e3, profile_block_type_name(block->type),
+                    offsets, line_no, (unsigned) block->n_lines,
+                    block->n_marks, block->n_passes);
+    }
+}
+
+
+/**********************
+ ***  Main program  ***
+ **********************/
+
 static int
 process_file(const char* in_path, FILE* in, FILE* out)
 {
     size_t n;
     struct membuffer buf_in = {0};
     struct membuffer buf_out = {0};
+    struct profile prof;
+    MD_CHAR* out_data = NULL;
+    MD_SIZE out_size = 0;
     int ret = -1;
     clock_t t0, t1;
     unsigned p_flags = parser_flags;
@@ -147,10 +255,6 @@ process_file(const char* in_path, FILE* in, FILE* out)
         buf_in.size += n;
     }
 
-    /* Input size is good estimation of output size. Add some more reserve to
-     * deal with the HTML header/footer and tags. */
-    membuf_init(&buf_out, (MD_SIZE)(buf_in.size + buf_in.size/8 + 64));
-
     /* Special mode for reproducing a test case found with a fuzzing tool.
      * We assume file the same file format as produced by the fuzzer implemented
      * in test/fuzzers/fuzz-mdhtml.c. */
@@ -171,12 +275,40 @@ process_file(const char* in_path, FILE* in, FILE* out)
         buf_in.size -= 2 * sizeof(unsigned);
     }
 
-    /* Parse the document. This shall call our callbacks provided via the
-     * md_renderer_t structure. */
+    if(want_profile_blocks) {
+        memset(&prof, 0, sizeof(prof));
+        prof.profiler.slow_block = profile_slow_block;
+        prof.profiler.threshold = profile_threshold;
+        prof.profiler.data = &prof;
+        prof.input = buf_in.data;
+        prof.input_size = (MD_SIZE) buf_in.size;
+        prof.parser_flags = p_flags;
+
+        /* md_html_render_events() does not skip the BOM on its own. */
+        if((r_flags & MD_HTML_FLAG_SKIP_UTF8_BOM)  &&  sizeof(MD_CHAR) == 1  &&
+           buf_in.size >= 3  &&  memcmp(buf_in.data, "\xef\xbb\xbf", 3) == 0)
+        {
+            prof.input += 3;
+            prof.input_size -= 3;
+        }
+
+        membuf_init(&buf_out, (MD_SIZE)(buf_in.size + buf_in.size/8 + 64));
+    }
+
+    /* Parse the document. The renderer writes the output directly into
+     * a buffer it allocates (with a size estimated from the input size). */
     t0 = clock();
 
-    ret = md_html(buf_in.data, (MD_SIZE)buf_in.size, process_output,
-                (void*) &buf_out, p_flags, r_flags);
+    if(want_profile_blocks) {
+        ret = md_html_render_events(profile_produce, &prof,
+                    profile_process_output, &buf_out, r_flags);
+        out_data = buf_out.data;
+        out_size = (MD_SIZE) buf_out.size;
+        buf_out.data = NULL;
+    } else {
+        ret = md_html_to_new_buffer(buf_in.data, (MD_SIZE)buf_in.size,
+                    &out_data, &out_size, p_flags, r_flags);
+    }
 
     t1 = clock();
     if(ret != 0) {
@@ -208,7 +340,7 @@ process_file(const char* in_path, FILE* in, FILE* out)
         fprintf(out, "<body>\n");
     }
 
-    fwrite(buf_out.data, 1, buf_out.size, out);
+    fwrite(out_data, 1, out_size, out);
 
     if(want_fullhtml) {
         fprintf(out, "</body>\n");
@@ -225,12 +357,16 @@ process_file(const char* in_path, FILE* in, FILE* out)
         }
     }
 
+    if(want_profile_blocks)
+        profile_report(&prof, (MD_SIZE)(prof.input - buf_in.data));
+
     /* Success if we have reached here. */
     ret = 0;
 
 out:
     membuf_fini(&buf_in);
     membuf_fini(&buf_out);
+    free(out_data);
 
     return ret;
 }
@@ -241,6 +377,7 @@ static const CMDLINE_OPTION cmdline_options[] = {
     { 'f', "full-html",                     'f', 0 },
     { 'x', "xhtml",                         'x', 0 },
     { 's', "stat",                          's', 0 },
+    {  0,  "profile-blocks",                'p', CMDLINE_OPTFLAG_OPTIONALARG },
     { 'h', "help",                          'h', 0 },
     { 'v', "version",                       'v', 0 },
 
@@ -253,6 +390,7 @@ static const CMDLINE_OPTION cmdline_options[] = {
 
     {  0,  "fadmonitions",                  'D', 0 },
     {  0,  "fcollapse-whitespace",          'W', 0 },
+    {  0,  "fearly-block-emission",         'Y', 0 },
     {  0,  "ffootnotes",                    'N', 0 },
     {  0,  "fhard-soft-breaks",             'B', 0 },
     {  0,  "fhighlight",                    'M', 0 },
@@ -295,6 +433,9 @@ usage(void)
         "  -f, --full-html      Generate full HTML document, including header\n"
         "  -x, --xhtml          Generate XHTML instead of HTML\n"
         "  -s, --stat           Measure time of input parsing\n"
+        "      --profile-blocks[=MS]\n"
+        "                       Report the slowest blocks (taking at least MS\n"
+        "                       milliseconds) with their offsets in the input\n"
         "  -h, --help           Display this help and exit\n"
         "  -v, --version        Display version and exit\n"
         "\n"
@@ -308,6 +449,8 @@ usage(void)
         "      --fadmonitions   Enable admonitions\n"
         "      --fcollapse-whitespace\n"
         "                       Collapse non-trivial whitespace\n"
+        "      --fearly-block-emission\n"
+        "                       Emit blocks early; definitions apply only to links after them\n"
         "      --ffootnotes     Enable footnote references ([^label])\n"
         "      --fhard-soft-breaks\n"
         "                       Force all soft breaks to act as hard breaks\n"
@@ -379,6 +522,10 @@ cmdline_callback(int opt, char const* value, void* data)
         case 'f':   want_fullhtml = 1; break;
         case 'x':   want_xhtml = 1; renderer_flags |= MD_HTML_FLAG_XHTML; break;
         case 's':   want_stat = 1; break;
+        case 'p':   want_profile_blocks = 1;
+                    if(value != NULL)
+                        profile_threshold = atof(value) / 1e3;
+                    break;
         case 'r':   want_replay_fuzz = 1; break;
         case 'h':   usage(); exit(0); break;
         case 'v':   version(); exit(0); break;
@@ -398,6 +545,7 @@ cmdline_callback(int opt, char const* value, void* data)
         case 'G':   parser_flags |= MD_FLAG_NOHTMLSPANS; break;
         case 'H':   parser_flags |= MD_FLAG_NOHTML; break;
         case 'W':   parser_flags |= MD_FLAG_COLLAPSEWHITESPACE; break;
+        case 'Y':   parser_flags |= MD_FLAG_EARLYBLOCKEMISSION; break;
         case 'U':   parser_flags |= MD_FLAG_PERMISSIVEURLAUTOLINKS; break;
         case '.':   parser_flags |= MD_FLAG_PERMISSIVEWWWAUTOLINKS; break;
         case '@':   parser_flags |= MD_FLAG_PERMISSIVEEMAILAUTOLINKS; break;
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+
+# Generate md4c_all.c, a single translation unit containing MD4C and MD4C-HTML.
+#
+# Usage: build_amalgamation.py SRC_DIR OUTPUT_FILE
+#
+# Compiling everything together allows the compiler to inline the HTML
+# renderer's callbacks into the parser (see MD_CALL() in md4c.c). The public
+# headers md4c.h and md4c-html.h are still needed to use it; private headers
+# are pasted in.
+#
+# MD4C-HTML goes first so that its callbacks are already defined when the
+# parser calls them. As each of the source files is written as a stand-alone
+# unit, the macros it defines are #undef-ed after it (with the exception of
+# MD4C_xxx ones, which are meant to be seen by the files which follow).
+
+import os
+import re
+import sys
+
+
+if len(sys.argv) != 3:
+    print("Usage: {} SRC_DIR OUTPUT_FILE".format(sys.argv[0]), file=sys.stderr)
+    sys.exit(1)
+
+src_dir = sys.argv[1]
+out_path = sys.argv[2]
+
+public_headers = [ "md4c.h", "md4c-html.h" ]
+sources = [ "entity.c", "md4c-html.c", "md4c.c" ]
+
+include_re = re.compile(r'^\s*#\s*include\s+"([^"]+)"')
+define_re = re.compile(r'^\s*#\s*define\s+([A-Za-z_][A-Za-z0-9_]*)')
+
+
+def read_file(name):
+    with open(os.path.join(src_dir, name), "r", encoding="utf-8") as f:
+        return f.read().splitlines()
+
+
+def paste_file(name, out, pasted_headers):
+    lines = []
+    defines = []
+
+    for line_no, line in enumerate(read_file(name), 1):
+        m = include_re.match(line)
+        if m is not None:
+            header = m.group(1)
+            if header in public_headers:
+                lines.append(line)
+            elif header not in pasted_headers:
+                pasted_headers.add(header)
+                lines.append("#line 1 \"{}\"".format(header))
+                lines += read_file(header)
+                lines.append("#line {} \"{}\"".format(line_no + 1, name))
+            else:
+                lines.append("")
+            continue
+
+        m = define_re.match(line)
+        if m is not None  and  not m.group(1).startswith("MD4C_")  \
+                          and  m.group(1) not in defines:
+            defines.append(m.group(1))
+        lines.append(line)
+
+    out.write("\n/* Begin of {} */\n".format(name))
+    out.write("#line 1 \"{}\"\n".format(name))
+    out.write("\n".join(lines))
+    out.write("\n\n/* End of {} */\n".format(name))
+    for d in defines:
+        out.write("#undef {}\n".format(d))
+
+
+with open(out_path, "w", encoding="utf-8", newline="\n") as out:
+    pasted_headers = set()
+
+    out.write("/* Generated by scripts/build_amalgamation.py. Do not edit. */\n")
+    out.write("\n")
+    out.write("#define MD4C_AMALGAMATION    1\n")
+    for name in sources:
+        paste_file(name, out, pasted_headers)
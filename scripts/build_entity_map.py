@@ -6,10 +6,14 @@ import json
 import urllib.request
 
 
-url_str = "https://html.spec.whatwg.org/entities.json"
-
-with urllib.request.urlopen(url_str) as url:
-    entities = json.load(url)
+# Optionally, a local copy of the JSON may be given on the command line.
+if len(sys.argv) > 1:
+    with open(sys.argv[1], "r") as f:
+        entities = json.load(f)
+else:
+    url_str = "https://html.spec.whatwg.org/entities.json"
+    with urllib.request.urlopen(url_str) as url:
+        entities = json.load(url)
 
 records = []
 
@@ -27,11 +31,62 @@ for name in entities:
     while len(codepoints) < 2:
         codepoints.append(0)
 
-    codepoints_str = map(str, codepoints)
-    records.append("    { \"" + name + "\", { " + ", ".join(codepoints_str) + " } }")
+    records.append((name, codepoints))
 
 records.sort()
 
+
+# Minimal perfect hash ("hash and displace"): Each name falls into a bucket
+# given by entity_hash(0, name) % BUCKET_COUNT. The bucket's seed then gives
+# the final slot entity_hash(seed, name) % len(records), unique for each name.
+# Keep this in sync with entity_hash() in src/entity.c.
+def entity_hash(seed, name):
+    h = (0x811c9dc5 ^ seed) & 0xffffffff
+    for b in name.encode("utf-8"):
+        h ^= b
+        h = (h * 0x01000193) & 0xffffffff
+    return h
+
+N = len(records)
+BUCKET_COUNT = (N + 3) // 4
+MAX_SEED = 0xffff
+
+buckets = [ list() for i in range(BUCKET_COUNT) ]
+for record in records:
+    buckets[entity_hash(0, record[0]) % BUCKET_COUNT].append(record)
+
+seeds = [ 0 ] * BUCKET_COUNT
+slots = [ None ] * N
+for bucket_index in sorted(range(BUCKET_COUNT), key = lambda i: -len(buckets[i])):
+    bucket = buckets[bucket_index]
+    if not bucket:
+        break
+    for seed in range(1, MAX_SEED + 1):
+        bucket_slots = [ entity_hash(seed, record[0]) % N for record in bucket ]
+        if len(set(bucket_slots)) == len(bucket_slots) and \
+                all(slots[slot] is None for slot in bucket_slots):
+            break
+    else:
+        print('Failed to find a seed for the bucket {}.'.format(bucket_index), file=sys.stderr)
+        sys.exit(1)
+    seeds[bucket_index] = seed
+    for slot, record in zip(bucket_slots, bucket):
+        slots[slot] = record
+
+
+def utf8_str(codepoints):
+    utf8 = "".join(chr(cp) for cp in codepoints if cp != 0).encode("utf-8")
+    return "\"" + "".join("\\x{:02x}".format(b) for b in utf8) + "\", " + str(len(utf8))
+
+sys.stdout.write("#define ENTITY_BUCKET_COUNT    {}\n\n".format(BUCKET_COUNT))
+sys.stdout.write("static const unsigned short ENTITY_SEEDS[] = {\n")
+lines = []
+for i in range(0, BUCKET_COUNT, 16):
+    lines.append("    " + ", ".join(str(seed) for seed in seeds[i:i+16]))
+sys.stdout.write(",\n".join(lines))
+sys.stdout.write("\n};\n\n")
+
 sys.stdout.write("static const ENTITY ENTITY_MAP[] = {\n")
-sys.stdout.write(",\n".join(records))
+sys.stdout.write(",\n".join("    { \"" + name + "\", { " + ", ".join(map(str, codepoints)) + " }, " +
+                            utf8_str(codepoints) + " }" for name, codepoints in slots))
 sys.stdout.write("\n};\n\n")
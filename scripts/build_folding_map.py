@@ -35,86 +35,47 @@ for line in f:
 f.close()
 
 
-# If we assume that (index0 ... index-1) makes a range (as defined below),
-# check that the newly provided index is compatible with the range too; i.e.
-# verify that the range can be extended without breaking its properties.
-#
-# Currently, we can handle ranges which:
-#
-# (1) either form consecutive sequence of codepoints and which map that range
-#     to other consecutive range of codepoints (of the same length);
-#
-# (2) or a consecutive sequence of codepoints with step 2 where each codepoint
-#     CP is mapped to the codepoint CP+1
-#     (e.g. 0x1234 -> 0x1235; 0x1236 -> 0x1237; 0x1238 -> 0x1239; ...).
-#
-# Note: When the codepoints in the range are mapped to multiple codepoints,
-# only the 1st mapped codepoint is considered. All the other ones have to be
-# shared by all the mappings covered by the range.
-def is_range_compatible(folding, codepoint_list, index0, index):
-    N = index - index0
-    codepoint0 = codepoint_list[index0]
-    codepoint1 = codepoint_list[index0+1]
-    codepointN = codepoint_list[index]
-    mapping0 = folding[codepoint0]
-    mapping1 = folding[codepoint1]
-    mappingN = folding[codepointN]
-
-    # Check the range type (1):
-    if codepoint1 - codepoint0 == 1 and codepointN - codepoint0 == N                \
-            and mapping1[0] - mapping0[0] == 1 and mapping1[1:] == mapping0[1:]     \
-            and mappingN[0] - mapping0[0] == N and mappingN[1:] == mapping0[1:]:
-        return True
-
-    # Check the range type (2):
-    if codepoint1 - codepoint0 == 2 and codepointN - codepoint0 == 2 * N            \
-            and mapping0[0] - codepoint0 == 1                                       \
-            and mapping1[0] - codepoint1 == 1 and mapping1[1:] == mapping0[1:]      \
-            and mappingN[0] - codepointN == 1 and mappingN[1:] == mapping0[1:]:
-        return True
-
-    return False
-
-
-def mapping_str(list, mapping):
-    return ",".join("0x{:04x}".format(x) for x in mapping)
-
+# Build direct-indexed two-stage lookup table: The 1st stage maps each block
+# of 64 codepoints to an index of its record in the 2nd stage. Blocks with the
+# same contents (e.g. those without any folding) share the record. Each record
+# has 64 16-bit entries, one for each codepoint in the block: Zero if the
+# codepoint has no folding, or (N << 14) | I where N is the length of its
+# folding and I is an index of the folding in the FOLD_MAP_<N>_DATA[] array.
+BLOCK_SHIFT = 6
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+data_list = [ list(), list(), list() ]
+entry_map = dict()
 for mapping_len in range(1, 4):
     folding = folding_list[mapping_len-1]
-    codepoint_list = list(folding)
-
-    index0 = 0
-    count = len(folding)
-
-    records = list()
-    data_records = list()
-
-    while index0 < count:
-        index1 = index0 + 1
-        while index1 < count and is_range_compatible(folding, codepoint_list, index0, index1):
-            index1 += 1
-
-        if index1 - index0 > 2:
-            # Range of codepoints
-            records.append("R(0x{:04x},0x{:04x})".format(codepoint_list[index0], codepoint_list[index1-1]))
-            data_records.append(mapping_str(data_records, folding[codepoint_list[index0]]))
-            data_records.append(mapping_str(data_records, folding[codepoint_list[index1-1]]))
-            index0 = index1
-        else:
-            # Single codepoint
-            records.append("S(0x{:04x})".format(codepoint_list[index0]))
-            data_records.append(mapping_str(data_records, folding[codepoint_list[index0]]))
-            index0 += 1
-
-    sys.stdout.write("static const unsigned FOLD_MAP_{}[] = {{\n".format(mapping_len))
-    sys.stdout.write("\n".join(textwrap.wrap(", ".join(records), 110,
-                        initial_indent = "    ", subsequent_indent="    ")))
-    sys.stdout.write("\n};\n")
-
-    sys.stdout.write("static const unsigned FOLD_MAP_{}_DATA[] = {{\n".format(mapping_len))
-    sys.stdout.write("\n".join(textwrap.wrap(", ".join(data_records), 110,
+    for codepoint in sorted(folding):
+        index = len(data_list[mapping_len-1])
+        assert(index < (1 << 14))
+        data_list[mapping_len-1].append(folding[codepoint])
+        entry_map[codepoint] = (mapping_len << 14) | index
+
+stage1 = list()
+stage2 = list()
+record_index = dict()
+for block in range((max(entry_map) >> BLOCK_SHIFT) + 1):
+    record = tuple(entry_map.get((block << BLOCK_SHIFT) + i, 0) for i in range(BLOCK_SIZE))
+    if not record in record_index:
+        record_index[record] = len(record_index)
+        stage2.extend(record)
+    stage1.append(record_index[record])
+
+if len(record_index) > 256:
+    sys.exit("Too many distinct blocks for the 8-bit 1st stage.")
+
+
+def write_array(type, name, items):
+    sys.stdout.write("static const {} {}[] = {{\n".format(type, name))
+    sys.stdout.write("\n".join(textwrap.wrap(", ".join(items), 110,
                         initial_indent = "    ", subsequent_indent="    ")))
     sys.stdout.write("\n};\n")
 
-
-
+write_array("unsigned char", "FOLD_MAP_INDEX_1", [str(x) for x in stage1])
+write_array("unsigned short", "FOLD_MAP_INDEX_2", [str(x) for x in stage2])
+for mapping_len in range(1, 4):
+    write_array("unsigned", "FOLD_MAP_{}_DATA".format(mapping_len),
+                [",".join("0x{:04x}".format(x) for x in mapping) for mapping in data_list[mapping_len-1]])
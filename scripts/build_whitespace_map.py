@@ -42,25 +42,36 @@ f.close()
 codepoint_list.sort()
 
 
-index0 = 0
-count = len(codepoint_list)
-
-records = list()
-while index0 < count:
-    index1 = index0 + 1
-    while index1 < count and codepoint_list[index1] == codepoint_list[index1-1] + 1:
-        index1 += 1
-
-    if index1 - index0 > 1:
-        # Range of codepoints
-        records.append("R(0x{:04x},0x{:04x})".format(codepoint_list[index0], codepoint_list[index1-1]))
-    else:
-        # Single codepoint
-        records.append("S(0x{:04x})".format(codepoint_list[index0]))
-
-    index0 = index1
-
-sys.stdout.write("static const unsigned WHITESPACE_MAP[] = {\n")
-sys.stdout.write("\n".join(textwrap.wrap(", ".join(records), 110,
+codepoint_set = set(codepoint_list)
+
+# Build two-stage lookup table: The 1st stage maps each block of 128
+# codepoints to an index of its bitmap in the 2nd stage. Blocks with the same
+# bitmap (e.g. those without any codepoint of interest) share it.
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+stage1 = list()
+stage2 = list()
+bitmap_index = dict()
+for block in range((max(codepoint_list) >> BLOCK_SHIFT) + 1):
+    bitmap = [0] * (BLOCK_SIZE // 8)
+    for i in range(BLOCK_SIZE):
+        if (block << BLOCK_SHIFT) + i in codepoint_set:
+            bitmap[i // 8] |= 1 << (i % 8)
+    bitmap = tuple(bitmap)
+    if not bitmap in bitmap_index:
+        bitmap_index[bitmap] = len(bitmap_index)
+        stage2.extend(bitmap)
+    stage1.append(bitmap_index[bitmap])
+
+if len(bitmap_index) > 256:
+    sys.exit("Too many distinct blocks for the 8-bit 1st stage.")
+
+sys.stdout.write("static const unsigned char WHITESPACE_MAP_1[] = {\n")
+sys.stdout.write("\n".join(textwrap.wrap(", ".join(str(i) for i in stage1), 110,
+                    initial_indent = "    ", subsequent_indent="    ")))
+sys.stdout.write("\n};\n")
+sys.stdout.write("static const unsigned char WHITESPACE_MAP_2[] = {\n")
+sys.stdout.write("\n".join(textwrap.wrap(", ".join("0x{:02x}".format(b) for b in stage2), 110,
                     initial_indent = "    ", subsequent_indent="    ")))
 sys.stdout.write("\n};\n\n")
@@ -10,6 +10,8 @@ argv0_dir = os.path.dirname(sys.argv[0])
 project_dir = os.path.abspath(os.path.join(argv0_dir, ".."))
 test_dir = os.path.join(project_dir, "test")
 program = os.path.abspath(os.path.join("md2html", "md2html"))
+api_tests = os.path.abspath(os.path.join("test", "api-tests"))
+api_tests_all = os.path.abspath(os.path.join("test", "api-tests-all"))
 
 if __name__ == "__main__":
     err_count = 0
@@ -42,5 +44,36 @@ if __name__ == "__main__":
     p = subprocess.run(args)
     if p.returncode != 0:
         err_count += 1
+    print()
+
+    print("Testing scaling of pathological inputs:")
+    sys.stdout.flush()
+    sys.stderr.flush()
+    args = [
+            sys.executable,
+            "scaling-tests.py",
+            "-p", str(program)
+    ]
+    p = subprocess.run(args)
+    if p.returncode != 0:
+        err_count += 1
+    print()
+
+    print("Testing the API:")
+    sys.stdout.flush()
+    sys.stderr.flush()
+    p = subprocess.run([ api_tests ])
+    if p.returncode != 0:
+        err_count += 1
+
+    # Built only with BUILD_AMALGAMATION.
+    if os.path.exists(api_tests_all)  or  os.path.exists(api_tests_all + ".exe"):
+        print()
+        print("Testing the API of the amalgamated build:")
+        sys.stdout.flush()
+        sys.stderr.flush()
+        p = subprocess.run([ api_tests_all ])
+        if p.returncode != 0:
+            err_count += 1
 
     sys.exit(err_count)
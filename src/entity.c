@@ -28,2158 +28,2202 @@
 
 
 /* Generated by scripts/build_entity_map.py. */
-static const ENTITY ENTITY_MAP[] = {
-    { "&AElig;", { 198, 0 } },
-    { "&AMP;", { 38, 0 } },
-    { "&Aacute;", { 193, 0 } },
-    { "&Abreve;", { 258, 0 } },
-    { "&Acirc;", { 194, 0 } },
-    { "&Acy;", { 1040, 0 } },
-    { "&Afr;", { 120068, 0 } },
-    { "&Agrave;", { 192, 0 } },
-    { "&Alpha;", { 913, 0 } },
-    { "&Amacr;", { 256, 0 } },
-    { "&And;", { 10835, 0 } },
-    { "&Aogon;", { 260, 0 } },
-    { "&Aopf;", { 120120, 0 } },
-    { "&ApplyFunction;", { 8289, 0 } },
-    { "&Aring;", { 197, 0 } },
-    { "&Ascr;", { 119964, 0 } },
-    { "&Assign;", { 8788, 0 } },
-    { "&Atilde;", { 195, 0 } },
-    { "&Auml;", { 196, 0 } },
-    { "&Backslash;", { 8726, 0 } },
-    { "&Barv;", { 10983, 0 } },
-    { "&Barwed;", { 8966, 0 } },
-    { "&Bcy;", { 1041, 0 } },
-    { "&Because;", { 8757, 0 } },
-    { "&Bernoullis;", { 8492, 0 } },
-    { "&Beta;", { 914, 0 } },
-    { "&Bfr;", { 120069, 0 } },
-    { "&Bopf;", { 120121, 0 } },
-    { "&Breve;", { 728, 0 } },
-    { "&Bscr;", { 8492, 0 } },
-    { "&Bumpeq;", { 8782, 0 } },
-    { "&CHcy;", { 1063, 0 } },
-    { "&COPY;", { 169, 0 } },
-    { "&Cacute;", { 262, 0 } },
-    { "&Cap;", { 8914, 0 } },
-    { "&CapitalDifferentialD;", { 8517, 0 } },
-    { "&Cayleys;", { 8493, 0 } },
-    { "&Ccaron;", { 268, 0 } },
-    { "&Ccedil;", { 199, 0 } },
-    { "&Ccirc;", { 264, 0 } },
-    { "&Cconint;", { 8752, 0 } },
-    { "&Cdot;", { 266, 0 } },
-    { "&Cedilla;", { 184, 0 } },
-    { "&CenterDot;", { 183, 0 } },
-    { "&Cfr;", { 8493, 0 } },
-    { "&Chi;", { 935, 0 } },
-    { "&CircleDot;", { 8857, 0 } },
-    { "&CircleMinus;", { 8854, 0 } },
-    { "&CirclePlus;", { 8853, 0 } },
-    { "&CircleTimes;", { 8855, 0 } },
-    { "&ClockwiseContourIntegral;", { 8754, 0 } },
-    { "&CloseCurlyDoubleQuote;", { 8221, 0 } },
-    { "&CloseCurlyQuote;", { 8217, 0 } },
-    { "&Colon;", { 8759, 0 } },
-    { "&Colone;", { 10868, 0 } },
-    { "&Congruent;", { 8801, 0 } },
-    { "&Conint;", { 8751, 0 } },
-    { "&ContourIntegral;", { 8750, 0 } },
-    { "&Copf;", { 8450, 0 } },
-    { "&Coproduct;", { 8720, 0 } },
-    { "&CounterClockwiseContourIntegral;", { 8755, 0 } },
-    { "&Cross;", { 10799, 0 } },
-    { "&Cscr;", { 119966, 0 } },
-    { "&Cup;", { 8915, 0 } },
-    { "&CupCap;", { 8781, 0 } },
-    { "&DD;", { 8517, 0 } },
-    { "&DDotrahd;", { 10513, 0 } },
-    { "&DJcy;", { 1026, 0 } },
-    { "&DScy;", { 1029, 0 } },
-    { "&DZcy;", { 1039, 0 } },
-    { "&Dagger;", { 8225, 0 } },
-    { "&Darr;", { 8609, 0 } },
-    { "&Dashv;", { 10980, 0 } },
-    { "&Dcaron;", { 270, 0 } },
-    { "&Dcy;", { 1044, 0 } },
-    { "&Del;", { 8711, 0 } },
-    { "&Delta;", { 916, 0 } },
-    { "&Dfr;", { 120071, 0 } },
-    { "&DiacriticalAcute;", { 180, 0 } },
-    { "&DiacriticalDot;", { 729, 0 } },
-    { "&DiacriticalDoubleAcute;", { 733, 0 } },
-    { "&DiacriticalGrave;", { 96, 0 } },
-    { "&DiacriticalTilde;", { 732, 0 } },
-    { "&Diamond;", { 8900, 0 } },
-    { "&DifferentialD;", { 8518, 0 } },
-    { "&Dopf;", { 120123, 0 } },
-    { "&Dot;", { 168, 0 } },
-    { "&DotDot;", { 8412, 0 } },
-    { "&DotEqual;", { 8784, 0 } },
-    { "&DoubleContourIntegral;", { 8751, 0 } },
-    { "&DoubleDot;", { 168, 0 } },
-    { "&DoubleDownArrow;", { 8659, 0 } },
-    { "&DoubleLeftArrow;", { 8656, 0 } },
-    { "&DoubleLeftRightArrow;", { 8660, 0 } },
-    { "&DoubleLeftTee;", { 10980, 0 } },
-    { "&DoubleLongLeftArrow;", { 10232, 0 } },
-    { "&DoubleLongLeftRightArrow;", { 10234, 0 } },
-    { "&DoubleLongRightArrow;", { 10233, 0 } },
-    { "&DoubleRightArrow;", { 8658, 0 } },
-    { "&DoubleRightTee;", { 8872, 0 } },
-    { "&DoubleUpArrow;", { 8657, 0 } },
-    { "&DoubleUpDownArrow;", { 8661, 0 } },
-    { "&DoubleVerticalBar;", { 8741, 0 } },
-    { "&DownArrow;", { 8595, 0 } },
-    { "&DownArrowBar;", { 10515, 0 } },
-    { "&DownArrowUpArrow;", { 8693, 0 } },
-    { "&DownBreve;", { 785, 0 } },
-    { "&DownLeftRightVector;", { 10576, 0 } },
-    { "&DownLeftTeeVector;", { 10590, 0 } },
-    { "&DownLeftVector;", { 8637, 0 } },
-    { "&DownLeftVectorBar;", { 10582, 0 } },
-    { "&DownRightTeeVector;", { 10591, 0 } },
-    { "&DownRightVector;", { 8641, 0 } },
-    { "&DownRightVectorBar;", { 10583, 0 } },
-    { "&DownTee;", { 8868, 0 } },
-    { "&DownTeeArrow;", { 8615, 0 } },
-    { "&Downarrow;", { 8659, 0 } },
-    { "&Dscr;", { 119967, 0 } },
-    { "&Dstrok;", { 272, 0 } },
-    { "&ENG;", { 330, 0 } },
-    { "&ETH;", { 208, 0 } },
-    { "&Eacute;", { 201, 0 } },
-    { "&Ecaron;", { 282, 0 } },
-    { "&Ecirc;", { 202, 0 } },
-    { "&Ecy;", { 1069, 0 } },
-    { "&Edot;", { 278, 0 } },
-    { "&Efr;", { 120072, 0 } },
-    { "&Egrave;", { 200, 0 } },
-    { "&Element;", { 8712, 0 } },
-    { "&Emacr;", { 274, 0 } },
-    { "&EmptySmallSquare;", { 9723, 0 } },
-    { "&EmptyVerySmallSquare;", { 9643, 0 } },
-    { "&Eogon;", { 280, 0 } },
-    { "&Eopf;", { 120124, 0 } },
-    { "&Epsilon;", { 917, 0 } },
-    { "&Equal;", { 10869, 0 } },
-    { "&EqualTilde;", { 8770, 0 } },
-    { "&Equilibrium;", { 8652, 0 } },
-    { "&Escr;", { 8496, 0 } },
-    { "&Esim;", { 10867, 0 } },
-    { "&Eta;", { 919, 0 } },
-    { "&Euml;", { 203, 0 } },
-    { "&Exists;", { 8707, 0 } },
-    { "&ExponentialE;", { 8519, 0 } },
-    { "&Fcy;", { 1060, 0 } },
-    { "&Ffr;", { 120073, 0 } },
-    { "&FilledSmallSquare;", { 9724, 0 } },
-    { "&FilledVerySmallSquare;", { 9642, 0 } },
-    { "&Fopf;", { 120125, 0 } },
-    { "&ForAll;", { 8704, 0 } },
-    { "&Fouriertrf;", { 8497, 0 } },
-    { "&Fscr;", { 8497, 0 } },
-    { "&GJcy;", { 1027, 0 } },
-    { "&GT;", { 62, 0 } },
-    { "&Gamma;", { 915, 0 } },
-    { "&Gammad;", { 988, 0 } },
-    { "&Gbreve;", { 286, 0 } },
-    { "&Gcedil;", { 290, 0 } },
-    { "&Gcirc;", { 284, 0 } },
-    { "&Gcy;", { 1043, 0 } },
-    { "&Gdot;", { 288, 0 } },
-    { "&Gfr;", { 120074, 0 } },
-    { "&Gg;", { 8921, 0 } },
-    { "&Gopf;", { 120126, 0 } },
-    { "&GreaterEqual;", { 8805, 0 } },
-    { "&GreaterEqualLess;", { 8923, 0 } },
-    { "&GreaterFullEqual;", { 8807, 0 } },
-    { "&GreaterGreater;", { 10914, 0 } },
-    { "&GreaterLess;", { 8823, 0 } },
-    { "&GreaterSlantEqual;", { 10878, 0 } },
-    { "&GreaterTilde;", { 8819, 0 } },
-    { "&Gscr;", { 119970, 0 } },
-    { "&Gt;", { 8811, 0 } },
-    { "&HARDcy;", { 1066, 0 } },
-    { "&Hacek;", { 711, 0 } },
-    { "&Hat;", { 94, 0 } },
-    { "&Hcirc;", { 292, 0 } },
-    { "&Hfr;", { 8460, 0 } },
-    { "&HilbertSpace;", { 8459, 0 } },
-    { "&Hopf;", { 8461, 0 } },
-    { "&HorizontalLine;", { 9472, 0 } },
-    { "&Hscr;", { 8459, 0 } },
-    { "&Hstrok;", { 294, 0 } },
-    { "&HumpDownHump;", { 8782, 0 } },
-    { "&HumpEqual;", { 8783, 0 } },
-    { "&IEcy;", { 1045, 0 } },
-    { "&IJlig;", { 306, 0 } },
-    { "&IOcy;", { 1025, 0 } },
-    { "&Iacute;", { 205, 0 } },
-    { "&Icirc;", { 206, 0 } },
-    { "&Icy;", { 1048, 0 } },
-    { "&Idot;", { 304, 0 } },
-    { "&Ifr;", { 8465, 0 } },
-    { "&Igrave;", { 204, 0 } },
-    { "&Im;", { 8465, 0 } },
-    { "&Imacr;", { 298, 0 } },
-    { "&ImaginaryI;", { 8520, 0 } },
-    { "&Implies;", { 8658, 0 } },
-    { "&Int;", { 8748, 0 } },
-    { "&Integral;", { 8747, 0 } },
-    { "&Intersection;", { 8898, 0 } },
-    { "&InvisibleComma;", { 8291, 0 } },
-    { "&InvisibleTimes;", { 8290, 0 } },
-    { "&Iogon;", { 302, 0 } },
-    { "&Iopf;", { 120128, 0 } },
-    { "&Iota;", { 921, 0 } },
-    { "&Iscr;", { 8464, 0 } },
-    { "&Itilde;", { 296, 0 } },
-    { "&Iukcy;", { 1030, 0 } },
-    { "&Iuml;", { 207, 0 } },
-    { "&Jcirc;", { 308, 0 } },
-    { "&Jcy;", { 1049, 0 } },
-    { "&Jfr;", { 120077, 0 } },
-    { "&Jopf;", { 120129, 0 } },
-    { "&Jscr;", { 119973, 0 } },
-    { "&Jsercy;", { 1032, 0 } },
-    { "&Jukcy;", { 1028, 0 } },
-    { "&KHcy;", { 1061, 0 } },
-    { "&KJcy;", { 1036, 0 } },
-    { "&Kappa;", { 922, 0 } },
-    { "&Kcedil;", { 310, 0 } },
-    { "&Kcy;", { 1050, 0 } },
-    { "&Kfr;", { 120078, 0 } },
-    { "&Kopf;", { 120130, 0 } },
-    { "&Kscr;", { 119974, 0 } },
-    { "&LJcy;", { 1033, 0 } },
-    { "&LT;", { 60, 0 } },
-    { "&Lacute;", { 313, 0 } },
-    { "&Lambda;", { 923, 0 } },
-    { "&Lang;", { 10218, 0 } },
-    { "&Laplacetrf;", { 8466, 0 } },
-    { "&Larr;", { 8606, 0 } },
-    { "&Lcaron;", { 317, 0 } },
-    { "&Lcedil;", { 315, 0 } },
-    { "&Lcy;", { 1051, 0 } },
-    { "&LeftAngleBracket;", { 10216, 0 } },
-    { "&LeftArrow;", { 8592, 0 } },
-    { "&LeftArrowBar;", { 8676, 0 } },
-    { "&LeftArrowRightArrow;", { 8646, 0 } },
-    { "&LeftCeiling;", { 8968, 0 } },
-    { "&LeftDoubleBracket;", { 10214, 0 } },
-    { "&LeftDownTeeVector;", { 10593, 0 } },
-    { "&LeftDownVector;", { 8643, 0 } },
-    { "&LeftDownVectorBar;", { 10585, 0 } },
-    { "&LeftFloor;", { 8970, 0 } },
-    { "&LeftRightArrow;", { 8596, 0 } },
-    { "&LeftRightVector;", { 10574, 0 } },
-    { "&LeftTee;", { 8867, 0 } },
-    { "&LeftTeeArrow;", { 8612, 0 } },
-    { "&LeftTeeVector;", { 10586, 0 } },
-    { "&LeftTriangle;", { 8882, 0 } },
-    { "&LeftTriangleBar;", { 10703, 0 } },
-    { "&LeftTriangleEqual;", { 8884, 0 } },
-    { "&LeftUpDownVector;", { 10577, 0 } },
-    { "&LeftUpTeeVector;", { 10592, 0 } },
-    { "&LeftUpVector;", { 8639, 0 } },
-    { "&LeftUpVectorBar;", { 10584, 0 } },
-    { "&LeftVector;", { 8636, 0 } },
-    { "&LeftVectorBar;", { 10578, 0 } },
-    { "&Leftarrow;", { 8656, 0 } },
-    { "&Leftrightarrow;", { 8660, 0 } },
-    { "&LessEqualGreater;", { 8922, 0 } },
-    { "&LessFullEqual;", { 8806, 0 } },
-    { "&LessGreater;", { 8822, 0 } },
-    { "&LessLess;", { 10913, 0 } },
-    { "&LessSlantEqual;", { 10877, 0 } },
-    { "&LessTilde;", { 8818, 0 } },
-    { "&Lfr;", { 120079, 0 } },
-    { "&Ll;", { 8920, 0 } },
-    { "&Lleftarrow;", { 8666, 0 } },
-    { "&Lmidot;", { 319, 0 } },
-    { "&LongLeftArrow;", { 10229, 0 } },
-    { "&LongLeftRightArrow;", { 10231, 0 } },
-    { "&LongRightArrow;", { 10230, 0 } },
-    { "&Longleftarrow;", { 10232, 0 } },
-    { "&Longleftrightarrow;", { 10234, 0 } },
-    { "&Longrightarrow;", { 10233, 0 } },
-    { "&Lopf;", { 120131, 0 } },
-    { "&LowerLeftArrow;", { 8601, 0 } },
-    { "&LowerRightArrow;", { 8600, 0 } },
-    { "&Lscr;", { 8466, 0 } },
-    { "&Lsh;", { 8624, 0 } },
-    { "&Lstrok;", { 321, 0 } },
-    { "&Lt;", { 8810, 0 } },
-    { "&Map;", { 10501, 0 } },
-    { "&Mcy;", { 1052, 0 } },
-    { "&MediumSpace;", { 8287, 0 } },
-    { "&Mellintrf;", { 8499, 0 } },
-    { "&Mfr;", { 120080, 0 } },
-    { "&MinusPlus;", { 8723, 0 } },
-    { "&Mopf;", { 120132, 0 } },
-    { "&Mscr;", { 8499, 0 } },
-    { "&Mu;", { 924, 0 } },
-    { "&NJcy;", { 1034, 0 } },
-    { "&Nacute;", { 323, 0 } },
-    { "&Ncaron;", { 327, 0 } },
-    { "&Ncedil;", { 325, 0 } },
-    { "&Ncy;", { 1053, 0 } },
-    { "&NegativeMediumSpace;", { 8203, 0 } },
-    { "&NegativeThickSpace;", { 8203, 0 } },
-    { "&NegativeThinSpace;", { 8203, 0 } },
-    { "&NegativeVeryThinSpace;", { 8203, 0 } },
-    { "&NestedGreaterGreater;", { 8811, 0 } },
-    { "&NestedLessLess;", { 8810, 0 } },
-    { "&NewLine;", { 10, 0 } },
-    { "&Nfr;", { 120081, 0 } },
-    { "&NoBreak;", { 8288, 0 } },
-    { "&NonBreakingSpace;", { 160, 0 } },
-    { "&Nopf;", { 8469, 0 } },
-    { "&Not;", { 10988, 0 } },
-    { "&NotCongruent;", { 8802, 0 } },
-    { "&NotCupCap;", { 8813, 0 } },
-    { "&NotDoubleVerticalBar;", { 8742, 0 } },
-    { "&NotElement;", { 8713, 0 } },
-    { "&NotEqual;", { 8800, 0 } },
-    { "&NotEqualTilde;", { 8770, 824 } },
-    { "&NotExists;", { 8708, 0 } },
-    { "&NotGreater;", { 8815, 0 } },
-    { "&NotGreaterEqual;", { 8817, 0 } },
-    { "&NotGreaterFullEqual;", { 8807, 824 } },
-    { "&NotGreaterGreater;", { 8811, 824 } },
-    { "&NotGreaterLess;", { 8825, 0 } },
-    { "&NotGreaterSlantEqual;", { 10878, 824 } },
-    { "&NotGreaterTilde;", { 8821, 0 } },
-    { "&NotHumpDownHump;", { 8782, 824 } },
-    { "&NotHumpEqual;", { 8783, 824 } },
-    { "&NotLeftTriangle;", { 8938, 0 } },
-    { "&NotLeftTriangleBar;", { 10703, 824 } },
-    { "&NotLeftTriangleEqual;", { 8940, 0 } },
-    { "&NotLess;", { 8814, 0 } },
-    { "&NotLessEqual;", { 8816, 0 } },
-    { "&NotLessGreater;", { 8824, 0 } },
-    { "&NotLessLess;", { 8810, 824 } },
-    { "&NotLessSlantEqual;", { 10877, 824 } },
-    { "&NotLessTilde;", { 8820, 0 } },
-    { "&NotNestedGreaterGreater;", { 10914, 824 } },
-    { "&NotNestedLessLess;", { 10913, 824 } },
-    { "&NotPrecedes;", { 8832, 0 } },
-    { "&NotPrecedesEqual;", { 10927, 824 } },
-    { "&NotPrecedesSlantEqual;", { 8928, 0 } },
-    { "&NotReverseElement;", { 8716, 0 } },
-    { "&NotRightTriangle;", { 8939, 0 } },
-    { "&NotRightTriangleBar;", { 10704, 824 } },
-    { "&NotRightTriangleEqual;", { 8941, 0 } },
-    { "&NotSquareSubset;", { 8847, 824 } },
-    { "&NotSquareSubsetEqual;", { 8930, 0 } },
-    { "&NotSquareSuperset;", { 8848, 824 } },
-    { "&NotSquareSupersetEqual;", { 8931, 0 } },
-    { "&NotSubset;", { 8834, 8402 } },
-    { "&NotSubsetEqual;", { 8840, 0 } },
-    { "&NotSucceeds;", { 8833, 0 } },
-    { "&NotSucceedsEqual;", { 10928, 824 } },
-    { "&NotSucceedsSlantEqual;", { 8929, 0 } },
-    { "&NotSucceedsTilde;", { 8831, 824 } },
-    { "&NotSuperset;", { 8835, 8402 } },
-    { "&NotSupersetEqual;", { 8841, 0 } },
-    { "&NotTilde;", { 8769, 0 } },
-    { "&NotTildeEqual;", { 8772, 0 } },
-    { "&NotTildeFullEqual;", { 8775, 0 } },
-    { "&NotTildeTilde;", { 8777, 0 } },
-    { "&NotVerticalBar;", { 8740, 0 } },
-    { "&Nscr;", { 119977, 0 } },
-    { "&Ntilde;", { 209, 0 } },
-    { "&Nu;", { 925, 0 } },
-    { "&OElig;", { 338, 0 } },
-    { "&Oacute;", { 211, 0 } },
-    { "&Ocirc;", { 212, 0 } },
-    { "&Ocy;", { 1054, 0 } },
-    { "&Odblac;", { 336, 0 } },
-    { "&Ofr;", { 120082, 0 } },
-    { "&Ograve;", { 210, 0 } },
-    { "&Omacr;", { 332, 0 } },
-    { "&Omega;", { 937, 0 } },
-    { "&Omicron;", { 927, 0 } },
-    { "&Oopf;", { 120134, 0 } },
-    { "&OpenCurlyDoubleQuote;", { 8220, 0 } },
-    { "&OpenCurlyQuote;", { 8216, 0 } },
-    { "&Or;", { 10836, 0 } },
-    { "&Oscr;", { 119978, 0 } },
-    { "&Oslash;", { 216, 0 } },
-    { "&Otilde;", { 213, 0 } },
-    { "&Otimes;", { 10807, 0 } },
-    { "&Ouml;", { 214, 0 } },
-    { "&OverBar;", { 8254, 0 } },
-    { "&OverBrace;", { 9182, 0 } },
-    { "&OverBracket;", { 9140, 0 } },
-    { "&OverParenthesis;", { 9180, 0 } },
-    { "&PartialD;", { 8706, 0 } },
-    { "&Pcy;", { 1055, 0 } },
-    { "&Pfr;", { 120083, 0 } },
-    { "&Phi;", { 934, 0 } },
-    { "&Pi;", { 928, 0 } },
-    { "&PlusMinus;", { 177, 0 } },
-    { "&Poincareplane;", { 8460, 0 } },
-    { "&Popf;", { 8473, 0 } },
-    { "&Pr;", { 10939, 0 } },
-    { "&Precedes;", { 8826, 0 } },
-    { "&PrecedesEqual;", { 10927, 0 } },
-    { "&PrecedesSlantEqual;", { 8828, 0 } },
-    { "&PrecedesTilde;", { 8830, 0 } },
-    { "&Prime;", { 8243, 0 } },
-    { "&Product;", { 8719, 0 } },
-    { "&Proportion;", { 8759, 0 } },
-    { "&Proportional;", { 8733, 0 } },
-    { "&Pscr;", { 119979, 0 } },
-    { "&Psi;", { 936, 0 } },
-    { "&QUOT;", { 34, 0 } },
-    { "&Qfr;", { 120084, 0 } },
-    { "&Qopf;", { 8474, 0 } },
-    { "&Qscr;", { 119980, 0 } },
-    { "&RBarr;", { 10512, 0 } },
-    { "&REG;", { 174, 0 } },
-    { "&Racute;", { 340, 0 } },
-    { "&Rang;", { 10219, 0 } },
-    { "&Rarr;", { 8608, 0 } },
-    { "&Rarrtl;", { 10518, 0 } },
-    { "&Rcaron;", { 344, 0 } },
-    { "&Rcedil;", { 342, 0 } },
-    { "&Rcy;", { 1056, 0 } },
-    { "&Re;", { 8476, 0 } },
-    { "&ReverseElement;", { 8715, 0 } },
-    { "&ReverseEquilibrium;", { 8651, 0 } },
-    { "&ReverseUpEquilibrium;", { 10607, 0 } },
-    { "&Rfr;", { 8476, 0 } },
-    { "&Rho;", { 929, 0 } },
-    { "&RightAngleBracket;", { 10217, 0 } },
-    { "&RightArrow;", { 8594, 0 } },
-    { "&RightArrowBar;", { 8677, 0 } },
-    { "&RightArrowLeftArrow;", { 8644, 0 } },
-    { "&RightCeiling;", { 8969, 0 } },
-    { "&RightDoubleBracket;", { 10215, 0 } },
-    { "&RightDownTeeVector;", { 10589, 0 } },
-    { "&RightDownVector;", { 8642, 0 } },
-    { "&RightDownVectorBar;", { 10581, 0 } },
-    { "&RightFloor;", { 8971, 0 } },
-    { "&RightTee;", { 8866, 0 } },
-    { "&RightTeeArrow;", { 8614, 0 } },
-    { "&RightTeeVector;", { 10587, 0 } },
-    { "&RightTriangle;", { 8883, 0 } },
-    { "&RightTriangleBar;", { 10704, 0 } },
-    { "&RightTriangleEqual;", { 8885, 0 } },
-    { "&RightUpDownVector;", { 10575, 0 } },
-    { "&RightUpTeeVector;", { 10588, 0 } },
-    { "&RightUpVector;", { 8638, 0 } },
-    { "&RightUpVectorBar;", { 10580, 0 } },
-    { "&RightVector;", { 8640, 0 } },
-    { "&RightVectorBar;", { 10579, 0 } },
-    { "&Rightarrow;", { 8658, 0 } },
-    { "&Ropf;", { 8477, 0 } },
-    { "&RoundImplies;", { 10608, 0 } },
-    { "&Rrightarrow;", { 8667, 0 } },
-    { "&Rscr;", { 8475, 0 } },
-    { "&Rsh;", { 8625, 0 } },
-    { "&RuleDelayed;", { 10740, 0 } },
-    { "&SHCHcy;", { 1065, 0 } },
-    { "&SHcy;", { 1064, 0 } },
-    { "&SOFTcy;", { 1068, 0 } },
-    { "&Sacute;", { 346, 0 } },
-    { "&Sc;", { 10940, 0 } },
-    { "&Scaron;", { 352, 0 } },
-    { "&Scedil;", { 350, 0 } },
-    { "&Scirc;", { 348, 0 } },
-    { "&Scy;", { 1057, 0 } },
-    { "&Sfr;", { 120086, 0 } },
-    { "&ShortDownArrow;", { 8595, 0 } },
-    { "&ShortLeftArrow;", { 8592, 0 } },
-    { "&ShortRightArrow;", { 8594, 0 } },
-    { "&ShortUpArrow;", { 8593, 0 } },
-    { "&Sigma;", { 931, 0 } },
-    { "&SmallCircle;", { 8728, 0 } },
-    { "&Sopf;", { 120138, 0 } },
-    { "&Sqrt;", { 8730, 0 } },
-    { "&Square;", { 9633, 0 } },
-    { "&SquareIntersection;", { 8851, 0 } },
-    { "&SquareSubset;", { 8847, 0 } },
-    { "&SquareSubsetEqual;", { 8849, 0 } },
-    { "&SquareSuperset;", { 8848, 0 } },
-    { "&SquareSupersetEqual;", { 8850, 0 } },
-    { "&SquareUnion;", { 8852, 0 } },
-    { "&Sscr;", { 119982, 0 } },
-    { "&Star;", { 8902, 0 } },
-    { "&Sub;", { 8912, 0 } },
-    { "&Subset;", { 8912, 0 } },
-    { "&SubsetEqual;", { 8838, 0 } },
-    { "&Succeeds;", { 8827, 0 } },
-    { "&SucceedsEqual;", { 10928, 0 } },
-    { "&SucceedsSlantEqual;", { 8829, 0 } },
-    { "&SucceedsTilde;", { 8831, 0 } },
-    { "&SuchThat;", { 8715, 0 } },
-    { "&Sum;", { 8721, 0 } },
-    { "&Sup;", { 8913, 0 } },
-    { "&Superset;", { 8835, 0 } },
-    { "&SupersetEqual;", { 8839, 0 } },
-    { "&Supset;", { 8913, 0 } },
-    { "&THORN;", { 222, 0 } },
-    { "&TRADE;", { 8482, 0 } },
-    { "&TSHcy;", { 1035, 0 } },
-    { "&TScy;", { 1062, 0 } },
-    { "&Tab;", { 9, 0 } },
-    { "&Tau;", { 932, 0 } },
-    { "&Tcaron;", { 356, 0 } },
-    { "&Tcedil;", { 354, 0 } },
-    { "&Tcy;", { 1058, 0 } },
-    { "&Tfr;", { 120087, 0 } },
-    { "&Therefore;", { 8756, 0 } },
-    { "&Theta;", { 920, 0 } },
-    { "&ThickSpace;", { 8287, 8202 } },
-    { "&ThinSpace;", { 8201, 0 } },
-    { "&Tilde;", { 8764, 0 } },
-    { "&TildeEqual;", { 8771, 0 } },
-    { "&TildeFullEqual;", { 8773, 0 } },
-    { "&TildeTilde;", { 8776, 0 } },
-    { "&Topf;", { 120139, 0 } },
-    { "&TripleDot;", { 8411, 0 } },
-    { "&Tscr;", { 119983, 0 } },
-    { "&Tstrok;", { 358, 0 } },
-    { "&Uacute;", { 218, 0 } },
-    { "&Uarr;", { 8607, 0 } },
-    { "&Uarrocir;", { 10569, 0 } },
-    { "&Ubrcy;", { 1038, 0 } },
-    { "&Ubreve;", { 364, 0 } },
-    { "&Ucirc;", { 219, 0 } },
-    { "&Ucy;", { 1059, 0 } },
-    { "&Udblac;", { 368, 0 } },
-    { "&Ufr;", { 120088, 0 } },
-    { "&Ugrave;", { 217, 0 } },
-    { "&Umacr;", { 362, 0 } },
-    { "&UnderBar;", { 95, 0 } },
-    { "&UnderBrace;", { 9183, 0 } },
-    { "&UnderBracket;", { 9141, 0 } },
-    { "&UnderParenthesis;", { 9181, 0 } },
-    { "&Union;", { 8899, 0 } },
-    { "&UnionPlus;", { 8846, 0 } },
-    { "&Uogon;", { 370, 0 } },
-    { "&Uopf;", { 120140, 0 } },
-    { "&UpArrow;", { 8593, 0 } },
-    { "&UpArrowBar;", { 10514, 0 } },
-    { "&UpArrowDownArrow;", { 8645, 0 } },
-    { "&UpDownArrow;", { 8597, 0 } },
-    { "&UpEquilibrium;", { 10606, 0 } },
-    { "&UpTee;", { 8869, 0 } },
-    { "&UpTeeArrow;", { 8613, 0 } },
-    { "&Uparrow;", { 8657, 0 } },
-    { "&Updownarrow;", { 8661, 0 } },
-    { "&UpperLeftArrow;", { 8598, 0 } },
-    { "&UpperRightArrow;", { 8599, 0 } },
-    { "&Upsi;", { 978, 0 } },
-    { "&Upsilon;", { 933, 0 } },
-    { "&Uring;", { 366, 0 } },
-    { "&Uscr;", { 119984, 0 } },
-    { "&Utilde;", { 360, 0 } },
-    { "&Uuml;", { 220, 0 } },
-    { "&VDash;", { 8875, 0 } },
-    { "&Vbar;", { 10987, 0 } },
-    { "&Vcy;", { 1042, 0 } },
-    { "&Vdash;", { 8873, 0 } },
-    { "&Vdashl;", { 10982, 0 } },
-    { "&Vee;", { 8897, 0 } },
-    { "&Verbar;", { 8214, 0 } },
-    { "&Vert;", { 8214, 0 } },
-    { "&VerticalBar;", { 8739, 0 } },
-    { "&VerticalLine;", { 124, 0 } },
-    { "&VerticalSeparator;", { 10072, 0 } },
-    { "&VerticalTilde;", { 8768, 0 } },
-    { "&VeryThinSpace;", { 8202, 0 } },
-    { "&Vfr;", { 120089, 0 } },
-    { "&Vopf;", { 120141, 0 } },
-    { "&Vscr;", { 119985, 0 } },
-    { "&Vvdash;", { 8874, 0 } },
-    { "&Wcirc;", { 372, 0 } },
-    { "&Wedge;", { 8896, 0 } },
-    { "&Wfr;", { 120090, 0 } },
-    { "&Wopf;", { 120142, 0 } },
-    { "&Wscr;", { 119986, 0 } },
-    { "&Xfr;", { 120091, 0 } },
-    { "&Xi;", { 926, 0 } },
-    { "&Xopf;", { 120143, 0 } },
-    { "&Xscr;", { 119987, 0 } },
-    { "&YAcy;", { 1071, 0 } },
-    { "&YIcy;", { 1031, 0 } },
-    { "&YUcy;", { 1070, 0 } },
-    { "&Yacute;", { 221, 0 } },
-    { "&Ycirc;", { 374, 0 } },
-    { "&Ycy;", { 1067, 0 } },
-    { "&Yfr;", { 120092, 0 } },
-    { "&Yopf;", { 120144, 0 } },
-    { "&Yscr;", { 119988, 0 } },
-    { "&Yuml;", { 376, 0 } },
-    { "&ZHcy;", { 1046, 0 } },
-    { "&Zacute;", { 377, 0 } },
-    { "&Zcaron;", { 381, 0 } },
-    { "&Zcy;", { 1047, 0 } },
-    { "&Zdot;", { 379, 0 } },
-    { "&ZeroWidthSpace;", { 8203, 0 } },
-    { "&Zeta;", { 918, 0 } },
-    { "&Zfr;", { 8488, 0 } },
-    { "&Zopf;", { 8484, 0 } },
-    { "&Zscr;", { 119989, 0 } },
-    { "&aacute;", { 225, 0 } },
-    { "&abreve;", { 259, 0 } },
-    { "&ac;", { 8766, 0 } },
-    { "&acE;", { 8766, 819 } },
-    { "&acd;", { 8767, 0 } },
-    { "&acirc;", { 226, 0 } },
-    { "&acute;", { 180, 0 } },
-    { "&acy;", { 1072, 0 } },
-    { "&aelig;", { 230, 0 } },
-    { "&af;", { 8289, 0 } },
-    { "&afr;", { 120094, 0 } },
-    { "&agrave;", { 224, 0 } },
-    { "&alefsym;", { 8501, 0 } },
-    { "&aleph;", { 8501, 0 } },
-    { "&alpha;", { 945, 0 } },
-    { "&amacr;", { 257, 0 } },
-    { "&amalg;", { 10815, 0 } },
-    { "&amp;", { 38, 0 } },
-    { "&and;", { 8743, 0 } },
-    { "&andand;", { 10837, 0 } },
-    { "&andd;", { 10844, 0 } },
-    { "&andslope;", { 10840, 0 } },
-    { "&andv;", { 10842, 0 } },
-    { "&ang;", { 8736, 0 } },
-    { "&ange;", { 10660, 0 } },
-    { "&angle;", { 8736, 0 } },
-    { "&angmsd;", { 8737, 0 } },
-    { "&angmsdaa;", { 10664, 0 } },
-    { "&angmsdab;", { 10665, 0 } },
-    { "&angmsdac;", { 10666, 0 } },
-    { "&angmsdad;", { 10667, 0 } },
-    { "&angmsdae;", { 10668, 0 } },
-    { "&angmsdaf;", { 10669, 0 } },
-    { "&angmsdag;", { 10670, 0 } },
-    { "&angmsdah;", { 10671, 0 } },
-    { "&angrt;", { 8735, 0 } },
-    { "&angrtvb;", { 8894, 0 } },
-    { "&angrtvbd;", { 10653, 0 } },
-    { "&angsph;", { 8738, 0 } },
-    { "&angst;", { 197, 0 } },
-    { "&angzarr;", { 9084, 0 } },
-    { "&aogon;", { 261, 0 } },
-    { "&aopf;", { 120146, 0 } },
-    { "&ap;", { 8776, 0 } },
-    { "&apE;", { 10864, 0 } },
-    { "&apacir;", { 10863, 0 } },
-    { "&ape;", { 8778, 0 } },
-    { "&apid;", { 8779, 0 } },
-    { "&apos;", { 39, 0 } },
-    { "&approx;", { 8776, 0 } },
-    { "&approxeq;", { 8778, 0 } },
-    { "&aring;", { 229, 0 } },
-    { "&ascr;", { 119990, 0 } },
-    { "&ast;", { 42, 0 } },
-    { "&asymp;", { 8776, 0 } },
-    { "&asympeq;", { 8781, 0 } },
-    { "&atilde;", { 227, 0 } },
-    { "&auml;", { 228, 0 } },
-    { "&awconint;", { 8755, 0 } },
-    { "&awint;", { 10769, 0 } },
-    { "&bNot;", { 10989, 0 } },
-    { "&backcong;", { 8780, 0 } },
-    { "&backepsilon;", { 1014, 0 } },
-    { "&backprime;", { 8245, 0 } },
-    { "&backsim;", { 8765, 0 } },
-    { "&backsimeq;", { 8909, 0 } },
-    { "&barvee;", { 8893, 0 } },
-    { "&barwed;", { 8965, 0 } },
-    { "&barwedge;", { 8965, 0 } },
-    { "&bbrk;", { 9141, 0 } },
-    { "&bbrktbrk;", { 9142, 0 } },
-    { "&bcong;", { 8780, 0 } },
-    { "&bcy;", { 1073, 0 } },
-    { "&bdquo;", { 8222, 0 } },
-    { "&becaus;", { 8757, 0 } },
-    { "&because;", { 8757, 0 } },
-    { "&bemptyv;", { 10672, 0 } },
-    { "&bepsi;", { 1014, 0 } },
-    { "&bernou;", { 8492, 0 } },
-    { "&beta;", { 946, 0 } },
-    { "&beth;", { 8502, 0 } },
-    { "&between;", { 8812, 0 } },
-    { "&bfr;", { 120095, 0 } },
-    { "&bigcap;", { 8898, 0 } },
-    { "&bigcirc;", { 9711, 0 } },
-    { "&bigcup;", { 8899, 0 } },
-    { "&bigodot;", { 10752, 0 } },
-    { "&bigoplus;", { 10753, 0 } },
-    { "&bigotimes;", { 10754, 0 } },
-    { "&bigsqcup;", { 10758, 0 } },
-    { "&bigstar;", { 9733, 0 } },
-    { "&bigtriangledown;", { 9661, 0 } },
-    { "&bigtriangleup;", { 9651, 0 } },
-    { "&biguplus;", { 10756, 0 } },
-    { "&bigvee;", { 8897, 0 } },
-    { "&bigwedge;", { 8896, 0 } },
-    { "&bkarow;", { 10509, 0 } },
-    { "&blacklozenge;", { 10731, 0 } },
-    { "&blacksquare;", { 9642, 0 } },
-    { "&blacktriangle;", { 9652, 0 } },
-    { "&blacktriangledown;", { 9662, 0 } },
-    { "&blacktriangleleft;", { 9666, 0 } },
-    { "&blacktriangleright;", { 9656, 0 } },
-    { "&blank;", { 9251, 0 } },
-    { "&blk12;", { 9618, 0 } },
-    { "&blk14;", { 9617, 0 } },
-    { "&blk34;", { 9619, 0 } },
-    { "&block;", { 9608, 0 } },
-    { "&bne;", { 61, 8421 } },
-    { "&bnequiv;", { 8801, 8421 } },
-    { "&bnot;", { 8976, 0 } },
-    { "&bopf;", { 120147, 0 } },
-    { "&bot;", { 8869, 0 } },
-    { "&bottom;", { 8869, 0 } },
-    { "&bowtie;", { 8904, 0 } },
-    { "&boxDL;", { 9559, 0 } },
-    { "&boxDR;", { 9556, 0 } },
-    { "&boxDl;", { 9558, 0 } },
-    { "&boxDr;", { 9555, 0 } },
-    { "&boxH;", { 9552, 0 } },
-    { "&boxHD;", { 9574, 0 } },
-    { "&boxHU;", { 9577, 0 } },
-    { "&boxHd;", { 9572, 0 } },
-    { "&boxHu;", { 9575, 0 } },
-    { "&boxUL;", { 9565, 0 } },
-    { "&boxUR;", { 9562, 0 } },
-    { "&boxUl;", { 9564, 0 } },
-    { "&boxUr;", { 9561, 0 } },
-    { "&boxV;", { 9553, 0 } },
-    { "&boxVH;", { 9580, 0 } },
-    { "&boxVL;", { 9571, 0 } },
-    { "&boxVR;", { 9568, 0 } },
-    { "&boxVh;", { 9579, 0 } },
-    { "&boxVl;", { 9570, 0 } },
-    { "&boxVr;", { 9567, 0 } },
-    { "&boxbox;", { 10697, 0 } },
-    { "&boxdL;", { 9557, 0 } },
-    { "&boxdR;", { 9554, 0 } },
-    { "&boxdl;", { 9488, 0 } },
-    { "&boxdr;", { 9484, 0 } },
-    { "&boxh;", { 9472, 0 } },
-    { "&boxhD;", { 9573, 0 } },
-    { "&boxhU;", { 9576, 0 } },
-    { "&boxhd;", { 9516, 0 } },
-    { "&boxhu;", { 9524, 0 } },
-    { "&boxminus;", { 8863, 0 } },
-    { "&boxplus;", { 8862, 0 } },
-    { "&boxtimes;", { 8864, 0 } },
-    { "&boxuL;", { 9563, 0 } },
-    { "&boxuR;", { 9560, 0 } },
-    { "&boxul;", { 9496, 0 } },
-    { "&boxur;", { 9492, 0 } },
-    { "&boxv;", { 9474, 0 } },
-    { "&boxvH;", { 9578, 0 } },
-    { "&boxvL;", { 9569, 0 } },
-    { "&boxvR;", { 9566, 0 } },
-    { "&boxvh;", { 9532, 0 } },
-    { "&boxvl;", { 9508, 0 } },
-    { "&boxvr;", { 9500, 0 } },
-    { "&bprime;", { 8245, 0 } },
-    { "&breve;", { 728, 0 } },
-    { "&brvbar;", { 166, 0 } },
-    { "&bscr;", { 119991, 0 } },
-    { "&bsemi;", { 8271, 0 } },
-    { "&bsim;", { 8765, 0 } },
-    { "&bsime;", { 8909, 0 } },
-    { "&bsol;", { 92, 0 } },
-    { "&bsolb;", { 10693, 0 } },
-    { "&bsolhsub;", { 10184, 0 } },
-    { "&bull;", { 8226, 0 } },
-    { "&bullet;", { 8226, 0 } },
-    { "&bump;", { 8782, 0 } },
-    { "&bumpE;", { 10926, 0 } },
-    { "&bumpe;", { 8783, 0 } },
-    { "&bumpeq;", { 8783, 0 } },
-    { "&cacute;", { 263, 0 } },
-    { "&cap;", { 8745, 0 } },
-    { "&capand;", { 10820, 0 } },
-    { "&capbrcup;", { 10825, 0 } },
-    { "&capcap;", { 10827, 0 } },
-    { "&capcup;", { 10823, 0 } },
-    { "&capdot;", { 10816, 0 } },
-    { "&caps;", { 8745, 65024 } },
-    { "&caret;", { 8257, 0 } },
-    { "&caron;", { 711, 0 } },
-    { "&ccaps;", { 10829, 0 } },
-    { "&ccaron;", { 269, 0 } },
-    { "&ccedil;", { 231, 0 } },
-    { "&ccirc;", { 265, 0 } },
-    { "&ccups;", { 10828, 0 } },
-    { "&ccupssm;", { 10832, 0 } },
-    { "&cdot;", { 267, 0 } },
-    { "&cedil;", { 184, 0 } },
-    { "&cemptyv;", { 10674, 0 } },
-    { "&cent;", { 162, 0 } },
-    { "&centerdot;", { 183, 0 } },
-    { "&cfr;", { 120096, 0 } },
-    { "&chcy;", { 1095, 0 } },
-    { "&check;", { 10003, 0 } },
-    { "&checkmark;", { 10003, 0 } },
-    { "&chi;", { 967, 0 } },
-    { "&cir;", { 9675, 0 } },
-    { "&cirE;", { 10691, 0 } },
-    { "&circ;", { 710, 0 } },
-    { "&circeq;", { 8791, 0 } },
-    { "&circlearrowleft;", { 8634, 0 } },
-    { "&circlearrowright;", { 8635, 0 } },
-    { "&circledR;", { 174, 0 } },
-    { "&circledS;", { 9416, 0 } },
-    { "&circledast;", { 8859, 0 } },
-    { "&circledcirc;", { 8858, 0 } },
-    { "&circleddash;", { 8861, 0 } },
-    { "&cire;", { 8791, 0 } },
-    { "&cirfnint;", { 10768, 0 } },
-    { "&cirmid;", { 10991, 0 } },
-    { "&cirscir;", { 10690, 0 } },
-    { "&clubs;", { 9827, 0 } },
-    { "&clubsuit;", { 9827, 0 } },
-    { "&colon;", { 58, 0 } },
-    { "&colone;", { 8788, 0 } },
-    { "&coloneq;", { 8788, 0 } },
-    { "&comma;", { 44, 0 } },
-    { "&commat;", { 64, 0 } },
-    { "&comp;", { 8705, 0 } },
-    { "&compfn;", { 8728, 0 } },
-    { "&complement;", { 8705, 0 } },
-    { "&complexes;", { 8450, 0 } },
-    { "&cong;", { 8773, 0 } },
-    { "&congdot;", { 10861, 0 } },
-    { "&conint;", { 8750, 0 } },
-    { "&copf;", { 120148, 0 } },
-    { "&coprod;", { 8720, 0 } },
-    { "&copy;", { 169, 0 } },
-    { "&copysr;", { 8471, 0 } },
-    { "&crarr;", { 8629, 0 } },
-    { "&cross;", { 10007, 0 } },
-    { "&cscr;", { 119992, 0 } },
-    { "&csub;", { 10959, 0 } },
-    { "&csube;", { 10961, 0 } },
-    { "&csup;", { 10960, 0 } },
-    { "&csupe;", { 10962, 0 } },
-    { "&ctdot;", { 8943, 0 } },
-    { "&cudarrl;", { 10552, 0 } },
-    { "&cudarrr;", { 10549, 0 } },
-    { "&cuepr;", { 8926, 0 } },
-    { "&cuesc;", { 8927, 0 } },
-    { "&cularr;", { 8630, 0 } },
-    { "&cularrp;", { 10557, 0 } },
-    { "&cup;", { 8746, 0 } },
-    { "&cupbrcap;", { 10824, 0 } },
-    { "&cupcap;", { 10822, 0 } },
-    { "&cupcup;", { 10826, 0 } },
-    { "&cupdot;", { 8845, 0 } },
-    { "&cupor;", { 10821, 0 } },
-    { "&cups;", { 8746, 65024 } },
-    { "&curarr;", { 8631, 0 } },
-    { "&curarrm;", { 10556, 0 } },
-    { "&curlyeqprec;", { 8926, 0 } },
-    { "&curlyeqsucc;", { 8927, 0 } },
-    { "&curlyvee;", { 8910, 0 } },
-    { "&curlywedge;", { 8911, 0 } },
-    { "&curren;", { 164, 0 } },
-    { "&curvearrowleft;", { 8630, 0 } },
-    { "&curvearrowright;", { 8631, 0 } },
-    { "&cuvee;", { 8910, 0 } },
-    { "&cuwed;", { 8911, 0 } },
-    { "&cwconint;", { 8754, 0 } },
-    { "&cwint;", { 8753, 0 } },
-    { "&cylcty;", { 9005, 0 } },
-    { "&dArr;", { 8659, 0 } },
-    { "&dHar;", { 10597, 0 } },
-    { "&dagger;", { 8224, 0 } },
-    { "&daleth;", { 8504, 0 } },
-    { "&darr;", { 8595, 0 } },
-    { "&dash;", { 8208, 0 } },
-    { "&dashv;", { 8867, 0 } },
-    { "&dbkarow;", { 10511, 0 } },
-    { "&dblac;", { 733, 0 } },
-    { "&dcaron;", { 271, 0 } },
-    { "&dcy;", { 1076, 0 } },
-    { "&dd;", { 8518, 0 } },
-    { "&ddagger;", { 8225, 0 } },
-    { "&ddarr;", { 8650, 0 } },
-    { "&ddotseq;", { 10871, 0 } },
-    { "&deg;", { 176, 0 } },
-    { "&delta;", { 948, 0 } },
-    { "&demptyv;", { 10673, 0 } },
-    { "&dfisht;", { 10623, 0 } },
-    { "&dfr;", { 120097, 0 } },
-    { "&dharl;", { 8643, 0 } },
-    { "&dharr;", { 8642, 0 } },
-    { "&diam;", { 8900, 0 } },
-    { "&diamond;", { 8900, 0 } },
-    { "&diamondsuit;", { 9830, 0 } },
-    { "&diams;", { 9830, 0 } },
-    { "&die;", { 168, 0 } },
-    { "&digamma;", { 989, 0 } },
-    { "&disin;", { 8946, 0 } },
-    { "&div;", { 247, 0 } },
-    { "&divide;", { 247, 0 } },
-    { "&divideontimes;", { 8903, 0 } },
-    { "&divonx;", { 8903, 0 } },
-    { "&djcy;", { 1106, 0 } },
-    { "&dlcorn;", { 8990, 0 } },
-    { "&dlcrop;", { 8973, 0 } },
-    { "&dollar;", { 36, 0 } },
-    { "&dopf;", { 120149, 0 } },
-    { "&dot;", { 729, 0 } },
-    { "&doteq;", { 8784, 0 } },
-    { "&doteqdot;", { 8785, 0 } },
-    { "&dotminus;", { 8760, 0 } },
-    { "&dotplus;", { 8724, 0 } },
-    { "&dotsquare;", { 8865, 0 } },
-    { "&doublebarwedge;", { 8966, 0 } },
-    { "&downarrow;", { 8595, 0 } },
-    { "&downdownarrows;", { 8650, 0 } },
-    { "&downharpoonleft;", { 8643, 0 } },
-    { "&downharpoonright;", { 8642, 0 } },
-    { "&drbkarow;", { 10512, 0 } },
-    { "&drcorn;", { 8991, 0 } },
-    { "&drcrop;", { 8972, 0 } },
-    { "&dscr;", { 119993, 0 } },
-    { "&dscy;", { 1109, 0 } },
-    { "&dsol;", { 10742, 0 } },
-    { "&dstrok;", { 273, 0 } },
-    { "&dtdot;", { 8945, 0 } },
-    { "&dtri;", { 9663, 0 } },
-    { "&dtrif;", { 9662, 0 } },
-    { "&duarr;", { 8693, 0 } },
-    { "&duhar;", { 10607, 0 } },
-    { "&dwangle;", { 10662, 0 } },
-    { "&dzcy;", { 1119, 0 } },
-    { "&dzigrarr;", { 10239, 0 } },
-    { "&eDDot;", { 10871, 0 } },
-    { "&eDot;", { 8785, 0 } },
-    { "&eacute;", { 233, 0 } },
-    { "&easter;", { 10862, 0 } },
-    { "&ecaron;", { 283, 0 } },
-    { "&ecir;", { 8790, 0 } },
-    { "&ecirc;", { 234, 0 } },
-    { "&ecolon;", { 8789, 0 } },
-    { "&ecy;", { 1101, 0 } },
-    { "&edot;", { 279, 0 } },
-    { "&ee;", { 8519, 0 } },
-    { "&efDot;", { 8786, 0 } },
-    { "&efr;", { 120098, 0 } },
-    { "&eg;", { 10906, 0 } },
-    { "&egrave;", { 232, 0 } },
-    { "&egs;", { 10902, 0 } },
-    { "&egsdot;", { 10904, 0 } },
-    { "&el;", { 10905, 0 } },
-    { "&elinters;", { 9191, 0 } },
-    { "&ell;", { 8467, 0 } },
-    { "&els;", { 10901, 0 } },
-    { "&elsdot;", { 10903, 0 } },
-    { "&emacr;", { 275, 0 } },
-    { "&empty;", { 8709, 0 } },
-    { "&emptyset;", { 8709, 0 } },
-    { "&emptyv;", { 8709, 0 } },
-    { "&emsp13;", { 8196, 0 } },
-    { "&emsp14;", { 8197, 0 } },
-    { "&emsp;", { 8195, 0 } },
-    { "&eng;", { 331, 0 } },
-    { "&ensp;", { 8194, 0 } },
-    { "&eogon;", { 281, 0 } },
-    { "&eopf;", { 120150, 0 } },
-    { "&epar;", { 8917, 0 } },
-    { "&eparsl;", { 10723, 0 } },
-    { "&eplus;", { 10865, 0 } },
-    { "&epsi;", { 949, 0 } },
-    { "&epsilon;", { 949, 0 } },
-    { "&epsiv;", { 1013, 0 } },
-    { "&eqcirc;", { 8790, 0 } },
-    { "&eqcolon;", { 8789, 0 } },
-    { "&eqsim;", { 8770, 0 } },
-    { "&eqslantgtr;", { 10902, 0 } },
-    { "&eqslantless;", { 10901, 0 } },
-    { "&equals;", { 61, 0 } },
-    { "&equest;", { 8799, 0 } },
-    { "&equiv;", { 8801, 0 } },
-    { "&equivDD;", { 10872, 0 } },
-    { "&eqvparsl;", { 10725, 0 } },
-    { "&erDot;", { 8787, 0 } },
-    { "&erarr;", { 10609, 0 } },
-    { "&escr;", { 8495, 0 } },
-    { "&esdot;", { 8784, 0 } },
-    { "&esim;", { 8770, 0 } },
-    { "&eta;", { 951, 0 } },
-    { "&eth;", { 240, 0 } },
-    { "&euml;", { 235, 0 } },
-    { "&euro;", { 8364, 0 } },
-    { "&excl;", { 33, 0 } },
-    { "&exist;", { 8707, 0 } },
-    { "&expectation;", { 8496, 0 } },
-    { "&exponentiale;", { 8519, 0 } },
-    { "&fallingdotseq;", { 8786, 0 } },
-    { "&fcy;", { 1092, 0 } },
-    { "&female;", { 9792, 0 } },
-    { "&ffilig;", { 64259, 0 } },
-    { "&fflig;", { 64256, 0 } },
-    { "&ffllig;", { 64260, 0 } },
-    { "&ffr;", { 120099, 0 } },
-    { "&filig;", { 64257, 0 } },
-    { "&fjlig;", { 102, 106 } },
-    { "&flat;", { 9837, 0 } },
-    { "&fllig;", { 64258, 0 } },
-    { "&fltns;", { 9649, 0 } },
-    { "&fnof;", { 402, 0 } },
-    { "&fopf;", { 120151, 0 } },
-    { "&forall;", { 8704, 0 } },
-    { "&fork;", { 8916, 0 } },
-    { "&forkv;", { 10969, 0 } },
-    { "&fpartint;", { 10765, 0 } },
-    { "&frac12;", { 189, 0 } },
-    { "&frac13;", { 8531, 0 } },
-    { "&frac14;", { 188, 0 } },
-    { "&frac15;", { 8533, 0 } },
-    { "&frac16;", { 8537, 0 } },
-    { "&frac18;", { 8539, 0 } },
-    { "&frac23;", { 8532, 0 } },
-    { "&frac25;", { 8534, 0 } },
-    { "&frac34;", { 190, 0 } },
-    { "&frac35;", { 8535, 0 } },
-    { "&frac38;", { 8540, 0 } },
-    { "&frac45;", { 8536, 0 } },
-    { "&frac56;", { 8538, 0 } },
-    { "&frac58;", { 8541, 0 } },
-    { "&frac78;", { 8542, 0 } },
-    { "&frasl;", { 8260, 0 } },
-    { "&frown;", { 8994, 0 } },
-    { "&fscr;", { 119995, 0 } },
-    { "&gE;", { 8807, 0 } },
-    { "&gEl;", { 10892, 0 } },
-    { "&gacute;", { 501, 0 } },
-    { "&gamma;", { 947, 0 } },
-    { "&gammad;", { 989, 0 } },
-    { "&gap;", { 10886, 0 } },
-    { "&gbreve;", { 287, 0 } },
-    { "&gcirc;", { 285, 0 } },
-    { "&gcy;", { 1075, 0 } },
-    { "&gdot;", { 289, 0 } },
-    { "&ge;", { 8805, 0 } },
-    { "&gel;", { 8923, 0 } },
-    { "&geq;", { 8805, 0 } },
-    { "&geqq;", { 8807, 0 } },
-    { "&geqslant;", { 10878, 0 } },
-    { "&ges;", { 10878, 0 } },
-    { "&gescc;", { 10921, 0 } },
-    { "&gesdot;", { 10880, 0 } },
-    { "&gesdoto;", { 10882, 0 } },
-    { "&gesdotol;", { 10884, 0 } },
-    { "&gesl;", { 8923, 65024 } },
-    { "&gesles;", { 10900, 0 } },
-    { "&gfr;", { 120100, 0 } },
-    { "&gg;", { 8811, 0 } },
-    { "&ggg;", { 8921, 0 } },
-    { "&gimel;", { 8503, 0 } },
-    { "&gjcy;", { 1107, 0 } },
-    { "&gl;", { 8823, 0 } },
-    { "&glE;", { 10898, 0 } },
-    { "&gla;", { 10917, 0 } },
-    { "&glj;", { 10916, 0 } },
-    { "&gnE;", { 8809, 0 } },
-    { "&gnap;", { 10890, 0 } },
-    { "&gnapprox;", { 10890, 0 } },
-    { "&gne;", { 10888, 0 } },
-    { "&gneq;", { 10888, 0 } },
-    { "&gneqq;", { 8809, 0 } },
-    { "&gnsim;", { 8935, 0 } },
-    { "&gopf;", { 120152, 0 } },
-    { "&grave;", { 96, 0 } },
-    { "&gscr;", { 8458, 0 } },
-    { "&gsim;", { 8819, 0 } },
-    { "&gsime;", { 10894, 0 } },
-    { "&gsiml;", { 10896, 0 } },
-    { "&gt;", { 62, 0 } },
-    { "&gtcc;", { 10919, 0 } },
-    { "&gtcir;", { 10874, 0 } },
-    { "&gtdot;", { 8919, 0 } },
-    { "&gtlPar;", { 10645, 0 } },
-    { "&gtquest;", { 10876, 0 } },
-    { "&gtrapprox;", { 10886, 0 } },
-    { "&gtrarr;", { 10616, 0 } },
-    { "&gtrdot;", { 8919, 0 } },
-    { "&gtreqless;", { 8923, 0 } },
-    { "&gtreqqless;", { 10892, 0 } },
-    { "&gtrless;", { 8823, 0 } },
-    { "&gtrsim;", { 8819, 0 } },
-    { "&gvertneqq;", { 8809, 65024 } },
-    { "&gvnE;", { 8809, 65024 } },
-    { "&hArr;", { 8660, 0 } },
-    { "&hairsp;", { 8202, 0 } },
-    { "&half;", { 189, 0 } },
-    { "&hamilt;", { 8459, 0 } },
-    { "&hardcy;", { 1098, 0 } },
-    { "&harr;", { 8596, 0 } },
-    { "&harrcir;", { 10568, 0 } },
-    { "&harrw;", { 8621, 0 } },
-    { "&hbar;", { 8463, 0 } },
-    { "&hcirc;", { 293, 0 } },
-    { "&hearts;", { 9829, 0 } },
-    { "&heartsuit;", { 9829, 0 } },
-    { "&hellip;", { 8230, 0 } },
-    { "&hercon;", { 8889, 0 } },
-    { "&hfr;", { 120101, 0 } },
-    { "&hksearow;", { 10533, 0 } },
-    { "&hkswarow;", { 10534, 0 } },
-    { "&hoarr;", { 8703, 0 } },
-    { "&homtht;", { 8763, 0 } },
-    { "&hookleftarrow;", { 8617, 0 } },
-    { "&hookrightarrow;", { 8618, 0 } },
-    { "&hopf;", { 120153, 0 } },
-    { "&horbar;", { 8213, 0 } },
-    { "&hscr;", { 119997, 0 } },
-    { "&hslash;", { 8463, 0 } },
-    { "&hstrok;", { 295, 0 } },
-    { "&hybull;", { 8259, 0 } },
-    { "&hyphen;", { 8208, 0 } },
-    { "&iacute;", { 237, 0 } },
-    { "&ic;", { 8291, 0 } },
-    { "&icirc;", { 238, 0 } },
-    { "&icy;", { 1080, 0 } },
-    { "&iecy;", { 1077, 0 } },
-    { "&iexcl;", { 161, 0 } },
-    { "&iff;", { 8660, 0 } },
-    { "&ifr;", { 120102, 0 } },
-    { "&igrave;", { 236, 0 } },
-    { "&ii;", { 8520, 0 } },
-    { "&iiiint;", { 10764, 0 } },
-    { "&iiint;", { 8749, 0 } },
-    { "&iinfin;", { 10716, 0 } },
-    { "&iiota;", { 8489, 0 } },
-    { "&ijlig;", { 307, 0 } },
-    { "&imacr;", { 299, 0 } },
-    { "&image;", { 8465, 0 } },
-    { "&imagline;", { 8464, 0 } },
-    { "&imagpart;", { 8465, 0 } },
-    { "&imath;", { 305, 0 } },
-    { "&imof;", { 8887, 0 } },
-    { "&imped;", { 437, 0 } },
-    { "&in;", { 8712, 0 } },
-    { "&incare;", { 8453, 0 } },
-    { "&infin;", { 8734, 0 } },
-    { "&infintie;", { 10717, 0 } },
-    { "&inodot;", { 305, 0 } },
-    { "&int;", { 8747, 0 } },
-    { "&intcal;", { 8890, 0 } },
-    { "&integers;", { 8484, 0 } },
-    { "&intercal;", { 8890, 0 } },
-    { "&intlarhk;", { 10775, 0 } },
-    { "&intprod;", { 10812, 0 } },
-    { "&iocy;", { 1105, 0 } },
-    { "&iogon;", { 303, 0 } },
-    { "&iopf;", { 120154, 0 } },
-    { "&iota;", { 953, 0 } },
-    { "&iprod;", { 10812, 0 } },
-    { "&iquest;", { 191, 0 } },
-    { "&iscr;", { 119998, 0 } },
-    { "&isin;", { 8712, 0 } },
-    { "&isinE;", { 8953, 0 } },
-    { "&isindot;", { 8949, 0 } },
-    { "&isins;", { 8948, 0 } },
-    { "&isinsv;", { 8947, 0 } },
-    { "&isinv;", { 8712, 0 } },
-    { "&it;", { 8290, 0 } },
-    { "&itilde;", { 297, 0 } },
-    { "&iukcy;", { 1110, 0 } },
-    { "&iuml;", { 239, 0 } },
-    { "&jcirc;", { 309, 0 } },
-    { "&jcy;", { 1081, 0 } },
-    { "&jfr;", { 120103, 0 } },
-    { "&jmath;", { 567, 0 } },
-    { "&jopf;", { 120155, 0 } },
-    { "&jscr;", { 119999, 0 } },
-    { "&jsercy;", { 1112, 0 } },
-    { "&jukcy;", { 1108, 0 } },
-    { "&kappa;", { 954, 0 } },
-    { "&kappav;", { 1008, 0 } },
-    { "&kcedil;", { 311, 0 } },
-    { "&kcy;", { 1082, 0 } },
-    { "&kfr;", { 120104, 0 } },
-    { "&kgreen;", { 312, 0 } },
-    { "&khcy;", { 1093, 0 } },
-    { "&kjcy;", { 1116, 0 } },
-    { "&kopf;", { 120156, 0 } },
-    { "&kscr;", { 120000, 0 } },
-    { "&lAarr;", { 8666, 0 } },
-    { "&lArr;", { 8656, 0 } },
-    { "&lAtail;", { 10523, 0 } },
-    { "&lBarr;", { 10510, 0 } },
-    { "&lE;", { 8806, 0 } },
-    { "&lEg;", { 10891, 0 } },
-    { "&lHar;", { 10594, 0 } },
-    { "&lacute;", { 314, 0 } },
-    { "&laemptyv;", { 10676, 0 } },
-    { "&lagran;", { 8466, 0 } },
-    { "&lambda;", { 955, 0 } },
-    { "&lang;", { 10216, 0 } },
-    { "&langd;", { 10641, 0 } },
-    { "&langle;", { 10216, 0 } },
-    { "&lap;", { 10885, 0 } },
-    { "&laquo;", { 171, 0 } },
-    { "&larr;", { 8592, 0 } },
-    { "&larrb;", { 8676, 0 } },
-    { "&larrbfs;", { 10527, 0 } },
-    { "&larrfs;", { 10525, 0 } },
-    { "&larrhk;", { 8617, 0 } },
-    { "&larrlp;", { 8619, 0 } },
-    { "&larrpl;", { 10553, 0 } },
-    { "&larrsim;", { 10611, 0 } },
-    { "&larrtl;", { 8610, 0 } },
-    { "&lat;", { 10923, 0 } },
-    { "&latail;", { 10521, 0 } },
-    { "&late;", { 10925, 0 } },
-    { "&lates;", { 10925, 65024 } },
-    { "&lbarr;", { 10508, 0 } },
-    { "&lbbrk;", { 10098, 0 } },
-    { "&lbrace;", { 123, 0 } },
-    { "&lbrack;", { 91, 0 } },
-    { "&lbrke;", { 10635, 0 } },
-    { "&lbrksld;", { 10639, 0 } },
-    { "&lbrkslu;", { 10637, 0 } },
-    { "&lcaron;", { 318, 0 } },
-    { "&lcedil;", { 316, 0 } },
-    { "&lceil;", { 8968, 0 } },
-    { "&lcub;", { 123, 0 } },
-    { "&lcy;", { 1083, 0 } },
-    { "&ldca;", { 10550, 0 } },
-    { "&ldquo;", { 8220, 0 } },
-    { "&ldquor;", { 8222, 0 } },
-    { "&ldrdhar;", { 10599, 0 } },
-    { "&ldrushar;", { 10571, 0 } },
-    { "&ldsh;", { 8626, 0 } },
-    { "&le;", { 8804, 0 } },
-    { "&leftarrow;", { 8592, 0 } },
-    { "&leftarrowtail;", { 8610, 0 } },
-    { "&leftharpoondown;", { 8637, 0 } },
-    { "&leftharpoonup;", { 8636, 0 } },
-    { "&leftleftarrows;", { 8647, 0 } },
-    { "&leftrightarrow;", { 8596, 0 } },
-    { "&leftrightarrows;", { 8646, 0 } },
-    { "&leftrightharpoons;", { 8651, 0 } },
-    { "&leftrightsquigarrow;", { 8621, 0 } },
-    { "&leftthreetimes;", { 8907, 0 } },
-    { "&leg;", { 8922, 0 } },
-    { "&leq;", { 8804, 0 } },
-    { "&leqq;", { 8806, 0 } },
-    { "&leqslant;", { 10877, 0 } },
-    { "&les;", { 10877, 0 } },
-    { "&lescc;", { 10920, 0 } },
-    { "&lesdot;", { 10879, 0 } },
-    { "&lesdoto;", { 10881, 0 } },
-    { "&lesdotor;", { 10883, 0 } },
-    { "&lesg;", { 8922, 65024 } },
-    { "&lesges;", { 10899, 0 } },
-    { "&lessapprox;", { 10885, 0 } },
-    { "&lessdot;", { 8918, 0 } },
-    { "&lesseqgtr;", { 8922, 0 } },
-    { "&lesseqqgtr;", { 10891, 0 } },
-    { "&lessgtr;", { 8822, 0 } },
-    { "&lesssim;", { 8818, 0 } },
-    { "&lfisht;", { 10620, 0 } },
-    { "&lfloor;", { 8970, 0 } },
-    { "&lfr;", { 120105, 0 } },
-    { "&lg;", { 8822, 0 } },
-    { "&lgE;", { 10897, 0 } },
-    { "&lhard;", { 8637, 0 } },
-    { "&lharu;", { 8636, 0 } },
-    { "&lharul;", { 10602, 0 } },
-    { "&lhblk;", { 9604, 0 } },
-    { "&ljcy;", { 1113, 0 } },
-    { "&ll;", { 8810, 0 } },
-    { "&llarr;", { 8647, 0 } },
-    { "&llcorner;", { 8990, 0 } },
-    { "&llhard;", { 10603, 0 } },
-    { "&lltri;", { 9722, 0 } },
-    { "&lmidot;", { 320, 0 } },
-    { "&lmoust;", { 9136, 0 } },
-    { "&lmoustache;", { 9136, 0 } },
-    { "&lnE;", { 8808, 0 } },
-    { "&lnap;", { 10889, 0 } },
-    { "&lnapprox;", { 10889, 0 } },
-    { "&lne;", { 10887, 0 } },
-    { "&lneq;", { 10887, 0 } },
-    { "&lneqq;", { 8808, 0 } },
-    { "&lnsim;", { 8934, 0 } },
-    { "&loang;", { 10220, 0 } },
-    { "&loarr;", { 8701, 0 } },
-    { "&lobrk;", { 10214, 0 } },
-    { "&longleftarrow;", { 10229, 0 } },
-    { "&longleftrightarrow;", { 10231, 0 } },
-    { "&longmapsto;", { 10236, 0 } },
-    { "&longrightarrow;", { 10230, 0 } },
-    { "&looparrowleft;", { 8619, 0 } },
-    { "&looparrowright;", { 8620, 0 } },
-    { "&lopar;", { 10629, 0 } },
-    { "&lopf;", { 120157, 0 } },
-    { "&loplus;", { 10797, 0 } },
-    { "&lotimes;", { 10804, 0 } },
-    { "&lowast;", { 8727, 0 } },
-    { "&lowbar;", { 95, 0 } },
-    { "&loz;", { 9674, 0 } },
-    { "&lozenge;", { 9674, 0 } },
-    { "&lozf;", { 10731, 0 } },
-    { "&lpar;", { 40, 0 } },
-    { "&lparlt;", { 10643, 0 } },
-    { "&lrarr;", { 8646, 0 } },
-    { "&lrcorner;", { 8991, 0 } },
-    { "&lrhar;", { 8651, 0 } },
-    { "&lrhard;", { 10605, 0 } },
-    { "&lrm;", { 8206, 0 } },
-    { "&lrtri;", { 8895, 0 } },
-    { "&lsaquo;", { 8249, 0 } },
-    { "&lscr;", { 120001, 0 } },
-    { "&lsh;", { 8624, 0 } },
-    { "&lsim;", { 8818, 0 } },
-    { "&lsime;", { 10893, 0 } },
-    { "&lsimg;", { 10895, 0 } },
-    { "&lsqb;", { 91, 0 } },
-    { "&lsquo;", { 8216, 0 } },
-    { "&lsquor;", { 8218, 0 } },
-    { "&lstrok;", { 322, 0 } },
-    { "&lt;", { 60, 0 } },
-    { "&ltcc;", { 10918, 0 } },
-    { "&ltcir;", { 10873, 0 } },
-    { "&ltdot;", { 8918, 0 } },
-    { "&lthree;", { 8907, 0 } },
-    { "&ltimes;", { 8905, 0 } },
-    { "&ltlarr;", { 10614, 0 } },
-    { "&ltquest;", { 10875, 0 } },
-    { "&ltrPar;", { 10646, 0 } },
-    { "&ltri;", { 9667, 0 } },
-    { "&ltrie;", { 8884, 0 } },
-    { "&ltrif;", { 9666, 0 } },
-    { "&lurdshar;", { 10570, 0 } },
-    { "&luruhar;", { 10598, 0 } },
-    { "&lvertneqq;", { 8808, 65024 } },
-    { "&lvnE;", { 8808, 65024 } },
-    { "&mDDot;", { 8762, 0 } },
-    { "&macr;", { 175, 0 } },
-    { "&male;", { 9794, 0 } },
-    { "&malt;", { 10016, 0 } },
-    { "&maltese;", { 10016, 0 } },
-    { "&map;", { 8614, 0 } },
-    { "&mapsto;", { 8614, 0 } },
-    { "&mapstodown;", { 8615, 0 } },
-    { "&mapstoleft;", { 8612, 0 } },
-    { "&mapstoup;", { 8613, 0 } },
-    { "&marker;", { 9646, 0 } },
-    { "&mcomma;", { 10793, 0 } },
-    { "&mcy;", { 1084, 0 } },
-    { "&mdash;", { 8212, 0 } },
-    { "&measuredangle;", { 8737, 0 } },
-    { "&mfr;", { 120106, 0 } },
-    { "&mho;", { 8487, 0 } },
-    { "&micro;", { 181, 0 } },
-    { "&mid;", { 8739, 0 } },
-    { "&midast;", { 42, 0 } },
-    { "&midcir;", { 10992, 0 } },
-    { "&middot;", { 183, 0 } },
-    { "&minus;", { 8722, 0 } },
-    { "&minusb;", { 8863, 0 } },
-    { "&minusd;", { 8760, 0 } },
-    { "&minusdu;", { 10794, 0 } },
-    { "&mlcp;", { 10971, 0 } },
-    { "&mldr;", { 8230, 0 } },
-    { "&mnplus;", { 8723, 0 } },
-    { "&models;", { 8871, 0 } },
-    { "&mopf;", { 120158, 0 } },
-    { "&mp;", { 8723, 0 } },
-    { "&mscr;", { 120002, 0 } },
-    { "&mstpos;", { 8766, 0 } },
-    { "&mu;", { 956, 0 } },
-    { "&multimap;", { 8888, 0 } },
-    { "&mumap;", { 8888, 0 } },
-    { "&nGg;", { 8921, 824 } },
-    { "&nGt;", { 8811, 8402 } },
-    { "&nGtv;", { 8811, 824 } },
-    { "&nLeftarrow;", { 8653, 0 } },
-    { "&nLeftrightarrow;", { 8654, 0 } },
-    { "&nLl;", { 8920, 824 } },
-    { "&nLt;", { 8810, 8402 } },
-    { "&nLtv;", { 8810, 824 } },
-    { "&nRightarrow;", { 8655, 0 } },
-    { "&nVDash;", { 8879, 0 } },
-    { "&nVdash;", { 8878, 0 } },
-    { "&nabla;", { 8711, 0 } },
-    { "&nacute;", { 324, 0 } },
-    { "&nang;", { 8736, 8402 } },
-    { "&nap;", { 8777, 0 } },
-    { "&napE;", { 10864, 824 } },
-    { "&napid;", { 8779, 824 } },
-    { "&napos;", { 329, 0 } },
-    { "&napprox;", { 8777, 0 } },
-    { "&natur;", { 9838, 0 } },
-    { "&natural;", { 9838, 0 } },
-    { "&naturals;", { 8469, 0 } },
-    { "&nbsp;", { 160, 0 } },
-    { "&nbump;", { 8782, 824 } },
-    { "&nbumpe;", { 8783, 824 } },
-    { "&ncap;", { 10819, 0 } },
-    { "&ncaron;", { 328, 0 } },
-    { "&ncedil;", { 326, 0 } },
-    { "&ncong;", { 8775, 0 } },
-    { "&ncongdot;", { 10861, 824 } },
-    { "&ncup;", { 10818, 0 } },
-    { "&ncy;", { 1085, 0 } },
-    { "&ndash;", { 8211, 0 } },
-    { "&ne;", { 8800, 0 } },
-    { "&neArr;", { 8663, 0 } },
-    { "&nearhk;", { 10532, 0 } },
-    { "&nearr;", { 8599, 0 } },
-    { "&nearrow;", { 8599, 0 } },
-    { "&nedot;", { 8784, 824 } },
-    { "&nequiv;", { 8802, 0 } },
-    { "&nesear;", { 10536, 0 } },
-    { "&nesim;", { 8770, 824 } },
-    { "&nexist;", { 8708, 0 } },
-    { "&nexists;", { 8708, 0 } },
-    { "&nfr;", { 120107, 0 } },
-    { "&ngE;", { 8807, 824 } },
-    { "&nge;", { 8817, 0 } },
-    { "&ngeq;", { 8817, 0 } },
-    { "&ngeqq;", { 8807, 824 } },
-    { "&ngeqslant;", { 10878, 824 } },
-    { "&nges;", { 10878, 824 } },
-    { "&ngsim;", { 8821, 0 } },
-    { "&ngt;", { 8815, 0 } },
-    { "&ngtr;", { 8815, 0 } },
-    { "&nhArr;", { 8654, 0 } },
-    { "&nharr;", { 8622, 0 } },
-    { "&nhpar;", { 10994, 0 } },
-    { "&ni;", { 8715, 0 } },
-    { "&nis;", { 8956, 0 } },
-    { "&nisd;", { 8954, 0 } },
-    { "&niv;", { 8715, 0 } },
-    { "&njcy;", { 1114, 0 } },
-    { "&nlArr;", { 8653, 0 } },
-    { "&nlE;", { 8806, 824 } },
-    { "&nlarr;", { 8602, 0 } },
-    { "&nldr;", { 8229, 0 } },
-    { "&nle;", { 8816, 0 } },
-    { "&nleftarrow;", { 8602, 0 } },
-    { "&nleftrightarrow;", { 8622, 0 } },
-    { "&nleq;", { 8816, 0 } },
-    { "&nleqq;", { 8806, 824 } },
-    { "&nleqslant;", { 10877, 824 } },
-    { "&nles;", { 10877, 824 } },
-    { "&nless;", { 8814, 0 } },
-    { "&nlsim;", { 8820, 0 } },
-    { "&nlt;", { 8814, 0 } },
-    { "&nltri;", { 8938, 0 } },
-    { "&nltrie;", { 8940, 0 } },
-    { "&nmid;", { 8740, 0 } },
-    { "&nopf;", { 120159, 0 } },
-    { "&not;", { 172, 0 } },
-    { "&notin;", { 8713, 0 } },
-    { "&notinE;", { 8953, 824 } },
-    { "&notindot;", { 8949, 824 } },
-    { "&notinva;", { 8713, 0 } },
-    { "&notinvb;", { 8951, 0 } },
-    { "&notinvc;", { 8950, 0 } },
-    { "&notni;", { 8716, 0 } },
-    { "&notniva;", { 8716, 0 } },
-    { "&notnivb;", { 8958, 0 } },
-    { "&notnivc;", { 8957, 0 } },
-    { "&npar;", { 8742, 0 } },
-    { "&nparallel;", { 8742, 0 } },
-    { "&nparsl;", { 11005, 8421 } },
-    { "&npart;", { 8706, 824 } },
-    { "&npolint;", { 10772, 0 } },
-    { "&npr;", { 8832, 0 } },
-    { "&nprcue;", { 8928, 0 } },
-    { "&npre;", { 10927, 824 } },
-    { "&nprec;", { 8832, 0 } },
-    { "&npreceq;", { 10927, 824 } },
-    { "&nrArr;", { 8655, 0 } },
-    { "&nrarr;", { 8603, 0 } },
-    { "&nrarrc;", { 10547, 824 } },
-    { "&nrarrw;", { 8605, 824 } },
-    { "&nrightarrow;", { 8603, 0 } },
-    { "&nrtri;", { 8939, 0 } },
-    { "&nrtrie;", { 8941, 0 } },
-    { "&nsc;", { 8833, 0 } },
-    { "&nsccue;", { 8929, 0 } },
-    { "&nsce;", { 10928, 824 } },
-    { "&nscr;", { 120003, 0 } },
-    { "&nshortmid;", { 8740, 0 } },
-    { "&nshortparallel;", { 8742, 0 } },
-    { "&nsim;", { 8769, 0 } },
-    { "&nsime;", { 8772, 0 } },
-    { "&nsimeq;", { 8772, 0 } },
-    { "&nsmid;", { 8740, 0 } },
-    { "&nspar;", { 8742, 0 } },
-    { "&nsqsube;", { 8930, 0 } },
-    { "&nsqsupe;", { 8931, 0 } },
-    { "&nsub;", { 8836, 0 } },
-    { "&nsubE;", { 10949, 824 } },
-    { "&nsube;", { 8840, 0 } },
-    { "&nsubset;", { 8834, 8402 } },
-    { "&nsubseteq;", { 8840, 0 } },
-    { "&nsubseteqq;", { 10949, 824 } },
-    { "&nsucc;", { 8833, 0 } },
-    { "&nsucceq;", { 10928, 824 } },
-    { "&nsup;", { 8837, 0 } },
-    { "&nsupE;", { 10950, 824 } },
-    { "&nsupe;", { 8841, 0 } },
-    { "&nsupset;", { 8835, 8402 } },
-    { "&nsupseteq;", { 8841, 0 } },
-    { "&nsupseteqq;", { 10950, 824 } },
-    { "&ntgl;", { 8825, 0 } },
-    { "&ntilde;", { 241, 0 } },
-    { "&ntlg;", { 8824, 0 } },
-    { "&ntriangleleft;", { 8938, 0 } },
-    { "&ntrianglelefteq;", { 8940, 0 } },
-    { "&ntriangleright;", { 8939, 0 } },
-    { "&ntrianglerighteq;", { 8941, 0 } },
-    { "&nu;", { 957, 0 } },
-    { "&num;", { 35, 0 } },
-    { "&numero;", { 8470, 0 } },
-    { "&numsp;", { 8199, 0 } },
-    { "&nvDash;", { 8877, 0 } },
-    { "&nvHarr;", { 10500, 0 } },
-    { "&nvap;", { 8781, 8402 } },
-    { "&nvdash;", { 8876, 0 } },
-    { "&nvge;", { 8805, 8402 } },
-    { "&nvgt;", { 62, 8402 } },
-    { "&nvinfin;", { 10718, 0 } },
-    { "&nvlArr;", { 10498, 0 } },
-    { "&nvle;", { 8804, 8402 } },
-    { "&nvlt;", { 60, 8402 } },
-    { "&nvltrie;", { 8884, 8402 } },
-    { "&nvrArr;", { 10499, 0 } },
-    { "&nvrtrie;", { 8885, 8402 } },
-    { "&nvsim;", { 8764, 8402 } },
-    { "&nwArr;", { 8662, 0 } },
-    { "&nwarhk;", { 10531, 0 } },
-    { "&nwarr;", { 8598, 0 } },
-    { "&nwarrow;", { 8598, 0 } },
-    { "&nwnear;", { 10535, 0 } },
-    { "&oS;", { 9416, 0 } },
-    { "&oacute;", { 243, 0 } },
-    { "&oast;", { 8859, 0 } },
-    { "&ocir;", { 8858, 0 } },
-    { "&ocirc;", { 244, 0 } },
-    { "&ocy;", { 1086, 0 } },
-    { "&odash;", { 8861, 0 } },
-    { "&odblac;", { 337, 0 } },
-    { "&odiv;", { 10808, 0 } },
-    { "&odot;", { 8857, 0 } },
-    { "&odsold;", { 10684, 0 } },
-    { "&oelig;", { 339, 0 } },
-    { "&ofcir;", { 10687, 0 } },
-    { "&ofr;", { 120108, 0 } },
-    { "&ogon;", { 731, 0 } },
-    { "&ograve;", { 242, 0 } },
-    { "&ogt;", { 10689, 0 } },
-    { "&ohbar;", { 10677, 0 } },
-    { "&ohm;", { 937, 0 } },
-    { "&oint;", { 8750, 0 } },
-    { "&olarr;", { 8634, 0 } },
-    { "&olcir;", { 10686, 0 } },
-    { "&olcross;", { 10683, 0 } },
-    { "&oline;", { 8254, 0 } },
-    { "&olt;", { 10688, 0 } },
-    { "&omacr;", { 333, 0 } },
-    { "&omega;", { 969, 0 } },
-    { "&omicron;", { 959, 0 } },
-    { "&omid;", { 10678, 0 } },
-    { "&ominus;", { 8854, 0 } },
-    { "&oopf;", { 120160, 0 } },
-    { "&opar;", { 10679, 0 } },
-    { "&operp;", { 10681, 0 } },
-    { "&oplus;", { 8853, 0 } },
-    { "&or;", { 8744, 0 } },
-    { "&orarr;", { 8635, 0 } },
-    { "&ord;", { 10845, 0 } },
-    { "&order;", { 8500, 0 } },
-    { "&orderof;", { 8500, 0 } },
-    { "&ordf;", { 170, 0 } },
-    { "&ordm;", { 186, 0 } },
-    { "&origof;", { 8886, 0 } },
-    { "&oror;", { 10838, 0 } },
-    { "&orslope;", { 10839, 0 } },
-    { "&orv;", { 10843, 0 } },
-    { "&oscr;", { 8500, 0 } },
-    { "&oslash;", { 248, 0 } },
-    { "&osol;", { 8856, 0 } },
-    { "&otilde;", { 245, 0 } },
-    { "&otimes;", { 8855, 0 } },
-    { "&otimesas;", { 10806, 0 } },
-    { "&ouml;", { 246, 0 } },
-    { "&ovbar;", { 9021, 0 } },
-    { "&par;", { 8741, 0 } },
-    { "&para;", { 182, 0 } },
-    { "&parallel;", { 8741, 0 } },
-    { "&parsim;", { 10995, 0 } },
-    { "&parsl;", { 11005, 0 } },
-    { "&part;", { 8706, 0 } },
-    { "&pcy;", { 1087, 0 } },
-    { "&percnt;", { 37, 0 } },
-    { "&period;", { 46, 0 } },
-    { "&permil;", { 8240, 0 } },
-    { "&perp;", { 8869, 0 } },
-    { "&pertenk;", { 8241, 0 } },
-    { "&pfr;", { 120109, 0 } },
-    { "&phi;", { 966, 0 } },
-    { "&phiv;", { 981, 0 } },
-    { "&phmmat;", { 8499, 0 } },
-    { "&phone;", { 9742, 0 } },
-    { "&pi;", { 960, 0 } },
-    { "&pitchfork;", { 8916, 0 } },
-    { "&piv;", { 982, 0 } },
-    { "&planck;", { 8463, 0 } },
-    { "&planckh;", { 8462, 0 } },
-    { "&plankv;", { 8463, 0 } },
-    { "&plus;", { 43, 0 } },
-    { "&plusacir;", { 10787, 0 } },
-    { "&plusb;", { 8862, 0 } },
-    { "&pluscir;", { 10786, 0 } },
-    { "&plusdo;", { 8724, 0 } },
-    { "&plusdu;", { 10789, 0 } },
-    { "&pluse;", { 10866, 0 } },
-    { "&plusmn;", { 177, 0 } },
-    { "&plussim;", { 10790, 0 } },
-    { "&plustwo;", { 10791, 0 } },
-    { "&pm;", { 177, 0 } },
-    { "&pointint;", { 10773, 0 } },
-    { "&popf;", { 120161, 0 } },
-    { "&pound;", { 163, 0 } },
-    { "&pr;", { 8826, 0 } },
-    { "&prE;", { 10931, 0 } },
-    { "&prap;", { 10935, 0 } },
-    { "&prcue;", { 8828, 0 } },
-    { "&pre;", { 10927, 0 } },
-    { "&prec;", { 8826, 0 } },
-    { "&precapprox;", { 10935, 0 } },
-    { "&preccurlyeq;", { 8828, 0 } },
-    { "&preceq;", { 10927, 0 } },
-    { "&precnapprox;", { 10937, 0 } },
-    { "&precneqq;", { 10933, 0 } },
-    { "&precnsim;", { 8936, 0 } },
-    { "&precsim;", { 8830, 0 } },
-    { "&prime;", { 8242, 0 } },
-    { "&primes;", { 8473, 0 } },
-    { "&prnE;", { 10933, 0 } },
-    { "&prnap;", { 10937, 0 } },
-    { "&prnsim;", { 8936, 0 } },
-    { "&prod;", { 8719, 0 } },
-    { "&profalar;", { 9006, 0 } },
-    { "&profline;", { 8978, 0 } },
-    { "&profsurf;", { 8979, 0 } },
-    { "&prop;", { 8733, 0 } },
-    { "&propto;", { 8733, 0 } },
-    { "&prsim;", { 8830, 0 } },
-    { "&prurel;", { 8880, 0 } },
-    { "&pscr;", { 120005, 0 } },
-    { "&psi;", { 968, 0 } },
-    { "&puncsp;", { 8200, 0 } },
-    { "&qfr;", { 120110, 0 } },
-    { "&qint;", { 10764, 0 } },
-    { "&qopf;", { 120162, 0 } },
-    { "&qprime;", { 8279, 0 } },
-    { "&qscr;", { 120006, 0 } },
-    { "&quaternions;", { 8461, 0 } },
-    { "&quatint;", { 10774, 0 } },
-    { "&quest;", { 63, 0 } },
-    { "&questeq;", { 8799, 0 } },
-    { "&quot;", { 34, 0 } },
-    { "&rAarr;", { 8667, 0 } },
-    { "&rArr;", { 8658, 0 } },
-    { "&rAtail;", { 10524, 0 } },
-    { "&rBarr;", { 10511, 0 } },
-    { "&rHar;", { 10596, 0 } },
-    { "&race;", { 8765, 817 } },
-    { "&racute;", { 341, 0 } },
-    { "&radic;", { 8730, 0 } },
-    { "&raemptyv;", { 10675, 0 } },
-    { "&rang;", { 10217, 0 } },
-    { "&rangd;", { 10642, 0 } },
-    { "&range;", { 10661, 0 } },
-    { "&rangle;", { 10217, 0 } },
-    { "&raquo;", { 187, 0 } },
-    { "&rarr;", { 8594, 0 } },
-    { "&rarrap;", { 10613, 0 } },
-    { "&rarrb;", { 8677, 0 } },
-    { "&rarrbfs;", { 10528, 0 } },
-    { "&rarrc;", { 10547, 0 } },
-    { "&rarrfs;", { 10526, 0 } },
-    { "&rarrhk;", { 8618, 0 } },
-    { "&rarrlp;", { 8620, 0 } },
-    { "&rarrpl;", { 10565, 0 } },
-    { "&rarrsim;", { 10612, 0 } },
-    { "&rarrtl;", { 8611, 0 } },
-    { "&rarrw;", { 8605, 0 } },
-    { "&ratail;", { 10522, 0 } },
-    { "&ratio;", { 8758, 0 } },
-    { "&rationals;", { 8474, 0 } },
-    { "&rbarr;", { 10509, 0 } },
-    { "&rbbrk;", { 10099, 0 } },
-    { "&rbrace;", { 125, 0 } },
-    { "&rbrack;", { 93, 0 } },
-    { "&rbrke;", { 10636, 0 } },
-    { "&rbrksld;", { 10638, 0 } },
-    { "&rbrkslu;", { 10640, 0 } },
-    { "&rcaron;", { 345, 0 } },
-    { "&rcedil;", { 343, 0 } },
-    { "&rceil;", { 8969, 0 } },
-    { "&rcub;", { 125, 0 } },
-    { "&rcy;", { 1088, 0 } },
-    { "&rdca;", { 10551, 0 } },
-    { "&rdldhar;", { 10601, 0 } },
-    { "&rdquo;", { 8221, 0 } },
-    { "&rdquor;", { 8221, 0 } },
-    { "&rdsh;", { 8627, 0 } },
-    { "&real;", { 8476, 0 } },
-    { "&realine;", { 8475, 0 } },
-    { "&realpart;", { 8476, 0 } },
-    { "&reals;", { 8477, 0 } },
-    { "&rect;", { 9645, 0 } },
-    { "&reg;", { 174, 0 } },
-    { "&rfisht;", { 10621, 0 } },
-    { "&rfloor;", { 8971, 0 } },
-    { "&rfr;", { 120111, 0 } },
-    { "&rhard;", { 8641, 0 } },
-    { "&rharu;", { 8640, 0 } },
-    { "&rharul;", { 10604, 0 } },
-    { "&rho;", { 961, 0 } },
-    { "&rhov;", { 1009, 0 } },
-    { "&rightarrow;", { 8594, 0 } },
-    { "&rightarrowtail;", { 8611, 0 } },
-    { "&rightharpoondown;", { 8641, 0 } },
-    { "&rightharpoonup;", { 8640, 0 } },
-    { "&rightleftarrows;", { 8644, 0 } },
-    { "&rightleftharpoons;", { 8652, 0 } },
-    { "&rightrightarrows;", { 8649, 0 } },
-    { "&rightsquigarrow;", { 8605, 0 } },
-    { "&rightthreetimes;", { 8908, 0 } },
-    { "&ring;", { 730, 0 } },
-    { "&risingdotseq;", { 8787, 0 } },
-    { "&rlarr;", { 8644, 0 } },
-    { "&rlhar;", { 8652, 0 } },
-    { "&rlm;", { 8207, 0 } },
-    { "&rmoust;", { 9137, 0 } },
-    { "&rmoustache;", { 9137, 0 } },
-    { "&rnmid;", { 10990, 0 } },
-    { "&roang;", { 10221, 0 } },
-    { "&roarr;", { 8702, 0 } },
-    { "&robrk;", { 10215, 0 } },
-    { "&ropar;", { 10630, 0 } },
-    { "&ropf;", { 120163, 0 } },
-    { "&roplus;", { 10798, 0 } },
-    { "&rotimes;", { 10805, 0 } },
-    { "&rpar;", { 41, 0 } },
-    { "&rpargt;", { 10644, 0 } },
-    { "&rppolint;", { 10770, 0 } },
-    { "&rrarr;", { 8649, 0 } },
-    { "&rsaquo;", { 8250, 0 } },
-    { "&rscr;", { 120007, 0 } },
-    { "&rsh;", { 8625, 0 } },
-    { "&rsqb;", { 93, 0 } },
-    { "&rsquo;", { 8217, 0 } },
-    { "&rsquor;", { 8217, 0 } },
-    { "&rthree;", { 8908, 0 } },
-    { "&rtimes;", { 8906, 0 } },
-    { "&rtri;", { 9657, 0 } },
-    { "&rtrie;", { 8885, 0 } },
-    { "&rtrif;", { 9656, 0 } },
-    { "&rtriltri;", { 10702, 0 } },
-    { "&ruluhar;", { 10600, 0 } },
-    { "&rx;", { 8478, 0 } },
-    { "&sacute;", { 347, 0 } },
-    { "&sbquo;", { 8218, 0 } },
-    { "&sc;", { 8827, 0 } },
-    { "&scE;", { 10932, 0 } },
-    { "&scap;", { 10936, 0 } },
-    { "&scaron;", { 353, 0 } },
-    { "&sccue;", { 8829, 0 } },
-    { "&sce;", { 10928, 0 } },
-    { "&scedil;", { 351, 0 } },
-    { "&scirc;", { 349, 0 } },
-    { "&scnE;", { 10934, 0 } },
-    { "&scnap;", { 10938, 0 } },
-    { "&scnsim;", { 8937, 0 } },
-    { "&scpolint;", { 10771, 0 } },
-    { "&scsim;", { 8831, 0 } },
-    { "&scy;", { 1089, 0 } },
-    { "&sdot;", { 8901, 0 } },
-    { "&sdotb;", { 8865, 0 } },
-    { "&sdote;", { 10854, 0 } },
-    { "&seArr;", { 8664, 0 } },
-    { "&searhk;", { 10533, 0 } },
-    { "&searr;", { 8600, 0 } },
-    { "&searrow;", { 8600, 0 } },
-    { "&sect;", { 167, 0 } },
-    { "&semi;", { 59, 0 } },
-    { "&seswar;", { 10537, 0 } },
-    { "&setminus;", { 8726, 0 } },
-    { "&setmn;", { 8726, 0 } },
-    { "&sext;", { 10038, 0 } },
-    { "&sfr;", { 120112, 0 } },
-    { "&sfrown;", { 8994, 0 } },
-    { "&sharp;", { 9839, 0 } },
-    { "&shchcy;", { 1097, 0 } },
-    { "&shcy;", { 1096, 0 } },
-    { "&shortmid;", { 8739, 0 } },
-    { "&shortparallel;", { 8741, 0 } },
-    { "&shy;", { 173, 0 } },
-    { "&sigma;", { 963, 0 } },
-    { "&sigmaf;", { 962, 0 } },
-    { "&sigmav;", { 962, 0 } },
-    { "&sim;", { 8764, 0 } },
-    { "&simdot;", { 10858, 0 } },
-    { "&sime;", { 8771, 0 } },
-    { "&simeq;", { 8771, 0 } },
-    { "&simg;", { 10910, 0 } },
-    { "&simgE;", { 10912, 0 } },
-    { "&siml;", { 10909, 0 } },
-    { "&simlE;", { 10911, 0 } },
-    { "&simne;", { 8774, 0 } },
-    { "&simplus;", { 10788, 0 } },
-    { "&simrarr;", { 10610, 0 } },
-    { "&slarr;", { 8592, 0 } },
-    { "&smallsetminus;", { 8726, 0 } },
-    { "&smashp;", { 10803, 0 } },
-    { "&smeparsl;", { 10724, 0 } },
-    { "&smid;", { 8739, 0 } },
-    { "&smile;", { 8995, 0 } },
-    { "&smt;", { 10922, 0 } },
-    { "&smte;", { 10924, 0 } },
-    { "&smtes;", { 10924, 65024 } },
-    { "&softcy;", { 1100, 0 } },
-    { "&sol;", { 47, 0 } },
-    { "&solb;", { 10692, 0 } },
-    { "&solbar;", { 9023, 0 } },
-    { "&sopf;", { 120164, 0 } },
-    { "&spades;", { 9824, 0 } },
-    { "&spadesuit;", { 9824, 0 } },
-    { "&spar;", { 8741, 0 } },
-    { "&sqcap;", { 8851, 0 } },
-    { "&sqcaps;", { 8851, 65024 } },
-    { "&sqcup;", { 8852, 0 } },
-    { "&sqcups;", { 8852, 65024 } },
-    { "&sqsub;", { 8847, 0 } },
-    { "&sqsube;", { 8849, 0 } },
-    { "&sqsubset;", { 8847, 0 } },
-    { "&sqsubseteq;", { 8849, 0 } },
-    { "&sqsup;", { 8848, 0 } },
-    { "&sqsupe;", { 8850, 0 } },
-    { "&sqsupset;", { 8848, 0 } },
-    { "&sqsupseteq;", { 8850, 0 } },
-    { "&squ;", { 9633, 0 } },
-    { "&square;", { 9633, 0 } },
-    { "&squarf;", { 9642, 0 } },
-    { "&squf;", { 9642, 0 } },
-    { "&srarr;", { 8594, 0 } },
-    { "&sscr;", { 120008, 0 } },
-    { "&ssetmn;", { 8726, 0 } },
-    { "&ssmile;", { 8995, 0 } },
-    { "&sstarf;", { 8902, 0 } },
-    { "&star;", { 9734, 0 } },
-    { "&starf;", { 9733, 0 } },
-    { "&straightepsilon;", { 1013, 0 } },
-    { "&straightphi;", { 981, 0 } },
-    { "&strns;", { 175, 0 } },
-    { "&sub;", { 8834, 0 } },
-    { "&subE;", { 10949, 0 } },
-    { "&subdot;", { 10941, 0 } },
-    { "&sube;", { 8838, 0 } },
-    { "&subedot;", { 10947, 0 } },
-    { "&submult;", { 10945, 0 } },
-    { "&subnE;", { 10955, 0 } },
-    { "&subne;", { 8842, 0 } },
-    { "&subplus;", { 10943, 0 } },
-    { "&subrarr;", { 10617, 0 } },
-    { "&subset;", { 8834, 0 } },
-    { "&subseteq;", { 8838, 0 } },
-    { "&subseteqq;", { 10949, 0 } },
-    { "&subsetneq;", { 8842, 0 } },
-    { "&subsetneqq;", { 10955, 0 } },
-    { "&subsim;", { 10951, 0 } },
-    { "&subsub;", { 10965, 0 } },
-    { "&subsup;", { 10963, 0 } },
-    { "&succ;", { 8827, 0 } },
-    { "&succapprox;", { 10936, 0 } },
-    { "&succcurlyeq;", { 8829, 0 } },
-    { "&succeq;", { 10928, 0 } },
-    { "&succnapprox;", { 10938, 0 } },
-    { "&succneqq;", { 10934, 0 } },
-    { "&succnsim;", { 8937, 0 } },
-    { "&succsim;", { 8831, 0 } },
-    { "&sum;", { 8721, 0 } },
-    { "&sung;", { 9834, 0 } },
-    { "&sup1;", { 185, 0 } },
-    { "&sup2;", { 178, 0 } },
-    { "&sup3;", { 179, 0 } },
-    { "&sup;", { 8835, 0 } },
-    { "&supE;", { 10950, 0 } },
-    { "&supdot;", { 10942, 0 } },
-    { "&supdsub;", { 10968, 0 } },
-    { "&supe;", { 8839, 0 } },
-    { "&supedot;", { 10948, 0 } },
-    { "&suphsol;", { 10185, 0 } },
-    { "&suphsub;", { 10967, 0 } },
-    { "&suplarr;", { 10619, 0 } },
-    { "&supmult;", { 10946, 0 } },
-    { "&supnE;", { 10956, 0 } },
-    { "&supne;", { 8843, 0 } },
-    { "&supplus;", { 10944, 0 } },
-    { "&supset;", { 8835, 0 } },
-    { "&supseteq;", { 8839, 0 } },
-    { "&supseteqq;", { 10950, 0 } },
-    { "&supsetneq;", { 8843, 0 } },
-    { "&supsetneqq;", { 10956, 0 } },
-    { "&supsim;", { 10952, 0 } },
-    { "&supsub;", { 10964, 0 } },
-    { "&supsup;", { 10966, 0 } },
-    { "&swArr;", { 8665, 0 } },
-    { "&swarhk;", { 10534, 0 } },
-    { "&swarr;", { 8601, 0 } },
-    { "&swarrow;", { 8601, 0 } },
-    { "&swnwar;", { 10538, 0 } },
-    { "&szlig;", { 223, 0 } },
-    { "&target;", { 8982, 0 } },
-    { "&tau;", { 964, 0 } },
-    { "&tbrk;", { 9140, 0 } },
-    { "&tcaron;", { 357, 0 } },
-    { "&tcedil;", { 355, 0 } },
-    { "&tcy;", { 1090, 0 } },
-    { "&tdot;", { 8411, 0 } },
-    { "&telrec;", { 8981, 0 } },
-    { "&tfr;", { 120113, 0 } },
-    { "&there4;", { 8756, 0 } },
-    { "&therefore;", { 8756, 0 } },
-    { "&theta;", { 952, 0 } },
-    { "&thetasym;", { 977, 0 } },
-    { "&thetav;", { 977, 0 } },
-    { "&thickapprox;", { 8776, 0 } },
-    { "&thicksim;", { 8764, 0 } },
-    { "&thinsp;", { 8201, 0 } },
-    { "&thkap;", { 8776, 0 } },
-    { "&thksim;", { 8764, 0 } },
-    { "&thorn;", { 254, 0 } },
-    { "&tilde;", { 732, 0 } },
-    { "&times;", { 215, 0 } },
-    { "&timesb;", { 8864, 0 } },
-    { "&timesbar;", { 10801, 0 } },
-    { "&timesd;", { 10800, 0 } },
-    { "&tint;", { 8749, 0 } },
-    { "&toea;", { 10536, 0 } },
-    { "&top;", { 8868, 0 } },
-    { "&topbot;", { 9014, 0 } },
-    { "&topcir;", { 10993, 0 } },
-    { "&topf;", { 120165, 0 } },
-    { "&topfork;", { 10970, 0 } },
-    { "&tosa;", { 10537, 0 } },
-    { "&tprime;", { 8244, 0 } },
-    { "&trade;", { 8482, 0 } },
-    { "&triangle;", { 9653, 0 } },
-    { "&triangledown;", { 9663, 0 } },
-    { "&triangleleft;", { 9667, 0 } },
-    { "&trianglelefteq;", { 8884, 0 } },
-    { "&triangleq;", { 8796, 0 } },
-    { "&triangleright;", { 9657, 0 } },
-    { "&trianglerighteq;", { 8885, 0 } },
-    { "&tridot;", { 9708, 0 } },
-    { "&trie;", { 8796, 0 } },
-    { "&triminus;", { 10810, 0 } },
-    { "&triplus;", { 10809, 0 } },
-    { "&trisb;", { 10701, 0 } },
-    { "&tritime;", { 10811, 0 } },
-    { "&trpezium;", { 9186, 0 } },
-    { "&tscr;", { 120009, 0 } },
-    { "&tscy;", { 1094, 0 } },
-    { "&tshcy;", { 1115, 0 } },
-    { "&tstrok;", { 359, 0 } },
-    { "&twixt;", { 8812, 0 } },
-    { "&twoheadleftarrow;", { 8606, 0 } },
-    { "&twoheadrightarrow;", { 8608, 0 } },
-    { "&uArr;", { 8657, 0 } },
-    { "&uHar;", { 10595, 0 } },
-    { "&uacute;", { 250, 0 } },
-    { "&uarr;", { 8593, 0 } },
-    { "&ubrcy;", { 1118, 0 } },
-    { "&ubreve;", { 365, 0 } },
-    { "&ucirc;", { 251, 0 } },
-    { "&ucy;", { 1091, 0 } },
-    { "&udarr;", { 8645, 0 } },
-    { "&udblac;", { 369, 0 } },
-    { "&udhar;", { 10606, 0 } },
-    { "&ufisht;", { 10622, 0 } },
-    { "&ufr;", { 120114, 0 } },
-    { "&ugrave;", { 249, 0 } },
-    { "&uharl;", { 8639, 0 } },
-    { "&uharr;", { 8638, 0 } },
-    { "&uhblk;", { 9600, 0 } },
-    { "&ulcorn;", { 8988, 0 } },
-    { "&ulcorner;", { 8988, 0 } },
-    { "&ulcrop;", { 8975, 0 } },
-    { "&ultri;", { 9720, 0 } },
-    { "&umacr;", { 363, 0 } },
-    { "&uml;", { 168, 0 } },
-    { "&uogon;", { 371, 0 } },
-    { "&uopf;", { 120166, 0 } },
-    { "&uparrow;", { 8593, 0 } },
-    { "&updownarrow;", { 8597, 0 } },
-    { "&upharpoonleft;", { 8639, 0 } },
-    { "&upharpoonright;", { 8638, 0 } },
-    { "&uplus;", { 8846, 0 } },
-    { "&upsi;", { 965, 0 } },
-    { "&upsih;", { 978, 0 } },
-    { "&upsilon;", { 965, 0 } },
-    { "&upuparrows;", { 8648, 0 } },
-    { "&urcorn;", { 8989, 0 } },
-    { "&urcorner;", { 8989, 0 } },
-    { "&urcrop;", { 8974, 0 } },
-    { "&uring;", { 367, 0 } },
-    { "&urtri;", { 9721, 0 } },
-    { "&uscr;", { 120010, 0 } },
-    { "&utdot;", { 8944, 0 } },
-    { "&utilde;", { 361, 0 } },
-    { "&utri;", { 9653, 0 } },
-    { "&utrif;", { 9652, 0 } },
-    { "&uuarr;", { 8648, 0 } },
-    { "&uuml;", { 252, 0 } },
-    { "&uwangle;", { 10663, 0 } },
-    { "&vArr;", { 8661, 0 } },
-    { "&vBar;", { 10984, 0 } },
-    { "&vBarv;", { 10985, 0 } },
-    { "&vDash;", { 8872, 0 } },
-    { "&vangrt;", { 10652, 0 } },
-    { "&varepsilon;", { 1013, 0 } },
-    { "&varkappa;", { 1008, 0 } },
-    { "&varnothing;", { 8709, 0 } },
-    { "&varphi;", { 981, 0 } },
-    { "&varpi;", { 982, 0 } },
-    { "&varpropto;", { 8733, 0 } },
-    { "&varr;", { 8597, 0 } },
-    { "&varrho;", { 1009, 0 } },
-    { "&varsigma;", { 962, 0 } },
-    { "&varsubsetneq;", { 8842, 65024 } },
-    { "&varsubsetneqq;", { 10955, 65024 } },
-    { "&varsupsetneq;", { 8843, 65024 } },
-    { "&varsupsetneqq;", { 10956, 65024 } },
-    { "&vartheta;", { 977, 0 } },
-    { "&vartriangleleft;", { 8882, 0 } },
-    { "&vartriangleright;", { 8883, 0 } },
-    { "&vcy;", { 1074, 0 } },
-    { "&vdash;", { 8866, 0 } },
-    { "&vee;", { 8744, 0 } },
-    { "&veebar;", { 8891, 0 } },
-    { "&veeeq;", { 8794, 0 } },
-    { "&vellip;", { 8942, 0 } },
-    { "&verbar;", { 124, 0 } },
-    { "&vert;", { 124, 0 } },
-    { "&vfr;", { 120115, 0 } },
-    { "&vltri;", { 8882, 0 } },
-    { "&vnsub;", { 8834, 8402 } },
-    { "&vnsup;", { 8835, 8402 } },
-    { "&vopf;", { 120167, 0 } },
-    { "&vprop;", { 8733, 0 } },
-    { "&vrtri;", { 8883, 0 } },
-    { "&vscr;", { 120011, 0 } },
-    { "&vsubnE;", { 10955, 65024 } },
-    { "&vsubne;", { 8842, 65024 } },
-    { "&vsupnE;", { 10956, 65024 } },
-    { "&vsupne;", { 8843, 65024 } },
-    { "&vzigzag;", { 10650, 0 } },
-    { "&wcirc;", { 373, 0 } },
-    { "&wedbar;", { 10847, 0 } },
-    { "&wedge;", { 8743, 0 } },
-    { "&wedgeq;", { 8793, 0 } },
-    { "&weierp;", { 8472, 0 } },
-    { "&wfr;", { 120116, 0 } },
-    { "&wopf;", { 120168, 0 } },
-    { "&wp;", { 8472, 0 } },
-    { "&wr;", { 8768, 0 } },
-    { "&wreath;", { 8768, 0 } },
-    { "&wscr;", { 120012, 0 } },
-    { "&xcap;", { 8898, 0 } },
-    { "&xcirc;", { 9711, 0 } },
-    { "&xcup;", { 8899, 0 } },
-    { "&xdtri;", { 9661, 0 } },
-    { "&xfr;", { 120117, 0 } },
-    { "&xhArr;", { 10234, 0 } },
-    { "&xharr;", { 10231, 0 } },
-    { "&xi;", { 958, 0 } },
-    { "&xlArr;", { 10232, 0 } },
-    { "&xlarr;", { 10229, 0 } },
-    { "&xmap;", { 10236, 0 } },
-    { "&xnis;", { 8955, 0 } },
-    { "&xodot;", { 10752, 0 } },
-    { "&xopf;", { 120169, 0 } },
-    { "&xoplus;", { 10753, 0 } },
-    { "&xotime;", { 10754, 0 } },
-    { "&xrArr;", { 10233, 0 } },
-    { "&xrarr;", { 10230, 0 } },
-    { "&xscr;", { 120013, 0 } },
-    { "&xsqcup;", { 10758, 0 } },
-    { "&xuplus;", { 10756, 0 } },
-    { "&xutri;", { 9651, 0 } },
-    { "&xvee;", { 8897, 0 } },
-    { "&xwedge;", { 8896, 0 } },
-    { "&yacute;", { 253, 0 } },
-    { "&yacy;", { 1103, 0 } },
-    { "&ycirc;", { 375, 0 } },
-    { "&ycy;", { 1099, 0 } },
-    { "&yen;", { 165, 0 } },
-    { "&yfr;", { 120118, 0 } },
-    { "&yicy;", { 1111, 0 } },
-    { "&yopf;", { 120170, 0 } },
-    { "&yscr;", { 120014, 0 } },
-    { "&yucy;", { 1102, 0 } },
-    { "&yuml;", { 255, 0 } },
-    { "&zacute;", { 378, 0 } },
-    { "&zcaron;", { 382, 0 } },
-    { "&zcy;", { 1079, 0 } },
-    { "&zdot;", { 380, 0 } },
-    { "&zeetrf;", { 8488, 0 } },
-    { "&zeta;", { 950, 0 } },
-    { "&zfr;", { 120119, 0 } },
-    { "&zhcy;", { 1078, 0 } },
-    { "&zigrarr;", { 8669, 0 } },
-    { "&zopf;", { 120171, 0 } },
-    { "&zscr;", { 120015, 0 } },
-    { "&zwj;", { 8205, 0 } },
-    { "&zwnj;", { 8204, 0 } }
-};
+#define ENTITY_BUCKET_COUNT    532
 
+static const unsigned short ENTITY_SEEDS[] = {
+    3, 3, 147, 22, 2, 106, 247, 2, 55, 31, 44, 168, 9, 12, 1, 31,
+    1, 77, 0, 107, 6, 1, 32, 3, 0, 8, 132, 10, 1, 68, 197, 305,
+    25, 29, 2, 3, 1, 2, 22, 6, 1, 6, 29, 23, 47, 55, 83, 5,
+    10, 42, 4, 2, 4, 179, 41, 40, 28, 33, 2, 2, 116, 1, 8, 35,
+    27, 66, 8, 6, 6, 5, 65, 6, 78, 63, 19, 13, 1, 26, 95, 25,
+    1, 138, 100, 2, 85, 7, 318, 3, 19, 152, 111, 1, 8, 337, 156, 1,
+    26, 30, 1, 132, 11, 56, 1, 50, 349, 78, 43, 50, 69, 5, 33, 5,
+    1, 11, 115, 77, 4, 136, 18, 154, 4, 348, 0, 34, 2, 17, 3, 25,
+    0, 57, 31, 141, 49, 8, 22, 173, 285, 3, 1, 23, 3, 8, 72, 1,
+    219, 28, 5, 4, 14, 16, 97, 5, 1, 398, 112, 83, 78, 6, 47, 1,
+    106, 1, 201, 1, 28, 126, 4, 30, 25, 1, 6, 95, 23, 49, 113, 89,
+    122, 180, 16, 89, 386, 3, 34, 224, 2, 0, 1, 181, 10, 58, 56, 14,
+    3, 95, 12, 1, 531, 2, 2, 146, 1, 42, 0, 32, 17, 3, 164, 316,
+    1, 126, 65, 3, 59, 1, 23, 99, 27, 19, 100, 3, 33, 19, 5, 14,
+    2, 135, 262, 917, 21, 177, 4, 13, 7, 37, 148, 258, 37, 1, 6, 1,
+    12, 70, 1020, 261, 337, 6, 6, 20, 112, 377, 7, 29, 6, 1, 828, 396,
+    69, 1, 64, 51, 133, 1, 55, 90, 38, 162, 93, 6, 56, 125, 422, 1100,
+    31, 1, 40, 247, 200, 237, 75, 17, 1, 4, 4, 29, 7, 35, 4, 51,
+    14, 15, 93, 211, 172, 26, 69, 35, 2, 13, 1, 81, 120, 15, 13, 127,
+    243, 7, 17, 110, 15, 17, 244, 53, 72, 67, 92, 175, 116, 123, 14, 22,
+    194, 45, 4, 6, 2, 293, 337, 216, 1, 7, 10, 1817, 54, 184, 24, 36,
+    4, 263, 2, 43, 6, 19, 8, 155, 36, 2, 8, 6, 83, 12, 285, 11,
+    373, 913, 13, 144, 53, 663, 5, 8, 0, 5, 5, 5, 243, 150, 22, 1,
+    1, 20, 25, 383, 8, 45, 1, 547, 235, 9, 92, 9, 319, 33, 162, 265,
+    47, 1, 113, 21, 509, 93, 27, 528, 31, 145, 51, 25, 44, 144, 356, 2,
+    2, 597, 1266, 64, 29, 19, 73, 0, 193, 405, 21, 180, 500, 57, 73, 9,
+    1004, 7, 217, 4, 52, 1338, 300, 543, 866, 51, 304, 82, 888, 220, 20, 218,
+    12, 324, 2, 37, 520, 625, 485, 1, 3, 598, 10, 1289, 241, 438, 40, 1,
+    70, 10, 9, 2, 489, 14, 161, 84, 2, 560, 1265, 331, 30, 418, 174, 14,
+    61, 79, 565, 30, 19, 226, 61, 995, 133, 480, 74, 52, 12, 385, 220, 2,
+    139, 12, 1183, 932, 16, 3676, 1082, 2, 63, 2, 26, 28, 57, 442, 242, 7,
+    93, 2318, 52, 1276, 1, 333, 1, 215, 673, 81, 634, 8, 1, 18, 1, 511,
+    7, 4, 303, 5, 163, 739, 2, 128, 555, 172, 1109, 228, 1, 1967, 3529, 179,
+    1, 2404, 10, 5
+};
 
-typedef struct ENTITY_KEY_tag ENTITY_KEY;
-struct ENTITY_KEY_tag {
-    const char* name;
-    size_t name_size;
+static const ENTITY ENTITY_MAP[] = {
+    { "&topfork;", { 10970, 0 }, "\xe2\xab\x9a", 3 },
+    { "&efr;", { 120098, 0 }, "\xf0\x9d\x94\xa2", 4 },
+    { "&uarr;", { 8593, 0 }, "\xe2\x86\x91", 3 },
+    { "&VeryThinSpace;", { 8202, 0 }, "\xe2\x80\x8a", 3 },
+    { "&vprop;", { 8733, 0 }, "\xe2\x88\x9d", 3 },
+    { "&fllig;", { 64258, 0 }, "\xef\xac\x82", 3 },
+    { "&measuredangle;", { 8737, 0 }, "\xe2\x88\xa1", 3 },
+    { "&larrb;", { 8676, 0 }, "\xe2\x87\xa4", 3 },
+    { "&vopf;", { 120167, 0 }, "\xf0\x9d\x95\xa7", 4 },
+    { "&shortparallel;", { 8741, 0 }, "\xe2\x88\xa5", 3 },
+    { "&ggg;", { 8921, 0 }, "\xe2\x8b\x99", 3 },
+    { "&dagger;", { 8224, 0 }, "\xe2\x80\xa0", 3 },
+    { "&lt;", { 60, 0 }, "\x3c", 1 },
+    { "&napid;", { 8779, 824 }, "\xe2\x89\x8b\xcc\xb8", 5 },
+    { "&pluse;", { 10866, 0 }, "\xe2\xa9\xb2", 3 },
+    { "&le;", { 8804, 0 }, "\xe2\x89\xa4", 3 },
+    { "&Integral;", { 8747, 0 }, "\xe2\x88\xab", 3 },
+    { "&tbrk;", { 9140, 0 }, "\xe2\x8e\xb4", 3 },
+    { "&SucceedsEqual;", { 10928, 0 }, "\xe2\xaa\xb0", 3 },
+    { "&Vfr;", { 120089, 0 }, "\xf0\x9d\x94\x99", 4 },
+    { "&bcong;", { 8780, 0 }, "\xe2\x89\x8c", 3 },
+    { "&Bscr;", { 8492, 0 }, "\xe2\x84\xac", 3 },
+    { "&ncong;", { 8775, 0 }, "\xe2\x89\x87", 3 },
+    { "&rightarrowtail;", { 8611, 0 }, "\xe2\x86\xa3", 3 },
+    { "&Pi;", { 928, 0 }, "\xce\xa0", 2 },
+    { "&utilde;", { 361, 0 }, "\xc5\xa9", 2 },
+    { "&upharpoonleft;", { 8639, 0 }, "\xe2\x86\xbf", 3 },
+    { "&jsercy;", { 1112, 0 }, "\xd1\x98", 2 },
+    { "&Colone;", { 10868, 0 }, "\xe2\xa9\xb4", 3 },
+    { "&gtcir;", { 10874, 0 }, "\xe2\xa9\xba", 3 },
+    { "&Nopf;", { 8469, 0 }, "\xe2\x84\x95", 3 },
+    { "&plusacir;", { 10787, 0 }, "\xe2\xa8\xa3", 3 },
+    { "&rbrack;", { 93, 0 }, "\x5d", 1 },
+    { "&cire;", { 8791, 0 }, "\xe2\x89\x97", 3 },
+    { "&nsc;", { 8833, 0 }, "\xe2\x8a\x81", 3 },
+    { "&boxDl;", { 9558, 0 }, "\xe2\x95\x96", 3 },
+    { "&eDDot;", { 10871, 0 }, "\xe2\xa9\xb7", 3 },
+    { "&curlywedge;", { 8911, 0 }, "\xe2\x8b\x8f", 3 },
+    { "&dharr;", { 8642, 0 }, "\xe2\x87\x82", 3 },
+    { "&szlig;", { 223, 0 }, "\xc3\x9f", 2 },
+    { "&nles;", { 10877, 824 }, "\xe2\xa9\xbd\xcc\xb8", 5 },
+    { "&NotSquareSupersetEqual;", { 8931, 0 }, "\xe2\x8b\xa3", 3 },
+    { "&IOcy;", { 1025, 0 }, "\xd0\x81", 2 },
+    { "&LeftRightArrow;", { 8596, 0 }, "\xe2\x86\x94", 3 },
+    { "&IEcy;", { 1045, 0 }, "\xd0\x95", 2 },
+    { "&models;", { 8871, 0 }, "\xe2\x8a\xa7", 3 },
+    { "&SquareSupersetEqual;", { 8850, 0 }, "\xe2\x8a\x92", 3 },
+    { "&xwedge;", { 8896, 0 }, "\xe2\x8b\x80", 3 },
+    { "&hfr;", { 120101, 0 }, "\xf0\x9d\x94\xa5", 4 },
+    { "&frac38;", { 8540, 0 }, "\xe2\x85\x9c", 3 },
+    { "&Jopf;", { 120129, 0 }, "\xf0\x9d\x95\x81", 4 },
+    { "&NotNestedLessLess;", { 10913, 824 }, "\xe2\xaa\xa1\xcc\xb8", 5 },
+    { "&yopf;", { 120170, 0 }, "\xf0\x9d\x95\xaa", 4 },
+    { "&ApplyFunction;", { 8289, 0 }, "\xe2\x81\xa1", 3 },
+    { "&uuml;", { 252, 0 }, "\xc3\xbc", 2 },
+    { "&swarhk;", { 10534, 0 }, "\xe2\xa4\xa6", 3 },
+    { "&dwangle;", { 10662, 0 }, "\xe2\xa6\xa6", 3 },
+    { "&nges;", { 10878, 824 }, "\xe2\xa9\xbe\xcc\xb8", 5 },
+    { "&hardcy;", { 1098, 0 }, "\xd1\x8a", 2 },
+    { "&oS;", { 9416, 0 }, "\xe2\x93\x88", 3 },
+    { "&LessTilde;", { 8818, 0 }, "\xe2\x89\xb2", 3 },
+    { "&umacr;", { 363, 0 }, "\xc5\xab", 2 },
+    { "&Xi;", { 926, 0 }, "\xce\x9e", 2 },
+    { "&upsi;", { 965, 0 }, "\xcf\x85", 2 },
+    { "&UnderBar;", { 95, 0 }, "\x5f", 1 },
+    { "&zscr;", { 120015, 0 }, "\xf0\x9d\x93\x8f", 4 },
+    { "&ntrianglerighteq;", { 8941, 0 }, "\xe2\x8b\xad", 3 },
+    { "&softcy;", { 1100, 0 }, "\xd1\x8c", 2 },
+    { "&Map;", { 10501, 0 }, "\xe2\xa4\x85", 3 },
+    { "&topf;", { 120165, 0 }, "\xf0\x9d\x95\xa5", 4 },
+    { "&leftarrow;", { 8592, 0 }, "\xe2\x86\x90", 3 },
+    { "&iff;", { 8660, 0 }, "\xe2\x87\x94", 3 },
+    { "&Jfr;", { 120077, 0 }, "\xf0\x9d\x94\x8d", 4 },
+    { "&gtrdot;", { 8919, 0 }, "\xe2\x8b\x97", 3 },
+    { "&hscr;", { 119997, 0 }, "\xf0\x9d\x92\xbd", 4 },
+    { "&colone;", { 8788, 0 }, "\xe2\x89\x94", 3 },
+    { "&LeftUpVector;", { 8639, 0 }, "\xe2\x86\xbf", 3 },
+    { "&lneqq;", { 8808, 0 }, "\xe2\x89\xa8", 3 },
+    { "&mapstodown;", { 8615, 0 }, "\xe2\x86\xa7", 3 },
+    { "&yacute;", { 253, 0 }, "\xc3\xbd", 2 },
+    { "&LeftDownVector;", { 8643, 0 }, "\xe2\x87\x83", 3 },
+    { "&SquareSuperset;", { 8848, 0 }, "\xe2\x8a\x90", 3 },
+    { "&Superset;", { 8835, 0 }, "\xe2\x8a\x83", 3 },
+    { "&Acy;", { 1040, 0 }, "\xd0\x90", 2 },
+    { "&omid;", { 10678, 0 }, "\xe2\xa6\xb6", 3 },
+    { "&curlyvee;", { 8910, 0 }, "\xe2\x8b\x8e", 3 },
+    { "&blk12;", { 9618, 0 }, "\xe2\x96\x92", 3 },
+    { "&qprime;", { 8279, 0 }, "\xe2\x81\x97", 3 },
+    { "&alpha;", { 945, 0 }, "\xce\xb1", 2 },
+    { "&niv;", { 8715, 0 }, "\xe2\x88\x8b", 3 },
+    { "&marker;", { 9646, 0 }, "\xe2\x96\xae", 3 },
+    { "&Zacute;", { 377, 0 }, "\xc5\xb9", 2 },
+    { "&RightDownVector;", { 8642, 0 }, "\xe2\x87\x82", 3 },
+    { "&lharul;", { 10602, 0 }, "\xe2\xa5\xaa", 3 },
+    { "&ac;", { 8766, 0 }, "\xe2\x88\xbe", 3 },
+    { "&vnsub;", { 8834, 8402 }, "\xe2\x8a\x82\xe2\x83\x92", 6 },
+    { "&emsp13;", { 8196, 0 }, "\xe2\x80\x84", 3 },
+    { "&Bfr;", { 120069, 0 }, "\xf0\x9d\x94\x85", 4 },
+    { "&InvisibleTimes;", { 8290, 0 }, "\xe2\x81\xa2", 3 },
+    { "&LT;", { 60, 0 }, "\x3c", 1 },
+    { "&RBarr;", { 10512, 0 }, "\xe2\xa4\x90", 3 },
+    { "&neArr;", { 8663, 0 }, "\xe2\x87\x97", 3 },
+    { "&curlyeqprec;", { 8926, 0 }, "\xe2\x8b\x9e", 3 },
+    { "&odiv;", { 10808, 0 }, "\xe2\xa8\xb8", 3 },
+    { "&CircleDot;", { 8857, 0 }, "\xe2\x8a\x99", 3 },
+    { "&wcirc;", { 373, 0 }, "\xc5\xb5", 2 },
+    { "&LeftUpTeeVector;", { 10592, 0 }, "\xe2\xa5\xa0", 3 },
+    { "&minusd;", { 8760, 0 }, "\xe2\x88\xb8", 3 },
+    { "&Wedge;", { 8896, 0 }, "\xe2\x8b\x80", 3 },
+    { "&hopf;", { 120153, 0 }, "\xf0\x9d\x95\x99", 4 },
+    { "&subsetneq;", { 8842, 0 }, "\xe2\x8a\x8a", 3 },
+    { "&olcross;", { 10683, 0 }, "\xe2\xa6\xbb", 3 },
+    { "&lnap;", { 10889, 0 }, "\xe2\xaa\x89", 3 },
+    { "&NotReverseElement;", { 8716, 0 }, "\xe2\x88\x8c", 3 },
+    { "&supedot;", { 10948, 0 }, "\xe2\xab\x84", 3 },
+    { "&boxUR;", { 9562, 0 }, "\xe2\x95\x9a", 3 },
+    { "&circeq;", { 8791, 0 }, "\xe2\x89\x97", 3 },
+    { "&laquo;", { 171, 0 }, "\xc2\xab", 2 },
+    { "&ell;", { 8467, 0 }, "\xe2\x84\x93", 3 },
+    { "&supe;", { 8839, 0 }, "\xe2\x8a\x87", 3 },
+    { "&Fouriertrf;", { 8497, 0 }, "\xe2\x84\xb1", 3 },
+    { "&Delta;", { 916, 0 }, "\xce\x94", 2 },
+    { "&beta;", { 946, 0 }, "\xce\xb2", 2 },
+    { "&Iukcy;", { 1030, 0 }, "\xd0\x86", 2 },
+    { "&nis;", { 8956, 0 }, "\xe2\x8b\xbc", 3 },
+    { "&Square;", { 9633, 0 }, "\xe2\x96\xa1", 3 },
+    { "&leftrightsquigarrow;", { 8621, 0 }, "\xe2\x86\xad", 3 },
+    { "&ssetmn;", { 8726, 0 }, "\xe2\x88\x96", 3 },
+    { "&precneqq;", { 10933, 0 }, "\xe2\xaa\xb5", 3 },
+    { "&curvearrowright;", { 8631, 0 }, "\xe2\x86\xb7", 3 },
+    { "&Sqrt;", { 8730, 0 }, "\xe2\x88\x9a", 3 },
+    { "&shchcy;", { 1097, 0 }, "\xd1\x89", 2 },
+    { "&vartheta;", { 977, 0 }, "\xcf\x91", 2 },
+    { "&succapprox;", { 10936, 0 }, "\xe2\xaa\xb8", 3 },
+    { "&epsilon;", { 949, 0 }, "\xce\xb5", 2 },
+    { "&rlarr;", { 8644, 0 }, "\xe2\x87\x84", 3 },
+    { "&rsqb;", { 93, 0 }, "\x5d", 1 },
+    { "&LeftAngleBracket;", { 10216, 0 }, "\xe2\x9f\xa8", 3 },
+    { "&minus;", { 8722, 0 }, "\xe2\x88\x92", 3 },
+    { "&asymp;", { 8776, 0 }, "\xe2\x89\x88", 3 },
+    { "&xnis;", { 8955, 0 }, "\xe2\x8b\xbb", 3 },
+    { "&rlhar;", { 8652, 0 }, "\xe2\x87\x8c", 3 },
+    { "&qscr;", { 120006, 0 }, "\xf0\x9d\x93\x86", 4 },
+    { "&gtrsim;", { 8819, 0 }, "\xe2\x89\xb3", 3 },
+    { "&egrave;", { 232, 0 }, "\xc3\xa8", 2 },
+    { "&nsimeq;", { 8772, 0 }, "\xe2\x89\x84", 3 },
+    { "&vellip;", { 8942, 0 }, "\xe2\x8b\xae", 3 },
+    { "&thetav;", { 977, 0 }, "\xcf\x91", 2 },
+    { "&precnsim;", { 8936, 0 }, "\xe2\x8b\xa8", 3 },
+    { "&wreath;", { 8768, 0 }, "\xe2\x89\x80", 3 },
+    { "&NotLessLess;", { 8810, 824 }, "\xe2\x89\xaa\xcc\xb8", 5 },
+    { "&nabla;", { 8711, 0 }, "\xe2\x88\x87", 3 },
+    { "&Alpha;", { 913, 0 }, "\xce\x91", 2 },
+    { "&frac18;", { 8539, 0 }, "\xe2\x85\x9b", 3 },
+    { "&pi;", { 960, 0 }, "\xcf\x80", 2 },
+    { "&acE;", { 8766, 819 }, "\xe2\x88\xbe\xcc\xb3", 5 },
+    { "&DDotrahd;", { 10513, 0 }, "\xe2\xa4\x91", 3 },
+    { "&phi;", { 966, 0 }, "\xcf\x86", 2 },
+    { "&Escr;", { 8496, 0 }, "\xe2\x84\xb0", 3 },
+    { "&precapprox;", { 10935, 0 }, "\xe2\xaa\xb7", 3 },
+    { "&uparrow;", { 8593, 0 }, "\xe2\x86\x91", 3 },
+    { "&trisb;", { 10701, 0 }, "\xe2\xa7\x8d", 3 },
+    { "&doteqdot;", { 8785, 0 }, "\xe2\x89\x91", 3 },
+    { "&Racute;", { 340, 0 }, "\xc5\x94", 2 },
+    { "&nwarhk;", { 10531, 0 }, "\xe2\xa4\xa3", 3 },
+    { "&hookleftarrow;", { 8617, 0 }, "\xe2\x86\xa9", 3 },
+    { "&vcy;", { 1074, 0 }, "\xd0\xb2", 2 },
+    { "&nhpar;", { 10994, 0 }, "\xe2\xab\xb2", 3 },
+    { "&lmoust;", { 9136, 0 }, "\xe2\x8e\xb0", 3 },
+    { "&LeftCeiling;", { 8968, 0 }, "\xe2\x8c\x88", 3 },
+    { "&eta;", { 951, 0 }, "\xce\xb7", 2 },
+    { "&GT;", { 62, 0 }, "\x3e", 1 },
+    { "&escr;", { 8495, 0 }, "\xe2\x84\xaf", 3 },
+    { "&Igrave;", { 204, 0 }, "\xc3\x8c", 2 },
+    { "&Tcy;", { 1058, 0 }, "\xd0\xa2", 2 },
+    { "&LJcy;", { 1033, 0 }, "\xd0\x89", 2 },
+    { "&hyphen;", { 8208, 0 }, "\xe2\x80\x90", 3 },
+    { "&larrlp;", { 8619, 0 }, "\xe2\x86\xab", 3 },
+    { "&eqcirc;", { 8790, 0 }, "\xe2\x89\x96", 3 },
+    { "&sdotb;", { 8865, 0 }, "\xe2\x8a\xa1", 3 },
+    { "&Verbar;", { 8214, 0 }, "\xe2\x80\x96", 3 },
+    { "&Tau;", { 932, 0 }, "\xce\xa4", 2 },
+    { "&Equal;", { 10869, 0 }, "\xe2\xa9\xb5", 3 },
+    { "&Kcy;", { 1050, 0 }, "\xd0\x9a", 2 },
+    { "&DoubleDot;", { 168, 0 }, "\xc2\xa8", 2 },
+    { "&xrArr;", { 10233, 0 }, "\xe2\x9f\xb9", 3 },
+    { "&gesdot;", { 10880, 0 }, "\xe2\xaa\x80", 3 },
+    { "&supne;", { 8843, 0 }, "\xe2\x8a\x8b", 3 },
+    { "&dzcy;", { 1119, 0 }, "\xd1\x9f", 2 },
+    { "&scsim;", { 8831, 0 }, "\xe2\x89\xbf", 3 },
+    { "&ufisht;", { 10622, 0 }, "\xe2\xa5\xbe", 3 },
+    { "&nrarrc;", { 10547, 824 }, "\xe2\xa4\xb3\xcc\xb8", 5 },
+    { "&swArr;", { 8665, 0 }, "\xe2\x87\x99", 3 },
+    { "&Zcy;", { 1047, 0 }, "\xd0\x97", 2 },
+    { "&mapsto;", { 8614, 0 }, "\xe2\x86\xa6", 3 },
+    { "&dopf;", { 120149, 0 }, "\xf0\x9d\x95\x95", 4 },
+    { "&daleth;", { 8504, 0 }, "\xe2\x84\xb8", 3 },
+    { "&blacktriangle;", { 9652, 0 }, "\xe2\x96\xb4", 3 },
+    { "&dotsquare;", { 8865, 0 }, "\xe2\x8a\xa1", 3 },
+    { "&duhar;", { 10607, 0 }, "\xe2\xa5\xaf", 3 },
+    { "&not;", { 172, 0 }, "\xc2\xac", 2 },
+    { "&NotSucceedsSlantEqual;", { 8929, 0 }, "\xe2\x8b\xa1", 3 },
+    { "&angsph;", { 8738, 0 }, "\xe2\x88\xa2", 3 },
+    { "&icy;", { 1080, 0 }, "\xd0\xb8", 2 },
+    { "&bbrktbrk;", { 9142, 0 }, "\xe2\x8e\xb6", 3 },
+    { "&nLeftarrow;", { 8653, 0 }, "\xe2\x87\x8d", 3 },
+    { "&bigcirc;", { 9711, 0 }, "\xe2\x97\xaf", 3 },
+    { "&lesges;", { 10899, 0 }, "\xe2\xaa\x93", 3 },
+    { "&DiacriticalAcute;", { 180, 0 }, "\xc2\xb4", 2 },
+    { "&lbrack;", { 91, 0 }, "\x5b", 1 },
+    { "&egsdot;", { 10904, 0 }, "\xe2\xaa\x98", 3 },
+    { "&percnt;", { 37, 0 }, "\x25", 1 },
+    { "&UpArrowBar;", { 10514, 0 }, "\xe2\xa4\x92", 3 },
+    { "&NotTildeEqual;", { 8772, 0 }, "\xe2\x89\x84", 3 },
+    { "&ufr;", { 120114, 0 }, "\xf0\x9d\x94\xb2", 4 },
+    { "&Conint;", { 8751, 0 }, "\xe2\x88\xaf", 3 },
+    { "&ntriangleright;", { 8939, 0 }, "\xe2\x8b\xab", 3 },
+    { "&andand;", { 10837, 0 }, "\xe2\xa9\x95", 3 },
+    { "&Ocirc;", { 212, 0 }, "\xc3\x94", 2 },
+    { "&csube;", { 10961, 0 }, "\xe2\xab\x91", 3 },
+    { "&subne;", { 8842, 0 }, "\xe2\x8a\x8a", 3 },
+    { "&agrave;", { 224, 0 }, "\xc3\xa0", 2 },
+    { "&backepsilon;", { 1014, 0 }, "\xcf\xb6", 2 },
+    { "&mcy;", { 1084, 0 }, "\xd0\xbc", 2 },
+    { "&nacute;", { 324, 0 }, "\xc5\x84", 2 },
+    { "&quest;", { 63, 0 }, "\x3f", 1 },
+    { "&NotGreaterEqual;", { 8817, 0 }, "\xe2\x89\xb1", 3 },
+    { "&bowtie;", { 8904, 0 }, "\xe2\x8b\x88", 3 },
+    { "&triangleright;", { 9657, 0 }, "\xe2\x96\xb9", 3 },
+    { "&ReverseUpEquilibrium;", { 10607, 0 }, "\xe2\xa5\xaf", 3 },
+    { "&LeftVector;", { 8636, 0 }, "\xe2\x86\xbc", 3 },
+    { "&ap;", { 8776, 0 }, "\xe2\x89\x88", 3 },
+    { "&Iogon;", { 302, 0 }, "\xc4\xae", 2 },
+    { "&supmult;", { 10946, 0 }, "\xe2\xab\x82", 3 },
+    { "&plustwo;", { 10791, 0 }, "\xe2\xa8\xa7", 3 },
+    { "&boxur;", { 9492, 0 }, "\xe2\x94\x94", 3 },
+    { "&capcap;", { 10827, 0 }, "\xe2\xa9\x8b", 3 },
+    { "&boxul;", { 9496, 0 }, "\xe2\x94\x98", 3 },
+    { "&searrow;", { 8600, 0 }, "\xe2\x86\x98", 3 },
+    { "&permil;", { 8240, 0 }, "\xe2\x80\xb0", 3 },
+    { "&SupersetEqual;", { 8839, 0 }, "\xe2\x8a\x87", 3 },
+    { "&nsubseteq;", { 8840, 0 }, "\xe2\x8a\x88", 3 },
+    { "&DownLeftVector;", { 8637, 0 }, "\xe2\x86\xbd", 3 },
+    { "&seArr;", { 8664, 0 }, "\xe2\x87\x98", 3 },
+    { "&ucy;", { 1091, 0 }, "\xd1\x83", 2 },
+    { "&simrarr;", { 10610, 0 }, "\xe2\xa5\xb2", 3 },
+    { "&gtquest;", { 10876, 0 }, "\xe2\xa9\xbc", 3 },
+    { "&angrt;", { 8735, 0 }, "\xe2\x88\x9f", 3 },
+    { "&pitchfork;", { 8916, 0 }, "\xe2\x8b\x94", 3 },
+    { "&Oopf;", { 120134, 0 }, "\xf0\x9d\x95\x86", 4 },
+    { "&nsub;", { 8836, 0 }, "\xe2\x8a\x84", 3 },
+    { "&cir;", { 9675, 0 }, "\xe2\x97\x8b", 3 },
+    { "&Upsilon;", { 933, 0 }, "\xce\xa5", 2 },
+    { "&shortmid;", { 8739, 0 }, "\xe2\x88\xa3", 3 },
+    { "&larrpl;", { 10553, 0 }, "\xe2\xa4\xb9", 3 },
+    { "&iopf;", { 120154, 0 }, "\xf0\x9d\x95\x9a", 4 },
+    { "&sqsupseteq;", { 8850, 0 }, "\xe2\x8a\x92", 3 },
+    { "&raquo;", { 187, 0 }, "\xc2\xbb", 2 },
+    { "&NotLeftTriangleBar;", { 10703, 824 }, "\xe2\xa7\x8f\xcc\xb8", 5 },
+    { "&downharpoonright;", { 8642, 0 }, "\xe2\x87\x82", 3 },
+    { "&oint;", { 8750, 0 }, "\xe2\x88\xae", 3 },
+    { "&biguplus;", { 10756, 0 }, "\xe2\xa8\x84", 3 },
+    { "&Rang;", { 10219, 0 }, "\xe2\x9f\xab", 3 },
+    { "&Gcedil;", { 290, 0 }, "\xc4\xa2", 2 },
+    { "&nmid;", { 8740, 0 }, "\xe2\x88\xa4", 3 },
+    { "&scE;", { 10932, 0 }, "\xe2\xaa\xb4", 3 },
+    { "&eogon;", { 281, 0 }, "\xc4\x99", 2 },
+    { "&ldquo;", { 8220, 0 }, "\xe2\x80\x9c", 3 },
+    { "&zacute;", { 378, 0 }, "\xc5\xba", 2 },
+    { "&lfisht;", { 10620, 0 }, "\xe2\xa5\xbc", 3 },
+    { "&Qfr;", { 120084, 0 }, "\xf0\x9d\x94\x94", 4 },
+    { "&veeeq;", { 8794, 0 }, "\xe2\x89\x9a", 3 },
+    { "&rarrlp;", { 8620, 0 }, "\xe2\x86\xac", 3 },
+    { "&Sup;", { 8913, 0 }, "\xe2\x8b\x91", 3 },
+    { "&boxHU;", { 9577, 0 }, "\xe2\x95\xa9", 3 },
+    { "&ocy;", { 1086, 0 }, "\xd0\xbe", 2 },
+    { "&cdot;", { 267, 0 }, "\xc4\x8b", 2 },
+    { "&csub;", { 10959, 0 }, "\xe2\xab\x8f", 3 },
+    { "&check;", { 10003, 0 }, "\xe2\x9c\x93", 3 },
+    { "&sub;", { 8834, 0 }, "\xe2\x8a\x82", 3 },
+    { "&lsimg;", { 10895, 0 }, "\xe2\xaa\x8f", 3 },
+    { "&suplarr;", { 10619, 0 }, "\xe2\xa5\xbb", 3 },
+    { "&dArr;", { 8659, 0 }, "\xe2\x87\x93", 3 },
+    { "&Congruent;", { 8801, 0 }, "\xe2\x89\xa1", 3 },
+    { "&rcy;", { 1088, 0 }, "\xd1\x80", 2 },
+    { "&cups;", { 8746, 65024 }, "\xe2\x88\xaa\xef\xb8\x80", 6 },
+    { "&pm;", { 177, 0 }, "\xc2\xb1", 2 },
+    { "&UpDownArrow;", { 8597, 0 }, "\xe2\x86\x95", 3 },
+    { "&boxvR;", { 9566, 0 }, "\xe2\x95\x9e", 3 },
+    { "&looparrowright;", { 8620, 0 }, "\xe2\x86\xac", 3 },
+    { "&Rcedil;", { 342, 0 }, "\xc5\x96", 2 },
+    { "&gE;", { 8807, 0 }, "\xe2\x89\xa7", 3 },
+    { "&csupe;", { 10962, 0 }, "\xe2\xab\x92", 3 },
+    { "&rharu;", { 8640, 0 }, "\xe2\x87\x80", 3 },
+    { "&nLtv;", { 8810, 824 }, "\xe2\x89\xaa\xcc\xb8", 5 },
+    { "&lAarr;", { 8666, 0 }, "\xe2\x87\x9a", 3 },
+    { "&drcrop;", { 8972, 0 }, "\xe2\x8c\x8c", 3 },
+    { "&gtdot;", { 8919, 0 }, "\xe2\x8b\x97", 3 },
+    { "&Ccedil;", { 199, 0 }, "\xc3\x87", 2 },
+    { "&And;", { 10835, 0 }, "\xe2\xa9\x93", 3 },
+    { "&Otilde;", { 213, 0 }, "\xc3\x95", 2 },
+    { "&Yscr;", { 119988, 0 }, "\xf0\x9d\x92\xb4", 4 },
+    { "&Rfr;", { 8476, 0 }, "\xe2\x84\x9c", 3 },
+    { "&Not;", { 10988, 0 }, "\xe2\xab\xac", 3 },
+    { "&lowbar;", { 95, 0 }, "\x5f", 1 },
+    { "&dashv;", { 8867, 0 }, "\xe2\x8a\xa3", 3 },
+    { "&ffilig;", { 64259, 0 }, "\xef\xac\x83", 3 },
+    { "&Uuml;", { 220, 0 }, "\xc3\x9c", 2 },
+    { "&ropf;", { 120163, 0 }, "\xf0\x9d\x95\xa3", 4 },
+    { "&boxvh;", { 9532, 0 }, "\xe2\x94\xbc", 3 },
+    { "&ssmile;", { 8995, 0 }, "\xe2\x8c\xa3", 3 },
+    { "&uml;", { 168, 0 }, "\xc2\xa8", 2 },
+    { "&gscr;", { 8458, 0 }, "\xe2\x84\x8a", 3 },
+    { "&HilbertSpace;", { 8459, 0 }, "\xe2\x84\x8b", 3 },
+    { "&rightleftarrows;", { 8644, 0 }, "\xe2\x87\x84", 3 },
+    { "&GJcy;", { 1027, 0 }, "\xd0\x83", 2 },
+    { "&Intersection;", { 8898, 0 }, "\xe2\x8b\x82", 3 },
+    { "&integers;", { 8484, 0 }, "\xe2\x84\xa4", 3 },
+    { "&hamilt;", { 8459, 0 }, "\xe2\x84\x8b", 3 },
+    { "&Uopf;", { 120140, 0 }, "\xf0\x9d\x95\x8c", 4 },
+    { "&rceil;", { 8969, 0 }, "\xe2\x8c\x89", 3 },
+    { "&nrarr;", { 8603, 0 }, "\xe2\x86\x9b", 3 },
+    { "&Because;", { 8757, 0 }, "\xe2\x88\xb5", 3 },
+    { "&Eopf;", { 120124, 0 }, "\xf0\x9d\x94\xbc", 4 },
+    { "&mho;", { 8487, 0 }, "\xe2\x84\xa7", 3 },
+    { "&prsim;", { 8830, 0 }, "\xe2\x89\xbe", 3 },
+    { "&isin;", { 8712, 0 }, "\xe2\x88\x88", 3 },
+    { "&HumpDownHump;", { 8782, 0 }, "\xe2\x89\x8e", 3 },
+    { "&urcorn;", { 8989, 0 }, "\xe2\x8c\x9d", 3 },
+    { "&npre;", { 10927, 824 }, "\xe2\xaa\xaf\xcc\xb8", 5 },
+    { "&Abreve;", { 258, 0 }, "\xc4\x82", 2 },
+    { "&uArr;", { 8657, 0 }, "\xe2\x87\x91", 3 },
+    { "&heartsuit;", { 9829, 0 }, "\xe2\x99\xa5", 3 },
+    { "&CapitalDifferentialD;", { 8517, 0 }, "\xe2\x85\x85", 3 },
+    { "&LessGreater;", { 8822, 0 }, "\xe2\x89\xb6", 3 },
+    { "&Zscr;", { 119989, 0 }, "\xf0\x9d\x92\xb5", 4 },
+    { "&UpTeeArrow;", { 8613, 0 }, "\xe2\x86\xa5", 3 },
+    { "&llarr;", { 8647, 0 }, "\xe2\x87\x87", 3 },
+    { "&apos;", { 39, 0 }, "\x27", 1 },
+    { "&strns;", { 175, 0 }, "\xc2\xaf", 2 },
+    { "&subseteqq;", { 10949, 0 }, "\xe2\xab\x85", 3 },
+    { "&ifr;", { 120102, 0 }, "\xf0\x9d\x94\xa6", 4 },
+    { "&Vcy;", { 1042, 0 }, "\xd0\x92", 2 },
+    { "&ZHcy;", { 1046, 0 }, "\xd0\x96", 2 },
+    { "&vzigzag;", { 10650, 0 }, "\xe2\xa6\x9a", 3 },
+    { "&cularr;", { 8630, 0 }, "\xe2\x86\xb6", 3 },
+    { "&subsup;", { 10963, 0 }, "\xe2\xab\x93", 3 },
+    { "&oslash;", { 248, 0 }, "\xc3\xb8", 2 },
+    { "&PartialD;", { 8706, 0 }, "\xe2\x88\x82", 3 },
+    { "&curarrm;", { 10556, 0 }, "\xe2\xa4\xbc", 3 },
+    { "&bump;", { 8782, 0 }, "\xe2\x89\x8e", 3 },
+    { "&gamma;", { 947, 0 }, "\xce\xb3", 2 },
+    { "&Longleftrightarrow;", { 10234, 0 }, "\xe2\x9f\xba", 3 },
+    { "&Hcirc;", { 292, 0 }, "\xc4\xa4", 2 },
+    { "&sstarf;", { 8902, 0 }, "\xe2\x8b\x86", 3 },
+    { "&DoubleVerticalBar;", { 8741, 0 }, "\xe2\x88\xa5", 3 },
+    { "&DoubleDownArrow;", { 8659, 0 }, "\xe2\x87\x93", 3 },
+    { "&CirclePlus;", { 8853, 0 }, "\xe2\x8a\x95", 3 },
+    { "&notinvc;", { 8950, 0 }, "\xe2\x8b\xb6", 3 },
+    { "&sup2;", { 178, 0 }, "\xc2\xb2", 2 },
+    { "&kcedil;", { 311, 0 }, "\xc4\xb7", 2 },
+    { "&darr;", { 8595, 0 }, "\xe2\x86\x93", 3 },
+    { "&gammad;", { 989, 0 }, "\xcf\x9d", 2 },
+    { "&Sscr;", { 119982, 0 }, "\xf0\x9d\x92\xae", 4 },
+    { "&NotPrecedesSlantEqual;", { 8928, 0 }, "\xe2\x8b\xa0", 3 },
+    { "&pcy;", { 1087, 0 }, "\xd0\xbf", 2 },
+    { "&bemptyv;", { 10672, 0 }, "\xe2\xa6\xb0", 3 },
+    { "&simgE;", { 10912, 0 }, "\xe2\xaa\xa0", 3 },
+    { "&scnap;", { 10938, 0 }, "\xe2\xaa\xba", 3 },
+    { "&scy;", { 1089, 0 }, "\xd1\x81", 2 },
+    { "&sext;", { 10038, 0 }, "\xe2\x9c\xb6", 3 },
+    { "&tritime;", { 10811, 0 }, "\xe2\xa8\xbb", 3 },
+    { "&khcy;", { 1093, 0 }, "\xd1\x85", 2 },
+    { "&CircleMinus;", { 8854, 0 }, "\xe2\x8a\x96", 3 },
+    { "&Ncy;", { 1053, 0 }, "\xd0\x9d", 2 },
+    { "&nlsim;", { 8820, 0 }, "\xe2\x89\xb4", 3 },
+    { "&backsim;", { 8765, 0 }, "\xe2\x88\xbd", 3 },
+    { "&udhar;", { 10606, 0 }, "\xe2\xa5\xae", 3 },
+    { "&rbrksld;", { 10638, 0 }, "\xe2\xa6\x8e", 3 },
+    { "&lstrok;", { 322, 0 }, "\xc5\x82", 2 },
+    { "&larrfs;", { 10525, 0 }, "\xe2\xa4\x9d", 3 },
+    { "&ge;", { 8805, 0 }, "\xe2\x89\xa5", 3 },
+    { "&plusmn;", { 177, 0 }, "\xc2\xb1", 2 },
+    { "&nearhk;", { 10532, 0 }, "\xe2\xa4\xa4", 3 },
+    { "&YIcy;", { 1031, 0 }, "\xd0\x87", 2 },
+    { "&nrarrw;", { 8605, 824 }, "\xe2\x86\x9d\xcc\xb8", 5 },
+    { "&lrarr;", { 8646, 0 }, "\xe2\x87\x86", 3 },
+    { "&emsp;", { 8195, 0 }, "\xe2\x80\x83", 3 },
+    { "&isindot;", { 8949, 0 }, "\xe2\x8b\xb5", 3 },
+    { "&NotHumpEqual;", { 8783, 824 }, "\xe2\x89\x8f\xcc\xb8", 5 },
+    { "&Ffr;", { 120073, 0 }, "\xf0\x9d\x94\x89", 4 },
+    { "&rfloor;", { 8971, 0 }, "\xe2\x8c\x8b", 3 },
+    { "&notinE;", { 8953, 824 }, "\xe2\x8b\xb9\xcc\xb8", 5 },
+    { "&ubreve;", { 365, 0 }, "\xc5\xad", 2 },
+    { "&midast;", { 42, 0 }, "\x2a", 1 },
+    { "&ldrushar;", { 10571, 0 }, "\xe2\xa5\x8b", 3 },
+    { "&Proportion;", { 8759, 0 }, "\xe2\x88\xb7", 3 },
+    { "&ii;", { 8520, 0 }, "\xe2\x85\x88", 3 },
+    { "&Pr;", { 10939, 0 }, "\xe2\xaa\xbb", 3 },
+    { "&map;", { 8614, 0 }, "\xe2\x86\xa6", 3 },
+    { "&leftthreetimes;", { 8907, 0 }, "\xe2\x8b\x8b", 3 },
+    { "&lesg;", { 8922, 65024 }, "\xe2\x8b\x9a\xef\xb8\x80", 6 },
+    { "&scap;", { 10936, 0 }, "\xe2\xaa\xb8", 3 },
+    { "&isinv;", { 8712, 0 }, "\xe2\x88\x88", 3 },
+    { "&RightVector;", { 8640, 0 }, "\xe2\x87\x80", 3 },
+    { "&drbkarow;", { 10512, 0 }, "\xe2\xa4\x90", 3 },
+    { "&nvltrie;", { 8884, 8402 }, "\xe2\x8a\xb4\xe2\x83\x92", 6 },
+    { "&supsim;", { 10952, 0 }, "\xe2\xab\x88", 3 },
+    { "&backsimeq;", { 8909, 0 }, "\xe2\x8b\x8d", 3 },
+    { "&nGg;", { 8921, 824 }, "\xe2\x8b\x99\xcc\xb8", 5 },
+    { "&divideontimes;", { 8903, 0 }, "\xe2\x8b\x87", 3 },
+    { "&Ccaron;", { 268, 0 }, "\xc4\x8c", 2 },
+    { "&Ncaron;", { 327, 0 }, "\xc5\x87", 2 },
+    { "&uscr;", { 120010, 0 }, "\xf0\x9d\x93\x8a", 4 },
+    { "&popf;", { 120161, 0 }, "\xf0\x9d\x95\xa1", 4 },
+    { "&rHar;", { 10596, 0 }, "\xe2\xa5\xa4", 3 },
+    { "&eg;", { 10906, 0 }, "\xe2\xaa\x9a", 3 },
+    { "&ThickSpace;", { 8287, 8202 }, "\xe2\x81\x9f\xe2\x80\x8a", 6 },
+    { "&smashp;", { 10803, 0 }, "\xe2\xa8\xb3", 3 },
+    { "&flat;", { 9837, 0 }, "\xe2\x99\xad", 3 },
+    { "&Iacute;", { 205, 0 }, "\xc3\x8d", 2 },
+    { "&Eogon;", { 280, 0 }, "\xc4\x98", 2 },
+    { "&isinE;", { 8953, 0 }, "\xe2\x8b\xb9", 3 },
+    { "&ruluhar;", { 10600, 0 }, "\xe2\xa5\xa8", 3 },
+    { "&simeq;", { 8771, 0 }, "\xe2\x89\x83", 3 },
+    { "&reals;", { 8477, 0 }, "\xe2\x84\x9d", 3 },
+    { "&aelig;", { 230, 0 }, "\xc3\xa6", 2 },
+    { "&swarrow;", { 8601, 0 }, "\xe2\x86\x99", 3 },
+    { "&lsquo;", { 8216, 0 }, "\xe2\x80\x98", 3 },
+    { "&nvsim;", { 8764, 8402 }, "\xe2\x88\xbc\xe2\x83\x92", 6 },
+    { "&boxDR;", { 9556, 0 }, "\xe2\x95\x94", 3 },
+    { "&nshortmid;", { 8740, 0 }, "\xe2\x88\xa4", 3 },
+    { "&eng;", { 331, 0 }, "\xc5\x8b", 2 },
+    { "&ulcrop;", { 8975, 0 }, "\xe2\x8c\x8f", 3 },
+    { "&caps;", { 8745, 65024 }, "\xe2\x88\xa9\xef\xb8\x80", 6 },
+    { "&frac34;", { 190, 0 }, "\xc2\xbe", 2 },
+    { "&ccups;", { 10828, 0 }, "\xe2\xa9\x8c", 3 },
+    { "&LeftDownVectorBar;", { 10585, 0 }, "\xe2\xa5\x99", 3 },
+    { "&DZcy;", { 1039, 0 }, "\xd0\x8f", 2 },
+    { "&nprec;", { 8832, 0 }, "\xe2\x8a\x80", 3 },
+    { "&prap;", { 10935, 0 }, "\xe2\xaa\xb7", 3 },
+    { "&ENG;", { 330, 0 }, "\xc5\x8a", 2 },
+    { "&nesear;", { 10536, 0 }, "\xe2\xa4\xa8", 3 },
+    { "&NotGreaterFullEqual;", { 8807, 824 }, "\xe2\x89\xa7\xcc\xb8", 5 },
+    { "&coprod;", { 8720, 0 }, "\xe2\x88\x90", 3 },
+    { "&Yacute;", { 221, 0 }, "\xc3\x9d", 2 },
+    { "&Ntilde;", { 209, 0 }, "\xc3\x91", 2 },
+    { "&Lcaron;", { 317, 0 }, "\xc4\xbd", 2 },
+    { "&malt;", { 10016, 0 }, "\xe2\x9c\xa0", 3 },
+    { "&vBarv;", { 10985, 0 }, "\xe2\xab\xa9", 3 },
+    { "&clubsuit;", { 9827, 0 }, "\xe2\x99\xa3", 3 },
+    { "&ijlig;", { 307, 0 }, "\xc4\xb3", 2 },
+    { "&SubsetEqual;", { 8838, 0 }, "\xe2\x8a\x86", 3 },
+    { "&Epsilon;", { 917, 0 }, "\xce\x95", 2 },
+    { "&Ofr;", { 120082, 0 }, "\xf0\x9d\x94\x92", 4 },
+    { "&blank;", { 9251, 0 }, "\xe2\x90\xa3", 3 },
+    { "&bNot;", { 10989, 0 }, "\xe2\xab\xad", 3 },
+    { "&VerticalSeparator;", { 10072, 0 }, "\xe2\x9d\x98", 3 },
+    { "&pre;", { 10927, 0 }, "\xe2\xaa\xaf", 3 },
+    { "&bbrk;", { 9141, 0 }, "\xe2\x8e\xb5", 3 },
+    { "&boxDL;", { 9559, 0 }, "\xe2\x95\x97", 3 },
+    { "&iecy;", { 1077, 0 }, "\xd0\xb5", 2 },
+    { "&olcir;", { 10686, 0 }, "\xe2\xa6\xbe", 3 },
+    { "&bsime;", { 8909, 0 }, "\xe2\x8b\x8d", 3 },
+    { "&Ll;", { 8920, 0 }, "\xe2\x8b\x98", 3 },
+    { "&cup;", { 8746, 0 }, "\xe2\x88\xaa", 3 },
+    { "&slarr;", { 8592, 0 }, "\xe2\x86\x90", 3 },
+    { "&Sub;", { 8912, 0 }, "\xe2\x8b\x90", 3 },
+    { "&vDash;", { 8872, 0 }, "\xe2\x8a\xa8", 3 },
+    { "&straightepsilon;", { 1013, 0 }, "\xcf\xb5", 2 },
+    { "&cuepr;", { 8926, 0 }, "\xe2\x8b\x9e", 3 },
+    { "&DD;", { 8517, 0 }, "\xe2\x85\x85", 3 },
+    { "&xopf;", { 120169, 0 }, "\xf0\x9d\x95\xa9", 4 },
+    { "&nLl;", { 8920, 824 }, "\xe2\x8b\x98\xcc\xb8", 5 },
+    { "&Idot;", { 304, 0 }, "\xc4\xb0", 2 },
+    { "&NotLessGreater;", { 8824, 0 }, "\xe2\x89\xb8", 3 },
+    { "&chcy;", { 1095, 0 }, "\xd1\x87", 2 },
+    { "&AMP;", { 38, 0 }, "\x26", 1 },
+    { "&yucy;", { 1102, 0 }, "\xd1\x8e", 2 },
+    { "&bne;", { 61, 8421 }, "\x3d\xe2\x83\xa5", 4 },
+    { "&iocy;", { 1105, 0 }, "\xd1\x91", 2 },
+    { "&bkarow;", { 10509, 0 }, "\xe2\xa4\x8d", 3 },
+    { "&rcub;", { 125, 0 }, "\x7d", 1 },
+    { "&ecir;", { 8790, 0 }, "\xe2\x89\x96", 3 },
+    { "&Oslash;", { 216, 0 }, "\xc3\x98", 2 },
+    { "&uharr;", { 8638, 0 }, "\xe2\x86\xbe", 3 },
+    { "&robrk;", { 10215, 0 }, "\xe2\x9f\xa7", 3 },
+    { "&submult;", { 10945, 0 }, "\xe2\xab\x81", 3 },
+    { "&imagpart;", { 8465, 0 }, "\xe2\x84\x91", 3 },
+    { "&nsupe;", { 8841, 0 }, "\xe2\x8a\x89", 3 },
+    { "&nsmid;", { 8740, 0 }, "\xe2\x88\xa4", 3 },
+    { "&gvertneqq;", { 8809, 65024 }, "\xe2\x89\xa9\xef\xb8\x80", 6 },
+    { "&varsigma;", { 962, 0 }, "\xcf\x82", 2 },
+    { "&ni;", { 8715, 0 }, "\xe2\x88\x8b", 3 },
+    { "&tosa;", { 10537, 0 }, "\xe2\xa4\xa9", 3 },
+    { "&deg;", { 176, 0 }, "\xc2\xb0", 2 },
+    { "&numsp;", { 8199, 0 }, "\xe2\x80\x87", 3 },
+    { "&subrarr;", { 10617, 0 }, "\xe2\xa5\xb9", 3 },
+    { "&leg;", { 8922, 0 }, "\xe2\x8b\x9a", 3 },
+    { "&ShortLeftArrow;", { 8592, 0 }, "\xe2\x86\x90", 3 },
+    { "&acute;", { 180, 0 }, "\xc2\xb4", 2 },
+    { "&llhard;", { 10603, 0 }, "\xe2\xa5\xab", 3 },
+    { "&OverBar;", { 8254, 0 }, "\xe2\x80\xbe", 3 },
+    { "&Precedes;", { 8826, 0 }, "\xe2\x89\xba", 3 },
+    { "&ogon;", { 731, 0 }, "\xcb\x9b", 2 },
+    { "&eqslantless;", { 10901, 0 }, "\xe2\xaa\x95", 3 },
+    { "&elsdot;", { 10903, 0 }, "\xe2\xaa\x97", 3 },
+    { "&DoubleRightTee;", { 8872, 0 }, "\xe2\x8a\xa8", 3 },
+    { "&cap;", { 8745, 0 }, "\xe2\x88\xa9", 3 },
+    { "&UpArrowDownArrow;", { 8645, 0 }, "\xe2\x87\x85", 3 },
+    { "&Vdashl;", { 10982, 0 }, "\xe2\xab\xa6", 3 },
+    { "&Ycy;", { 1067, 0 }, "\xd0\xab", 2 },
+    { "&bfr;", { 120095, 0 }, "\xf0\x9d\x94\x9f", 4 },
+    { "&tilde;", { 732, 0 }, "\xcb\x9c", 2 },
+    { "&nwarr;", { 8598, 0 }, "\xe2\x86\x96", 3 },
+    { "&iuml;", { 239, 0 }, "\xc3\xaf", 2 },
+    { "&cscr;", { 119992, 0 }, "\xf0\x9d\x92\xb8", 4 },
+    { "&ngt;", { 8815, 0 }, "\xe2\x89\xaf", 3 },
+    { "&ccedil;", { 231, 0 }, "\xc3\xa7", 2 },
+    { "&NegativeMediumSpace;", { 8203, 0 }, "\xe2\x80\x8b", 3 },
+    { "&Pcy;", { 1055, 0 }, "\xd0\x9f", 2 },
+    { "&udblac;", { 369, 0 }, "\xc5\xb1", 2 },
+    { "&Ograve;", { 210, 0 }, "\xc3\x92", 2 },
+    { "&Ascr;", { 119964, 0 }, "\xf0\x9d\x92\x9c", 4 },
+    { "&angmsdah;", { 10671, 0 }, "\xe2\xa6\xaf", 3 },
+    { "&vangrt;", { 10652, 0 }, "\xe2\xa6\x9c", 3 },
+    { "&sigma;", { 963, 0 }, "\xcf\x83", 2 },
+    { "&blacktriangleleft;", { 9666, 0 }, "\xe2\x97\x82", 3 },
+    { "&iquest;", { 191, 0 }, "\xc2\xbf", 2 },
+    { "&UpTee;", { 8869, 0 }, "\xe2\x8a\xa5", 3 },
+    { "&bprime;", { 8245, 0 }, "\xe2\x80\xb5", 3 },
+    { "&Beta;", { 914, 0 }, "\xce\x92", 2 },
+    { "&RightTee;", { 8866, 0 }, "\xe2\x8a\xa2", 3 },
+    { "&sube;", { 8838, 0 }, "\xe2\x8a\x86", 3 },
+    { "&shcy;", { 1096, 0 }, "\xd1\x88", 2 },
+    { "&nrtrie;", { 8941, 0 }, "\xe2\x8b\xad", 3 },
+    { "&jscr;", { 119999, 0 }, "\xf0\x9d\x92\xbf", 4 },
+    { "&mDDot;", { 8762, 0 }, "\xe2\x88\xba", 3 },
+    { "&hookrightarrow;", { 8618, 0 }, "\xe2\x86\xaa", 3 },
+    { "&lneq;", { 10887, 0 }, "\xe2\xaa\x87", 3 },
+    { "&tridot;", { 9708, 0 }, "\xe2\x97\xac", 3 },
+    { "&xsqcup;", { 10758, 0 }, "\xe2\xa8\x86", 3 },
+    { "&Scy;", { 1057, 0 }, "\xd0\xa1", 2 },
+    { "&yacy;", { 1103, 0 }, "\xd1\x8f", 2 },
+    { "&nfr;", { 120107, 0 }, "\xf0\x9d\x94\xab", 4 },
+    { "&NotLessEqual;", { 8816, 0 }, "\xe2\x89\xb0", 3 },
+    { "&Agrave;", { 192, 0 }, "\xc3\x80", 2 },
+    { "&NotEqual;", { 8800, 0 }, "\xe2\x89\xa0", 3 },
+    { "&lnE;", { 8808, 0 }, "\xe2\x89\xa8", 3 },
+    { "&nearrow;", { 8599, 0 }, "\xe2\x86\x97", 3 },
+    { "&int;", { 8747, 0 }, "\xe2\x88\xab", 3 },
+    { "&DotEqual;", { 8784, 0 }, "\xe2\x89\x90", 3 },
+    { "&capdot;", { 10816, 0 }, "\xe2\xa9\x80", 3 },
+    { "&bsolhsub;", { 10184, 0 }, "\xe2\x9f\x88", 3 },
+    { "&Uogon;", { 370, 0 }, "\xc5\xb2", 2 },
+    { "&cuvee;", { 8910, 0 }, "\xe2\x8b\x8e", 3 },
+    { "&THORN;", { 222, 0 }, "\xc3\x9e", 2 },
+    { "&nGtv;", { 8811, 824 }, "\xe2\x89\xab\xcc\xb8", 5 },
+    { "&rbrace;", { 125, 0 }, "\x7d", 1 },
+    { "&thicksim;", { 8764, 0 }, "\xe2\x88\xbc", 3 },
+    { "&Tscr;", { 119983, 0 }, "\xf0\x9d\x92\xaf", 4 },
+    { "&xvee;", { 8897, 0 }, "\xe2\x8b\x81", 3 },
+    { "&Leftarrow;", { 8656, 0 }, "\xe2\x87\x90", 3 },
+    { "&DifferentialD;", { 8518, 0 }, "\xe2\x85\x86", 3 },
+    { "&oacute;", { 243, 0 }, "\xc3\xb3", 2 },
+    { "&vBar;", { 10984, 0 }, "\xe2\xab\xa8", 3 },
+    { "&Icy;", { 1048, 0 }, "\xd0\x98", 2 },
+    { "&ccaps;", { 10829, 0 }, "\xe2\xa9\x8d", 3 },
+    { "&Udblac;", { 368, 0 }, "\xc5\xb0", 2 },
+    { "&yuml;", { 255, 0 }, "\xc3\xbf", 2 },
+    { "&boxHd;", { 9572, 0 }, "\xe2\x95\xa4", 3 },
+    { "&nscr;", { 120003, 0 }, "\xf0\x9d\x93\x83", 4 },
+    { "&bigsqcup;", { 10758, 0 }, "\xe2\xa8\x86", 3 },
+    { "&centerdot;", { 183, 0 }, "\xc2\xb7", 2 },
+    { "&barwed;", { 8965, 0 }, "\xe2\x8c\x85", 3 },
+    { "&prE;", { 10931, 0 }, "\xe2\xaa\xb3", 3 },
+    { "&NotSubsetEqual;", { 8840, 0 }, "\xe2\x8a\x88", 3 },
+    { "&varpropto;", { 8733, 0 }, "\xe2\x88\x9d", 3 },
+    { "&gsime;", { 10894, 0 }, "\xe2\xaa\x8e", 3 },
+    { "&loang;", { 10220, 0 }, "\xe2\x9f\xac", 3 },
+    { "&subsub;", { 10965, 0 }, "\xe2\xab\x95", 3 },
+    { "&NotRightTriangleEqual;", { 8941, 0 }, "\xe2\x8b\xad", 3 },
+    { "&Nu;", { 925, 0 }, "\xce\x9d", 2 },
+    { "&iexcl;", { 161, 0 }, "\xc2\xa1", 2 },
+    { "&ohbar;", { 10677, 0 }, "\xe2\xa6\xb5", 3 },
+    { "&cacute;", { 263, 0 }, "\xc4\x87", 2 },
+    { "&csup;", { 10960, 0 }, "\xe2\xab\x90", 3 },
+    { "&RightUpVector;", { 8638, 0 }, "\xe2\x86\xbe", 3 },
+    { "&rbbrk;", { 10099, 0 }, "\xe2\x9d\xb3", 3 },
+    { "&rhov;", { 1009, 0 }, "\xcf\xb1", 2 },
+    { "&emacr;", { 275, 0 }, "\xc4\x93", 2 },
+    { "&empty;", { 8709, 0 }, "\xe2\x88\x85", 3 },
+    { "&Euml;", { 203, 0 }, "\xc3\x8b", 2 },
+    { "&succcurlyeq;", { 8829, 0 }, "\xe2\x89\xbd", 3 },
+    { "&twoheadrightarrow;", { 8608, 0 }, "\xe2\x86\xa0", 3 },
+    { "&mscr;", { 120002, 0 }, "\xf0\x9d\x93\x82", 4 },
+    { "&rhard;", { 8641, 0 }, "\xe2\x87\x81", 3 },
+    { "&Acirc;", { 194, 0 }, "\xc3\x82", 2 },
+    { "&gnE;", { 8809, 0 }, "\xe2\x89\xa9", 3 },
+    { "&zcaron;", { 382, 0 }, "\xc5\xbe", 2 },
+    { "&boxvr;", { 9500, 0 }, "\xe2\x94\x9c", 3 },
+    { "&Uparrow;", { 8657, 0 }, "\xe2\x87\x91", 3 },
+    { "&thksim;", { 8764, 0 }, "\xe2\x88\xbc", 3 },
+    { "&Wscr;", { 119986, 0 }, "\xf0\x9d\x92\xb2", 4 },
+    { "&gsim;", { 8819, 0 }, "\xe2\x89\xb3", 3 },
+    { "&Cup;", { 8915, 0 }, "\xe2\x8b\x93", 3 },
+    { "&downarrow;", { 8595, 0 }, "\xe2\x86\x93", 3 },
+    { "&RightTriangle;", { 8883, 0 }, "\xe2\x8a\xb3", 3 },
+    { "&lsim;", { 8818, 0 }, "\xe2\x89\xb2", 3 },
+    { "&bigcap;", { 8898, 0 }, "\xe2\x8b\x82", 3 },
+    { "&larrhk;", { 8617, 0 }, "\xe2\x86\xa9", 3 },
+    { "&xmap;", { 10236, 0 }, "\xe2\x9f\xbc", 3 },
+    { "&Equilibrium;", { 8652, 0 }, "\xe2\x87\x8c", 3 },
+    { "&glE;", { 10898, 0 }, "\xe2\xaa\x92", 3 },
+    { "&LeftTee;", { 8867, 0 }, "\xe2\x8a\xa3", 3 },
+    { "&MediumSpace;", { 8287, 0 }, "\xe2\x81\x9f", 3 },
+    { "&Jcy;", { 1049, 0 }, "\xd0\x99", 2 },
+    { "&Omacr;", { 332, 0 }, "\xc5\x8c", 2 },
+    { "&hellip;", { 8230, 0 }, "\xe2\x80\xa6", 3 },
+    { "&Kcedil;", { 310, 0 }, "\xc4\xb6", 2 },
+    { "&rtimes;", { 8906, 0 }, "\xe2\x8b\x8a", 3 },
+    { "&opar;", { 10679, 0 }, "\xe2\xa6\xb7", 3 },
+    { "&doteq;", { 8784, 0 }, "\xe2\x89\x90", 3 },
+    { "&bullet;", { 8226, 0 }, "\xe2\x80\xa2", 3 },
+    { "&gla;", { 10917, 0 }, "\xe2\xaa\xa5", 3 },
+    { "&lmidot;", { 320, 0 }, "\xc5\x80", 2 },
+    { "&Iscr;", { 8464, 0 }, "\xe2\x84\x90", 3 },
+    { "&prime;", { 8242, 0 }, "\xe2\x80\xb2", 3 },
+    { "&frac12;", { 189, 0 }, "\xc2\xbd", 2 },
+    { "&verbar;", { 124, 0 }, "\x7c", 1 },
+    { "&rightleftharpoons;", { 8652, 0 }, "\xe2\x87\x8c", 3 },
+    { "&mp;", { 8723, 0 }, "\xe2\x88\x93", 3 },
+    { "&gtlPar;", { 10645, 0 }, "\xe2\xa6\x95", 3 },
+    { "&lhblk;", { 9604, 0 }, "\xe2\x96\x84", 3 },
+    { "&subE;", { 10949, 0 }, "\xe2\xab\x85", 3 },
+    { "&Nfr;", { 120081, 0 }, "\xf0\x9d\x94\x91", 4 },
+    { "&boxhu;", { 9524, 0 }, "\xe2\x94\xb4", 3 },
+    { "&ntrianglelefteq;", { 8940, 0 }, "\xe2\x8b\xac", 3 },
+    { "&boxVL;", { 9571, 0 }, "\xe2\x95\xa3", 3 },
+    { "&boxplus;", { 8862, 0 }, "\xe2\x8a\x9e", 3 },
+    { "&DoubleLongLeftRightArrow;", { 10234, 0 }, "\xe2\x9f\xba", 3 },
+    { "&ZeroWidthSpace;", { 8203, 0 }, "\xe2\x80\x8b", 3 },
+    { "&capand;", { 10820, 0 }, "\xe2\xa9\x84", 3 },
+    { "&planck;", { 8463, 0 }, "\xe2\x84\x8f", 3 },
+    { "&NestedGreaterGreater;", { 8811, 0 }, "\xe2\x89\xab", 3 },
+    { "&origof;", { 8886, 0 }, "\xe2\x8a\xb6", 3 },
+    { "&Fopf;", { 120125, 0 }, "\xf0\x9d\x94\xbd", 4 },
+    { "&Or;", { 10836, 0 }, "\xe2\xa9\x94", 3 },
+    { "&lscr;", { 120001, 0 }, "\xf0\x9d\x93\x81", 4 },
+    { "&dfisht;", { 10623, 0 }, "\xe2\xa5\xbf", 3 },
+    { "&circleddash;", { 8861, 0 }, "\xe2\x8a\x9d", 3 },
+    { "&dscy;", { 1109, 0 }, "\xd1\x95", 2 },
+    { "&intprod;", { 10812, 0 }, "\xe2\xa8\xbc", 3 },
+    { "&incare;", { 8453, 0 }, "\xe2\x84\x85", 3 },
+    { "&xcap;", { 8898, 0 }, "\xe2\x8b\x82", 3 },
+    { "&angrtvb;", { 8894, 0 }, "\xe2\x8a\xbe", 3 },
+    { "&easter;", { 10862, 0 }, "\xe2\xa9\xae", 3 },
+    { "&angle;", { 8736, 0 }, "\xe2\x88\xa0", 3 },
+    { "&emptyv;", { 8709, 0 }, "\xe2\x88\x85", 3 },
+    { "&Uacute;", { 218, 0 }, "\xc3\x9a", 2 },
+    { "&nsce;", { 10928, 824 }, "\xe2\xaa\xb0\xcc\xb8", 5 },
+    { "&boxV;", { 9553, 0 }, "\xe2\x95\x91", 3 },
+    { "&gnsim;", { 8935, 0 }, "\xe2\x8b\xa7", 3 },
+    { "&yen;", { 165, 0 }, "\xc2\xa5", 2 },
+    { "&angmsdaf;", { 10669, 0 }, "\xe2\xa6\xad", 3 },
+    { "&approxeq;", { 8778, 0 }, "\xe2\x89\x8a", 3 },
+    { "&vsupnE;", { 10956, 65024 }, "\xe2\xab\x8c\xef\xb8\x80", 6 },
+    { "&otilde;", { 245, 0 }, "\xc3\xb5", 2 },
+    { "&bigotimes;", { 10754, 0 }, "\xe2\xa8\x82", 3 },
+    { "&rangd;", { 10642, 0 }, "\xe2\xa6\x92", 3 },
+    { "&NotLessTilde;", { 8820, 0 }, "\xe2\x89\xb4", 3 },
+    { "&ncongdot;", { 10861, 824 }, "\xe2\xa9\xad\xcc\xb8", 5 },
+    { "&sce;", { 10928, 0 }, "\xe2\xaa\xb0", 3 },
+    { "&DownRightTeeVector;", { 10591, 0 }, "\xe2\xa5\x9f", 3 },
+    { "&rarrc;", { 10547, 0 }, "\xe2\xa4\xb3", 3 },
+    { "&omicron;", { 959, 0 }, "\xce\xbf", 2 },
+    { "&Gdot;", { 288, 0 }, "\xc4\xa0", 2 },
+    { "&leftharpoondown;", { 8637, 0 }, "\xe2\x86\xbd", 3 },
+    { "&Gg;", { 8921, 0 }, "\xe2\x8b\x99", 3 },
+    { "&esdot;", { 8784, 0 }, "\xe2\x89\x90", 3 },
+    { "&Gcirc;", { 284, 0 }, "\xc4\x9c", 2 },
+    { "&gdot;", { 289, 0 }, "\xc4\xa1", 2 },
+    { "&erDot;", { 8787, 0 }, "\xe2\x89\x93", 3 },
+    { "&NotSuperset;", { 8835, 8402 }, "\xe2\x8a\x83\xe2\x83\x92", 6 },
+    { "&sum;", { 8721, 0 }, "\xe2\x88\x91", 3 },
+    { "&zeta;", { 950, 0 }, "\xce\xb6", 2 },
+    { "&Gscr;", { 119970, 0 }, "\xf0\x9d\x92\xa2", 4 },
+    { "&upsilon;", { 965, 0 }, "\xcf\x85", 2 },
+    { "&Sfr;", { 120086, 0 }, "\xf0\x9d\x94\x96", 4 },
+    { "&NotGreater;", { 8815, 0 }, "\xe2\x89\xaf", 3 },
+    { "&Psi;", { 936, 0 }, "\xce\xa8", 2 },
+    { "&Emacr;", { 274, 0 }, "\xc4\x92", 2 },
+    { "&ograve;", { 242, 0 }, "\xc3\xb2", 2 },
+    { "&sqcup;", { 8852, 0 }, "\xe2\x8a\x94", 3 },
+    { "&gtrarr;", { 10616, 0 }, "\xe2\xa5\xb8", 3 },
+    { "&male;", { 9794, 0 }, "\xe2\x99\x82", 3 },
+    { "&ucirc;", { 251, 0 }, "\xc3\xbb", 2 },
+    { "&larrsim;", { 10611, 0 }, "\xe2\xa5\xb3", 3 },
+    { "&NotSucceeds;", { 8833, 0 }, "\xe2\x8a\x81", 3 },
+    { "&orderof;", { 8500, 0 }, "\xe2\x84\xb4", 3 },
+    { "&thkap;", { 8776, 0 }, "\xe2\x89\x88", 3 },
+    { "&multimap;", { 8888, 0 }, "\xe2\x8a\xb8", 3 },
+    { "&oelig;", { 339, 0 }, "\xc5\x93", 2 },
+    { "&ngeqq;", { 8807, 824 }, "\xe2\x89\xa7\xcc\xb8", 5 },
+    { "&succneqq;", { 10934, 0 }, "\xe2\xaa\xb6", 3 },
+    { "&LongLeftRightArrow;", { 10231, 0 }, "\xe2\x9f\xb7", 3 },
+    { "&Ubrcy;", { 1038, 0 }, "\xd0\x8e", 2 },
+    { "&sqsubseteq;", { 8849, 0 }, "\xe2\x8a\x91", 3 },
+    { "&inodot;", { 305, 0 }, "\xc4\xb1", 2 },
+    { "&Larr;", { 8606, 0 }, "\xe2\x86\x9e", 3 },
+    { "&upharpoonright;", { 8638, 0 }, "\xe2\x86\xbe", 3 },
+    { "&ntlg;", { 8824, 0 }, "\xe2\x89\xb8", 3 },
+    { "&Therefore;", { 8756, 0 }, "\xe2\x88\xb4", 3 },
+    { "&nedot;", { 8784, 824 }, "\xe2\x89\x90\xcc\xb8", 5 },
+    { "&Ncedil;", { 325, 0 }, "\xc5\x85", 2 },
+    { "&thinsp;", { 8201, 0 }, "\xe2\x80\x89", 3 },
+    { "&RightUpTeeVector;", { 10588, 0 }, "\xe2\xa5\x9c", 3 },
+    { "&imagline;", { 8464, 0 }, "\xe2\x84\x90", 3 },
+    { "&Theta;", { 920, 0 }, "\xce\x98", 2 },
+    { "&TildeEqual;", { 8771, 0 }, "\xe2\x89\x83", 3 },
+    { "&parallel;", { 8741, 0 }, "\xe2\x88\xa5", 3 },
+    { "&num;", { 35, 0 }, "\x23", 1 },
+    { "&bnot;", { 8976, 0 }, "\xe2\x8c\x90", 3 },
+    { "&tfr;", { 120113, 0 }, "\xf0\x9d\x94\xb1", 4 },
+    { "&ecolon;", { 8789, 0 }, "\xe2\x89\x95", 3 },
+    { "&nlt;", { 8814, 0 }, "\xe2\x89\xae", 3 },
+    { "&lcy;", { 1083, 0 }, "\xd0\xbb", 2 },
+    { "&lhard;", { 8637, 0 }, "\xe2\x86\xbd", 3 },
+    { "&chi;", { 967, 0 }, "\xcf\x87", 2 },
+    { "&realine;", { 8475, 0 }, "\xe2\x84\x9b", 3 },
+    { "&DownTee;", { 8868, 0 }, "\xe2\x8a\xa4", 3 },
+    { "&kappav;", { 1008, 0 }, "\xcf\xb0", 2 },
+    { "&Hscr;", { 8459, 0 }, "\xe2\x84\x8b", 3 },
+    { "&precnapprox;", { 10937, 0 }, "\xe2\xaa\xb9", 3 },
+    { "&DoubleRightArrow;", { 8658, 0 }, "\xe2\x87\x92", 3 },
+    { "&infin;", { 8734, 0 }, "\xe2\x88\x9e", 3 },
+    { "&dbkarow;", { 10511, 0 }, "\xe2\xa4\x8f", 3 },
+    { "&plusb;", { 8862, 0 }, "\xe2\x8a\x9e", 3 },
+    { "&orslope;", { 10839, 0 }, "\xe2\xa9\x97", 3 },
+    { "&jmath;", { 567, 0 }, "\xc8\xb7", 2 },
+    { "&euro;", { 8364, 0 }, "\xe2\x82\xac", 3 },
+    { "&simdot;", { 10858, 0 }, "\xe2\xa9\xaa", 3 },
+    { "&equiv;", { 8801, 0 }, "\xe2\x89\xa1", 3 },
+    { "&nequiv;", { 8802, 0 }, "\xe2\x89\xa2", 3 },
+    { "&NotExists;", { 8708, 0 }, "\xe2\x88\x84", 3 },
+    { "&nltrie;", { 8940, 0 }, "\xe2\x8b\xac", 3 },
+    { "&therefore;", { 8756, 0 }, "\xe2\x88\xb4", 3 },
+    { "&RightArrowBar;", { 8677, 0 }, "\xe2\x87\xa5", 3 },
+    { "&jukcy;", { 1108, 0 }, "\xd1\x94", 2 },
+    { "&NotPrecedesEqual;", { 10927, 824 }, "\xe2\xaa\xaf\xcc\xb8", 5 },
+    { "&les;", { 10877, 0 }, "\xe2\xa9\xbd", 3 },
+    { "&ngeq;", { 8817, 0 }, "\xe2\x89\xb1", 3 },
+    { "&lsh;", { 8624, 0 }, "\xe2\x86\xb0", 3 },
+    { "&raemptyv;", { 10675, 0 }, "\xe2\xa6\xb3", 3 },
+    { "&rbarr;", { 10509, 0 }, "\xe2\xa4\x8d", 3 },
+    { "&DotDot;", { 8412, 0 }, "\xe2\x83\x9c", 3 },
+    { "&OverBrace;", { 9182, 0 }, "\xe2\x8f\x9e", 3 },
+    { "&ncaron;", { 328, 0 }, "\xc5\x88", 2 },
+    { "&gescc;", { 10921, 0 }, "\xe2\xaa\xa9", 3 },
+    { "&mu;", { 956, 0 }, "\xce\xbc", 2 },
+    { "&imath;", { 305, 0 }, "\xc4\xb1", 2 },
+    { "&bigvee;", { 8897, 0 }, "\xe2\x8b\x81", 3 },
+    { "&Gfr;", { 120074, 0 }, "\xf0\x9d\x94\x8a", 4 },
+    { "&succnsim;", { 8937, 0 }, "\xe2\x8b\xa9", 3 },
+    { "&lnapprox;", { 10889, 0 }, "\xe2\xaa\x89", 3 },
+    { "&ang;", { 8736, 0 }, "\xe2\x88\xa0", 3 },
+    { "&dblac;", { 733, 0 }, "\xcb\x9d", 2 },
+    { "&Re;", { 8476, 0 }, "\xe2\x84\x9c", 3 },
+    { "&diamond;", { 8900, 0 }, "\xe2\x8b\x84", 3 },
+    { "&udarr;", { 8645, 0 }, "\xe2\x87\x85", 3 },
+    { "&ljcy;", { 1113, 0 }, "\xd1\x99", 2 },
+    { "&gcy;", { 1075, 0 }, "\xd0\xb3", 2 },
+    { "&DownLeftTeeVector;", { 10590, 0 }, "\xe2\xa5\x9e", 3 },
+    { "&notnivc;", { 8957, 0 }, "\xe2\x8b\xbd", 3 },
+    { "&bot;", { 8869, 0 }, "\xe2\x8a\xa5", 3 },
+    { "&plusdo;", { 8724, 0 }, "\xe2\x88\x94", 3 },
+    { "&xuplus;", { 10756, 0 }, "\xe2\xa8\x84", 3 },
+    { "&lbrksld;", { 10639, 0 }, "\xe2\xa6\x8f", 3 },
+    { "&leftleftarrows;", { 8647, 0 }, "\xe2\x87\x87", 3 },
+    { "&ascr;", { 119990, 0 }, "\xf0\x9d\x92\xb6", 4 },
+    { "&telrec;", { 8981, 0 }, "\xe2\x8c\x95", 3 },
+    { "&hslash;", { 8463, 0 }, "\xe2\x84\x8f", 3 },
+    { "&lltri;", { 9722, 0 }, "\xe2\x97\xba", 3 },
+    { "&Rho;", { 929, 0 }, "\xce\xa1", 2 },
+    { "&hcirc;", { 293, 0 }, "\xc4\xa5", 2 },
+    { "&setmn;", { 8726, 0 }, "\xe2\x88\x96", 3 },
+    { "&Uarrocir;", { 10569, 0 }, "\xe2\xa5\x89", 3 },
+    { "&simlE;", { 10911, 0 }, "\xe2\xaa\x9f", 3 },
+    { "&triangleleft;", { 9667, 0 }, "\xe2\x97\x83", 3 },
+    { "&hkswarow;", { 10534, 0 }, "\xe2\xa4\xa6", 3 },
+    { "&gbreve;", { 287, 0 }, "\xc4\x9f", 2 },
+    { "&equivDD;", { 10872, 0 }, "\xe2\xa9\xb8", 3 },
+    { "&eDot;", { 8785, 0 }, "\xe2\x89\x91", 3 },
+    { "&Jukcy;", { 1028, 0 }, "\xd0\x84", 2 },
+    { "&Lscr;", { 8466, 0 }, "\xe2\x84\x92", 3 },
+    { "&SOFTcy;", { 1068, 0 }, "\xd0\xac", 2 },
+    { "&NotElement;", { 8713, 0 }, "\xe2\x88\x89", 3 },
+    { "&Rcy;", { 1056, 0 }, "\xd0\xa0", 2 },
+    { "&Qopf;", { 8474, 0 }, "\xe2\x84\x9a", 3 },
+    { "&nsime;", { 8772, 0 }, "\xe2\x89\x84", 3 },
+    { "&gnapprox;", { 10890, 0 }, "\xe2\xaa\x8a", 3 },
+    { "&gnap;", { 10890, 0 }, "\xe2\xaa\x8a", 3 },
+    { "&Product;", { 8719, 0 }, "\xe2\x88\x8f", 3 },
+    { "&Ouml;", { 214, 0 }, "\xc3\x96", 2 },
+    { "&ForAll;", { 8704, 0 }, "\xe2\x88\x80", 3 },
+    { "&utdot;", { 8944, 0 }, "\xe2\x8b\xb0", 3 },
+    { "&GreaterEqual;", { 8805, 0 }, "\xe2\x89\xa5", 3 },
+    { "&fpartint;", { 10765, 0 }, "\xe2\xa8\x8d", 3 },
+    { "&varepsilon;", { 1013, 0 }, "\xcf\xb5", 2 },
+    { "&otimesas;", { 10806, 0 }, "\xe2\xa8\xb6", 3 },
+    { "&boxdR;", { 9554, 0 }, "\xe2\x95\x92", 3 },
+    { "&gjcy;", { 1107, 0 }, "\xd1\x93", 2 },
+    { "&notinva;", { 8713, 0 }, "\xe2\x88\x89", 3 },
+    { "&varr;", { 8597, 0 }, "\xe2\x86\x95", 3 },
+    { "&varpi;", { 982, 0 }, "\xcf\x96", 2 },
+    { "&Zeta;", { 918, 0 }, "\xce\x96", 2 },
+    { "&ropar;", { 10630, 0 }, "\xe2\xa6\x86", 3 },
+    { "&coloneq;", { 8788, 0 }, "\xe2\x89\x94", 3 },
+    { "&tcedil;", { 355, 0 }, "\xc5\xa3", 2 },
+    { "&supsup;", { 10966, 0 }, "\xe2\xab\x96", 3 },
+    { "&rightharpoondown;", { 8641, 0 }, "\xe2\x87\x81", 3 },
+    { "&prod;", { 8719, 0 }, "\xe2\x88\x8f", 3 },
+    { "&odash;", { 8861, 0 }, "\xe2\x8a\x9d", 3 },
+    { "&Otimes;", { 10807, 0 }, "\xe2\xa8\xb7", 3 },
+    { "&rbrke;", { 10636, 0 }, "\xe2\xa6\x8c", 3 },
+    { "&ocirc;", { 244, 0 }, "\xc3\xb4", 2 },
+    { "&rect;", { 9645, 0 }, "\xe2\x96\xad", 3 },
+    { "&ltrif;", { 9666, 0 }, "\xe2\x97\x82", 3 },
+    { "&leftarrowtail;", { 8610, 0 }, "\xe2\x86\xa2", 3 },
+    { "&Coproduct;", { 8720, 0 }, "\xe2\x88\x90", 3 },
+    { "&Lsh;", { 8624, 0 }, "\xe2\x86\xb0", 3 },
+    { "&dstrok;", { 273, 0 }, "\xc4\x91", 2 },
+    { "&RightDownTeeVector;", { 10589, 0 }, "\xe2\xa5\x9d", 3 },
+    { "&InvisibleComma;", { 8291, 0 }, "\xe2\x81\xa3", 3 },
+    { "&intercal;", { 8890, 0 }, "\xe2\x8a\xba", 3 },
+    { "&Ugrave;", { 217, 0 }, "\xc3\x99", 2 },
+    { "&ic;", { 8291, 0 }, "\xe2\x81\xa3", 3 },
+    { "&smt;", { 10922, 0 }, "\xe2\xaa\xaa", 3 },
+    { "&Barwed;", { 8966, 0 }, "\xe2\x8c\x86", 3 },
+    { "&nldr;", { 8229, 0 }, "\xe2\x80\xa5", 3 },
+    { "&SucceedsTilde;", { 8831, 0 }, "\xe2\x89\xbf", 3 },
+    { "&Aopf;", { 120120, 0 }, "\xf0\x9d\x94\xb8", 4 },
+    { "&kopf;", { 120156, 0 }, "\xf0\x9d\x95\x9c", 4 },
+    { "&lceil;", { 8968, 0 }, "\xe2\x8c\x88", 3 },
+    { "&fltns;", { 9649, 0 }, "\xe2\x96\xb1", 3 },
+    { "&Lacute;", { 313, 0 }, "\xc4\xb9", 2 },
+    { "&odblac;", { 337, 0 }, "\xc5\x91", 2 },
+    { "&rlm;", { 8207, 0 }, "\xe2\x80\x8f", 3 },
+    { "&lesdoto;", { 10881, 0 }, "\xe2\xaa\x81", 3 },
+    { "&angmsdac;", { 10666, 0 }, "\xe2\xa6\xaa", 3 },
+    { "&nrtri;", { 8939, 0 }, "\xe2\x8b\xab", 3 },
+    { "&CloseCurlyQuote;", { 8217, 0 }, "\xe2\x80\x99", 3 },
+    { "&diams;", { 9830, 0 }, "\xe2\x99\xa6", 3 },
+    { "&angst;", { 197, 0 }, "\xc3\x85", 2 },
+    { "&lrtri;", { 8895, 0 }, "\xe2\x8a\xbf", 3 },
+    { "&LowerLeftArrow;", { 8601, 0 }, "\xe2\x86\x99", 3 },
+    { "&cudarrl;", { 10552, 0 }, "\xe2\xa4\xb8", 3 },
+    { "&checkmark;", { 10003, 0 }, "\xe2\x9c\x93", 3 },
+    { "&Vopf;", { 120141, 0 }, "\xf0\x9d\x95\x8d", 4 },
+    { "&omacr;", { 333, 0 }, "\xc5\x8d", 2 },
+    { "&SucceedsSlantEqual;", { 8829, 0 }, "\xe2\x89\xbd", 3 },
+    { "&bscr;", { 119991, 0 }, "\xf0\x9d\x92\xb7", 4 },
+    { "&racute;", { 341, 0 }, "\xc5\x95", 2 },
+    { "&LeftUpDownVector;", { 10577, 0 }, "\xe2\xa5\x91", 3 },
+    { "&starf;", { 9733, 0 }, "\xe2\x98\x85", 3 },
+    { "&blk14;", { 9617, 0 }, "\xe2\x96\x91", 3 },
+    { "&rarrsim;", { 10612, 0 }, "\xe2\xa5\xb4", 3 },
+    { "&nwnear;", { 10535, 0 }, "\xe2\xa4\xa7", 3 },
+    { "&planckh;", { 8462, 0 }, "\xe2\x84\x8e", 3 },
+    { "&suphsub;", { 10967, 0 }, "\xe2\xab\x97", 3 },
+    { "&loplus;", { 10797, 0 }, "\xe2\xa8\xad", 3 },
+    { "&vArr;", { 8661, 0 }, "\xe2\x87\x95", 3 },
+    { "&precsim;", { 8830, 0 }, "\xe2\x89\xbe", 3 },
+    { "&Poincareplane;", { 8460, 0 }, "\xe2\x84\x8c", 3 },
+    { "&times;", { 215, 0 }, "\xc3\x97", 2 },
+    { "&boxdr;", { 9484, 0 }, "\xe2\x94\x8c", 3 },
+    { "&ecaron;", { 283, 0 }, "\xc4\x9b", 2 },
+    { "&NotTilde;", { 8769, 0 }, "\xe2\x89\x81", 3 },
+    { "&Int;", { 8748, 0 }, "\xe2\x88\xac", 3 },
+    { "&xlArr;", { 10232, 0 }, "\xe2\x9f\xb8", 3 },
+    { "&boxvH;", { 9578, 0 }, "\xe2\x95\xaa", 3 },
+    { "&phone;", { 9742, 0 }, "\xe2\x98\x8e", 3 },
+    { "&LessLess;", { 10913, 0 }, "\xe2\xaa\xa1", 3 },
+    { "&EmptyVerySmallSquare;", { 9643, 0 }, "\xe2\x96\xab", 3 },
+    { "&supseteq;", { 8839, 0 }, "\xe2\x8a\x87", 3 },
+    { "&dharl;", { 8643, 0 }, "\xe2\x87\x83", 3 },
+    { "&nsucc;", { 8833, 0 }, "\xe2\x8a\x81", 3 },
+    { "&supnE;", { 10956, 0 }, "\xe2\xab\x8c", 3 },
+    { "&gesles;", { 10900, 0 }, "\xe2\xaa\x94", 3 },
+    { "&leqslant;", { 10877, 0 }, "\xe2\xa9\xbd", 3 },
+    { "&nge;", { 8817, 0 }, "\xe2\x89\xb1", 3 },
+    { "&aogon;", { 261, 0 }, "\xc4\x85", 2 },
+    { "&geq;", { 8805, 0 }, "\xe2\x89\xa5", 3 },
+    { "&uhblk;", { 9600, 0 }, "\xe2\x96\x80", 3 },
+    { "&straightphi;", { 981, 0 }, "\xcf\x95", 2 },
+    { "&cent;", { 162, 0 }, "\xc2\xa2", 2 },
+    { "&lBarr;", { 10510, 0 }, "\xe2\xa4\x8e", 3 },
+    { "&eqvparsl;", { 10725, 0 }, "\xe2\xa7\xa5", 3 },
+    { "&ovbar;", { 9021, 0 }, "\xe2\x8c\xbd", 3 },
+    { "&Ucy;", { 1059, 0 }, "\xd0\xa3", 2 },
+    { "&die;", { 168, 0 }, "\xc2\xa8", 2 },
+    { "&and;", { 8743, 0 }, "\xe2\x88\xa7", 3 },
+    { "&harrw;", { 8621, 0 }, "\xe2\x86\xad", 3 },
+    { "&ofcir;", { 10687, 0 }, "\xe2\xa6\xbf", 3 },
+    { "&pfr;", { 120109, 0 }, "\xf0\x9d\x94\xad", 4 },
+    { "&OpenCurlyQuote;", { 8216, 0 }, "\xe2\x80\x98", 3 },
+    { "&iprod;", { 10812, 0 }, "\xe2\xa8\xbc", 3 },
+    { "&rtrif;", { 9656, 0 }, "\xe2\x96\xb8", 3 },
+    { "&sigmav;", { 962, 0 }, "\xcf\x82", 2 },
+    { "&Yuml;", { 376, 0 }, "\xc5\xb8", 2 },
+    { "&OverBracket;", { 9140, 0 }, "\xe2\x8e\xb4", 3 },
+    { "&eqsim;", { 8770, 0 }, "\xe2\x89\x82", 3 },
+    { "&sup3;", { 179, 0 }, "\xc2\xb3", 2 },
+    { "&Sigma;", { 931, 0 }, "\xce\xa3", 2 },
+    { "&rx;", { 8478, 0 }, "\xe2\x84\x9e", 3 },
+    { "&nvgt;", { 62, 8402 }, "\x3e\xe2\x83\x92", 4 },
+    { "&bigstar;", { 9733, 0 }, "\xe2\x98\x85", 3 },
+    { "&pointint;", { 10773, 0 }, "\xe2\xa8\x95", 3 },
+    { "&LeftVectorBar;", { 10578, 0 }, "\xe2\xa5\x92", 3 },
+    { "&gvnE;", { 8809, 65024 }, "\xe2\x89\xa9\xef\xb8\x80", 6 },
+    { "&rarrtl;", { 8611, 0 }, "\xe2\x86\xa3", 3 },
+    { "&rsh;", { 8625, 0 }, "\xe2\x86\xb1", 3 },
+    { "&ncup;", { 10818, 0 }, "\xe2\xa9\x82", 3 },
+    { "&lnsim;", { 8934, 0 }, "\xe2\x8b\xa6", 3 },
+    { "&boxhD;", { 9573, 0 }, "\xe2\x95\xa5", 3 },
+    { "&comp;", { 8705, 0 }, "\xe2\x88\x81", 3 },
+    { "&LeftArrowBar;", { 8676, 0 }, "\xe2\x87\xa4", 3 },
+    { "&CounterClockwiseContourIntegral;", { 8755, 0 }, "\xe2\x88\xb3", 3 },
+    { "&blacksquare;", { 9642, 0 }, "\xe2\x96\xaa", 3 },
+    { "&square;", { 9633, 0 }, "\xe2\x96\xa1", 3 },
+    { "&Vvdash;", { 8874, 0 }, "\xe2\x8a\xaa", 3 },
+    { "&Dot;", { 168, 0 }, "\xc2\xa8", 2 },
+    { "&doublebarwedge;", { 8966, 0 }, "\xe2\x8c\x86", 3 },
+    { "&triangleq;", { 8796, 0 }, "\xe2\x89\x9c", 3 },
+    { "&Dashv;", { 10980, 0 }, "\xe2\xab\xa4", 3 },
+    { "&lacute;", { 314, 0 }, "\xc4\xba", 2 },
+    { "&abreve;", { 259, 0 }, "\xc4\x83", 2 },
+    { "&rnmid;", { 10990, 0 }, "\xe2\xab\xae", 3 },
+    { "&complexes;", { 8450, 0 }, "\xe2\x84\x82", 3 },
+    { "&napE;", { 10864, 824 }, "\xe2\xa9\xb0\xcc\xb8", 5 },
+    { "&LeftDownTeeVector;", { 10593, 0 }, "\xe2\xa5\xa1", 3 },
+    { "&Cayleys;", { 8493, 0 }, "\xe2\x84\xad", 3 },
+    { "&lurdshar;", { 10570, 0 }, "\xe2\xa5\x8a", 3 },
+    { "&range;", { 10661, 0 }, "\xe2\xa6\xa5", 3 },
+    { "&Vee;", { 8897, 0 }, "\xe2\x8b\x81", 3 },
+    { "&harr;", { 8596, 0 }, "\xe2\x86\x94", 3 },
+    { "&half;", { 189, 0 }, "\xc2\xbd", 2 },
+    { "&xotime;", { 10754, 0 }, "\xe2\xa8\x82", 3 },
+    { "&lowast;", { 8727, 0 }, "\xe2\x88\x97", 3 },
+    { "&excl;", { 33, 0 }, "\x21", 1 },
+    { "&DiacriticalTilde;", { 732, 0 }, "\xcb\x9c", 2 },
+    { "&Zfr;", { 8488, 0 }, "\xe2\x84\xa8", 3 },
+    { "&SHcy;", { 1064, 0 }, "\xd0\xa8", 2 },
+    { "&Union;", { 8899, 0 }, "\xe2\x8b\x83", 3 },
+    { "&div;", { 247, 0 }, "\xc3\xb7", 2 },
+    { "&upuparrows;", { 8648, 0 }, "\xe2\x87\x88", 3 },
+    { "&nbump;", { 8782, 824 }, "\xe2\x89\x8e\xcc\xb8", 5 },
+    { "&midcir;", { 10992, 0 }, "\xe2\xab\xb0", 3 },
+    { "&NotDoubleVerticalBar;", { 8742, 0 }, "\xe2\x88\xa6", 3 },
+    { "&hksearow;", { 10533, 0 }, "\xe2\xa4\xa5", 3 },
+    { "&lesssim;", { 8818, 0 }, "\xe2\x89\xb2", 3 },
+    { "&UpperLeftArrow;", { 8598, 0 }, "\xe2\x86\x96", 3 },
+    { "&sfr;", { 120112, 0 }, "\xf0\x9d\x94\xb0", 4 },
+    { "&piv;", { 982, 0 }, "\xcf\x96", 2 },
+    { "&bumpe;", { 8783, 0 }, "\xe2\x89\x8f", 3 },
+    { "&horbar;", { 8213, 0 }, "\xe2\x80\x95", 3 },
+    { "&afr;", { 120094, 0 }, "\xf0\x9d\x94\x9e", 4 },
+    { "&fcy;", { 1092, 0 }, "\xd1\x84", 2 },
+    { "&nprcue;", { 8928, 0 }, "\xe2\x8b\xa0", 3 },
+    { "&nvge;", { 8805, 8402 }, "\xe2\x89\xa5\xe2\x83\x92", 6 },
+    { "&nsccue;", { 8929, 0 }, "\xe2\x8b\xa1", 3 },
+    { "&dscr;", { 119993, 0 }, "\xf0\x9d\x92\xb9", 4 },
+    { "&smallsetminus;", { 8726, 0 }, "\xe2\x88\x96", 3 },
+    { "&updownarrow;", { 8597, 0 }, "\xe2\x86\x95", 3 },
+    { "&lArr;", { 8656, 0 }, "\xe2\x87\x90", 3 },
+    { "&Assign;", { 8788, 0 }, "\xe2\x89\x94", 3 },
+    { "&notindot;", { 8949, 824 }, "\xe2\x8b\xb5\xcc\xb8", 5 },
+    { "&FilledVerySmallSquare;", { 9642, 0 }, "\xe2\x96\xaa", 3 },
+    { "&cylcty;", { 9005, 0 }, "\xe2\x8c\xad", 3 },
+    { "&npolint;", { 10772, 0 }, "\xe2\xa8\x94", 3 },
+    { "&NotHumpDownHump;", { 8782, 824 }, "\xe2\x89\x8e\xcc\xb8", 5 },
+    { "&Imacr;", { 298, 0 }, "\xc4\xaa", 2 },
+    { "&xrarr;", { 10230, 0 }, "\xe2\x9f\xb6", 3 },
+    { "&diam;", { 8900, 0 }, "\xe2\x8b\x84", 3 },
+    { "&DoubleContourIntegral;", { 8751, 0 }, "\xe2\x88\xaf", 3 },
+    { "&simne;", { 8774, 0 }, "\xe2\x89\x86", 3 },
+    { "&sqcap;", { 8851, 0 }, "\xe2\x8a\x93", 3 },
+    { "&DiacriticalDoubleAcute;", { 733, 0 }, "\xcb\x9d", 2 },
+    { "&NotCupCap;", { 8813, 0 }, "\xe2\x89\xad", 3 },
+    { "&vscr;", { 120011, 0 }, "\xf0\x9d\x93\x8b", 4 },
+    { "&because;", { 8757, 0 }, "\xe2\x88\xb5", 3 },
+    { "&sqsubset;", { 8847, 0 }, "\xe2\x8a\x8f", 3 },
+    { "&angmsdag;", { 10670, 0 }, "\xe2\xa6\xae", 3 },
+    { "&IJlig;", { 306, 0 }, "\xc4\xb2", 2 },
+    { "&Bcy;", { 1041, 0 }, "\xd0\x91", 2 },
+    { "&NotSquareSubset;", { 8847, 824 }, "\xe2\x8a\x8f\xcc\xb8", 5 },
+    { "&Downarrow;", { 8659, 0 }, "\xe2\x87\x93", 3 },
+    { "&bumpE;", { 10926, 0 }, "\xe2\xaa\xae", 3 },
+    { "&NotSquareSubsetEqual;", { 8930, 0 }, "\xe2\x8b\xa2", 3 },
+    { "&fopf;", { 120151, 0 }, "\xf0\x9d\x95\x97", 4 },
+    { "&aacute;", { 225, 0 }, "\xc3\xa1", 2 },
+    { "&boxminus;", { 8863, 0 }, "\xe2\x8a\x9f", 3 },
+    { "&vartriangleright;", { 8883, 0 }, "\xe2\x8a\xb3", 3 },
+    { "&elinters;", { 9191, 0 }, "\xe2\x8f\xa7", 3 },
+    { "&ldquor;", { 8222, 0 }, "\xe2\x80\x9e", 3 },
+    { "&rfisht;", { 10621, 0 }, "\xe2\xa5\xbd", 3 },
+    { "&bnequiv;", { 8801, 8421 }, "\xe2\x89\xa1\xe2\x83\xa5", 6 },
+    { "&nbumpe;", { 8783, 824 }, "\xe2\x89\x8f\xcc\xb8", 5 },
+    { "&nVdash;", { 8878, 0 }, "\xe2\x8a\xae", 3 },
+    { "&leftrightarrows;", { 8646, 0 }, "\xe2\x87\x86", 3 },
+    { "&urtri;", { 9721, 0 }, "\xe2\x97\xb9", 3 },
+    { "&Wopf;", { 120142, 0 }, "\xf0\x9d\x95\x8e", 4 },
+    { "&barwedge;", { 8965, 0 }, "\xe2\x8c\x85", 3 },
+    { "&gtcc;", { 10919, 0 }, "\xe2\xaa\xa7", 3 },
+    { "&LeftTriangle;", { 8882, 0 }, "\xe2\x8a\xb2", 3 },
+    { "&NotTildeFullEqual;", { 8775, 0 }, "\xe2\x89\x87", 3 },
+    { "&lotimes;", { 10804, 0 }, "\xe2\xa8\xb4", 3 },
+    { "&nexists;", { 8708, 0 }, "\xe2\x88\x84", 3 },
+    { "&disin;", { 8946, 0 }, "\xe2\x8b\xb2", 3 },
+    { "&nsupseteq;", { 8841, 0 }, "\xe2\x8a\x89", 3 },
+    { "&varsupsetneqq;", { 10956, 65024 }, "\xe2\xab\x8c\xef\xb8\x80", 6 },
+    { "&uwangle;", { 10663, 0 }, "\xe2\xa6\xa7", 3 },
+    { "&complement;", { 8705, 0 }, "\xe2\x88\x81", 3 },
+    { "&Cconint;", { 8752, 0 }, "\xe2\x88\xb0", 3 },
+    { "&boxhU;", { 9576, 0 }, "\xe2\x95\xa8", 3 },
+    { "&boxVh;", { 9579, 0 }, "\xe2\x95\xab", 3 },
+    { "&TildeFullEqual;", { 8773, 0 }, "\xe2\x89\x85", 3 },
+    { "&rmoust;", { 9137, 0 }, "\xe2\x8e\xb1", 3 },
+    { "&Zopf;", { 8484, 0 }, "\xe2\x84\xa4", 3 },
+    { "&ordm;", { 186, 0 }, "\xc2\xba", 2 },
+    { "&rdquor;", { 8221, 0 }, "\xe2\x80\x9d", 3 },
+    { "&maltese;", { 10016, 0 }, "\xe2\x9c\xa0", 3 },
+    { "&aleph;", { 8501, 0 }, "\xe2\x84\xb5", 3 },
+    { "&nLeftrightarrow;", { 8654, 0 }, "\xe2\x87\x8e", 3 },
+    { "&NotSucceedsTilde;", { 8831, 824 }, "\xe2\x89\xbf\xcc\xb8", 5 },
+    { "&qfr;", { 120110, 0 }, "\xf0\x9d\x94\xae", 4 },
+    { "&vsupne;", { 8843, 65024 }, "\xe2\x8a\x8b\xef\xb8\x80", 6 },
+    { "&longleftrightarrow;", { 10231, 0 }, "\xe2\x9f\xb7", 3 },
+    { "&dsol;", { 10742, 0 }, "\xe2\xa7\xb6", 3 },
+    { "&cwconint;", { 8754, 0 }, "\xe2\x88\xb2", 3 },
+    { "&timesd;", { 10800, 0 }, "\xe2\xa8\xb0", 3 },
+    { "&ogt;", { 10689, 0 }, "\xe2\xa7\x81", 3 },
+    { "&frasl;", { 8260, 0 }, "\xe2\x81\x84", 3 },
+    { "&gtreqless;", { 8923, 0 }, "\xe2\x8b\x9b", 3 },
+    { "&Scirc;", { 348, 0 }, "\xc5\x9c", 2 },
+    { "&rBarr;", { 10511, 0 }, "\xe2\xa4\x8f", 3 },
+    { "&nleq;", { 8816, 0 }, "\xe2\x89\xb0", 3 },
+    { "&primes;", { 8473, 0 }, "\xe2\x84\x99", 3 },
+    { "&Im;", { 8465, 0 }, "\xe2\x84\x91", 3 },
+    { "&boxdl;", { 9488, 0 }, "\xe2\x94\x90", 3 },
+    { "&filig;", { 64257, 0 }, "\xef\xac\x81", 3 },
+    { "&ord;", { 10845, 0 }, "\xe2\xa9\x9d", 3 },
+    { "&latail;", { 10521, 0 }, "\xe2\xa4\x99", 3 },
+    { "&Tab;", { 9, 0 }, "\x09", 1 },
+    { "&luruhar;", { 10598, 0 }, "\xe2\xa5\xa6", 3 },
+    { "&comma;", { 44, 0 }, "\x2c", 1 },
+    { "&curarr;", { 8631, 0 }, "\xe2\x86\xb7", 3 },
+    { "&lfloor;", { 8970, 0 }, "\xe2\x8c\x8a", 3 },
+    { "&LeftArrowRightArrow;", { 8646, 0 }, "\xe2\x87\x86", 3 },
+    { "&nlarr;", { 8602, 0 }, "\xe2\x86\x9a", 3 },
+    { "&NewLine;", { 10, 0 }, "\x0a", 1 },
+    { "&UpEquilibrium;", { 10606, 0 }, "\xe2\xa5\xae", 3 },
+    { "&UnionPlus;", { 8846, 0 }, "\xe2\x8a\x8e", 3 },
+    { "&scnsim;", { 8937, 0 }, "\xe2\x8b\xa9", 3 },
+    { "&gel;", { 8923, 0 }, "\xe2\x8b\x9b", 3 },
+    { "&shy;", { 173, 0 }, "\xc2\xad", 2 },
+    { "&Dagger;", { 8225, 0 }, "\xe2\x80\xa1", 3 },
+    { "&succsim;", { 8831, 0 }, "\xe2\x89\xbf", 3 },
+    { "&succnapprox;", { 10938, 0 }, "\xe2\xaa\xba", 3 },
+    { "&Itilde;", { 296, 0 }, "\xc4\xa8", 2 },
+    { "&ange;", { 10660, 0 }, "\xe2\xa6\xa4", 3 },
+    { "&Lstrok;", { 321, 0 }, "\xc5\x81", 2 },
+    { "&angmsdab;", { 10665, 0 }, "\xe2\xa6\xa9", 3 },
+    { "&profsurf;", { 8979, 0 }, "\xe2\x8c\x93", 3 },
+    { "&swarr;", { 8601, 0 }, "\xe2\x86\x99", 3 },
+    { "&Oscr;", { 119978, 0 }, "\xf0\x9d\x92\xaa", 4 },
+    { "&xcirc;", { 9711, 0 }, "\xe2\x97\xaf", 3 },
+    { "&rarr;", { 8594, 0 }, "\xe2\x86\x92", 3 },
+    { "&ominus;", { 8854, 0 }, "\xe2\x8a\x96", 3 },
+    { "&puncsp;", { 8200, 0 }, "\xe2\x80\x88", 3 },
+    { "&fjlig;", { 102, 106 }, "\x66\x6a", 2 },
+    { "&REG;", { 174, 0 }, "\xc2\xae", 2 },
+    { "&Gt;", { 8811, 0 }, "\xe2\x89\xab", 3 },
+    { "&circledS;", { 9416, 0 }, "\xe2\x93\x88", 3 },
+    { "&apacir;", { 10863, 0 }, "\xe2\xa9\xaf", 3 },
+    { "&forall;", { 8704, 0 }, "\xe2\x88\x80", 3 },
+    { "&leftrightharpoons;", { 8651, 0 }, "\xe2\x87\x8b", 3 },
+    { "&nvlt;", { 60, 8402 }, "\x3c\xe2\x83\x92", 4 },
+    { "&Ecaron;", { 282, 0 }, "\xc4\x9a", 2 },
+    { "&ddarr;", { 8650, 0 }, "\xe2\x87\x8a", 3 },
+    { "&cupcap;", { 10822, 0 }, "\xe2\xa9\x86", 3 },
+    { "&zfr;", { 120119, 0 }, "\xf0\x9d\x94\xb7", 4 },
+    { "&RightFloor;", { 8971, 0 }, "\xe2\x8c\x8b", 3 },
+    { "&boxHu;", { 9575, 0 }, "\xe2\x95\xa7", 3 },
+    { "&gtreqqless;", { 10892, 0 }, "\xe2\xaa\x8c", 3 },
+    { "&varnothing;", { 8709, 0 }, "\xe2\x88\x85", 3 },
+    { "&Edot;", { 278, 0 }, "\xc4\x96", 2 },
+    { "&emptyset;", { 8709, 0 }, "\xe2\x88\x85", 3 },
+    { "&gesl;", { 8923, 65024 }, "\xe2\x8b\x9b\xef\xb8\x80", 6 },
+    { "&realpart;", { 8476, 0 }, "\xe2\x84\x9c", 3 },
+    { "&OpenCurlyDoubleQuote;", { 8220, 0 }, "\xe2\x80\x9c", 3 },
+    { "&varsubsetneq;", { 8842, 65024 }, "\xe2\x8a\x8a\xef\xb8\x80", 6 },
+    { "&yicy;", { 1111, 0 }, "\xd1\x97", 2 },
+    { "&nvdash;", { 8876, 0 }, "\xe2\x8a\xac", 3 },
+    { "&ecirc;", { 234, 0 }, "\xc3\xaa", 2 },
+    { "&Copf;", { 8450, 0 }, "\xe2\x84\x82", 3 },
+    { "&edot;", { 279, 0 }, "\xc4\x97", 2 },
+    { "&boxdL;", { 9557, 0 }, "\xe2\x95\x95", 3 },
+    { "&Sc;", { 10940, 0 }, "\xe2\xaa\xbc", 3 },
+    { "&Backslash;", { 8726, 0 }, "\xe2\x88\x96", 3 },
+    { "&sime;", { 8771, 0 }, "\xe2\x89\x83", 3 },
+    { "&ExponentialE;", { 8519, 0 }, "\xe2\x85\x87", 3 },
+    { "&middot;", { 183, 0 }, "\xc2\xb7", 2 },
+    { "&frac35;", { 8535, 0 }, "\xe2\x85\x97", 3 },
+    { "&curlyeqsucc;", { 8927, 0 }, "\xe2\x8b\x9f", 3 },
+    { "&simplus;", { 10788, 0 }, "\xe2\xa8\xa4", 3 },
+    { "&NegativeThinSpace;", { 8203, 0 }, "\xe2\x80\x8b", 3 },
+    { "&eqcolon;", { 8789, 0 }, "\xe2\x89\x95", 3 },
+    { "&nleqq;", { 8806, 824 }, "\xe2\x89\xa6\xcc\xb8", 5 },
+    { "&Ifr;", { 8465, 0 }, "\xe2\x84\x91", 3 },
+    { "&lpar;", { 40, 0 }, "\x28", 1 },
+    { "&ordf;", { 170, 0 }, "\xc2\xaa", 2 },
+    { "&LongRightArrow;", { 10230, 0 }, "\xe2\x9f\xb6", 3 },
+    { "&LeftDoubleBracket;", { 10214, 0 }, "\xe2\x9f\xa6", 3 },
+    { "&NotSupersetEqual;", { 8841, 0 }, "\xe2\x8a\x89", 3 },
+    { "&oast;", { 8859, 0 }, "\xe2\x8a\x9b", 3 },
+    { "&trie;", { 8796, 0 }, "\xe2\x89\x9c", 3 },
+    { "&ClockwiseContourIntegral;", { 8754, 0 }, "\xe2\x88\xb2", 3 },
+    { "&DownTeeArrow;", { 8615, 0 }, "\xe2\x86\xa7", 3 },
+    { "&VerticalBar;", { 8739, 0 }, "\xe2\x88\xa3", 3 },
+    { "&lcedil;", { 316, 0 }, "\xc4\xbc", 2 },
+    { "&late;", { 10925, 0 }, "\xe2\xaa\xad", 3 },
+    { "&LeftFloor;", { 8970, 0 }, "\xe2\x8c\x8a", 3 },
+    { "&RightTriangleBar;", { 10704, 0 }, "\xe2\xa7\x90", 3 },
+    { "&dzigrarr;", { 10239, 0 }, "\xe2\x9f\xbf", 3 },
+    { "&profalar;", { 9006, 0 }, "\xe2\x8c\xae", 3 },
+    { "&LeftTeeArrow;", { 8612, 0 }, "\xe2\x86\xa4", 3 },
+    { "&fflig;", { 64256, 0 }, "\xef\xac\x80", 3 },
+    { "&looparrowleft;", { 8619, 0 }, "\xe2\x86\xab", 3 },
+    { "&nvrArr;", { 10499, 0 }, "\xe2\xa4\x83", 3 },
+    { "&lcaron;", { 318, 0 }, "\xc4\xbe", 2 },
+    { "&boxUl;", { 9564, 0 }, "\xe2\x95\x9c", 3 },
+    { "&ulcorner;", { 8988, 0 }, "\xe2\x8c\x9c", 3 },
+    { "&jcirc;", { 309, 0 }, "\xc4\xb5", 2 },
+    { "&Iuml;", { 207, 0 }, "\xc3\x8f", 2 },
+    { "&angrtvbd;", { 10653, 0 }, "\xe2\xa6\x9d", 3 },
+    { "&GreaterSlantEqual;", { 10878, 0 }, "\xe2\xa9\xbe", 3 },
+    { "&gap;", { 10886, 0 }, "\xe2\xaa\x86", 3 },
+    { "&gneqq;", { 8809, 0 }, "\xe2\x89\xa9", 3 },
+    { "&parsl;", { 11005, 0 }, "\xe2\xab\xbd", 3 },
+    { "&searhk;", { 10533, 0 }, "\xe2\xa4\xa5", 3 },
+    { "&rcedil;", { 343, 0 }, "\xc5\x97", 2 },
+    { "&lescc;", { 10920, 0 }, "\xe2\xaa\xa8", 3 },
+    { "&nsupE;", { 10950, 824 }, "\xe2\xab\x86\xcc\xb8", 5 },
+    { "&Prime;", { 8243, 0 }, "\xe2\x80\xb3", 3 },
+    { "&ratio;", { 8758, 0 }, "\xe2\x88\xb6", 3 },
+    { "&sdote;", { 10854, 0 }, "\xe2\xa9\xa6", 3 },
+    { "&Mfr;", { 120080, 0 }, "\xf0\x9d\x94\x90", 4 },
+    { "&Breve;", { 728, 0 }, "\xcb\x98", 2 },
+    { "&theta;", { 952, 0 }, "\xce\xb8", 2 },
+    { "&Rightarrow;", { 8658, 0 }, "\xe2\x87\x92", 3 },
+    { "&iiota;", { 8489, 0 }, "\xe2\x84\xa9", 3 },
+    { "&jcy;", { 1081, 0 }, "\xd0\xb9", 2 },
+    { "&Mcy;", { 1052, 0 }, "\xd0\x9c", 2 },
+    { "&LessFullEqual;", { 8806, 0 }, "\xe2\x89\xa6", 3 },
+    { "&ddagger;", { 8225, 0 }, "\xe2\x80\xa1", 3 },
+    { "&cirE;", { 10691, 0 }, "\xe2\xa7\x83", 3 },
+    { "&drcorn;", { 8991, 0 }, "\xe2\x8c\x9f", 3 },
+    { "&ltquest;", { 10875, 0 }, "\xe2\xa9\xbb", 3 },
+    { "&gneq;", { 10888, 0 }, "\xe2\xaa\x88", 3 },
+    { "&jfr;", { 120103, 0 }, "\xf0\x9d\x94\xa7", 4 },
+    { "&esim;", { 8770, 0 }, "\xe2\x89\x82", 3 },
+    { "&varrho;", { 1009, 0 }, "\xcf\xb1", 2 },
+    { "&cupor;", { 10821, 0 }, "\xe2\xa9\x85", 3 },
+    { "&cwint;", { 8753, 0 }, "\xe2\x88\xb1", 3 },
+    { "&eacute;", { 233, 0 }, "\xc3\xa9", 2 },
+    { "&notni;", { 8716, 0 }, "\xe2\x88\x8c", 3 },
+    { "&boxh;", { 9472, 0 }, "\xe2\x94\x80", 3 },
+    { "&lfr;", { 120105, 0 }, "\xf0\x9d\x94\xa9", 4 },
+    { "&sup;", { 8835, 0 }, "\xe2\x8a\x83", 3 },
+    { "&Gbreve;", { 286, 0 }, "\xc4\x9e", 2 },
+    { "&subseteq;", { 8838, 0 }, "\xe2\x8a\x86", 3 },
+    { "&Icirc;", { 206, 0 }, "\xc3\x8e", 2 },
+    { "&sc;", { 8827, 0 }, "\xe2\x89\xbb", 3 },
+    { "&lessapprox;", { 10885, 0 }, "\xe2\xaa\x85", 3 },
+    { "&atilde;", { 227, 0 }, "\xc3\xa3", 2 },
+    { "&orarr;", { 8635, 0 }, "\xe2\x86\xbb", 3 },
+    { "&bsol;", { 92, 0 }, "\x5c", 1 },
+    { "&els;", { 10901, 0 }, "\xe2\xaa\x95", 3 },
+    { "&ouml;", { 246, 0 }, "\xc3\xb6", 2 },
+    { "&Egrave;", { 200, 0 }, "\xc3\x88", 2 },
+    { "&cuwed;", { 8911, 0 }, "\xe2\x8b\x8f", 3 },
+    { "&timesb;", { 8864, 0 }, "\xe2\x8a\xa0", 3 },
+    { "&caron;", { 711, 0 }, "\xcb\x87", 2 },
+    { "&circlearrowright;", { 8635, 0 }, "\xe2\x86\xbb", 3 },
+    { "&rightthreetimes;", { 8908, 0 }, "\xe2\x8b\x8c", 3 },
+    { "&LessEqualGreater;", { 8922, 0 }, "\xe2\x8b\x9a", 3 },
+    { "&rdldhar;", { 10601, 0 }, "\xe2\xa5\xa9", 3 },
+    { "&tstrok;", { 359, 0 }, "\xc5\xa7", 2 },
+    { "&RightArrow;", { 8594, 0 }, "\xe2\x86\x92", 3 },
+    { "&zopf;", { 120171, 0 }, "\xf0\x9d\x95\xab", 4 },
+    { "&awint;", { 10769, 0 }, "\xe2\xa8\x91", 3 },
+    { "&ReverseElement;", { 8715, 0 }, "\xe2\x88\x8b", 3 },
+    { "&DownRightVectorBar;", { 10583, 0 }, "\xe2\xa5\x97", 3 },
+    { "&lsquor;", { 8218, 0 }, "\xe2\x80\x9a", 3 },
+    { "&nparsl;", { 11005, 8421 }, "\xe2\xab\xbd\xe2\x83\xa5", 6 },
+    { "&hbar;", { 8463, 0 }, "\xe2\x84\x8f", 3 },
+    { "&ubrcy;", { 1118, 0 }, "\xd1\x9e", 2 },
+    { "&supsub;", { 10964, 0 }, "\xe2\xab\x94", 3 },
+    { "&nvap;", { 8781, 8402 }, "\xe2\x89\x8d\xe2\x83\x92", 6 },
+    { "&star;", { 9734, 0 }, "\xe2\x98\x86", 3 },
+    { "&efDot;", { 8786, 0 }, "\xe2\x89\x92", 3 },
+    { "&mopf;", { 120158, 0 }, "\xf0\x9d\x95\x9e", 4 },
+    { "&iiint;", { 8749, 0 }, "\xe2\x88\xad", 3 },
+    { "&block;", { 9608, 0 }, "\xe2\x96\x88", 3 },
+    { "&ngeqslant;", { 10878, 824 }, "\xe2\xa9\xbe\xcc\xb8", 5 },
+    { "&Tstrok;", { 358, 0 }, "\xc5\xa6", 2 },
+    { "&dlcorn;", { 8990, 0 }, "\xe2\x8c\x9e", 3 },
+    { "&divonx;", { 8903, 0 }, "\xe2\x8b\x87", 3 },
+    { "&ffllig;", { 64260, 0 }, "\xef\xac\x84", 3 },
+    { "&boxuR;", { 9560, 0 }, "\xe2\x95\x98", 3 },
+    { "&KJcy;", { 1036, 0 }, "\xd0\x8c", 2 },
+    { "&sscr;", { 120008, 0 }, "\xf0\x9d\x93\x88", 4 },
+    { "&Utilde;", { 360, 0 }, "\xc5\xa8", 2 },
+    { "&ddotseq;", { 10871, 0 }, "\xe2\xa9\xb7", 3 },
+    { "&Barv;", { 10983, 0 }, "\xe2\xab\xa7", 3 },
+    { "&dtri;", { 9663, 0 }, "\xe2\x96\xbf", 3 },
+    { "&Vscr;", { 119985, 0 }, "\xf0\x9d\x92\xb1", 4 },
+    { "&Zcaron;", { 381, 0 }, "\xc5\xbd", 2 },
+    { "&PrecedesTilde;", { 8830, 0 }, "\xe2\x89\xbe", 3 },
+    { "&nsubE;", { 10949, 824 }, "\xe2\xab\x85\xcc\xb8", 5 },
+    { "&gt;", { 62, 0 }, "\x3e", 1 },
+    { "&dcy;", { 1076, 0 }, "\xd0\xb4", 2 },
+    { "&iscr;", { 119998, 0 }, "\xf0\x9d\x92\xbe", 4 },
+    { "&rbrkslu;", { 10640, 0 }, "\xe2\xa6\x90", 3 },
+    { "&smeparsl;", { 10724, 0 }, "\xe2\xa7\xa4", 3 },
+    { "&acd;", { 8767, 0 }, "\xe2\x88\xbf", 3 },
+    { "&boxtimes;", { 8864, 0 }, "\xe2\x8a\xa0", 3 },
+    { "&urcrop;", { 8974, 0 }, "\xe2\x8c\x8e", 3 },
+    { "&Hstrok;", { 294, 0 }, "\xc4\xa6", 2 },
+    { "&Dstrok;", { 272, 0 }, "\xc4\x90", 2 },
+    { "&lparlt;", { 10643, 0 }, "\xe2\xa6\x93", 3 },
+    { "&RightVectorBar;", { 10579, 0 }, "\xe2\xa5\x93", 3 },
+    { "&SquareSubset;", { 8847, 0 }, "\xe2\x8a\x8f", 3 },
+    { "&scaron;", { 353, 0 }, "\xc5\xa1", 2 },
+    { "&nless;", { 8814, 0 }, "\xe2\x89\xae", 3 },
+    { "&wp;", { 8472, 0 }, "\xe2\x84\x98", 3 },
+    { "&Umacr;", { 362, 0 }, "\xc5\xaa", 2 },
+    { "&boxVH;", { 9580, 0 }, "\xe2\x95\xac", 3 },
+    { "&Lcedil;", { 315, 0 }, "\xc4\xbb", 2 },
+    { "&isinsv;", { 8947, 0 }, "\xe2\x8b\xb3", 3 },
+    { "&swnwar;", { 10538, 0 }, "\xe2\xa4\xaa", 3 },
+    { "&cirscir;", { 10690, 0 }, "\xe2\xa7\x82", 3 },
+    { "&DScy;", { 1029, 0 }, "\xd0\x85", 2 },
+    { "&geqq;", { 8807, 0 }, "\xe2\x89\xa7", 3 },
+    { "&supset;", { 8835, 0 }, "\xe2\x8a\x83", 3 },
+    { "&OElig;", { 338, 0 }, "\xc5\x92", 2 },
+    { "&bottom;", { 8869, 0 }, "\xe2\x8a\xa5", 3 },
+    { "&Exists;", { 8707, 0 }, "\xe2\x88\x83", 3 },
+    { "&Sopf;", { 120138, 0 }, "\xf0\x9d\x95\x8a", 4 },
+    { "&Bopf;", { 120121, 0 }, "\xf0\x9d\x94\xb9", 4 },
+    { "&scirc;", { 349, 0 }, "\xc5\x9d", 2 },
+    { "&roarr;", { 8702, 0 }, "\xe2\x87\xbe", 3 },
+    { "&divide;", { 247, 0 }, "\xc3\xb7", 2 },
+    { "&in;", { 8712, 0 }, "\xe2\x88\x88", 3 },
+    { "&image;", { 8465, 0 }, "\xe2\x84\x91", 3 },
+    { "&ldca;", { 10550, 0 }, "\xe2\xa4\xb6", 3 },
+    { "&Longrightarrow;", { 10233, 0 }, "\xe2\x9f\xb9", 3 },
+    { "&leftharpoonup;", { 8636, 0 }, "\xe2\x86\xbc", 3 },
+    { "&NotGreaterTilde;", { 8821, 0 }, "\xe2\x89\xb5", 3 },
+    { "&cfr;", { 120096, 0 }, "\xf0\x9d\x94\xa0", 4 },
+    { "&larr;", { 8592, 0 }, "\xe2\x86\x90", 3 },
+    { "&gimel;", { 8503, 0 }, "\xe2\x84\xb7", 3 },
+    { "&Hfr;", { 8460, 0 }, "\xe2\x84\x8c", 3 },
+    { "&nRightarrow;", { 8655, 0 }, "\xe2\x87\x8f", 3 },
+    { "&Eta;", { 919, 0 }, "\xce\x97", 2 },
+    { "&rsaquo;", { 8250, 0 }, "\xe2\x80\xba", 3 },
+    { "&laemptyv;", { 10676, 0 }, "\xe2\xa6\xb4", 3 },
+    { "&EqualTilde;", { 8770, 0 }, "\xe2\x89\x82", 3 },
+    { "&DoubleLeftRightArrow;", { 8660, 0 }, "\xe2\x87\x94", 3 },
+    { "&lozf;", { 10731, 0 }, "\xe2\xa7\xab", 3 },
+    { "&acy;", { 1072, 0 }, "\xd0\xb0", 2 },
+    { "&there4;", { 8756, 0 }, "\xe2\x88\xb4", 3 },
+    { "&prnsim;", { 8936, 0 }, "\xe2\x8b\xa8", 3 },
+    { "&Lopf;", { 120131, 0 }, "\xf0\x9d\x95\x83", 4 },
+    { "&amalg;", { 10815, 0 }, "\xe2\xa8\xbf", 3 },
+    { "&breve;", { 728, 0 }, "\xcb\x98", 2 },
+    { "&expectation;", { 8496, 0 }, "\xe2\x84\xb0", 3 },
+    { "&roang;", { 10221, 0 }, "\xe2\x9f\xad", 3 },
+    { "&conint;", { 8750, 0 }, "\xe2\x88\xae", 3 },
+    { "&ltri;", { 9667, 0 }, "\xe2\x97\x83", 3 },
+    { "&vdash;", { 8866, 0 }, "\xe2\x8a\xa2", 3 },
+    { "&iinfin;", { 10716, 0 }, "\xe2\xa7\x9c", 3 },
+    { "&epar;", { 8917, 0 }, "\xe2\x8b\x95", 3 },
+    { "&hstrok;", { 295, 0 }, "\xc4\xa7", 2 },
+    { "&prec;", { 8826, 0 }, "\xe2\x89\xba", 3 },
+    { "&tscr;", { 120009, 0 }, "\xf0\x9d\x93\x89", 4 },
+    { "&nsup;", { 8837, 0 }, "\xe2\x8a\x85", 3 },
+    { "&RightTeeArrow;", { 8614, 0 }, "\xe2\x86\xa6", 3 },
+    { "&PlusMinus;", { 177, 0 }, "\xc2\xb1", 2 },
+    { "&DownBreve;", { 785, 0 }, "\xcc\x91", 2 },
+    { "&zcy;", { 1079, 0 }, "\xd0\xb7", 2 },
+    { "&hoarr;", { 8703, 0 }, "\xe2\x87\xbf", 3 },
+    { "&bigtriangledown;", { 9661, 0 }, "\xe2\x96\xbd", 3 },
+    { "&Gopf;", { 120126, 0 }, "\xf0\x9d\x94\xbe", 4 },
+    { "&NJcy;", { 1034, 0 }, "\xd0\x8a", 2 },
+    { "&DoubleLongLeftArrow;", { 10232, 0 }, "\xe2\x9f\xb8", 3 },
+    { "&frac15;", { 8533, 0 }, "\xe2\x85\x95", 3 },
+    { "&NonBreakingSpace;", { 160, 0 }, "\xc2\xa0", 2 },
+    { "&DJcy;", { 1026, 0 }, "\xd0\x82", 2 },
+    { "&cong;", { 8773, 0 }, "\xe2\x89\x85", 3 },
+    { "&yscr;", { 120014, 0 }, "\xf0\x9d\x93\x8e", 4 },
+    { "&nu;", { 957, 0 }, "\xce\xbd", 2 },
+    { "&nsubseteqq;", { 10949, 824 }, "\xe2\xab\x85\xcc\xb8", 5 },
+    { "&boxHD;", { 9574, 0 }, "\xe2\x95\xa6", 3 },
+    { "&caret;", { 8257, 0 }, "\xe2\x81\x81", 3 },
+    { "&fscr;", { 119995, 0 }, "\xf0\x9d\x92\xbb", 4 },
+    { "&Vbar;", { 10987, 0 }, "\xe2\xab\xab", 3 },
+    { "&NotVerticalBar;", { 8740, 0 }, "\xe2\x88\xa4", 3 },
+    { "&circledR;", { 174, 0 }, "\xc2\xae", 2 },
+    { "&HARDcy;", { 1066, 0 }, "\xd0\xaa", 2 },
+    { "&LeftTriangleBar;", { 10703, 0 }, "\xe2\xa7\x8f", 3 },
+    { "&itilde;", { 297, 0 }, "\xc4\xa9", 2 },
+    { "&part;", { 8706, 0 }, "\xe2\x88\x82", 3 },
+    { "&subsim;", { 10951, 0 }, "\xe2\xab\x87", 3 },
+    { "&subsetneqq;", { 10955, 0 }, "\xe2\xab\x8b", 3 },
+    { "&Tcedil;", { 354, 0 }, "\xc5\xa2", 2 },
+    { "&smile;", { 8995, 0 }, "\xe2\x8c\xa3", 3 },
+    { "&frac13;", { 8531, 0 }, "\xe2\x85\x93", 3 },
+    { "&NotNestedGreaterGreater;", { 10914, 824 }, "\xe2\xaa\xa2\xcc\xb8", 5 },
+    { "&hArr;", { 8660, 0 }, "\xe2\x87\x94", 3 },
+    { "&xcup;", { 8899, 0 }, "\xe2\x8b\x83", 3 },
+    { "&downdownarrows;", { 8650, 0 }, "\xe2\x87\x8a", 3 },
+    { "&RightUpVectorBar;", { 10580, 0 }, "\xe2\xa5\x94", 3 },
+    { "&asympeq;", { 8781, 0 }, "\xe2\x89\x8d", 3 },
+    { "&curren;", { 164, 0 }, "\xc2\xa4", 2 },
+    { "&Cscr;", { 119966, 0 }, "\xf0\x9d\x92\x9e", 4 },
+    { "&xutri;", { 9651, 0 }, "\xe2\x96\xb3", 3 },
+    { "&lthree;", { 8907, 0 }, "\xe2\x8b\x8b", 3 },
+    { "&tcy;", { 1090, 0 }, "\xd1\x82", 2 },
+    { "&NotCongruent;", { 8802, 0 }, "\xe2\x89\xa2", 3 },
+    { "&fnof;", { 402, 0 }, "\xc6\x92", 2 },
+    { "&gtrless;", { 8823, 0 }, "\xe2\x89\xb7", 3 },
+    { "&CloseCurlyDoubleQuote;", { 8221, 0 }, "\xe2\x80\x9d", 3 },
+    { "&rdquo;", { 8221, 0 }, "\xe2\x80\x9d", 3 },
+    { "&Rsh;", { 8625, 0 }, "\xe2\x86\xb1", 3 },
+    { "&circlearrowleft;", { 8634, 0 }, "\xe2\x86\xba", 3 },
+    { "&macr;", { 175, 0 }, "\xc2\xaf", 2 },
+    { "&DownArrow;", { 8595, 0 }, "\xe2\x86\x93", 3 },
+    { "&gl;", { 8823, 0 }, "\xe2\x89\xb7", 3 },
+    { "&Nscr;", { 119977, 0 }, "\xf0\x9d\x92\xa9", 4 },
+    { "&Lfr;", { 120079, 0 }, "\xf0\x9d\x94\x8f", 4 },
+    { "&utrif;", { 9652, 0 }, "\xe2\x96\xb4", 3 },
+    { "&mdash;", { 8212, 0 }, "\xe2\x80\x94", 3 },
+    { "&xdtri;", { 9661, 0 }, "\xe2\x96\xbd", 3 },
+    { "&NotGreaterSlantEqual;", { 10878, 824 }, "\xe2\xa9\xbe\xcc\xb8", 5 },
+    { "&lsime;", { 10893, 0 }, "\xe2\xaa\x8d", 3 },
+    { "&Cacute;", { 262, 0 }, "\xc4\x86", 2 },
+    { "&bigodot;", { 10752, 0 }, "\xe2\xa8\x80", 3 },
+    { "&LongLeftArrow;", { 10229, 0 }, "\xe2\x9f\xb5", 3 },
+    { "&supseteqq;", { 10950, 0 }, "\xe2\xab\x86", 3 },
+    { "&vnsup;", { 8835, 8402 }, "\xe2\x8a\x83\xe2\x83\x92", 6 },
+    { "&rangle;", { 10217, 0 }, "\xe2\x9f\xa9", 3 },
+    { "&downharpoonleft;", { 8643, 0 }, "\xe2\x87\x83", 3 },
+    { "&mapstoup;", { 8613, 0 }, "\xe2\x86\xa5", 3 },
+    { "&angmsdae;", { 10668, 0 }, "\xe2\xa6\xac", 3 },
+    { "&DownArrowBar;", { 10515, 0 }, "\xe2\xa4\x93", 3 },
+    { "&gfr;", { 120100, 0 }, "\xf0\x9d\x94\xa4", 4 },
+    { "&Darr;", { 8609, 0 }, "\xe2\x86\xa1", 3 },
+    { "&operp;", { 10681, 0 }, "\xe2\xa6\xb9", 3 },
+    { "&RuleDelayed;", { 10740, 0 }, "\xe2\xa7\xb4", 3 },
+    { "&Lambda;", { 923, 0 }, "\xce\x9b", 2 },
+    { "&setminus;", { 8726, 0 }, "\xe2\x88\x96", 3 },
+    { "&af;", { 8289, 0 }, "\xe2\x81\xa1", 3 },
+    { "&SquareSubsetEqual;", { 8849, 0 }, "\xe2\x8a\x91", 3 },
+    { "&trade;", { 8482, 0 }, "\xe2\x84\xa2", 3 },
+    { "&eth;", { 240, 0 }, "\xc3\xb0", 2 },
+    { "&rArr;", { 8658, 0 }, "\xe2\x87\x92", 3 },
+    { "&Cedilla;", { 184, 0 }, "\xc2\xb8", 2 },
+    { "&eopf;", { 120150, 0 }, "\xf0\x9d\x95\x96", 4 },
+    { "&or;", { 8744, 0 }, "\xe2\x88\xa8", 3 },
+    { "&rarrbfs;", { 10528, 0 }, "\xe2\xa4\xa0", 3 },
+    { "&notinvb;", { 8951, 0 }, "\xe2\x8b\xb7", 3 },
+    { "&blk34;", { 9619, 0 }, "\xe2\x96\x93", 3 },
+    { "&lesdot;", { 10879, 0 }, "\xe2\xa9\xbf", 3 },
+    { "&SquareIntersection;", { 8851, 0 }, "\xe2\x8a\x93", 3 },
+    { "&TripleDot;", { 8411, 0 }, "\xe2\x83\x9b", 3 },
+    { "&lesdotor;", { 10883, 0 }, "\xe2\xaa\x83", 3 },
+    { "&blacktriangledown;", { 9662, 0 }, "\xe2\x96\xbe", 3 },
+    { "&varkappa;", { 1008, 0 }, "\xcf\xb0", 2 },
+    { "&Kopf;", { 120130, 0 }, "\xf0\x9d\x95\x82", 4 },
+    { "&acirc;", { 226, 0 }, "\xc3\xa2", 2 },
+    { "&ltcir;", { 10873, 0 }, "\xe2\xa9\xb9", 3 },
+    { "&Omicron;", { 927, 0 }, "\xce\x9f", 2 },
+    { "&alefsym;", { 8501, 0 }, "\xe2\x84\xb5", 3 },
+    { "&apid;", { 8779, 0 }, "\xe2\x89\x8b", 3 },
+    { "&bsemi;", { 8271, 0 }, "\xe2\x81\x8f", 3 },
+    { "&QUOT;", { 34, 0 }, "\x22", 1 },
+    { "&ycy;", { 1099, 0 }, "\xd1\x8b", 2 },
+    { "&tshcy;", { 1115, 0 }, "\xd1\x9b", 2 },
+    { "&nvrtrie;", { 8885, 8402 }, "\xe2\x8a\xb5\xe2\x83\x92", 6 },
+    { "&nap;", { 8777, 0 }, "\xe2\x89\x89", 3 },
+    { "&rAarr;", { 8667, 0 }, "\xe2\x87\x9b", 3 },
+    { "&lozenge;", { 9674, 0 }, "\xe2\x97\x8a", 3 },
+    { "&MinusPlus;", { 8723, 0 }, "\xe2\x88\x93", 3 },
+    { "&NoBreak;", { 8288, 0 }, "\xe2\x81\xa0", 3 },
+    { "&imacr;", { 299, 0 }, "\xc4\xab", 2 },
+    { "&vfr;", { 120115, 0 }, "\xf0\x9d\x94\xb3", 4 },
+    { "&ulcorn;", { 8988, 0 }, "\xe2\x8c\x9c", 3 },
+    { "&kcy;", { 1082, 0 }, "\xd0\xba", 2 },
+    { "&ohm;", { 937, 0 }, "\xce\xa9", 2 },
+    { "&UnderBracket;", { 9141, 0 }, "\xe2\x8e\xb5", 3 },
+    { "&Wfr;", { 120090, 0 }, "\xf0\x9d\x94\x9a", 4 },
+    { "&dollar;", { 36, 0 }, "\x24", 1 },
+    { "&curvearrowleft;", { 8630, 0 }, "\xe2\x86\xb6", 3 },
+    { "&TRADE;", { 8482, 0 }, "\xe2\x84\xa2", 3 },
+    { "&rdsh;", { 8627, 0 }, "\xe2\x86\xb3", 3 },
+    { "&duarr;", { 8693, 0 }, "\xe2\x87\xb5", 3 },
+    { "&commat;", { 64, 0 }, "\x40", 1 },
+    { "&bsim;", { 8765, 0 }, "\xe2\x88\xbd", 3 },
+    { "&CupCap;", { 8781, 0 }, "\xe2\x89\x8d", 3 },
+    { "&uHar;", { 10595, 0 }, "\xe2\xa5\xa3", 3 },
+    { "&twixt;", { 8812, 0 }, "\xe2\x89\xac", 3 },
+    { "&Uarr;", { 8607, 0 }, "\xe2\x86\x9f", 3 },
+    { "&ContourIntegral;", { 8750, 0 }, "\xe2\x88\xae", 3 },
+    { "&Pscr;", { 119979, 0 }, "\xf0\x9d\x92\xab", 4 },
+    { "&Sacute;", { 346, 0 }, "\xc5\x9a", 2 },
+    { "&auml;", { 228, 0 }, "\xc3\xa4", 2 },
+    { "&VerticalTilde;", { 8768, 0 }, "\xe2\x89\x80", 3 },
+    { "&ensp;", { 8194, 0 }, "\xe2\x80\x82", 3 },
+    { "&Bernoullis;", { 8492, 0 }, "\xe2\x84\xac", 3 },
+    { "&quatint;", { 10774, 0 }, "\xe2\xa8\x96", 3 },
+    { "&boxbox;", { 10697, 0 }, "\xe2\xa7\x89", 3 },
+    { "&uacute;", { 250, 0 }, "\xc3\xba", 2 },
+    { "&between;", { 8812, 0 }, "\xe2\x89\xac", 3 },
+    { "&NegativeVeryThinSpace;", { 8203, 0 }, "\xe2\x80\x8b", 3 },
+    { "&thickapprox;", { 8776, 0 }, "\xe2\x89\x88", 3 },
+    { "&uuarr;", { 8648, 0 }, "\xe2\x87\x88", 3 },
+    { "&NestedLessLess;", { 8810, 0 }, "\xe2\x89\xaa", 3 },
+    { "&iogon;", { 303, 0 }, "\xc4\xaf", 2 },
+    { "&sqsub;", { 8847, 0 }, "\xe2\x8a\x8f", 3 },
+    { "&icirc;", { 238, 0 }, "\xc3\xae", 2 },
+    { "&hairsp;", { 8202, 0 }, "\xe2\x80\x8a", 3 },
+    { "&lne;", { 10887, 0 }, "\xe2\xaa\x87", 3 },
+    { "&scnE;", { 10934, 0 }, "\xe2\xaa\xb6", 3 },
+    { "&tint;", { 8749, 0 }, "\xe2\x88\xad", 3 },
+    { "&nvinfin;", { 10718, 0 }, "\xe2\xa7\x9e", 3 },
+    { "&lvertneqq;", { 8808, 65024 }, "\xe2\x89\xa8\xef\xb8\x80", 6 },
+    { "&target;", { 8982, 0 }, "\xe2\x8c\x96", 3 },
+    { "&forkv;", { 10969, 0 }, "\xe2\xab\x99", 3 },
+    { "&quaternions;", { 8461, 0 }, "\xe2\x84\x8d", 3 },
+    { "&ncap;", { 10819, 0 }, "\xe2\xa9\x83", 3 },
+    { "&DoubleUpArrow;", { 8657, 0 }, "\xe2\x87\x91", 3 },
+    { "&RightUpDownVector;", { 10575, 0 }, "\xe2\xa5\x8f", 3 },
+    { "&Xscr;", { 119987, 0 }, "\xf0\x9d\x92\xb3", 4 },
+    { "&crarr;", { 8629, 0 }, "\xe2\x86\xb5", 3 },
+    { "&seswar;", { 10537, 0 }, "\xe2\xa4\xa9", 3 },
+    { "&Longleftarrow;", { 10232, 0 }, "\xe2\x9f\xb8", 3 },
+    { "&nsucceq;", { 10928, 824 }, "\xe2\xaa\xb0\xcc\xb8", 5 },
+    { "&lAtail;", { 10523, 0 }, "\xe2\xa4\x9b", 3 },
+    { "&lrcorner;", { 8991, 0 }, "\xe2\x8c\x9f", 3 },
+    { "&LowerRightArrow;", { 8600, 0 }, "\xe2\x86\x98", 3 },
+    { "&Dfr;", { 120071, 0 }, "\xf0\x9d\x94\x87", 4 },
+    { "&frac56;", { 8538, 0 }, "\xe2\x85\x9a", 3 },
+    { "&boxDr;", { 9555, 0 }, "\xe2\x95\x93", 3 },
+    { "&vltri;", { 8882, 0 }, "\xe2\x8a\xb2", 3 },
+    { "&top;", { 8868, 0 }, "\xe2\x8a\xa4", 3 },
+    { "&rarrpl;", { 10565, 0 }, "\xe2\xa5\x85", 3 },
+    { "&nwarrow;", { 8598, 0 }, "\xe2\x86\x96", 3 },
+    { "&Phi;", { 934, 0 }, "\xce\xa6", 2 },
+    { "&nlArr;", { 8653, 0 }, "\xe2\x87\x8d", 3 },
+    { "&njcy;", { 1114, 0 }, "\xd1\x9a", 2 },
+    { "&rarrap;", { 10613, 0 }, "\xe2\xa5\xb5", 3 },
+    { "&DoubleLeftTee;", { 10980, 0 }, "\xe2\xab\xa4", 3 },
+    { "&squ;", { 9633, 0 }, "\xe2\x96\xa1", 3 },
+    { "&wfr;", { 120116, 0 }, "\xf0\x9d\x94\xb4", 4 },
+    { "&iacute;", { 237, 0 }, "\xc3\xad", 2 },
+    { "&nrArr;", { 8655, 0 }, "\xe2\x87\x8f", 3 },
+    { "&lHar;", { 10594, 0 }, "\xe2\xa5\xa2", 3 },
+    { "&urcorner;", { 8989, 0 }, "\xe2\x8c\x9d", 3 },
+    { "&UnderParenthesis;", { 9181, 0 }, "\xe2\x8f\x9d", 3 },
+    { "&uring;", { 367, 0 }, "\xc5\xaf", 2 },
+    { "&ltrPar;", { 10646, 0 }, "\xe2\xa6\x96", 3 },
+    { "&Vdash;", { 8873, 0 }, "\xe2\x8a\xa9", 3 },
+    { "&bopf;", { 120147, 0 }, "\xf0\x9d\x95\x93", 4 },
+    { "&propto;", { 8733, 0 }, "\xe2\x88\x9d", 3 },
+    { "&Fscr;", { 8497, 0 }, "\xe2\x84\xb1", 3 },
+    { "&thetasym;", { 977, 0 }, "\xcf\x91", 2 },
+    { "&lrhard;", { 10605, 0 }, "\xe2\xa5\xad", 3 },
+    { "&Mopf;", { 120132, 0 }, "\xf0\x9d\x95\x84", 4 },
+    { "&Ccirc;", { 264, 0 }, "\xc4\x88", 2 },
+    { "&nparallel;", { 8742, 0 }, "\xe2\x88\xa6", 3 },
+    { "&nwArr;", { 8662, 0 }, "\xe2\x87\x96", 3 },
+    { "&wr;", { 8768, 0 }, "\xe2\x89\x80", 3 },
+    { "&psi;", { 968, 0 }, "\xcf\x88", 2 },
+    { "&HumpEqual;", { 8783, 0 }, "\xe2\x89\x8f", 3 },
+    { "&Esim;", { 10867, 0 }, "\xe2\xa9\xb3", 3 },
+    { "&longleftarrow;", { 10229, 0 }, "\xe2\x9f\xb5", 3 },
+    { "&bumpeq;", { 8783, 0 }, "\xe2\x89\x8f", 3 },
+    { "&lrhar;", { 8651, 0 }, "\xe2\x87\x8b", 3 },
+    { "&RoundImplies;", { 10608, 0 }, "\xe2\xa5\xb0", 3 },
+    { "&harrcir;", { 10568, 0 }, "\xe2\xa5\x88", 3 },
+    { "&GreaterGreater;", { 10914, 0 }, "\xe2\xaa\xa2", 3 },
+    { "&larrtl;", { 8610, 0 }, "\xe2\x86\xa2", 3 },
+    { "&tscy;", { 1094, 0 }, "\xd1\x86", 2 },
+    { "&nshortparallel;", { 8742, 0 }, "\xe2\x88\xa6", 3 },
+    { "&NotRightTriangle;", { 8939, 0 }, "\xe2\x8b\xab", 3 },
+    { "&nvHarr;", { 10500, 0 }, "\xe2\xa4\x84", 3 },
+    { "&natur;", { 9838, 0 }, "\xe2\x99\xae", 3 },
+    { "&cross;", { 10007, 0 }, "\xe2\x9c\x97", 3 },
+    { "&Sum;", { 8721, 0 }, "\xe2\x88\x91", 3 },
+    { "&hercon;", { 8889, 0 }, "\xe2\x8a\xb9", 3 },
+    { "&Ropf;", { 8477, 0 }, "\xe2\x84\x9d", 3 },
+    { "&hybull;", { 8259, 0 }, "\xe2\x81\x83", 3 },
+    { "&ring;", { 730, 0 }, "\xcb\x9a", 2 },
+    { "&Popf;", { 8473, 0 }, "\xe2\x84\x99", 3 },
+    { "&xharr;", { 10231, 0 }, "\xe2\x9f\xb7", 3 },
+    { "&epsi;", { 949, 0 }, "\xce\xb5", 2 },
+    { "&equest;", { 8799, 0 }, "\xe2\x89\x9f", 3 },
+    { "&osol;", { 8856, 0 }, "\xe2\x8a\x98", 3 },
+    { "&lat;", { 10923, 0 }, "\xe2\xaa\xab", 3 },
+    { "&par;", { 8741, 0 }, "\xe2\x88\xa5", 3 },
+    { "&bigcup;", { 8899, 0 }, "\xe2\x8b\x83", 3 },
+    { "&ntgl;", { 8825, 0 }, "\xe2\x89\xb9", 3 },
+    { "&imped;", { 437, 0 }, "\xc6\xb5", 2 },
+    { "&rpargt;", { 10644, 0 }, "\xe2\xa6\x94", 3 },
+    { "&Jscr;", { 119973, 0 }, "\xf0\x9d\x92\xa5", 4 },
+    { "&euml;", { 235, 0 }, "\xc3\xab", 2 },
+    { "&Supset;", { 8913, 0 }, "\xe2\x8b\x91", 3 },
+    { "&lcub;", { 123, 0 }, "\x7b", 1 },
+    { "&egs;", { 10902, 0 }, "\xe2\xaa\x96", 3 },
+    { "&Iota;", { 921, 0 }, "\xce\x99", 2 },
+    { "&fallingdotseq;", { 8786, 0 }, "\xe2\x89\x92", 3 },
+    { "&napprox;", { 8777, 0 }, "\xe2\x89\x89", 3 },
+    { "&Diamond;", { 8900, 0 }, "\xe2\x8b\x84", 3 },
+    { "&gcirc;", { 285, 0 }, "\xc4\x9d", 2 },
+    { "&yfr;", { 120118, 0 }, "\xf0\x9d\x94\xb6", 4 },
+    { "&Pfr;", { 120083, 0 }, "\xf0\x9d\x94\x93", 4 },
+    { "&quot;", { 34, 0 }, "\x22", 1 },
+    { "&Kappa;", { 922, 0 }, "\xce\x9a", 2 },
+    { "&solbar;", { 9023, 0 }, "\xe2\x8c\xbf", 3 },
+    { "&dtrif;", { 9662, 0 }, "\xe2\x96\xbe", 3 },
+    { "&Colon;", { 8759, 0 }, "\xe2\x88\xb7", 3 },
+    { "&equals;", { 61, 0 }, "\x3d", 1 },
+    { "&GreaterLess;", { 8823, 0 }, "\xe2\x89\xb7", 3 },
+    { "&Cross;", { 10799, 0 }, "\xe2\xa8\xaf", 3 },
+    { "&rightharpoonup;", { 8640, 0 }, "\xe2\x87\x80", 3 },
+    { "&pr;", { 8826, 0 }, "\xe2\x89\xba", 3 },
+    { "&RightCeiling;", { 8969, 0 }, "\xe2\x8c\x89", 3 },
+    { "&plankv;", { 8463, 0 }, "\xe2\x84\x8f", 3 },
+    { "&sqcups;", { 8852, 65024 }, "\xe2\x8a\x94\xef\xb8\x80", 6 },
+    { "&npr;", { 8832, 0 }, "\xe2\x8a\x80", 3 },
+    { "&vee;", { 8744, 0 }, "\xe2\x88\xa8", 3 },
+    { "&dfr;", { 120097, 0 }, "\xf0\x9d\x94\xa1", 4 },
+    { "&zeetrf;", { 8488, 0 }, "\xe2\x84\xa8", 3 },
+    { "&Eacute;", { 201, 0 }, "\xc3\x89", 2 },
+    { "&ape;", { 8778, 0 }, "\xe2\x89\x8a", 3 },
+    { "&nopf;", { 120159, 0 }, "\xf0\x9d\x95\x9f", 4 },
+    { "&KHcy;", { 1061, 0 }, "\xd0\xa5", 2 },
+    { "&Aring;", { 197, 0 }, "\xc3\x85", 2 },
+    { "&rarrw;", { 8605, 0 }, "\xe2\x86\x9d", 3 },
+    { "&boxvL;", { 9569, 0 }, "\xe2\x95\xa1", 3 },
+    { "&Mscr;", { 8499, 0 }, "\xe2\x84\xb3", 3 },
+    { "&Ucirc;", { 219, 0 }, "\xc3\x9b", 2 },
+    { "&amp;", { 38, 0 }, "\x26", 1 },
+    { "&ngsim;", { 8821, 0 }, "\xe2\x89\xb5", 3 },
+    { "&profline;", { 8978, 0 }, "\xe2\x8c\x92", 3 },
+    { "&rarrb;", { 8677, 0 }, "\xe2\x87\xa5", 3 },
+    { "&mapstoleft;", { 8612, 0 }, "\xe2\x86\xa4", 3 },
+    { "&thorn;", { 254, 0 }, "\xc3\xbe", 2 },
+    { "&lates;", { 10925, 65024 }, "\xe2\xaa\xad\xef\xb8\x80", 6 },
+    { "&ee;", { 8519, 0 }, "\xe2\x85\x87", 3 },
+    { "&iota;", { 953, 0 }, "\xce\xb9", 2 },
+    { "&otimes;", { 8855, 0 }, "\xe2\x8a\x97", 3 },
+    { "&spar;", { 8741, 0 }, "\xe2\x88\xa5", 3 },
+    { "&oopf;", { 120160, 0 }, "\xf0\x9d\x95\xa0", 4 },
+    { "&boxhd;", { 9516, 0 }, "\xe2\x94\xac", 3 },
+    { "&zigrarr;", { 8669, 0 }, "\xe2\x87\x9d", 3 },
+    { "&angmsd;", { 8737, 0 }, "\xe2\x88\xa1", 3 },
+    { "&loz;", { 9674, 0 }, "\xe2\x97\x8a", 3 },
+    { "&RightDoubleBracket;", { 10215, 0 }, "\xe2\x9f\xa7", 3 },
+    { "&NotPrecedes;", { 8832, 0 }, "\xe2\x8a\x80", 3 },
+    { "&NotLess;", { 8814, 0 }, "\xe2\x89\xae", 3 },
+    { "&reg;", { 174, 0 }, "\xc2\xae", 2 },
+    { "&uogon;", { 371, 0 }, "\xc5\xb3", 2 },
+    { "&smid;", { 8739, 0 }, "\xe2\x88\xa3", 3 },
+    { "&ldrdhar;", { 10599, 0 }, "\xe2\xa5\xa7", 3 },
+    { "&ges;", { 10878, 0 }, "\xe2\xa9\xbe", 3 },
+    { "&NotSubset;", { 8834, 8402 }, "\xe2\x8a\x82\xe2\x83\x92", 6 },
+    { "&twoheadleftarrow;", { 8606, 0 }, "\xe2\x86\x9e", 3 },
+    { "&cupcup;", { 10826, 0 }, "\xe2\xa9\x8a", 3 },
+    { "&Lcy;", { 1051, 0 }, "\xd0\x9b", 2 },
+    { "&pluscir;", { 10786, 0 }, "\xe2\xa8\xa2", 3 },
+    { "&blacklozenge;", { 10731, 0 }, "\xe2\xa7\xab", 3 },
+    { "&Amacr;", { 256, 0 }, "\xc4\x80", 2 },
+    { "&xhArr;", { 10234, 0 }, "\xe2\x9f\xba", 3 },
+    { "&frac25;", { 8534, 0 }, "\xe2\x85\x96", 3 },
+    { "&ccirc;", { 265, 0 }, "\xc4\x89", 2 },
+    { "&CHcy;", { 1063, 0 }, "\xd0\xa7", 2 },
+    { "&SuchThat;", { 8715, 0 }, "\xe2\x88\x8b", 3 },
+    { "&nsqsupe;", { 8931, 0 }, "\xe2\x8b\xa3", 3 },
+    { "&rcaron;", { 345, 0 }, "\xc5\x99", 2 },
+    { "&lopf;", { 120157, 0 }, "\xf0\x9d\x95\x9d", 4 },
+    { "&rightrightarrows;", { 8649, 0 }, "\xe2\x87\x89", 3 },
+    { "&lessgtr;", { 8822, 0 }, "\xe2\x89\xb6", 3 },
+    { "&lE;", { 8806, 0 }, "\xe2\x89\xa6", 3 },
+    { "&srarr;", { 8594, 0 }, "\xe2\x86\x92", 3 },
+    { "&EmptySmallSquare;", { 9723, 0 }, "\xe2\x97\xbb", 3 },
+    { "&supdsub;", { 10968, 0 }, "\xe2\xab\x98", 3 },
+    { "&tau;", { 964, 0 }, "\xcf\x84", 2 },
+    { "&mcomma;", { 10793, 0 }, "\xe2\xa8\xa9", 3 },
+    { "&succeq;", { 10928, 0 }, "\xe2\xaa\xb0", 3 },
+    { "&upsih;", { 978, 0 }, "\xcf\x92", 2 },
+    { "&wscr;", { 120012, 0 }, "\xf0\x9d\x93\x8c", 4 },
+    { "&ltcc;", { 10918, 0 }, "\xe2\xaa\xa6", 3 },
+    { "&clubs;", { 9827, 0 }, "\xe2\x99\xa3", 3 },
+    { "&CircleTimes;", { 8855, 0 }, "\xe2\x8a\x97", 3 },
+    { "&notnivb;", { 8958, 0 }, "\xe2\x8b\xbe", 3 },
+    { "&DoubleLeftArrow;", { 8656, 0 }, "\xe2\x87\x90", 3 },
+    { "&mstpos;", { 8766, 0 }, "\xe2\x88\xbe", 3 },
+    { "&LeftTriangleEqual;", { 8884, 0 }, "\xe2\x8a\xb4", 3 },
+    { "&infintie;", { 10717, 0 }, "\xe2\xa7\x9d", 3 },
+    { "&circ;", { 710, 0 }, "\xcb\x86", 2 },
+    { "&Scedil;", { 350, 0 }, "\xc5\x9e", 2 },
+    { "&lsaquo;", { 8249, 0 }, "\xe2\x80\xb9", 3 },
+    { "&LessSlantEqual;", { 10877, 0 }, "\xe2\xa9\xbd", 3 },
+    { "&utri;", { 9653, 0 }, "\xe2\x96\xb5", 3 },
+    { "&Element;", { 8712, 0 }, "\xe2\x88\x88", 3 },
+    { "&lopar;", { 10629, 0 }, "\xe2\xa6\x85", 3 },
+    { "&zwj;", { 8205, 0 }, "\xe2\x80\x8d", 3 },
+    { "&sqsup;", { 8848, 0 }, "\xe2\x8a\x90", 3 },
+    { "&solb;", { 10692, 0 }, "\xe2\xa7\x84", 3 },
+    { "&GreaterTilde;", { 8819, 0 }, "\xe2\x89\xb3", 3 },
+    { "&xlarr;", { 10229, 0 }, "\xe2\x9f\xb5", 3 },
+    { "&Yfr;", { 120092, 0 }, "\xf0\x9d\x94\x9c", 4 },
+    { "&dot;", { 729, 0 }, "\xcb\x99", 2 },
+    { "&nltri;", { 8938, 0 }, "\xe2\x8b\xaa", 3 },
+    { "&supplus;", { 10944, 0 }, "\xe2\xab\x80", 3 },
+    { "&gopf;", { 120152, 0 }, "\xf0\x9d\x95\x98", 4 },
+    { "&PrecedesSlantEqual;", { 8828, 0 }, "\xe2\x89\xbc", 3 },
+    { "&Aogon;", { 260, 0 }, "\xc4\x84", 2 },
+    { "&Rarr;", { 8608, 0 }, "\xe2\x86\xa0", 3 },
+    { "&nsupset;", { 8835, 8402 }, "\xe2\x8a\x83\xe2\x83\x92", 6 },
+    { "&YUcy;", { 1070, 0 }, "\xd0\xae", 2 },
+    { "&frac16;", { 8537, 0 }, "\xe2\x85\x99", 3 },
+    { "&LeftTeeVector;", { 10586, 0 }, "\xe2\xa5\x9a", 3 },
+    { "&varsubsetneqq;", { 10955, 65024 }, "\xe2\xab\x8b\xef\xb8\x80", 6 },
+    { "&Updownarrow;", { 8661, 0 }, "\xe2\x87\x95", 3 },
+    { "&lrm;", { 8206, 0 }, "\xe2\x80\x8e", 3 },
+    { "&Gamma;", { 915, 0 }, "\xce\x93", 2 },
+    { "&HorizontalLine;", { 9472, 0 }, "\xe2\x94\x80", 3 },
+    { "&xfr;", { 120117, 0 }, "\xf0\x9d\x94\xb5", 4 },
+    { "&larrbfs;", { 10527, 0 }, "\xe2\xa4\x9f", 3 },
+    { "&VDash;", { 8875, 0 }, "\xe2\x8a\xab", 3 },
+    { "&RightTriangleEqual;", { 8885, 0 }, "\xe2\x8a\xb5", 3 },
+    { "&sfrown;", { 8994, 0 }, "\xe2\x8c\xa2", 3 },
+    { "&sbquo;", { 8218, 0 }, "\xe2\x80\x9a", 3 },
+    { "&aring;", { 229, 0 }, "\xc3\xa5", 2 },
+    { "&Uscr;", { 119984, 0 }, "\xf0\x9d\x92\xb0", 4 },
+    { "&ntriangleleft;", { 8938, 0 }, "\xe2\x8b\xaa", 3 },
+    { "&trianglelefteq;", { 8884, 0 }, "\xe2\x8a\xb4", 3 },
+    { "&uopf;", { 120166, 0 }, "\xf0\x9d\x95\xa6", 4 },
+    { "&Efr;", { 120072, 0 }, "\xf0\x9d\x94\x88", 4 },
+    { "&bigwedge;", { 8896, 0 }, "\xe2\x8b\x80", 3 },
+    { "&sqsupe;", { 8850, 0 }, "\xe2\x8a\x92", 3 },
+    { "&frac23;", { 8532, 0 }, "\xe2\x85\x94", 3 },
+    { "&RightTeeVector;", { 10587, 0 }, "\xe2\xa5\x9b", 3 },
+    { "&igrave;", { 236, 0 }, "\xc3\xac", 2 },
+    { "&rdca;", { 10551, 0 }, "\xe2\xa4\xb7", 3 },
+    { "&Ycirc;", { 374, 0 }, "\xc5\xb6", 2 },
+    { "&lobrk;", { 10214, 0 }, "\xe2\x9f\xa6", 3 },
+    { "&lang;", { 10216, 0 }, "\xe2\x9f\xa8", 3 },
+    { "&order;", { 8500, 0 }, "\xe2\x84\xb4", 3 },
+    { "&dotplus;", { 8724, 0 }, "\xe2\x88\x94", 3 },
+    { "&lg;", { 8822, 0 }, "\xe2\x89\xb6", 3 },
+    { "&sdot;", { 8901, 0 }, "\xe2\x8b\x85", 3 },
+    { "&homtht;", { 8763, 0 }, "\xe2\x88\xbb", 3 },
+    { "&ofr;", { 120108, 0 }, "\xf0\x9d\x94\xac", 4 },
+    { "&nsube;", { 8840, 0 }, "\xe2\x8a\x88", 3 },
+    { "&wopf;", { 120168, 0 }, "\xf0\x9d\x95\xa8", 4 },
+    { "&imof;", { 8887, 0 }, "\xe2\x8a\xb7", 3 },
+    { "&frac58;", { 8541, 0 }, "\xe2\x85\x9d", 3 },
+    { "&nGt;", { 8811, 8402 }, "\xe2\x89\xab\xe2\x83\x92", 6 },
+    { "&toea;", { 10536, 0 }, "\xe2\xa4\xa8", 3 },
+    { "&supE;", { 10950, 0 }, "\xe2\xab\x86", 3 },
+    { "&Jcirc;", { 308, 0 }, "\xc4\xb4", 2 },
+    { "&ugrave;", { 249, 0 }, "\xc3\xb9", 2 },
+    { "&Wcirc;", { 372, 0 }, "\xc5\xb4", 2 },
+    { "&plussim;", { 10790, 0 }, "\xe2\xa8\xa6", 3 },
+    { "&rho;", { 961, 0 }, "\xcf\x81", 2 },
+    { "&smtes;", { 10924, 65024 }, "\xe2\xaa\xac\xef\xb8\x80", 6 },
+    { "&AElig;", { 198, 0 }, "\xc3\x86", 2 },
+    { "&semi;", { 59, 0 }, "\x3b", 1 },
+    { "&dotminus;", { 8760, 0 }, "\xe2\x88\xb8", 3 },
+    { "&cedil;", { 184, 0 }, "\xc2\xb8", 2 },
+    { "&boxVR;", { 9568, 0 }, "\xe2\x95\xa0", 3 },
+    { "&circledast;", { 8859, 0 }, "\xe2\x8a\x9b", 3 },
+    { "&naturals;", { 8469, 0 }, "\xe2\x84\x95", 3 },
+    { "&leq;", { 8804, 0 }, "\xe2\x89\xa4", 3 },
+    { "&Ubreve;", { 364, 0 }, "\xc5\xac", 2 },
+    { "&CenterDot;", { 183, 0 }, "\xc2\xb7", 2 },
+    { "&ltdot;", { 8918, 0 }, "\xe2\x8b\x96", 3 },
+    { "&Cdot;", { 266, 0 }, "\xc4\x8a", 2 },
+    { "&Mu;", { 924, 0 }, "\xce\x9c", 2 },
+    { "&nang;", { 8736, 8402 }, "\xe2\x88\xa0\xe2\x83\x92", 6 },
+    { "&capcup;", { 10823, 0 }, "\xe2\xa9\x87", 3 },
+    { "&DiacriticalGrave;", { 96, 0 }, "\x60", 1 },
+    { "&ImaginaryI;", { 8520, 0 }, "\xe2\x85\x88", 3 },
+    { "&brvbar;", { 166, 0 }, "\xc2\xa6", 2 },
+    { "&Leftrightarrow;", { 8660, 0 }, "\xe2\x87\x94", 3 },
+    { "&subset;", { 8834, 0 }, "\xe2\x8a\x82", 3 },
+    { "&kjcy;", { 1116, 0 }, "\xd1\x9c", 2 },
+    { "&boxv;", { 9474, 0 }, "\xe2\x94\x82", 3 },
+    { "&notin;", { 8713, 0 }, "\xe2\x88\x89", 3 },
+    { "&zwnj;", { 8204, 0 }, "\xe2\x80\x8c", 3 },
+    { "&ccaron;", { 269, 0 }, "\xc4\x8d", 2 },
+    { "&rscr;", { 120007, 0 }, "\xf0\x9d\x93\x87", 4 },
+    { "&frac78;", { 8542, 0 }, "\xe2\x85\x9e", 3 },
+    { "&ldsh;", { 8626, 0 }, "\xe2\x86\xb2", 3 },
+    { "&rsquo;", { 8217, 0 }, "\xe2\x80\x99", 3 },
+    { "&OverParenthesis;", { 9180, 0 }, "\xe2\x8f\x9c", 3 },
+    { "&rpar;", { 41, 0 }, "\x29", 1 },
+    { "&rarrfs;", { 10526, 0 }, "\xe2\xa4\x9e", 3 },
+    { "&PrecedesEqual;", { 10927, 0 }, "\xe2\xaa\xaf", 3 },
+    { "&zdot;", { 380, 0 }, "\xc5\xbc", 2 },
+    { "&Rcaron;", { 344, 0 }, "\xc5\x98", 2 },
+    { "&cupbrcap;", { 10824, 0 }, "\xe2\xa9\x88", 3 },
+    { "&nleftrightarrow;", { 8622, 0 }, "\xe2\x86\xae", 3 },
+    { "&Dopf;", { 120123, 0 }, "\xf0\x9d\x94\xbb", 4 },
+    { "&kgreen;", { 312, 0 }, "\xc4\xb8", 2 },
+    { "&Odblac;", { 336, 0 }, "\xc5\x90", 2 },
+    { "&eqslantgtr;", { 10902, 0 }, "\xe2\xaa\x96", 3 },
+    { "&Scaron;", { 352, 0 }, "\xc5\xa0", 2 },
+    { "&YAcy;", { 1071, 0 }, "\xd0\xaf", 2 },
+    { "&lessdot;", { 8918, 0 }, "\xe2\x8b\x96", 3 },
+    { "&Cfr;", { 8493, 0 }, "\xe2\x84\xad", 3 },
+    { "&isins;", { 8948, 0 }, "\xe2\x8b\xb4", 3 },
+    { "&race;", { 8765, 817 }, "\xe2\x88\xbd\xcc\xb1", 5 },
+    { "&lbarr;", { 10508, 0 }, "\xe2\xa4\x8c", 3 },
+    { "&DownLeftRightVector;", { 10576, 0 }, "\xe2\xa5\x90", 3 },
+    { "&rightarrow;", { 8594, 0 }, "\xe2\x86\x92", 3 },
+    { "&gtrapprox;", { 10886, 0 }, "\xe2\xaa\x86", 3 },
+    { "&subedot;", { 10947, 0 }, "\xe2\xab\x83", 3 },
+    { "&ast;", { 42, 0 }, "\x2a", 1 },
+    { "&gsiml;", { 10896, 0 }, "\xe2\xaa\x90", 3 },
+    { "&Ocy;", { 1054, 0 }, "\xd0\x9e", 2 },
+    { "&prop;", { 8733, 0 }, "\xe2\x88\x9d", 3 },
+    { "&sect;", { 167, 0 }, "\xc2\xa7", 2 },
+    { "&ndash;", { 8211, 0 }, "\xe2\x80\x93", 3 },
+    { "&jopf;", { 120155, 0 }, "\xf0\x9d\x95\x9b", 4 },
+    { "&kscr;", { 120000, 0 }, "\xf0\x9d\x93\x80", 4 },
+    { "&boxUr;", { 9561, 0 }, "\xe2\x95\x99", 3 },
+    { "&el;", { 10905, 0 }, "\xe2\xaa\x99", 3 },
+    { "&aopf;", { 120146, 0 }, "\xf0\x9d\x95\x92", 4 },
+    { "&scedil;", { 351, 0 }, "\xc5\x9f", 2 },
+    { "&sccue;", { 8829, 0 }, "\xe2\x89\xbd", 3 },
+    { "&phiv;", { 981, 0 }, "\xcf\x95", 2 },
+    { "&varphi;", { 981, 0 }, "\xcf\x95", 2 },
+    { "&sqsube;", { 8849, 0 }, "\xe2\x8a\x91", 3 },
+    { "&frown;", { 8994, 0 }, "\xe2\x8c\xa2", 3 },
+    { "&TildeTilde;", { 8776, 0 }, "\xe2\x89\x88", 3 },
+    { "&sacute;", { 347, 0 }, "\xc5\x9b", 2 },
+    { "&Zdot;", { 379, 0 }, "\xc5\xbb", 2 },
+    { "&ultri;", { 9720, 0 }, "\xe2\x97\xb8", 3 },
+    { "&tprime;", { 8244, 0 }, "\xe2\x80\xb4", 3 },
+    { "&rharul;", { 10604, 0 }, "\xe2\xa5\xac", 3 },
+    { "&TSHcy;", { 1035, 0 }, "\xd0\x8b", 2 },
+    { "&NotGreaterGreater;", { 8811, 824 }, "\xe2\x89\xab\xcc\xb8", 5 },
+    { "&Ecirc;", { 202, 0 }, "\xc3\x8a", 2 },
+    { "&boxVr;", { 9567, 0 }, "\xe2\x95\x9f", 3 },
+    { "&nsupseteqq;", { 10950, 824 }, "\xe2\xab\x86\xcc\xb8", 5 },
+    { "&oror;", { 10838, 0 }, "\xe2\xa9\x96", 3 },
+    { "&rfr;", { 120111, 0 }, "\xf0\x9d\x94\xaf", 4 },
+    { "&Implies;", { 8658, 0 }, "\xe2\x87\x92", 3 },
+    { "&xscr;", { 120013, 0 }, "\xf0\x9d\x93\x8d", 4 },
+    { "&nearr;", { 8599, 0 }, "\xe2\x86\x97", 3 },
+    { "&boxUL;", { 9565, 0 }, "\xe2\x95\x9d", 3 },
+    { "&VerticalLine;", { 124, 0 }, "\x7c", 1 },
+    { "&sqcaps;", { 8851, 65024 }, "\xe2\x8a\x93\xef\xb8\x80", 6 },
+    { "&ETH;", { 208, 0 }, "\xc3\x90", 2 },
+    { "&sim;", { 8764, 0 }, "\xe2\x88\xbc", 3 },
+    { "&diamondsuit;", { 9830, 0 }, "\xe2\x99\xa6", 3 },
+    { "&ll;", { 8810, 0 }, "\xe2\x89\xaa", 3 },
+    { "&Omega;", { 937, 0 }, "\xce\xa9", 2 },
+    { "&questeq;", { 8799, 0 }, "\xe2\x89\x9f", 3 },
+    { "&Rrightarrow;", { 8667, 0 }, "\xe2\x87\x9b", 3 },
+    { "&vsubne;", { 8842, 65024 }, "\xe2\x8a\x8a\xef\xb8\x80", 6 },
+    { "&boxH;", { 9552, 0 }, "\xe2\x95\x90", 3 },
+    { "&nsqsube;", { 8930, 0 }, "\xe2\x8b\xa2", 3 },
+    { "&sung;", { 9834, 0 }, "\xe2\x99\xaa", 3 },
+    { "&mlcp;", { 10971, 0 }, "\xe2\xab\x9b", 3 },
+    { "&dHar;", { 10597, 0 }, "\xe2\xa5\xa5", 3 },
+    { "&dd;", { 8518, 0 }, "\xe2\x85\x86", 3 },
+    { "&triangle;", { 9653, 0 }, "\xe2\x96\xb5", 3 },
+    { "&oplus;", { 8853, 0 }, "\xe2\x8a\x95", 3 },
+    { "&ccupssm;", { 10832, 0 }, "\xe2\xa9\x90", 3 },
+    { "&omega;", { 969, 0 }, "\xcf\x89", 2 },
+    { "&leqq;", { 8806, 0 }, "\xe2\x89\xa6", 3 },
+    { "&rppolint;", { 10770, 0 }, "\xe2\xa8\x92", 3 },
+    { "&nsim;", { 8769, 0 }, "\xe2\x89\x81", 3 },
+    { "&trpezium;", { 9186, 0 }, "\xe2\x8f\xa2", 3 },
+    { "&spadesuit;", { 9824, 0 }, "\xe2\x99\xa0", 3 },
+    { "&notniva;", { 8716, 0 }, "\xe2\x88\x8c", 3 },
+    { "&ffr;", { 120099, 0 }, "\xf0\x9d\x94\xa3", 4 },
+    { "&eparsl;", { 10723, 0 }, "\xe2\xa7\xa3", 3 },
+    { "&angmsdaa;", { 10664, 0 }, "\xe2\xa6\xa8", 3 },
+    { "&lharu;", { 8636, 0 }, "\xe2\x86\xbc", 3 },
+    { "&NotRightTriangleBar;", { 10704, 824 }, "\xe2\xa7\x90\xcc\xb8", 5 },
+    { "&frac45;", { 8536, 0 }, "\xe2\x85\x98", 3 },
+    { "&perp;", { 8869, 0 }, "\xe2\x8a\xa5", 3 },
+    { "&nVDash;", { 8879, 0 }, "\xe2\x8a\xaf", 3 },
+    { "&rationals;", { 8474, 0 }, "\xe2\x84\x9a", 3 },
+    { "&bdquo;", { 8222, 0 }, "\xe2\x80\x9e", 3 },
+    { "&vsubnE;", { 10955, 65024 }, "\xe2\xab\x8b\xef\xb8\x80", 6 },
+    { "&wedgeq;", { 8793, 0 }, "\xe2\x89\x99", 3 },
+    { "&nexist;", { 8708, 0 }, "\xe2\x88\x84", 3 },
+    { "&veebar;", { 8891, 0 }, "\xe2\x8a\xbb", 3 },
+    { "&squarf;", { 9642, 0 }, "\xe2\x96\xaa", 3 },
+    { "&pertenk;", { 8241, 0 }, "\xe2\x80\xb1", 3 },
+    { "&Star;", { 8902, 0 }, "\xe2\x8b\x86", 3 },
+    { "&lbrace;", { 123, 0 }, "\x7b", 1 },
+    { "&compfn;", { 8728, 0 }, "\xe2\x88\x98", 3 },
+    { "&triminus;", { 10810, 0 }, "\xe2\xa8\xba", 3 },
+    { "&pound;", { 163, 0 }, "\xc2\xa3", 2 },
+    { "&gEl;", { 10892, 0 }, "\xe2\xaa\x8c", 3 },
+    { "&trianglerighteq;", { 8885, 0 }, "\xe2\x8a\xb5", 3 },
+    { "&nleqslant;", { 10877, 824 }, "\xe2\xa9\xbd\xcc\xb8", 5 },
+    { "&backprime;", { 8245, 0 }, "\xe2\x80\xb5", 3 },
+    { "&prnap;", { 10937, 0 }, "\xe2\xaa\xb9", 3 },
+    { "&pscr;", { 120005, 0 }, "\xf0\x9d\x93\x85", 4 },
+    { "&Oacute;", { 211, 0 }, "\xc3\x93", 2 },
+    { "&varsupsetneq;", { 8843, 65024 }, "\xe2\x8a\x8b\xef\xb8\x80", 6 },
+    { "&gg;", { 8811, 0 }, "\xe2\x89\xab", 3 },
+    { "&nharr;", { 8622, 0 }, "\xe2\x86\xae", 3 },
+    { "&gesdotol;", { 10884, 0 }, "\xe2\xaa\x84", 3 },
+    { "&Lmidot;", { 319, 0 }, "\xc4\xbf", 2 },
+    { "&bigoplus;", { 10753, 0 }, "\xe2\xa8\x81", 3 },
+    { "&orv;", { 10843, 0 }, "\xe2\xa9\x9b", 3 },
+    { "&Kscr;", { 119974, 0 }, "\xf0\x9d\x92\xa6", 4 },
+    { "&intlarhk;", { 10775, 0 }, "\xe2\xa8\x97", 3 },
+    { "&Aacute;", { 193, 0 }, "\xc3\x81", 2 },
+    { "&llcorner;", { 8990, 0 }, "\xe2\x8c\x9e", 3 },
+    { "&lambda;", { 955, 0 }, "\xce\xbb", 2 },
+    { "&plus;", { 43, 0 }, "\x2b", 1 },
+    { "&lesseqgtr;", { 8922, 0 }, "\xe2\x8b\x9a", 3 },
+    { "&cularrp;", { 10557, 0 }, "\xe2\xa4\xbd", 3 },
+    { "&xi;", { 958, 0 }, "\xce\xbe", 2 },
+    { "&bcy;", { 1073, 0 }, "\xd0\xb1", 2 },
+    { "&DownLeftVectorBar;", { 10582, 0 }, "\xe2\xa5\x96", 3 },
+    { "&frac14;", { 188, 0 }, "\xc2\xbc", 2 },
+    { "&squf;", { 9642, 0 }, "\xe2\x96\xaa", 3 },
+    { "&Hopf;", { 8461, 0 }, "\xe2\x84\x8d", 3 },
+    { "&kappa;", { 954, 0 }, "\xce\xba", 2 },
+    { "&vartriangleleft;", { 8882, 0 }, "\xe2\x8a\xb2", 3 },
+    { "&nsubset;", { 8834, 8402 }, "\xe2\x8a\x82\xe2\x83\x92", 6 },
+    { "&Laplacetrf;", { 8466, 0 }, "\xe2\x84\x92", 3 },
+    { "&Vert;", { 8214, 0 }, "\xe2\x80\x96", 3 },
+    { "&ctdot;", { 8943, 0 }, "\xe2\x8b\xaf", 3 },
+    { "&risingdotseq;", { 8787, 0 }, "\xe2\x89\x93", 3 },
+    { "&demptyv;", { 10673, 0 }, "\xe2\xa6\xb1", 3 },
+    { "&NotSucceedsEqual;", { 10928, 824 }, "\xe2\xaa\xb0\xcc\xb8", 5 },
+    { "&emsp14;", { 8197, 0 }, "\xe2\x80\x85", 3 },
+    { "&wedbar;", { 10847, 0 }, "\xe2\xa9\x9f", 3 },
+    { "&ycirc;", { 375, 0 }, "\xc5\xb7", 2 },
+    { "&cudarrr;", { 10549, 0 }, "\xe2\xa4\xb5", 3 },
+    { "&ecy;", { 1101, 0 }, "\xd1\x8d", 2 },
+    { "&angmsdad;", { 10667, 0 }, "\xe2\xa6\xab", 3 },
+    { "&topbot;", { 9014, 0 }, "\xe2\x8c\xb6", 3 },
+    { "&glj;", { 10916, 0 }, "\xe2\xaa\xa4", 3 },
+    { "&rthree;", { 8908, 0 }, "\xe2\x8b\x8c", 3 },
+    { "&copf;", { 120148, 0 }, "\xf0\x9d\x95\x94", 4 },
+    { "&ntilde;", { 241, 0 }, "\xc3\xb1", 2 },
+    { "&FilledSmallSquare;", { 9724, 0 }, "\xe2\x97\xbc", 3 },
+    { "&prcue;", { 8828, 0 }, "\xe2\x89\xbc", 3 },
+    { "&Ecy;", { 1069, 0 }, "\xd0\xad", 2 },
+    { "&lmoustache;", { 9136, 0 }, "\xe2\x8e\xb0", 3 },
+    { "&Lang;", { 10218, 0 }, "\xe2\x9f\xaa", 3 },
+    { "&triangledown;", { 9663, 0 }, "\xe2\x96\xbf", 3 },
+    { "&rtriltri;", { 10702, 0 }, "\xe2\xa7\x8e", 3 },
+    { "&approx;", { 8776, 0 }, "\xe2\x89\x88", 3 },
+    { "&DiacriticalDot;", { 729, 0 }, "\xcb\x99", 2 },
+    { "&rmoustache;", { 9137, 0 }, "\xe2\x8e\xb1", 3 },
+    { "&ShortUpArrow;", { 8593, 0 }, "\xe2\x86\x91", 3 },
+    { "&prnE;", { 10933, 0 }, "\xe2\xaa\xb5", 3 },
+    { "&SHCHcy;", { 1065, 0 }, "\xd0\xa9", 2 },
+    { "&nisd;", { 8954, 0 }, "\xe2\x8b\xba", 3 },
+    { "&UnderBrace;", { 9183, 0 }, "\xe2\x8f\x9f", 3 },
+    { "&Rscr;", { 8475, 0 }, "\xe2\x84\x9b", 3 },
+    { "&dtdot;", { 8945, 0 }, "\xe2\x8b\xb1", 3 },
+    { "&lbrke;", { 10635, 0 }, "\xe2\xa6\x8b", 3 },
+    { "&olarr;", { 8634, 0 }, "\xe2\x86\xba", 3 },
+    { "&radic;", { 8730, 0 }, "\xe2\x88\x9a", 3 },
+    { "&Chi;", { 935, 0 }, "\xce\xa7", 2 },
+    { "&ngE;", { 8807, 824 }, "\xe2\x89\xa7\xcc\xb8", 5 },
+    { "&uharl;", { 8639, 0 }, "\xe2\x86\xbf", 3 },
+    { "&vert;", { 124, 0 }, "\x7c", 1 },
+    { "&NotGreaterLess;", { 8825, 0 }, "\xe2\x89\xb9", 3 },
+    { "&NotSquareSuperset;", { 8848, 824 }, "\xe2\x8a\x90\xcc\xb8", 5 },
+    { "&langle;", { 10216, 0 }, "\xe2\x9f\xa8", 3 },
+    { "&Bumpeq;", { 8782, 0 }, "\xe2\x89\x8e", 3 },
+    { "&nleftarrow;", { 8602, 0 }, "\xe2\x86\x9a", 3 },
+    { "&beth;", { 8502, 0 }, "\xe2\x84\xb6", 3 },
+    { "&bull;", { 8226, 0 }, "\xe2\x80\xa2", 3 },
+    { "&RightArrowLeftArrow;", { 8644, 0 }, "\xe2\x87\x84", 3 },
+    { "&ne;", { 8800, 0 }, "\xe2\x89\xa0", 3 },
+    { "&Tcaron;", { 356, 0 }, "\xc5\xa4", 2 },
+    { "&Jsercy;", { 1032, 0 }, "\xd0\x88", 2 },
+    { "&ltimes;", { 8905, 0 }, "\xe2\x8b\x89", 3 },
+    { "&iiiint;", { 10764, 0 }, "\xe2\xa8\x8c", 3 },
+    { "&hearts;", { 9829, 0 }, "\xe2\x99\xa5", 3 },
+    { "&copy;", { 169, 0 }, "\xc2\xa9", 2 },
+    { "&Lt;", { 8810, 0 }, "\xe2\x89\xaa", 3 },
+    { "&parsim;", { 10995, 0 }, "\xe2\xab\xb3", 3 },
+    { "&prurel;", { 8880, 0 }, "\xe2\x8a\xb0", 3 },
+    { "&xoplus;", { 10753, 0 }, "\xe2\xa8\x81", 3 },
+    { "&RightDownVectorBar;", { 10581, 0 }, "\xe2\xa5\x95", 3 },
+    { "&mid;", { 8739, 0 }, "\xe2\x88\xa3", 3 },
+    { "&supsetneq;", { 8843, 0 }, "\xe2\x8a\x8b", 3 },
+    { "&wedge;", { 8743, 0 }, "\xe2\x88\xa7", 3 },
+    { "&rotimes;", { 10805, 0 }, "\xe2\xa8\xb5", 3 },
+    { "&Dcy;", { 1044, 0 }, "\xd0\x94", 2 },
+    { "&copysr;", { 8471, 0 }, "\xe2\x84\x97", 3 },
+    { "&SmallCircle;", { 8728, 0 }, "\xe2\x88\x98", 3 },
+    { "&TScy;", { 1062, 0 }, "\xd0\xa6", 2 },
+    { "&Uring;", { 366, 0 }, "\xc5\xae", 2 },
+    { "&Fcy;", { 1060, 0 }, "\xd0\xa4", 2 },
+    { "&minusb;", { 8863, 0 }, "\xe2\x8a\x9f", 3 },
+    { "&nbsp;", { 160, 0 }, "\xc2\xa0", 2 },
+    { "&ltlarr;", { 10614, 0 }, "\xe2\xa5\xb6", 3 },
+    { "&gne;", { 10888, 0 }, "\xe2\xaa\x88", 3 },
+    { "&Del;", { 8711, 0 }, "\xe2\x88\x87", 3 },
+    { "&boxvl;", { 9508, 0 }, "\xe2\x94\xa4", 3 },
+    { "&blacktriangleright;", { 9656, 0 }, "\xe2\x96\xb8", 3 },
+    { "&female;", { 9792, 0 }, "\xe2\x99\x80", 3 },
+    { "&LeftRightVector;", { 10574, 0 }, "\xe2\xa5\x8e", 3 },
+    { "&Rarrtl;", { 10518, 0 }, "\xe2\xa4\x96", 3 },
+    { "&Dscr;", { 119967, 0 }, "\xf0\x9d\x92\x9f", 4 },
+    { "&smte;", { 10924, 0 }, "\xe2\xaa\xac", 3 },
+    { "&Tfr;", { 120087, 0 }, "\xf0\x9d\x94\x97", 4 },
+    { "&sopf;", { 120164, 0 }, "\xf0\x9d\x95\xa4", 4 },
+    { "&ncedil;", { 326, 0 }, "\xc5\x86", 2 },
+    { "&vrtri;", { 8883, 0 }, "\xe2\x8a\xb3", 3 },
+    { "&roplus;", { 10798, 0 }, "\xe2\xa8\xae", 3 },
+    { "&topcir;", { 10993, 0 }, "\xe2\xab\xb1", 3 },
+    { "&Proportional;", { 8733, 0 }, "\xe2\x88\x9d", 3 },
+    { "&SquareUnion;", { 8852, 0 }, "\xe2\x8a\x94", 3 },
+    { "&qint;", { 10764, 0 }, "\xe2\xa8\x8c", 3 },
+    { "&nrightarrow;", { 8603, 0 }, "\xe2\x86\x9b", 3 },
+    { "&apE;", { 10864, 0 }, "\xe2\xa9\xb0", 3 },
+    { "&odot;", { 8857, 0 }, "\xe2\x8a\x99", 3 },
+    { "&ngtr;", { 8815, 0 }, "\xe2\x89\xaf", 3 },
+    { "&uplus;", { 8846, 0 }, "\xe2\x8a\x8e", 3 },
+    { "&LeftUpVectorBar;", { 10584, 0 }, "\xe2\xa5\x98", 3 },
+    { "&dash;", { 8208, 0 }, "\xe2\x80\x90", 3 },
+    { "&minusdu;", { 10794, 0 }, "\xe2\xa8\xaa", 3 },
+    { "&Yopf;", { 120144, 0 }, "\xf0\x9d\x95\x90", 4 },
+    { "&COPY;", { 169, 0 }, "\xc2\xa9", 2 },
+    { "&sol;", { 47, 0 }, "\x2f", 1 },
+    { "&Mellintrf;", { 8499, 0 }, "\xe2\x84\xb3", 3 },
+    { "&capbrcup;", { 10825, 0 }, "\xe2\xa9\x89", 3 },
+    { "&DoubleLongRightArrow;", { 10233, 0 }, "\xe2\x9f\xb9", 3 },
+    { "&LeftArrow;", { 8592, 0 }, "\xe2\x86\x90", 3 },
+    { "&cirmid;", { 10991, 0 }, "\xe2\xab\xaf", 3 },
+    { "&gacute;", { 501, 0 }, "\xc7\xb5", 2 },
+    { "&nspar;", { 8742, 0 }, "\xe2\x88\xa6", 3 },
+    { "&odsold;", { 10684, 0 }, "\xe2\xa6\xbc", 3 },
+    { "&NotLeftTriangle;", { 8938, 0 }, "\xe2\x8b\xaa", 3 },
+    { "&NotLeftTriangleEqual;", { 8940, 0 }, "\xe2\x8b\xac", 3 },
+    { "&tdot;", { 8411, 0 }, "\xe2\x83\x9b", 3 },
+    { "&nlE;", { 8806, 824 }, "\xe2\x89\xa6\xcc\xb8", 5 },
+    { "&Auml;", { 196, 0 }, "\xc3\x84", 2 },
+    { "&rarrhk;", { 8618, 0 }, "\xe2\x86\xaa", 3 },
+    { "&grave;", { 96, 0 }, "\x60", 1 },
+    { "&mldr;", { 8230, 0 }, "\xe2\x80\xa6", 3 },
+    { "&Ufr;", { 120088, 0 }, "\xf0\x9d\x94\x98", 4 },
+    { "&NotLessSlantEqual;", { 10877, 824 }, "\xe2\xa9\xbd\xcc\xb8", 5 },
+    { "&Qscr;", { 119980, 0 }, "\xf0\x9d\x92\xac", 4 },
+    { "&Afr;", { 120068, 0 }, "\xf0\x9d\x94\x84", 4 },
+    { "&boxuL;", { 9563, 0 }, "\xe2\x95\x9b", 3 },
+    { "&nvlArr;", { 10498, 0 }, "\xe2\xa4\x82", 3 },
+    { "&lagran;", { 8466, 0 }, "\xe2\x84\x92", 3 },
+    { "&searr;", { 8600, 0 }, "\xe2\x86\x98", 3 },
+    { "&NotTildeTilde;", { 8777, 0 }, "\xe2\x89\x89", 3 },
+    { "&dlcrop;", { 8973, 0 }, "\xe2\x8c\x8d", 3 },
+    { "&dcaron;", { 271, 0 }, "\xc4\x8f", 2 },
+    { "&cuesc;", { 8927, 0 }, "\xe2\x8b\x9f", 3 },
+    { "&Dcaron;", { 270, 0 }, "\xc4\x8e", 2 },
+    { "&exist;", { 8707, 0 }, "\xe2\x88\x83", 3 },
+    { "&olt;", { 10688, 0 }, "\xe2\xa7\x80", 3 },
+    { "&preceq;", { 10927, 0 }, "\xe2\xaa\xaf", 3 },
+    { "&andslope;", { 10840, 0 }, "\xe2\xa9\x98", 3 },
+    { "&real;", { 8476, 0 }, "\xe2\x84\x9c", 3 },
+    { "&Hat;", { 94, 0 }, "\x5e", 1 },
+    { "&GreaterEqualLess;", { 8923, 0 }, "\xe2\x8b\x9b", 3 },
+    { "&Cap;", { 8914, 0 }, "\xe2\x8b\x92", 3 },
+    { "&NotEqualTilde;", { 8770, 824 }, "\xe2\x89\x82\xcc\xb8", 5 },
+    { "&colon;", { 58, 0 }, "\x3a", 1 },
+    { "&lap;", { 10885, 0 }, "\xe2\xaa\x85", 3 },
+    { "&Hacek;", { 711, 0 }, "\xcb\x87", 2 },
+    { "&lEg;", { 10891, 0 }, "\xe2\xaa\x8b", 3 },
+    { "&cirfnint;", { 10768, 0 }, "\xe2\xa8\x90", 3 },
+    { "&Tilde;", { 8764, 0 }, "\xe2\x88\xbc", 3 },
+    { "&epsiv;", { 1013, 0 }, "\xcf\xb5", 2 },
+    { "&rAtail;", { 10524, 0 }, "\xe2\xa4\x9c", 3 },
+    { "&leftrightarrow;", { 8596, 0 }, "\xe2\x86\x94", 3 },
+    { "&Xopf;", { 120143, 0 }, "\xf0\x9d\x95\x8f", 4 },
+    { "&langd;", { 10641, 0 }, "\xe2\xa6\x91", 3 },
+    { "&lgE;", { 10897, 0 }, "\xe2\xaa\x91", 3 },
+    { "&lesseqqgtr;", { 10891, 0 }, "\xe2\xaa\x8b", 3 },
+    { "&period;", { 46, 0 }, "\x2e", 1 },
+    { "&Gcy;", { 1043, 0 }, "\xd0\x93", 2 },
+    { "&para;", { 182, 0 }, "\xc2\xb6", 2 },
+    { "&zhcy;", { 1078, 0 }, "\xd0\xb6", 2 },
+    { "&npar;", { 8742, 0 }, "\xe2\x88\xa6", 3 },
+    { "&amacr;", { 257, 0 }, "\xc4\x81", 2 },
+    { "&ShortRightArrow;", { 8594, 0 }, "\xe2\x86\x92", 3 },
+    { "&scpolint;", { 10771, 0 }, "\xe2\xa8\x93", 3 },
+    { "&Iopf;", { 120128, 0 }, "\xf0\x9d\x95\x80", 4 },
+    { "&oline;", { 8254, 0 }, "\xe2\x80\xbe", 3 },
+    { "&it;", { 8290, 0 }, "\xe2\x81\xa2", 3 },
+    { "&circledcirc;", { 8858, 0 }, "\xe2\x8a\x9a", 3 },
+    { "&angzarr;", { 9084, 0 }, "\xe2\x8d\xbc", 3 },
+    { "&boxVl;", { 9570, 0 }, "\xe2\x95\xa2", 3 },
+    { "&preccurlyeq;", { 8828, 0 }, "\xe2\x89\xbc", 3 },
+    { "&digamma;", { 989, 0 }, "\xcf\x9d", 2 },
+    { "&nvDash;", { 8877, 0 }, "\xe2\x8a\xad", 3 },
+    { "&ltrie;", { 8884, 0 }, "\xe2\x8a\xb4", 3 },
+    { "&backcong;", { 8780, 0 }, "\xe2\x89\x8c", 3 },
+    { "&NegativeThickSpace;", { 8203, 0 }, "\xe2\x80\x8b", 3 },
+    { "&Lleftarrow;", { 8666, 0 }, "\xe2\x87\x9a", 3 },
+    { "&siml;", { 10909, 0 }, "\xe2\xaa\x9d", 3 },
+    { "&timesbar;", { 10801, 0 }, "\xe2\xa8\xb1", 3 },
+    { "&rightsquigarrow;", { 8605, 0 }, "\xe2\x86\x9d", 3 },
+    { "&Succeeds;", { 8827, 0 }, "\xe2\x89\xbb", 3 },
+    { "&simg;", { 10910, 0 }, "\xe2\xaa\x9e", 3 },
+    { "&awconint;", { 8755, 0 }, "\xe2\x88\xb3", 3 },
+    { "&napos;", { 329, 0 }, "\xc5\x89", 2 },
+    { "&weierp;", { 8472, 0 }, "\xe2\x84\x98", 3 },
+    { "&sqsupset;", { 8848, 0 }, "\xe2\x8a\x90", 3 },
+    { "&kfr;", { 120104, 0 }, "\xf0\x9d\x94\xa8", 4 },
+    { "&UpArrow;", { 8593, 0 }, "\xe2\x86\x91", 3 },
+    { "&mumap;", { 8888, 0 }, "\xe2\x8a\xb8", 3 },
+    { "&qopf;", { 120162, 0 }, "\xf0\x9d\x95\xa2", 4 },
+    { "&rtri;", { 9657, 0 }, "\xe2\x96\xb9", 3 },
+    { "&UpperRightArrow;", { 8599, 0 }, "\xe2\x86\x97", 3 },
+    { "&congdot;", { 10861, 0 }, "\xe2\xa9\xad", 3 },
+    { "&mnplus;", { 8723, 0 }, "\xe2\x88\x93", 3 },
+    { "&ratail;", { 10522, 0 }, "\xe2\xa4\x9a", 3 },
+    { "&sigmaf;", { 962, 0 }, "\xcf\x82", 2 },
+    { "&ocir;", { 8858, 0 }, "\xe2\x8a\x9a", 3 },
+    { "&supdot;", { 10942, 0 }, "\xe2\xaa\xbe", 3 },
+    { "&barvee;", { 8893, 0 }, "\xe2\x8a\xbd", 3 },
+    { "&mfr;", { 120106, 0 }, "\xf0\x9d\x94\xaa", 4 },
+    { "&iukcy;", { 1110, 0 }, "\xd1\x96", 2 },
+    { "&geqslant;", { 10878, 0 }, "\xe2\xa9\xbe", 3 },
+    { "&npart;", { 8706, 824 }, "\xe2\x88\x82\xcc\xb8", 5 },
+    { "&nle;", { 8816, 0 }, "\xe2\x89\xb0", 3 },
+    { "&cupdot;", { 8845, 0 }, "\xe2\x8a\x8d", 3 },
+    { "&bepsi;", { 1014, 0 }, "\xcf\xb6", 2 },
+    { "&andd;", { 10844, 0 }, "\xe2\xa9\x9c", 3 },
+    { "&ReverseEquilibrium;", { 8651, 0 }, "\xe2\x87\x8b", 3 },
+    { "&subplus;", { 10943, 0 }, "\xe2\xaa\xbf", 3 },
+    { "&ThinSpace;", { 8201, 0 }, "\xe2\x80\x89", 3 },
+    { "&Atilde;", { 195, 0 }, "\xc3\x83", 2 },
+    { "&DoubleUpDownArrow;", { 8661, 0 }, "\xe2\x87\x95", 3 },
+    { "&bigtriangleup;", { 9651, 0 }, "\xe2\x96\xb3", 3 },
+    { "&becaus;", { 8757, 0 }, "\xe2\x88\xb5", 3 },
+    { "&longmapsto;", { 10236, 0 }, "\xe2\x9f\xbc", 3 },
+    { "&Kfr;", { 120078, 0 }, "\xf0\x9d\x94\x8e", 4 },
+    { "&djcy;", { 1106, 0 }, "\xd1\x92", 2 },
+    { "&rang;", { 10217, 0 }, "\xe2\x9f\xa9", 3 },
+    { "&Subset;", { 8912, 0 }, "\xe2\x8b\x90", 3 },
+    { "&DownRightVector;", { 8641, 0 }, "\xe2\x87\x81", 3 },
+    { "&succ;", { 8827, 0 }, "\xe2\x89\xbb", 3 },
+    { "&supsetneqq;", { 10956, 0 }, "\xe2\xab\x8c", 3 },
+    { "&numero;", { 8470, 0 }, "\xe2\x84\x96", 3 },
+    { "&rtrie;", { 8885, 0 }, "\xe2\x8a\xb5", 3 },
+    { "&RightAngleBracket;", { 10217, 0 }, "\xe2\x9f\xa9", 3 },
+    { "&Nacute;", { 323, 0 }, "\xc5\x83", 2 },
+    { "&subdot;", { 10941, 0 }, "\xe2\xaa\xbd", 3 },
+    { "&Gammad;", { 988, 0 }, "\xcf\x9c", 2 },
+    { "&ShortDownArrow;", { 8595, 0 }, "\xe2\x86\x93", 3 },
+    { "&suphsol;", { 10185, 0 }, "\xe2\x9f\x89", 3 },
+    { "&nLt;", { 8810, 8402 }, "\xe2\x89\xaa\xe2\x83\x92", 6 },
+    { "&gesdoto;", { 10882, 0 }, "\xe2\xaa\x82", 3 },
+    { "&fork;", { 8916, 0 }, "\xe2\x8b\x94", 3 },
+    { "&nhArr;", { 8654, 0 }, "\xe2\x87\x8e", 3 },
+    { "&bernou;", { 8492, 0 }, "\xe2\x84\xac", 3 },
+    { "&lsqb;", { 91, 0 }, "\x5b", 1 },
+    { "&sup1;", { 185, 0 }, "\xc2\xb9", 2 },
+    { "&sharp;", { 9839, 0 }, "\xe2\x99\xaf", 3 },
+    { "&exponentiale;", { 8519, 0 }, "\xe2\x85\x87", 3 },
+    { "&rrarr;", { 8649, 0 }, "\xe2\x87\x89", 3 },
+    { "&nesim;", { 8770, 824 }, "\xe2\x89\x82\xcc\xb8", 5 },
+    { "&npreceq;", { 10927, 824 }, "\xe2\xaa\xaf\xcc\xb8", 5 },
+    { "&micro;", { 181, 0 }, "\xc2\xb5", 2 },
+    { "&lvnE;", { 8808, 65024 }, "\xe2\x89\xa8\xef\xb8\x80", 6 },
+    { "&tcaron;", { 357, 0 }, "\xc5\xa5", 2 },
+    { "&delta;", { 948, 0 }, "\xce\xb4", 2 },
+    { "&loarr;", { 8701, 0 }, "\xe2\x87\xbd", 3 },
+    { "&ncy;", { 1085, 0 }, "\xd0\xbd", 2 },
+    { "&erarr;", { 10609, 0 }, "\xe2\xa5\xb1", 3 },
+    { "&phmmat;", { 8499, 0 }, "\xe2\x84\xb3", 3 },
+    { "&xodot;", { 10752, 0 }, "\xe2\xa8\x80", 3 },
+    { "&GreaterFullEqual;", { 8807, 0 }, "\xe2\x89\xa7", 3 },
+    { "&eplus;", { 10865, 0 }, "\xe2\xa9\xb1", 3 },
+    { "&plusdu;", { 10789, 0 }, "\xe2\xa8\xa5", 3 },
+    { "&nvle;", { 8804, 8402 }, "\xe2\x89\xa4\xe2\x83\x92", 6 },
+    { "&longrightarrow;", { 10230, 0 }, "\xe2\x9f\xb6", 3 },
+    { "&andv;", { 10842, 0 }, "\xe2\xa9\x9a", 3 },
+    { "&triplus;", { 10809, 0 }, "\xe2\xa8\xb9", 3 },
+    { "&Upsi;", { 978, 0 }, "\xcf\x92", 2 },
+    { "&rsquor;", { 8217, 0 }, "\xe2\x80\x99", 3 },
+    { "&Xfr;", { 120091, 0 }, "\xf0\x9d\x94\x9b", 4 },
+    { "&Topf;", { 120139, 0 }, "\xf0\x9d\x95\x8b", 4 },
+    { "&oscr;", { 8500, 0 }, "\xe2\x84\xb4", 3 },
+    { "&lbrkslu;", { 10637, 0 }, "\xe2\xa6\x8d", 3 },
+    { "&DownArrowUpArrow;", { 8693, 0 }, "\xe2\x87\xb5", 3 },
+    { "&spades;", { 9824, 0 }, "\xe2\x99\xa0", 3 },
+    { "&natural;", { 9838, 0 }, "\xe2\x99\xae", 3 },
+    { "&bsolb;", { 10693, 0 }, "\xe2\xa7\x85", 3 },
+    { "&intcal;", { 8890, 0 }, "\xe2\x8a\xba", 3 },
+    { "&subnE;", { 10955, 0 }, "\xe2\xab\x8b", 3 },
+    { "&cemptyv;", { 10674, 0 }, "\xe2\xa6\xb2", 3 },
+    { "&lbbrk;", { 10098, 0 }, "\xe2\x9d\xb2", 3 }
 };
 
-static int
-entity_cmp(const void* p_key, const void* p_entity)
+
+/* FNV-1a hash, with the seed mixed into its initial value.
+ * (Keep this in sync with entity_hash() in scripts/build_entity_map.py.) */
+static unsigned
+entity_hash(unsigned seed, const char* name, size_t name_size)
 {
-    ENTITY_KEY* key = (ENTITY_KEY*) p_key;
-    ENTITY* ent = (ENTITY*) p_entity;
+    unsigned hash = 0x811c9dc5 ^ seed;
+    size_t i;
+
+    for(i = 0; i < name_size; i++) {
+        hash ^= (unsigned char) name[i];
+        hash *= 0x01000193;
+    }
 
-    return strncmp(key->name, ent->name, key->name_size);
+    return hash & 0xffffffff;
 }
 
 const ENTITY*
 entity_lookup(const char* name, size_t name_size)
 {
-    ENTITY_KEY key = { name, name_size };
+    unsigned seed;
+    const ENTITY* ent;
+
+    /* Find the entity's slot with the minimal perfect hash. Any other name
+     * leads to some slot as well, so we have to verify it is really there. */
+    seed = ENTITY_SEEDS[entity_hash(0, name, name_size) % ENTITY_BUCKET_COUNT];
+    ent = &ENTITY_MAP[entity_hash(seed, name, name_size) % (sizeof(ENTITY_MAP) / sizeof(ENTITY_MAP[0]))];
 
-    return bsearch(&key,
-                   ENTITY_MAP,
-                   sizeof(ENTITY_MAP) / sizeof(ENTITY_MAP[0]),
-                   sizeof(ENTITY),
-                   entity_cmp);
+    if(strncmp(ent->name, name, name_size) != 0  ||  ent->name[name_size] != '\0')
+        return NULL;
+    return ent;
 }
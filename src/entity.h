@@ -30,11 +30,16 @@
 
 
 /* Most entities are formed by single Unicode codepoint, few by two codepoints.
- * Single-codepoint entities have codepoints[1] set to zero. */
+ * Single-codepoint entities have codepoints[1] set to zero.
+ *
+ * Member utf8 is the UTF-8 encoding of the codepoint(s), utf8_size is its
+ * length in bytes. */
 typedef struct ENTITY_tag ENTITY;
 struct ENTITY_tag {
     const char* name;
     unsigned codepoints[2];
+    const char* utf8;
+    unsigned utf8_size;
 };
 
 const ENTITY* entity_lookup(const char* name, size_t name_size);
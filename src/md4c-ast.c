@@ -0,0 +1,510 @@
+/*
+ * MD4C: Markdown parser for C
+ * (https://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2026 Martin Mitáš
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "md4c-ast.h"
+#include "md4c-html.h"
+
+
+/* Details are copied into an arena which never moves anything (so the
+ * pointers stored in the nodes remain valid). Each arena block starts with
+ * this header, which also defines the alignment of all allocations in it. */
+typedef union MD_AST_ARENA_BLOCK_tag MD_AST_ARENA_BLOCK;
+union MD_AST_ARENA_BLOCK_tag {
+    MD_AST_ARENA_BLOCK* next;
+    void* align_ptr;
+    double align_double;
+    long align_long;
+};
+
+#define MD_AST_ARENA_ROUND(size)                                            \
+        (((size) + sizeof(MD_AST_ARENA_BLOCK) - 1) / sizeof(MD_AST_ARENA_BLOCK) \
+                * sizeof(MD_AST_ARENA_BLOCK))
+
+#define MD_AST_ARENA_BLOCK_SIZE     4096
+
+struct MD_AST_tag {
+    const MD_CHAR* text;
+    MD_SIZE size;
+
+    MD_AST_NODE* nodes;
+    unsigned n_nodes;
+    unsigned alloc_nodes;
+
+    /* Texts which are not in the document. */
+    MD_CHAR* strings;
+    MD_SIZE n_strings;
+    MD_SIZE alloc_strings;
+
+    MD_AST_ARENA_BLOCK* arena;
+    char* arena_ptr;
+    char* arena_end;
+
+    /* The innermost open node while recording. */
+    unsigned current;
+};
+
+
+/*******************
+ ***  Recording  ***
+ *******************/
+
+static void*
+md_ast_alloc(MD_AST* ast, size_t size)
+{
+    void* ptr;
+
+    size = MD_AST_ARENA_ROUND(size);
+    if((size_t)(ast->arena_end - ast->arena_ptr) < size) {
+        MD_AST_ARENA_BLOCK* block;
+        size_t block_size = sizeof(MD_AST_ARENA_BLOCK) + size;
+
+        if(block_size < MD_AST_ARENA_BLOCK_SIZE)
+            block_size = MD_AST_ARENA_BLOCK_SIZE;
+        block = (MD_AST_ARENA_BLOCK*) malloc(block_size);
+        if(block == NULL)
+            return NULL;
+
+        block->next = ast->arena;
+        ast->arena = block;
+        ast->arena_ptr = (char*) (block + 1);
+        ast->arena_end = (char*) block + block_size;
+    }
+
+    ptr = ast->arena_ptr;
+    ast->arena_ptr += size;
+    return ptr;
+}
+
+static int
+md_ast_copy_attribute(MD_AST* ast, MD_ATTRIBUTE* attr)
+{
+    unsigned n = 0;
+
+    if(attr->text != NULL) {
+        MD_CHAR* text;
+
+        text = (MD_CHAR*) md_ast_alloc(ast, attr->size * sizeof(MD_CHAR));
+        if(text == NULL)
+            return -1;
+        memcpy(text, attr->text, attr->size * sizeof(MD_CHAR));
+        attr->text = text;
+    }
+
+    if(attr->substr_offsets != NULL) {
+        MD_TEXTTYPE* substr_types;
+        MD_OFFSET* substr_offsets;
+
+        while(attr->substr_offsets[n] < attr->size)
+            n++;
+
+        substr_types = (MD_TEXTTYPE*) md_ast_alloc(ast, n * sizeof(MD_TEXTTYPE));
+        substr_offsets = (MD_OFFSET*) md_ast_alloc(ast, (n+1) * sizeof(MD_OFFSET));
+        if(substr_types == NULL  ||  substr_offsets == NULL)
+            return -1;
+        memcpy(substr_types, attr->substr_types, n * sizeof(MD_TEXTTYPE));
+        memcpy(substr_offsets, attr->substr_offsets, (n+1) * sizeof(MD_OFFSET));
+        attr->substr_types = substr_types;
+        attr->substr_offsets = substr_offsets;
+    }
+
+    return 0;
+}
+
+static const void*
+md_ast_copy_detail(MD_AST* ast, unsigned kind, unsigned type, const void* detail, int* p_ret)
+{
+    void* copy;
+    size_t size = 0;
+    MD_ATTRIBUTE* attrs[2] = { NULL, NULL };
+
+    *p_ret = 0;
+    if(detail == NULL)
+        return NULL;
+
+    if(kind == MD_AST_BLOCK) {
+        switch(type) {
+            case MD_BLOCK_UL:               size = sizeof(MD_BLOCK_UL_DETAIL); break;
+            case MD_BLOCK_OL:               size = sizeof(MD_BLOCK_OL_DETAIL); break;
+            case MD_BLOCK_LI:               size = sizeof(MD_BLOCK_LI_DETAIL); break;
+            case MD_BLOCK_H:                size = sizeof(MD_BLOCK_H_DETAIL); break;
+            case MD_BLOCK_CODE:             size = sizeof(MD_BLOCK_CODE_DETAIL); break;
+            case MD_BLOCK_TABLE:            size = sizeof(MD_BLOCK_TABLE_DETAIL); break;
+            case MD_BLOCK_TH:               /* Pass through. */
+            case MD_BLOCK_TD:               size = sizeof(MD_BLOCK_TD_DETAIL); break;
+            case MD_BLOCK_FOOTNOTE_DEF:     size = sizeof(MD_BLOCK_FOOTNOTE_DEF_DETAIL); break;
+            case MD_BLOCK_ADMONITION:       size = sizeof(MD_BLOCK_ADMONITION_DETAIL); break;
+            default:                        return NULL;
+        }
+    } else {
+        switch(type) {
+            case MD_SPAN_A:                 size = sizeof(MD_SPAN_A_DETAIL); break;
+            case MD_SPAN_IMG:               size = sizeof(MD_SPAN_IMG_DETAIL); break;
+            case MD_SPAN_WIKILINK:          size = sizeof(MD_SPAN_WIKILINK_DETAIL); break;
+            case MD_SPAN_FOOTNOTE_REF:      size = sizeof(MD_SPAN_FOOTNOTE_REF_DETAIL); break;
+            default:                        return NULL;
+        }
+    }
+
+    copy = md_ast_alloc(ast, size);
+    if(copy == NULL) {
+        *p_ret = -1;
+        return NULL;
+    }
+    memcpy(copy, detail, size);
+
+    if(kind == MD_AST_BLOCK) {
+        switch(type) {
+            case MD_BLOCK_CODE:
+                attrs[0] = &((MD_BLOCK_CODE_DETAIL*) copy)->info;
+                attrs[1] = &((MD_BLOCK_CODE_DETAIL*) copy)->lang;
+                break;
+            case MD_BLOCK_FOOTNOTE_DEF:
+                attrs[0] = &((MD_BLOCK_FOOTNOTE_DEF_DETAIL*) copy)->label;
+                break;
+            case MD_BLOCK_ADMONITION:
+                attrs[0] = &((MD_BLOCK_ADMONITION_DETAIL*) copy)->type;
+                break;
+        }
+    } else {
+        switch(type) {
+            case MD_SPAN_A:
+                attrs[0] = &((MD_SPAN_A_DETAIL*) copy)->href;
+                attrs[1] = &((MD_SPAN_A_DETAIL*) copy)->title;
+                break;
+            case MD_SPAN_IMG:
+                attrs[0] = &((MD_SPAN_IMG_DETAIL*) copy)->src;
+                attrs[1] = &((MD_SPAN_IMG_DETAIL*) copy)->title;
+                break;
+            case MD_SPAN_WIKILINK:
+                attrs[0] = &((MD_SPAN_WIKILINK_DETAIL*) copy)->target;
+                break;
+            case MD_SPAN_FOOTNOTE_REF:
+                attrs[0] = &((MD_SPAN_FOOTNOTE_REF_DETAIL*) copy)->label;
+                break;
+        }
+    }
+
+    if((attrs[0] != NULL  &&  md_ast_copy_attribute(ast, attrs[0]) != 0)  ||
+       (attrs[1] != NULL  &&  md_ast_copy_attribute(ast, attrs[1]) != 0))
+    {
+        *p_ret = -1;
+        return NULL;
+    }
+
+    return copy;
+}
+
+static MD_AST_NODE*
+md_ast_add_node(MD_AST* ast, unsigned kind, unsigned type)
+{
+    MD_AST_NODE* node;
+    unsigned index = ast->n_nodes;
+
+    if(ast->n_nodes >= ast->alloc_nodes) {
+        MD_AST_NODE* new_nodes;
+        unsigned new_alloc_nodes;
+
+        new_alloc_nodes = (ast->alloc_nodes > 0
+                ? ast->alloc_nodes + ast->alloc_nodes / 2
+                : 256);
+        new_nodes = (MD_AST_NODE*) realloc(ast->nodes, new_alloc_nodes * sizeof(MD_AST_NODE));
+        if(new_nodes == NULL)
+            return NULL;
+
+        ast->nodes = new_nodes;
+        ast->alloc_nodes = new_alloc_nodes;
+    }
+
+    node = &ast->nodes[index];
+    memset(node, 0, sizeof(MD_AST_NODE));
+    node->kind = (unsigned char) kind;
+    node->type = (unsigned char) type;
+    node->parent = ast->current;
+    node->end = index + 1;
+
+    if(index > 0) {
+        /* While a node is open, its member 'end' refers to its last child. */
+        MD_AST_NODE* parent = &ast->nodes[ast->current];
+
+        if(parent->first_child == 0)
+            parent->first_child = index;
+        else
+            ast->nodes[parent->end].next_sibling = index;
+        parent->end = index;
+    }
+
+    ast->n_nodes++;
+    return node;
+}
+
+static int
+md_ast_enter(MD_AST* ast, unsigned kind, unsigned type, void* detail)
+{
+    MD_AST_NODE* node;
+    const void* detail_copy;
+    int ret;
+
+    detail_copy = md_ast_copy_detail(ast, kind, type, detail, &ret);
+    if(ret != 0)
+        return ret;
+
+    node = md_ast_add_node(ast, kind, type);
+    if(node == NULL)
+        return -1;
+
+    node->u.detail = detail_copy;
+    ast->current = (unsigned) (node - ast->nodes);
+    /* No children yet. */
+    node->end = 0;
+    return 0;
+}
+
+static int
+md_ast_leave(MD_AST* ast)
+{
+    MD_AST_NODE* node = &ast->nodes[ast->current];
+
+    node->end = ast->n_nodes;
+    ast->current = node->parent;
+    return 0;
+}
+
+static int
+md_ast_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    return md_ast_enter((MD_AST*) userdata, MD_AST_BLOCK, type, detail);
+}
+
+static int
+md_ast_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) type;
+    (void) detail;
+    return md_ast_leave((MD_AST*) userdata);
+}
+
+static int
+md_ast_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    return md_ast_enter((MD_AST*) userdata, MD_AST_SPAN, type, detail);
+}
+
+static int
+md_ast_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    (void) type;
+    (void) detail;
+    return md_ast_leave((MD_AST*) userdata);
+}
+
+static int
+md_ast_text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_AST* ast = (MD_AST*) userdata;
+    MD_AST_NODE* node;
+
+    node = md_ast_add_node(ast, MD_AST_TEXT, type);
+    if(node == NULL)
+        return -1;
+
+    node->u.text.size = size;
+    if(text >= ast->text  &&  text + size <= ast->text + ast->size) {
+        node->u.text.off = (MD_OFFSET) (text - ast->text);
+        return 0;
+    }
+
+    /* The text is not in the document: Remember it. */
+    if(ast->n_strings + size > ast->alloc_strings) {
+        MD_CHAR* new_strings;
+        MD_SIZE new_alloc_strings;
+
+        new_alloc_strings = ast->n_strings + size;
+        new_alloc_strings += new_alloc_strings / 2 + 64;
+        new_strings = (MD_CHAR*) realloc(ast->strings, new_alloc_strings * sizeof(MD_CHAR));
+        if(new_strings == NULL)
+            return -1;
+
+        ast->strings = new_strings;
+        ast->alloc_strings = new_alloc_strings;
+    }
+
+    memcpy(ast->strings + ast->n_strings, text, size * sizeof(MD_CHAR));
+    node->flags |= MD_AST_NODE_FLAG_INTERNED_TEXT;
+    node->u.text.off = ast->n_strings;
+    ast->n_strings += size;
+    return 0;
+}
+
+
+/**************************
+ ***  Public interface  ***
+ **************************/
+
+MD_AST*
+md_ast_parse(const MD_CHAR* text, MD_SIZE size, unsigned parser_flags)
+{
+    MD_AST* ast;
+    MD_PARSER parser;
+
+    ast = (MD_AST*) malloc(sizeof(MD_AST));
+    if(ast == NULL)
+        return NULL;
+    memset(ast, 0, sizeof(MD_AST));
+    ast->text = text;
+    ast->size = size;
+
+    memset(&parser, 0, sizeof(MD_PARSER));
+    parser.flags = parser_flags;
+    parser.enter_block = md_ast_enter_block;
+    parser.leave_block = md_ast_leave_block;
+    parser.enter_span = md_ast_enter_span;
+    parser.leave_span = md_ast_leave_span;
+    parser.text = md_ast_text_callback;
+
+    if(md_parse(text, size, &parser, (void*) ast) != 0  ||  ast->n_nodes == 0) {
+        md_ast_free(ast);
+        return NULL;
+    }
+
+    return ast;
+}
+
+void
+md_ast_free(MD_AST* ast)
+{
+    MD_AST_ARENA_BLOCK* block = ast->arena;
+
+    while(block != NULL) {
+        MD_AST_ARENA_BLOCK* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    free(ast->nodes);
+    free(ast->strings);
+    free(ast);
+}
+
+const MD_AST_NODE*
+md_ast_nodes(const MD_AST* ast)
+{
+    return ast->nodes;
+}
+
+unsigned
+md_ast_node_count(const MD_AST* ast)
+{
+    return ast->n_nodes;
+}
+
+const MD_CHAR*
+md_ast_text(const MD_AST* ast, const MD_AST_NODE* node)
+{
+    if(node->flags & MD_AST_NODE_FLAG_INTERNED_TEXT)
+        return ast->strings + node->u.text.off;
+    else
+        return ast->text + node->u.text.off;
+}
+
+int
+md_ast_replay(const MD_AST* ast, unsigned root, const MD_PARSER* parser, void* userdata)
+{
+    const MD_AST_NODE* nodes = ast->nodes;
+    unsigned i = root;
+    int ret;
+
+    while(1) {
+        const MD_AST_NODE* node = &nodes[i];
+
+        switch(node->kind) {
+            case MD_AST_BLOCK:
+                ret = parser->enter_block((MD_BLOCKTYPE) node->type, (void*) node->u.detail, userdata);
+                break;
+            case MD_AST_SPAN:
+                ret = parser->enter_span((MD_SPANTYPE) node->type, (void*) node->u.detail, userdata);
+                break;
+            default:
+                ret = parser->text((MD_TEXTTYPE) node->type, md_ast_text(ast, node),
+                                   node->u.text.size, userdata);
+                break;
+        }
+        if(ret != 0)
+            return ret;
+
+        if(node->first_child != 0) {
+            i = node->first_child;
+            continue;
+        }
+
+        /* Leave all the nodes we are done with. */
+        while(1) {
+            node = &nodes[i];
+            if(node->kind == MD_AST_BLOCK)
+                ret = parser->leave_block((MD_BLOCKTYPE) node->type, (void*) node->u.detail, userdata);
+            else if(node->kind == MD_AST_SPAN)
+                ret = parser->leave_span((MD_SPANTYPE) node->type, (void*) node->u.detail, userdata);
+            if(ret != 0)
+                return ret;
+
+            if(i == root)
+                return 0;
+            if(node->next_sibling != 0) {
+                i = node->next_sibling;
+                break;
+            }
+            i = node->parent;
+        }
+    }
+}
+
+typedef struct MD_AST_HTML_SOURCE_tag MD_AST_HTML_SOURCE;
+struct MD_AST_HTML_SOURCE_tag {
+    const MD_AST* ast;
+    unsigned node;
+};
+
+static int
+md_ast_produce(const MD_PARSER* parser, void* parser_userdata, void* source)
+{
+    MD_AST_HTML_SOURCE* src = (MD_AST_HTML_SOURCE*) source;
+
+    return md_ast_replay(src->ast, src->node, parser, parser_userdata);
+}
+
+int
+md_ast_html(const MD_AST* ast, unsigned node,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata, unsigned renderer_flags)
+{
+    MD_AST_HTML_SOURCE src;
+
+    src.ast = ast;
+    src.node = node;
+    return md_html_render_events(md_ast_produce, (void*) &src,
+                process_output, userdata, renderer_flags);
+}
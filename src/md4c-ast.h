@@ -0,0 +1,118 @@
+/*
+ * MD4C: Markdown parser for C
+ * (https://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2026 Martin Mitáš
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MD4C_AST_H
+#define MD4C_AST_H
+
+#include "md4c.h"
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+/* MD4C-AST records the callbacks of md_parse() into a flat array of nodes so
+ * that applications which need to walk the document several times (e.g. to
+ * build a table of contents, then to render it) do not have to parse it again.
+ *
+ * The nodes are stored in the document order (i.e. every node precedes all
+ * its descendants, and the descendants of any node form a contiguous range
+ * following it). The root node (index 0) is always MD_BLOCK_DOC.
+ *
+ * Texts are not copied: They refer to the parsed document, so it has to
+ * outlive the MD_AST. Details of the blocks and spans (including all their
+ * MD_ATTRIBUTE members) are copied into memory owned by the MD_AST.
+ */
+typedef struct MD_AST_tag MD_AST;
+
+typedef enum MD_AST_NODE_KIND {
+    MD_AST_BLOCK = 0,           /* MD_AST_NODE::type is MD_BLOCKTYPE */
+    MD_AST_SPAN,                /* MD_AST_NODE::type is MD_SPANTYPE */
+    MD_AST_TEXT                 /* MD_AST_NODE::type is MD_TEXTTYPE */
+} MD_AST_NODE_KIND;
+
+/* The text is not in the parsed document but in a buffer owned by MD_AST.
+ * (Parser emits some texts which are not found in the document verbatim,
+ * e.g. indentation of code block lines.) Use md_ast_text() to get it. */
+#define MD_AST_NODE_FLAG_INTERNED_TEXT      0x0001
+
+typedef struct MD_AST_NODE {
+    unsigned char kind;         /* MD_AST_NODE_KIND */
+    unsigned char type;         /* MD_BLOCKTYPE, MD_SPANTYPE or MD_TEXTTYPE */
+    unsigned short flags;       /* Bitmask of MD_AST_NODE_FLAG_xxxx. */
+    unsigned parent;            /* Index of parent node (zero for the root). */
+    unsigned first_child;       /* Index of the first child, or zero if none. */
+    unsigned next_sibling;      /* Index of the next sibling, or zero if none. */
+    unsigned end;               /* Index following the last descendant. */
+    union {
+        const void* detail;     /* Blocks and spans: The detail structure (or NULL). */
+        struct {
+            MD_OFFSET off;      /* Texts: Offset of the text. */
+            MD_SIZE size;       /* Texts: Size of the text. */
+        } text;
+    } u;
+} MD_AST_NODE;
+
+
+/* Parse the document and record it. Param parser_flags are flags from md4c.h
+ * propagated to md_parse().
+ *
+ * Returns NULL on failure.
+ */
+MD_AST* md_ast_parse(const MD_CHAR* text, MD_SIZE size, unsigned parser_flags);
+
+/* Release the MD_AST. */
+void md_ast_free(MD_AST* ast);
+
+/* Access the array of the nodes. */
+const MD_AST_NODE* md_ast_nodes(const MD_AST* ast);
+unsigned md_ast_node_count(const MD_AST* ast);
+
+/* Get the text of a MD_AST_TEXT node (its size is MD_AST_NODE::u.text.size). */
+const MD_CHAR* md_ast_text(const MD_AST* ast, const MD_AST_NODE* node);
+
+/* Call the callbacks in parser for the node and all its descendants, in the
+ * same way as md_parse() would. (Use node zero for the whole document.)
+ * MD_PARSER::flags and MD_PARSER::debug_log are not used.
+ *
+ * Returns zero on success, or the non-zero value returned by any of the
+ * callbacks, which also stops the walk.
+ */
+int md_ast_replay(const MD_AST* ast, unsigned node, const MD_PARSER* parser, void* userdata);
+
+/* Render the node and all its descendants into HTML using MD4C-HTML.
+ * See md_html() for the meaning of the other parameters. Param renderer_flags
+ * is bitmask of MD_HTML_FLAG_xxxx.
+ */
+int md_ast_html(const MD_AST* ast, unsigned node,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata, unsigned renderer_flags);
+
+
+#ifdef __cplusplus
+    }  /* extern "C" { */
+#endif
+
+#endif  /* MD4C_AST_H */
@@ -0,0 +1,850 @@
+/*
+ * MD4C: Markdown parser for C
+ * (https://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2026 Martin Mitáš
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "md4c-evlog.h"
+
+
+/* The log starts with a header of three words:
+ *
+ *   -- MD_EVLOG_MAGIC (also detects a different byte order);
+ *   -- MD_EVLOG_VERSION;
+ *   -- sizeof(MD_CHAR), sizeof(unsigned) and sizeof(MD_TEXTTYPE) in the
+ *      lowest three bytes.
+ *
+ * Then a record follows for each callback. Its first word holds an opcode
+ * (MD_EVLOG_OP_xxxx) in the lowest byte and the block, span or text type in
+ * the upper bytes:
+ *
+ *   -- MD_EVLOG_OP_ENTER_BLOCK, MD_EVLOG_OP_ENTER_SPAN:
+ *      Count of words of the detail, followed by the detail. (The count is
+ *      zero if the detail is NULL.)
+ *
+ *   -- MD_EVLOG_OP_LEAVE_BLOCK, MD_EVLOG_OP_LEAVE_SPAN:
+ *      Distance (in words) back to the record of the corresponding enter
+ *      callback, which also provides the detail.
+ *
+ *   -- MD_EVLOG_OP_TEXT:
+ *      Size of the text, followed by the text padded to a whole word.
+ *
+ *   -- MD_EVLOG_OP_END: The log ends here.
+ *
+ * Details are stored as sequences of their members. Numbers (and characters)
+ * take a word each. MD_ATTRIBUTE takes a word with its size, a word with
+ * the count of its substrings (n), a word with MD_EVLOG_ATTR_xxxx flags,
+ * then n words of MD_ATTRIBUTE::substr_types, n+1 words of
+ * MD_ATTRIBUTE::substr_offsets and the padded text.
+ */
+
+#define MD_EVLOG_MAGIC              0x4D44344CU     /* "MD4L" */
+
+#define MD_EVLOG_OP_ENTER_BLOCK     1
+#define MD_EVLOG_OP_LEAVE_BLOCK     2
+#define MD_EVLOG_OP_ENTER_SPAN      3
+#define MD_EVLOG_OP_LEAVE_SPAN      4
+#define MD_EVLOG_OP_TEXT            5
+#define MD_EVLOG_OP_END             6
+
+#define MD_EVLOG_ATTR_HAS_TEXT      0x1
+#define MD_EVLOG_ATTR_HAS_SUBSTRS   0x2
+
+#define MD_EVLOG_HEADER_SIZE        3
+#define MD_EVLOG_SIZES              (sizeof(MD_CHAR) | (sizeof(unsigned) << 8) | (sizeof(MD_TEXTTYPE) << 16))
+
+/* Count of words needed for a text. */
+#define MD_EVLOG_TEXT_WORDS(size)   (((size_t)(size) * sizeof(MD_CHAR) + sizeof(unsigned) - 1) / sizeof(unsigned))
+
+/* Output is flushed whenever this many words are buffered. */
+#define MD_EVLOG_FLUSH_WORDS        4096
+
+
+/****************
+ ***  Writer  ***
+ ****************/
+
+struct MD_EVLOG_WRITER_tag {
+    void (*process_output)(const void*, size_t, void*);
+    void* userdata;
+
+    /* Words not yet passed to process_output(). */
+    unsigned* buffer;
+    size_t n_buffer;
+    size_t alloc_buffer;
+
+    /* Count of words already passed to process_output(). */
+    size_t n_flushed;
+
+    /* Positions of the records of the currently open blocks and spans. */
+    size_t* stack;
+    unsigned n_stack;
+    unsigned alloc_stack;
+};
+
+/* Make room for n more words in the buffer. */
+static unsigned*
+md_evlog_reserve(MD_EVLOG_WRITER* w, size_t n)
+{
+    unsigned* ptr;
+
+    if(w->n_buffer + n > w->alloc_buffer) {
+        unsigned* new_buffer;
+        size_t new_alloc_buffer;
+
+        new_alloc_buffer = w->n_buffer + n;
+        new_alloc_buffer += new_alloc_buffer / 2 + MD_EVLOG_FLUSH_WORDS;
+        new_buffer = (unsigned*) realloc(w->buffer, new_alloc_buffer * sizeof(unsigned));
+        if(new_buffer == NULL)
+            return NULL;
+
+        w->buffer = new_buffer;
+        w->alloc_buffer = new_alloc_buffer;
+    }
+
+    ptr = w->buffer + w->n_buffer;
+    w->n_buffer += n;
+    return ptr;
+}
+
+static int
+md_evlog_put(MD_EVLOG_WRITER* w, unsigned word)
+{
+    unsigned* ptr;
+
+    ptr = md_evlog_reserve(w, 1);
+    if(ptr == NULL)
+        return -1;
+    *ptr = word;
+    return 0;
+}
+
+static int
+md_evlog_put_text(MD_EVLOG_WRITER* w, const MD_CHAR* text, MD_SIZE size)
+{
+    size_t n = MD_EVLOG_TEXT_WORDS(size);
+    unsigned* ptr;
+
+    if(n == 0)
+        return 0;
+
+    ptr = md_evlog_reserve(w, n);
+    if(ptr == NULL)
+        return -1;
+    ptr[n-1] = 0;   /* Padding. */
+    memcpy(ptr, text, size * sizeof(MD_CHAR));
+    return 0;
+}
+
+static int
+md_evlog_put_attribute(MD_EVLOG_WRITER* w, const MD_ATTRIBUTE* attr)
+{
+    unsigned n = 0;
+    unsigned flags = 0;
+    unsigned* ptr;
+    unsigned i;
+
+    if(attr->text != NULL)
+        flags |= MD_EVLOG_ATTR_HAS_TEXT;
+    if(attr->substr_offsets != NULL) {
+        flags |= MD_EVLOG_ATTR_HAS_SUBSTRS;
+        while(attr->substr_offsets[n] < attr->size)
+            n++;
+    }
+
+    ptr = md_evlog_reserve(w, 3 + ((flags & MD_EVLOG_ATTR_HAS_SUBSTRS) ? 2 * (size_t) n + 1 : 0));
+    if(ptr == NULL)
+        return -1;
+    *ptr++ = attr->size;
+    *ptr++ = n;
+    *ptr++ = flags;
+    if(flags & MD_EVLOG_ATTR_HAS_SUBSTRS) {
+        for(i = 0; i < n; i++)
+            *ptr++ = (unsigned) attr->substr_types[i];
+        for(i = 0; i <= n; i++)
+            *ptr++ = attr->substr_offsets[i];
+    }
+
+    if(flags & MD_EVLOG_ATTR_HAS_TEXT)
+        return md_evlog_put_text(w, attr->text, attr->size);
+    return 0;
+}
+
+static int
+md_evlog_put_block_detail(MD_EVLOG_WRITER* w, MD_BLOCKTYPE type, const void* detail)
+{
+    switch(type) {
+        case MD_BLOCK_UL:
+        {
+            const MD_BLOCK_UL_DETAIL* d = (const MD_BLOCK_UL_DETAIL*) detail;
+            if(md_evlog_put(w, (unsigned) d->is_tight) != 0  ||
+               md_evlog_put(w, (unsigned) d->mark) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_OL:
+        {
+            const MD_BLOCK_OL_DETAIL* d = (const MD_BLOCK_OL_DETAIL*) detail;
+            if(md_evlog_put(w, d->start) != 0  ||
+               md_evlog_put(w, (unsigned) d->is_tight) != 0  ||
+               md_evlog_put(w, (unsigned) d->mark_delimiter) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_LI:
+        {
+            const MD_BLOCK_LI_DETAIL* d = (const MD_BLOCK_LI_DETAIL*) detail;
+            if(md_evlog_put(w, (unsigned) d->is_task) != 0  ||
+               md_evlog_put(w, (unsigned) d->task_mark) != 0  ||
+               md_evlog_put(w, d->task_mark_offset) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_H:
+        {
+            const MD_BLOCK_H_DETAIL* d = (const MD_BLOCK_H_DETAIL*) detail;
+            if(md_evlog_put(w, d->level) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_CODE:
+        {
+            const MD_BLOCK_CODE_DETAIL* d = (const MD_BLOCK_CODE_DETAIL*) detail;
+            if(md_evlog_put_attribute(w, &d->info) != 0  ||
+               md_evlog_put_attribute(w, &d->lang) != 0  ||
+               md_evlog_put(w, (unsigned) d->fence_char) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_TABLE:
+        {
+            const MD_BLOCK_TABLE_DETAIL* d = (const MD_BLOCK_TABLE_DETAIL*) detail;
+            if(md_evlog_put(w, d->col_count) != 0  ||
+               md_evlog_put(w, d->head_row_count) != 0  ||
+               md_evlog_put(w, d->body_row_count) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_TH:
+        case MD_BLOCK_TD:
+        {
+            const MD_BLOCK_TD_DETAIL* d = (const MD_BLOCK_TD_DETAIL*) detail;
+            if(md_evlog_put(w, (unsigned) d->align) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_FOOTNOTE_DEF:
+        {
+            const MD_BLOCK_FOOTNOTE_DEF_DETAIL* d = (const MD_BLOCK_FOOTNOTE_DEF_DETAIL*) detail;
+            if(md_evlog_put(w, d->id) != 0  ||
+               md_evlog_put(w, d->ref_count) != 0  ||
+               md_evlog_put_attribute(w, &d->label) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_BLOCK_ADMONITION:
+        {
+            const MD_BLOCK_ADMONITION_DETAIL* d = (const MD_BLOCK_ADMONITION_DETAIL*) detail;
+            if(md_evlog_put_attribute(w, &d->type) != 0)
+                return -1;
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+static int
+md_evlog_put_span_detail(MD_EVLOG_WRITER* w, MD_SPANTYPE type, const void* detail)
+{
+    switch(type) {
+        case MD_SPAN_A:
+        {
+            const MD_SPAN_A_DETAIL* d = (const MD_SPAN_A_DETAIL*) detail;
+            if(md_evlog_put_attribute(w, &d->href) != 0  ||
+               md_evlog_put_attribute(w, &d->title) != 0  ||
+               md_evlog_put(w, (unsigned) d->is_autolink) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_SPAN_IMG:
+        {
+            const MD_SPAN_IMG_DETAIL* d = (const MD_SPAN_IMG_DETAIL*) detail;
+            if(md_evlog_put_attribute(w, &d->src) != 0  ||
+               md_evlog_put_attribute(w, &d->title) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_SPAN_WIKILINK:
+        {
+            const MD_SPAN_WIKILINK_DETAIL* d = (const MD_SPAN_WIKILINK_DETAIL*) detail;
+            if(md_evlog_put_attribute(w, &d->target) != 0)
+                return -1;
+            break;
+        }
+
+        case MD_SPAN_FOOTNOTE_REF:
+        {
+            const MD_SPAN_FOOTNOTE_REF_DETAIL* d = (const MD_SPAN_FOOTNOTE_REF_DETAIL*) detail;
+            if(md_evlog_put(w, d->id) != 0  ||
+               md_evlog_put(w, d->ref_id) != 0  ||
+               md_evlog_put_attribute(w, &d->label) != 0)
+                return -1;
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+static void
+md_evlog_flush(MD_EVLOG_WRITER* w)
+{
+    if(w->n_buffer > 0) {
+        w->process_output(w->buffer, w->n_buffer * sizeof(unsigned), w->userdata);
+        w->n_flushed += w->n_buffer;
+        w->n_buffer = 0;
+    }
+}
+
+static int
+md_evlog_enter(MD_EVLOG_WRITER* w, unsigned op, unsigned type, const void* detail)
+{
+    size_t record_pos = w->n_flushed + w->n_buffer;
+    size_t size_index;
+    int ret;
+
+    if(w->n_stack >= w->alloc_stack) {
+        size_t* new_stack;
+        unsigned new_alloc_stack;
+
+        new_alloc_stack = (w->alloc_stack > 0
+                ? w->alloc_stack + w->alloc_stack / 2
+                : 64);
+        new_stack = (size_t*) realloc(w->stack, new_alloc_stack * sizeof(size_t));
+        if(new_stack == NULL)
+            return -1;
+
+        w->stack = new_stack;
+        w->alloc_stack = new_alloc_stack;
+    }
+
+    if(md_evlog_put(w, op | (type << 8)) != 0  ||  md_evlog_put(w, 0) != 0)
+        return -1;
+    size_index = w->n_buffer - 1;
+
+    if(detail != NULL) {
+        if(op == MD_EVLOG_OP_ENTER_BLOCK)
+            ret = md_evlog_put_block_detail(w, (MD_BLOCKTYPE) type, detail);
+        else
+            ret = md_evlog_put_span_detail(w, (MD_SPANTYPE) type, detail);
+        if(ret != 0)
+            return ret;
+        w->buffer[size_index] = (unsigned) (w->n_buffer - size_index - 1);
+    }
+
+    w->stack[w->n_stack++] = record_pos;
+    return 0;
+}
+
+static int
+md_evlog_leave(MD_EVLOG_WRITER* w, unsigned op, unsigned type)
+{
+    size_t record_pos = w->n_flushed + w->n_buffer;
+
+    if(w->n_stack == 0)
+        return -1;
+    w->n_stack--;
+
+    if(md_evlog_put(w, op | (type << 8)) != 0  ||
+       md_evlog_put(w, (unsigned) (record_pos - w->stack[w->n_stack])) != 0)
+        return -1;
+
+    if(w->n_buffer >= MD_EVLOG_FLUSH_WORDS)
+        md_evlog_flush(w);
+    return 0;
+}
+
+static int
+md_evlog_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    return md_evlog_enter((MD_EVLOG_WRITER*) userdata, MD_EVLOG_OP_ENTER_BLOCK, type, detail);
+}
+
+static int
+md_evlog_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) detail;
+    return md_evlog_leave((MD_EVLOG_WRITER*) userdata, MD_EVLOG_OP_LEAVE_BLOCK, type);
+}
+
+static int
+md_evlog_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    return md_evlog_enter((MD_EVLOG_WRITER*) userdata, MD_EVLOG_OP_ENTER_SPAN, type, detail);
+}
+
+static int
+md_evlog_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    (void) detail;
+    return md_evlog_leave((MD_EVLOG_WRITER*) userdata, MD_EVLOG_OP_LEAVE_SPAN, type);
+}
+
+static int
+md_evlog_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_EVLOG_WRITER* w = (MD_EVLOG_WRITER*) userdata;
+
+    if(md_evlog_put(w, MD_EVLOG_OP_TEXT | ((unsigned) type << 8)) != 0  ||
+       md_evlog_put(w, size) != 0  ||
+       md_evlog_put_text(w, text, size) != 0)
+        return -1;
+
+    if(w->n_buffer >= MD_EVLOG_FLUSH_WORDS)
+        md_evlog_flush(w);
+    return 0;
+}
+
+MD_EVLOG_WRITER*
+md_evlog_writer_create(void (*process_output)(const void*, size_t, void*), void* userdata)
+{
+    MD_EVLOG_WRITER* w;
+
+    w = (MD_EVLOG_WRITER*) malloc(sizeof(MD_EVLOG_WRITER));
+    if(w == NULL)
+        return NULL;
+
+    memset(w, 0, sizeof(MD_EVLOG_WRITER));
+    w->process_output = process_output;
+    w->userdata = userdata;
+
+    if(md_evlog_put(w, MD_EVLOG_MAGIC) != 0  ||
+       md_evlog_put(w, MD_EVLOG_VERSION) != 0  ||
+       md_evlog_put(w, (unsigned) MD_EVLOG_SIZES) != 0)
+    {
+        md_evlog_writer_destroy(w);
+        return NULL;
+    }
+
+    return w;
+}
+
+void
+md_evlog_writer_init_parser(MD_PARSER* parser)
+{
+    memset(parser, 0, sizeof(MD_PARSER));
+    parser->enter_block = md_evlog_enter_block;
+    parser->leave_block = md_evlog_leave_block;
+    parser->enter_span = md_evlog_enter_span;
+    parser->leave_span = md_evlog_leave_span;
+    parser->text = md_evlog_text;
+}
+
+int
+md_evlog_writer_finish(MD_EVLOG_WRITER* w)
+{
+    if(md_evlog_put(w, MD_EVLOG_OP_END) != 0)
+        return -1;
+
+    md_evlog_flush(w);
+    return 0;
+}
+
+void
+md_evlog_writer_destroy(MD_EVLOG_WRITER* w)
+{
+    free(w->buffer);
+    free(w->stack);
+    free(w);
+}
+
+int
+md_evlog_write(const MD_CHAR* text, MD_SIZE size, unsigned parser_flags,
+            void (*process_output)(const void*, size_t, void*), void* userdata)
+{
+    MD_EVLOG_WRITER* w;
+    MD_PARSER parser;
+    int ret;
+
+    w = md_evlog_writer_create(process_output, userdata);
+    if(w == NULL)
+        return -1;
+
+    md_evlog_writer_init_parser(&parser);
+    parser.flags = parser_flags;
+
+    ret = md_parse(text, size, &parser, (void*) w);
+    if(ret == 0)
+        ret = md_evlog_writer_finish(w);
+
+    md_evlog_writer_destroy(w);
+    return ret;
+}
+
+
+/******************
+ ***  Replayer  ***
+ ******************/
+
+typedef struct MD_EVLOG_READER_tag MD_EVLOG_READER;
+struct MD_EVLOG_READER_tag {
+    const unsigned* ptr;
+    const unsigned* end;
+};
+
+typedef union MD_EVLOG_DETAIL_tag MD_EVLOG_DETAIL;
+union MD_EVLOG_DETAIL_tag {
+    MD_BLOCK_UL_DETAIL ul;
+    MD_BLOCK_OL_DETAIL ol;
+    MD_BLOCK_LI_DETAIL li;
+    MD_BLOCK_H_DETAIL h;
+    MD_BLOCK_CODE_DETAIL code;
+    MD_BLOCK_TABLE_DETAIL table;
+    MD_BLOCK_TD_DETAIL td;
+    MD_BLOCK_FOOTNOTE_DEF_DETAIL footnote_def;
+    MD_BLOCK_ADMONITION_DETAIL admonition;
+    MD_SPAN_A_DETAIL a;
+    MD_SPAN_IMG_DETAIL img;
+    MD_SPAN_WIKILINK_DETAIL wikilink;
+    MD_SPAN_FOOTNOTE_REF_DETAIL footnote_ref;
+};
+
+static const MD_TEXTTYPE md_evlog_empty_substr_types[1] = { MD_TEXT_NORMAL };
+static const MD_OFFSET md_evlog_empty_substr_offsets[1] = { 0 };
+
+/* The get functions return non-zero if the detail is truncated (or broken
+ * in any other way). */
+static int
+md_evlog_get(MD_EVLOG_READER* r, unsigned* p_word)
+{
+    if(r->ptr >= r->end)
+        return -1;
+    *p_word = *r->ptr++;
+    return 0;
+}
+
+static int
+md_evlog_get_attribute(MD_EVLOG_READER* r, MD_ATTRIBUTE* attr)
+{
+    unsigned n, flags;
+
+    if(md_evlog_get(r, &attr->size) != 0  ||
+       md_evlog_get(r, &n) != 0  ||
+       md_evlog_get(r, &flags) != 0)
+        return -1;
+
+    /* Renderers rely on the attribute invariants, so make sure a broken log
+     * cannot break them. (An attribute which had no substrings at all, e.g.
+     * an unused one in a zeroed detail, gets an empty list of them.) */
+    if(attr->size > 0  &&  (flags & (MD_EVLOG_ATTR_HAS_TEXT | MD_EVLOG_ATTR_HAS_SUBSTRS))
+                != (MD_EVLOG_ATTR_HAS_TEXT | MD_EVLOG_ATTR_HAS_SUBSTRS))
+        return -1;
+
+    attr->substr_types = md_evlog_empty_substr_types;
+    attr->substr_offsets = md_evlog_empty_substr_offsets;
+    if(flags & MD_EVLOG_ATTR_HAS_SUBSTRS) {
+        const unsigned* offsets;
+        unsigned i;
+
+        if((size_t)(r->end - r->ptr) < 2 * (size_t) n + 1)
+            return -1;
+
+        offsets = r->ptr + n;
+        if(offsets[0] != 0  ||  offsets[n] != attr->size)
+            return -1;
+        for(i = 0; i < n; i++) {
+            if(offsets[i] > offsets[i+1])
+                return -1;
+        }
+
+        attr->substr_types = (const MD_TEXTTYPE*) r->ptr;
+        attr->substr_offsets = (const MD_OFFSET*) offsets;
+        r->ptr += 2 * (size_t) n + 1;
+    }
+
+    attr->text = NULL;
+    if(flags & MD_EVLOG_ATTR_HAS_TEXT) {
+        size_t n_words = MD_EVLOG_TEXT_WORDS(attr->size);
+
+        if((size_t)(r->end - r->ptr) < n_words)
+            return -1;
+        attr->text = (const MD_CHAR*) r->ptr;
+        r->ptr += n_words;
+    }
+
+    return 0;
+}
+
+static int
+md_evlog_get_block_detail(MD_EVLOG_READER* r, MD_BLOCKTYPE type, MD_EVLOG_DETAIL* d, void** p_detail)
+{
+    unsigned tmp[3];
+
+    memset(d, 0, sizeof(MD_EVLOG_DETAIL));
+    *p_detail = (void*) d;
+
+    switch(type) {
+        case MD_BLOCK_UL:
+            if(md_evlog_get(r, &tmp[0]) != 0  ||  md_evlog_get(r, &tmp[1]) != 0)
+                return -1;
+            d->ul.is_tight = (int) tmp[0];
+            d->ul.mark = (MD_CHAR) tmp[1];
+            break;
+
+        case MD_BLOCK_OL:
+            if(md_evlog_get(r, &d->ol.start) != 0  ||
+               md_evlog_get(r, &tmp[0]) != 0  ||  md_evlog_get(r, &tmp[1]) != 0)
+                return -1;
+            d->ol.is_tight = (int) tmp[0];
+            d->ol.mark_delimiter = (MD_CHAR) tmp[1];
+            break;
+
+        case MD_BLOCK_LI:
+            if(md_evlog_get(r, &tmp[0]) != 0  ||  md_evlog_get(r, &tmp[1]) != 0  ||
+               md_evlog_get(r, &d->li.task_mark_offset) != 0)
+                return -1;
+            d->li.is_task = (int) tmp[0];
+            d->li.task_mark = (MD_CHAR) tmp[1];
+            break;
+
+        case MD_BLOCK_H:
+            if(md_evlog_get(r, &d->h.level) != 0  ||  d->h.level < 1  ||  d->h.level > 6)
+                return -1;
+            break;
+
+        case MD_BLOCK_CODE:
+            if(md_evlog_get_attribute(r, &d->code.info) != 0  ||
+               md_evlog_get_attribute(r, &d->code.lang) != 0  ||
+               md_evlog_get(r, &tmp[0]) != 0)
+                return -1;
+            d->code.fence_char = (MD_CHAR) tmp[0];
+            break;
+
+        case MD_BLOCK_TABLE:
+            if(md_evlog_get(r, &d->table.col_count) != 0  ||
+               md_evlog_get(r, &d->table.head_row_count) != 0  ||
+               md_evlog_get(r, &d->table.body_row_count) != 0)
+                return -1;
+            break;
+
+        case MD_BLOCK_TH:
+        case MD_BLOCK_TD:
+            if(md_evlog_get(r, &tmp[0]) != 0)
+                return -1;
+            d->td.align = (MD_ALIGN) tmp[0];
+            break;
+
+        case MD_BLOCK_FOOTNOTE_DEF:
+            if(md_evlog_get(r, &d->footnote_def.id) != 0  ||
+               md_evlog_get(r, &d->footnote_def.ref_count) != 0  ||
+               md_evlog_get_attribute(r, &d->footnote_def.label) != 0)
+                return -1;
+            break;
+
+        case MD_BLOCK_ADMONITION:
+            if(md_evlog_get_attribute(r, &d->admonition.type) != 0)
+                return -1;
+            break;
+
+        default:
+            *p_detail = NULL;
+            break;
+    }
+
+    return 0;
+}
+
+static int
+md_evlog_get_span_detail(MD_EVLOG_READER* r, MD_SPANTYPE type, MD_EVLOG_DETAIL* d, void** p_detail)
+{
+    unsigned tmp;
+
+    memset(d, 0, sizeof(MD_EVLOG_DETAIL));
+    *p_detail = (void*) d;
+
+    switch(type) {
+        case MD_SPAN_A:
+            if(md_evlog_get_attribute(r, &d->a.href) != 0  ||
+               md_evlog_get_attribute(r, &d->a.title) != 0  ||
+               md_evlog_get(r, &tmp) != 0)
+                return -1;
+            d->a.is_autolink = (int) tmp;
+            break;
+
+        case MD_SPAN_IMG:
+            if(md_evlog_get_attribute(r, &d->img.src) != 0  ||
+               md_evlog_get_attribute(r, &d->img.title) != 0)
+                return -1;
+            break;
+
+        case MD_SPAN_WIKILINK:
+            if(md_evlog_get_attribute(r, &d->wikilink.target) != 0)
+                return -1;
+            break;
+
+        case MD_SPAN_FOOTNOTE_REF:
+            if(md_evlog_get(r, &d->footnote_ref.id) != 0  ||
+               md_evlog_get(r, &d->footnote_ref.ref_id) != 0  ||
+               md_evlog_get_attribute(r, &d->footnote_ref.label) != 0)
+                return -1;
+            break;
+
+        default:
+            *p_detail = NULL;
+            break;
+    }
+
+    return 0;
+}
+
+/* Decode the detail of the enter record at ptr. Sets *p_detail to NULL if
+ * the block or span type has no detail. */
+static int
+md_evlog_get_detail(const unsigned* ptr, const unsigned* end, MD_EVLOG_DETAIL* d, void** p_detail)
+{
+    unsigned op = ptr[0] & 0xff;
+    unsigned type = ptr[0] >> 8;
+    MD_EVLOG_READER r;
+    int ret;
+
+    if((size_t)(end - ptr) < 2  ||  (size_t)(end - ptr - 2) < ptr[1])
+        return -1;
+
+    r.ptr = ptr + 2;
+    r.end = ptr + 2 + ptr[1];
+    if(op == MD_EVLOG_OP_ENTER_BLOCK)
+        ret = md_evlog_get_block_detail(&r, (MD_BLOCKTYPE) type, d, p_detail);
+    else
+        ret = md_evlog_get_span_detail(&r, (MD_SPANTYPE) type, d, p_detail);
+    if(ret != 0)
+        return ret;
+
+    /* All the detail has to be used. */
+    if(r.ptr != r.end)
+        return -1;
+    return 0;
+}
+
+int
+md_evlog_replay(const void* log, size_t log_size, const MD_PARSER* parser, void* userdata)
+{
+    const unsigned* begin = (const unsigned*) log;
+    const unsigned* end = begin + log_size / sizeof(unsigned);
+    const unsigned* ptr = begin + MD_EVLOG_HEADER_SIZE;
+    MD_EVLOG_DETAIL d;
+    void* detail;
+    int ret;
+
+    if((size_t)(end - begin) < MD_EVLOG_HEADER_SIZE  ||
+       begin[0] != MD_EVLOG_MAGIC  ||  begin[1] != MD_EVLOG_VERSION  ||
+       begin[2] != (unsigned) MD_EVLOG_SIZES  ||
+       sizeof(MD_TEXTTYPE) != sizeof(unsigned)  ||  sizeof(MD_OFFSET) != sizeof(unsigned))
+        return -1;
+
+    while(ptr < end) {
+        unsigned op = ptr[0] & 0xff;
+        unsigned type = ptr[0] >> 8;
+
+        switch(op) {
+            case MD_EVLOG_OP_ENTER_BLOCK:
+            case MD_EVLOG_OP_ENTER_SPAN:
+                if(md_evlog_get_detail(ptr, end, &d, &detail) != 0)
+                    return -1;
+                if(op == MD_EVLOG_OP_ENTER_BLOCK)
+                    ret = parser->enter_block((MD_BLOCKTYPE) type, detail, userdata);
+                else
+                    ret = parser->enter_span((MD_SPANTYPE) type, detail, userdata);
+                if(ret != 0)
+                    return ret;
+                ptr += 2 + ptr[1];
+                break;
+
+            case MD_EVLOG_OP_LEAVE_BLOCK:
+            case MD_EVLOG_OP_LEAVE_SPAN:
+            {
+                const unsigned* enter;
+
+                if((size_t)(end - ptr) < 2  ||
+                   ptr[1] > (size_t)(ptr - begin - MD_EVLOG_HEADER_SIZE))
+                    return -1;
+                enter = ptr - ptr[1];
+                if(enter[0] != ((op - 1) | (type << 8)))
+                    return -1;
+                if(md_evlog_get_detail(enter, end, &d, &detail) != 0)
+                    return -1;
+                if(op == MD_EVLOG_OP_LEAVE_BLOCK)
+                    ret = parser->leave_block((MD_BLOCKTYPE) type, detail, userdata);
+                else
+                    ret = parser->leave_span((MD_SPANTYPE) type, detail, userdata);
+                if(ret != 0)
+                    return ret;
+                ptr += 2;
+                break;
+            }
+
+            case MD_EVLOG_OP_TEXT:
+            {
+                size_t n_words;
+
+                if((size_t)(end - ptr) < 2)
+                    return -1;
+                n_words = MD_EVLOG_TEXT_WORDS(ptr[1]);
+                if((size_t)(end - ptr - 2) < n_words)
+                    return -1;
+                ret = parser->text((MD_TEXTTYPE) type, (const MD_CHAR*) (ptr + 2), ptr[1], userdata);
+                if(ret != 0)
+                    return ret;
+                ptr += 2 + n_words;
+                break;
+            }
+
+            case MD_EVLOG_OP_END:
+                return 0;
+
+            default:
+                return -1;
+        }
+    }
+
+    /* Truncated log. */
+    return -1;
+}
@@ -0,0 +1,96 @@
+/*
+ * MD4C: Markdown parser for C
+ * (https://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2026 Martin Mitáš
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MD4C_EVLOG_H
+#define MD4C_EVLOG_H
+
+#include <stddef.h>
+
+#include "md4c.h"
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+/* MD4C-EVLOG serializes the stream of MD_PARSER callbacks (including all the
+ * details and their attributes) into a compact binary "event log", and it
+ * replays such log into any MD_PARSER callbacks. This allows to cache the
+ * parsed document (e.g. on disk) and to render it many times, possibly in
+ * many ways, without parsing it again.
+ *
+ * The log does not refer to the parsed document nor to any memory address,
+ * so it can be stored anywhere. It consists of 32-bit words in the native
+ * byte order (the replaying fails for logs written on a machine with a
+ * different byte order or MD_CHAR size), so the replaying can use a log
+ * mapped into memory (e.g. by mmap()) directly, without copying anything.
+ * The log has to be aligned to 4 bytes in memory.
+ */
+
+/* Version of the format. Logs of other versions are rejected. */
+#define MD_EVLOG_VERSION        1
+
+
+/* Parse the document and write its log. Param parser_flags are flags from
+ * md4c.h propagated to md_parse(). Callback process_output() gets called with
+ * chunks of the log.
+ *
+ * Returns -1 on error, 0 on success.
+ */
+int md_evlog_write(const MD_CHAR* text, MD_SIZE size, unsigned parser_flags,
+            void (*process_output)(const void*, size_t, void*), void* userdata);
+
+/* Lower level interface for writing a log of callbacks from another source
+ * than md_evlog_write() (e.g. md_parse() with custom MD_PARSER settings).
+ *
+ * md_evlog_writer_create() returns NULL on failure. md_evlog_writer_init_parser()
+ * sets the callbacks in the MD_PARSER; pass the writer as userdata to them.
+ * md_evlog_writer_finish() terminates the log and outputs the rest of it.
+ * (Do not call it if any callback failed.) md_evlog_writer_destroy() releases
+ * the writer.
+ */
+typedef struct MD_EVLOG_WRITER_tag MD_EVLOG_WRITER;
+
+MD_EVLOG_WRITER* md_evlog_writer_create(void (*process_output)(const void*, size_t, void*), void* userdata);
+void md_evlog_writer_init_parser(MD_PARSER* parser);
+int md_evlog_writer_finish(MD_EVLOG_WRITER* writer);
+void md_evlog_writer_destroy(MD_EVLOG_WRITER* writer);
+
+/* Call the callbacks in parser for the whole log, in the same way as
+ * md_parse() did. The text and the details passed to the callbacks point into
+ * the log. MD_PARSER::flags and MD_PARSER::debug_log are not used.
+ *
+ * Returns zero on success, -1 if the log is not valid (or incompatible), or
+ * the non-zero value returned by any of the callbacks, which also stops the
+ * replaying.
+ */
+int md_evlog_replay(const void* log, size_t log_size, const MD_PARSER* parser, void* userdata);
+
+
+#ifdef __cplusplus
+    }  /* extern "C" { */
+#endif
+
+#endif  /* MD4C_EVLOG_H */
@@ -24,10 +24,12 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "md4c-html.h"
 #include "entity.h"
+#include "md4c-simd.h"
 
 
 #if !defined(__STDC_VERSION__) || __STDC_VERSION__ < 199409L
@@ -45,6 +47,15 @@
     #define snprintf _snprintf
 #endif
 
+/* Default size (in MD_CHAR units) of the buffer collecting the output, so that
+ * process_output() gets called with large chunks of it rather than with each
+ * tag and each piece of text. (See md_html_ex() for setting it at run time.) */
+#ifndef MD_HTML_OUTPUT_BUFFER_SIZE
+    #define MD_HTML_OUTPUT_BUFFER_SIZE      4096
+#endif
+
+/* Buffers up to this size live on the stack (or in MD_HTML_SESSION). */
+#define MD_HTML_LOCAL_BUFFER_SIZE   (MD_HTML_OUTPUT_BUFFER_SIZE > 0 ? MD_HTML_OUTPUT_BUFFER_SIZE : 1)
 
 
 typedef struct MD_HTML_tag MD_HTML;
@@ -52,13 +63,39 @@ struct MD_HTML_tag {
     void (*process_output)(const MD_CHAR*, MD_SIZE, void*);
     void* userdata;
     unsigned flags;
+
+    /* Output collected for process_output(). (If output_buffer_size is zero,
+     * there is no buffer and the output goes directly to the callback.)
+     *
+     * If process_output is NULL, the buffer is the final destination of the
+     * output (see md_html_to_buffer()): It then either grows as needed, or the
+     * output which does not fit in is only counted in output_dropped. */
+    MD_CHAR* output_buffer;
+    MD_SIZE output_buffer_size;
+    MD_SIZE output_buffer_used;
+    MD_SIZE output_dropped;
+    int output_buffer_growable;
+    int output_error;
+
     int image_nesting_level;
     char escape_map[256];
+
+    /* Find the next char which needs the given escaping. (See skip_unescaped().) */
+    MD_OFFSET (*skip_unescaped)(MD_HTML* /*r*/, unsigned /*esc_flag*/,
+                                const MD_CHAR* /*data*/, MD_OFFSET /*off*/, MD_SIZE /*size*/);
+#ifdef MD_X86_SIMD
+    /* escape_map[] in a form suitable for the SIMD lookup: For each escaping
+     * flag and each low nibble, a bitmask of high nibbles (up to 7) forming
+     * a char which needs the escaping. Chars >= 0x80 are handled separately. */
+    unsigned char escape_nibble_map[2][16];
+#endif
 };
 
 #define NEED_HTML_ESC_FLAG   0x1
 #define NEED_URL_ESC_FLAG    0x2
 
+#define ESC_FLAG_INDEX(esc_flag)    ((esc_flag) == NEED_HTML_ESC_FLAG ? 0 : 1)
+
 
 /*****************************************
  ***  HTML rendering helper functions  ***
@@ -70,10 +107,83 @@ struct MD_HTML_tag {
 #define ISALNUM(ch)     (ISLOWER(ch) || ISUPPER(ch) || ISDIGIT(ch))
 
 
+static void
+render_flush(MD_HTML* r)
+{
+    if(r->output_buffer_used > 0) {
+        r->process_output(r->output_buffer, r->output_buffer_used, r->userdata);
+        r->output_buffer_used = 0;
+    }
+}
+
+/* Grow the (growable) output buffer to accommodate more n chars. Note we keep
+ * one char in reserve for the string terminator. */
+static int
+render_grow_buffer(MD_HTML* r, MD_SIZE n)
+{
+    MD_CHAR* new_buffer;
+    MD_SIZE new_size;
+
+    if(n > (MD_SIZE)(-1) - 1 - r->output_buffer_used)
+        return -1;
+
+    new_size = r->output_buffer_size + r->output_buffer_size / 2;
+    if(new_size < r->output_buffer_size  ||  new_size > (MD_SIZE)(-1) - 1)
+        new_size = (MD_SIZE)(-1) - 1;
+    if(new_size < r->output_buffer_used + n)
+        new_size = r->output_buffer_used + n;
+
+    new_buffer = (MD_CHAR*) realloc(r->output_buffer, (new_size + 1) * sizeof(MD_CHAR));
+    if(new_buffer == NULL)
+        return -1;
+
+    r->output_buffer = new_buffer;
+    r->output_buffer_size = new_size;
+    return 0;
+}
+
+/* Slow path of render_verbatim(), for output which does not fit into the
+ * remaining space of the output buffer. */
+static void
+render_verbatim_overflow(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    if(r->process_output != NULL) {
+        render_flush(r);
+
+        /* Pieces too large for the buffer go directly to the output. */
+        if(size >= r->output_buffer_size) {
+            r->process_output(text, size, r->userdata);
+            return;
+        }
+    } else if(!r->output_buffer_growable  ||  r->output_error  ||  render_grow_buffer(r, size) != 0) {
+        MD_SIZE n = r->output_buffer_size - r->output_buffer_used;
+
+        /* Keep what fits in and count the rest. */
+        memcpy(r->output_buffer + r->output_buffer_used, text, n * sizeof(MD_CHAR));
+        r->output_buffer_used += n;
+        if(size - n > (MD_SIZE)(-1) - r->output_dropped)
+            r->output_error = 1;
+        else
+            r->output_dropped += size - n;
+        if(r->output_buffer_growable)
+            r->output_error = 1;
+        return;
+    }
+
+    memcpy(r->output_buffer + r->output_buffer_used, text, size * sizeof(MD_CHAR));
+    r->output_buffer_used += size;
+}
+
 static inline void
 render_verbatim(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
 {
-    r->process_output(text, size, r->userdata);
+    if(r->output_buffer_size - r->output_buffer_used < size) {
+        render_verbatim_overflow(r, text, size);
+        return;
+    }
+
+    memcpy(r->output_buffer + r->output_buffer_used, text, size * sizeof(MD_CHAR));
+    r->output_buffer_used += size;
 }
 
 /* Keep this as a macro. Most compiler should then be smart enough to replace
@@ -82,23 +192,128 @@ render_verbatim(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
         render_verbatim((r), (verbatim), (MD_SIZE) (strlen(verbatim)))
 
 
+/* Some characters need to be escaped in normal HTML text or in URL attributes. */
+#define NEED_ESC(ch, esc_flag)  (r->escape_map[(unsigned char)(ch)] & (esc_flag))
+
+static MD_OFFSET
+skip_unescaped_scalar(MD_HTML* r, unsigned esc_flag, const MD_CHAR* data, MD_OFFSET off, MD_SIZE size)
+{
+    /* Optimization: Use some loop unrolling. */
+    while(off + 3 < size  &&  !NEED_ESC(data[off+0], esc_flag)  &&  !NEED_ESC(data[off+1], esc_flag)
+                          &&  !NEED_ESC(data[off+2], esc_flag)  &&  !NEED_ESC(data[off+3], esc_flag))
+        off += 4;
+    while(off < size  &&  !NEED_ESC(data[off], esc_flag))
+        off++;
+    return off;
+}
+
+#ifdef MD_X86_SIMD
+/* The SIMD variants classify whole vectors of chars with the "nibble lookup"
+ * (two PSHUFB lookups, see escape_nibble_map[]). Chars >= 0x80 get zero from
+ * the second lookup; if they need the escaping, the sign bits of the input
+ * vector are added to the result. */
+
+MD_TARGET("ssse3") static MD_OFFSET
+skip_unescaped_ssse3(MD_HTML* r, unsigned esc_flag, const MD_CHAR* data, MD_OFFSET off, MD_SIZE size)
+{
+    const __m128i lo_map = _mm_loadu_si128((const __m128i*) r->escape_nibble_map[ESC_FLAG_INDEX(esc_flag)]);
+    const __m128i hi_map = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+    const unsigned high_mask = (NEED_ESC(0x80, esc_flag) ? 0xffff : 0);
+
+    while(size - off >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (data + off));
+        __m128i lo = _mm_shuffle_epi8(lo_map, _mm_and_si128(v, nibble_mask));
+        __m128i hi = _mm_shuffle_epi8(hi_map, _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask));
+        unsigned hits = ((unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero)) ^ 0xffff)
+                      | ((unsigned) _mm_movemask_epi8(v) & high_mask);
+
+        if(hits != 0)
+            return off + MD_CTZ(hits);
+        off += 16;
+    }
+
+    return skip_unescaped_scalar(r, esc_flag, data, off, size);
+}
+
+MD_TARGET("avx2") static MD_OFFSET
+skip_unescaped_avx2(MD_HTML* r, unsigned esc_flag, const MD_CHAR* data, MD_OFFSET off, MD_SIZE size)
+{
+    const __m128i lo_map128 = _mm_loadu_si128((const __m128i*) r->escape_nibble_map[ESC_FLAG_INDEX(esc_flag)]);
+    const __m256i lo_map = _mm256_broadcastsi128_si256(lo_map128);
+    const __m256i hi_map = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+                                            1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+    const unsigned high_mask = (NEED_ESC(0x80, esc_flag) ? 0xffffffffU : 0);
+
+    while(size - off >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (data + off));
+        __m256i lo = _mm256_shuffle_epi8(lo_map, _mm256_and_si256(v, nibble_mask));
+        __m256i hi = _mm256_shuffle_epi8(hi_map, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask));
+        unsigned hits = ~(unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), zero))
+                      | ((unsigned) _mm256_movemask_epi8(v) & high_mask);
+
+        if(hits != 0)
+            return off + MD_CTZ(hits);
+        off += 32;
+    }
+
+    /* Avoid the AVX-SSE transition penalty in the legacy SSE code. */
+    _mm256_zeroupper();
+    return skip_unescaped_ssse3(r, esc_flag, data, off, size);
+}
+
+static void
+select_skip_unescaped(MD_HTML* r)
+{
+    int i;
+
+    memset(r->escape_nibble_map, 0, sizeof(r->escape_nibble_map));
+    for(i = 0; i < 128; i++) {
+        if(r->escape_map[i] & NEED_HTML_ESC_FLAG)
+            r->escape_nibble_map[ESC_FLAG_INDEX(NEED_HTML_ESC_FLAG)][i & 0x0f] |= (unsigned char) (1 << (i >> 4));
+        if(r->escape_map[i] & NEED_URL_ESC_FLAG)
+            r->escape_nibble_map[ESC_FLAG_INDEX(NEED_URL_ESC_FLAG)][i & 0x0f] |= (unsigned char) (1 << (i >> 4));
+    }
+
+    switch(md_x86_simd_level()) {
+        case MD_SIMD_AVX2:  r->skip_unescaped = skip_unescaped_avx2; break;
+        case MD_SIMD_SSSE3: r->skip_unescaped = skip_unescaped_ssse3; break;
+        default:            break;
+    }
+}
+#endif  /* MD_X86_SIMD */
+
+/* Returns offset of the first char in data needing the escaping at or after
+ * off, or size if there is none. */
+static inline MD_OFFSET
+skip_unescaped(MD_HTML* r, unsigned esc_flag, const MD_CHAR* data, MD_OFFSET off, MD_SIZE size)
+{
+    MD_OFFSET stop = (size - off > 8) ? off + 8 : size;
+
+    /* Optimization: Short texts, and runs between chars needing the escaping,
+     * are common. Check few chars inline before paying for the indirect call. */
+    while(off < stop) {
+        if(NEED_ESC(data[off], esc_flag))
+            return off;
+        off++;
+    }
+
+    if(off >= size)
+        return size;
+    return r->skip_unescaped(r, esc_flag, data, off, size);
+}
+
 static void
 render_html_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 {
     MD_OFFSET beg = 0;
     MD_OFFSET off = 0;
 
-    /* Some characters need to be escaped in normal HTML text. */
-    #define NEED_HTML_ESC(ch)   (r->escape_map[(unsigned char)(ch)] & NEED_HTML_ESC_FLAG)
-
+    off = skip_unescaped(r, NEED_HTML_ESC_FLAG, data, off, size);
     while(1) {
-        /* Optimization: Use some loop unrolling. */
-        while(off + 3 < size  &&  !NEED_HTML_ESC(data[off+0])  &&  !NEED_HTML_ESC(data[off+1])
-                              &&  !NEED_HTML_ESC(data[off+2])  &&  !NEED_HTML_ESC(data[off+3]))
-            off += 4;
-        while(off < size  &&  !NEED_HTML_ESC(data[off]))
-            off++;
-
         if(off > beg)
             render_verbatim(r, data + beg, off - beg);
 
@@ -115,6 +330,7 @@ render_html_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
             break;
         }
         beg = off;
+        off = skip_unescaped(r, NEED_HTML_ESC_FLAG, data, off, size);
     }
 }
 
@@ -125,12 +341,8 @@ render_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
     MD_OFFSET beg = 0;
     MD_OFFSET off = 0;
 
-    /* Some characters need to be escaped in URL attributes. */
-    #define NEED_URL_ESC(ch)    (r->escape_map[(unsigned char)(ch)] & NEED_URL_ESC_FLAG)
-
+    off = skip_unescaped(r, NEED_URL_ESC_FLAG, data, off, size);
     while(1) {
-        while(off < size  &&  !NEED_URL_ESC(data[off]))
-            off++;
         if(off > beg)
             render_verbatim(r, data + beg, off - beg);
 
@@ -152,6 +364,7 @@ render_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
         }
 
         beg = off;
+        off = skip_unescaped(r, NEED_URL_ESC_FLAG, data, off, size);
     }
 }
 
@@ -237,9 +450,7 @@ render_entity(MD_HTML* r, const MD_CHAR* text, MD_SIZE size,
 
         ent = entity_lookup(text, size);
         if(ent != NULL) {
-            render_utf8_codepoint(r, ent->codepoints[0], fn_append);
-            if(ent->codepoints[1])
-                render_utf8_codepoint(r, ent->codepoints[1], fn_append);
+            fn_append(r, ent->utf8, ent->utf8_size);
             return;
         }
     }
@@ -602,45 +813,300 @@ debug_log_callback(const char* msg, void* userdata)
         fprintf(stderr, "MD4C: %s\n", msg);
 }
 
-int
-md_html(const MD_CHAR* input, MD_SIZE input_size,
-        void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
-        void* userdata, unsigned parser_flags, unsigned renderer_flags)
+#ifdef MD4C_AMALGAMATION
+/* In md4c_all.c, the parser follows in the same translation unit. Let it call
+ * the callbacks directly. (See MD_CALL() in md4c.c.) */
+#define MD4C_DIRECT_ENTER_BLOCK     enter_block_callback
+#define MD4C_DIRECT_LEAVE_BLOCK     leave_block_callback
+#define MD4C_DIRECT_ENTER_SPAN      enter_span_callback
+#define MD4C_DIRECT_LEAVE_SPAN      leave_span_callback
+#define MD4C_DIRECT_TEXT            text_callback
+#endif
+
+static void
+md_html_init(MD_HTML* r, unsigned renderer_flags)
 {
-    MD_HTML render = { process_output, userdata, renderer_flags, 0, { 0 } };
     int i;
 
-    MD_PARSER parser = {
-        0,
-        parser_flags,
-        enter_block_callback,
-        leave_block_callback,
-        enter_span_callback,
-        leave_span_callback,
-        text_callback,
-        debug_log_callback,
-        NULL
-    };
+    memset(r, 0, sizeof(MD_HTML));
+    r->flags = renderer_flags;
 
     /* Build map of characters which need escaping. */
     for(i = 0; i < 256; i++) {
         unsigned char ch = (unsigned char) i;
 
         if(strchr("\"&'<>", ch) != NULL)
-            render.escape_map[i] |= NEED_HTML_ESC_FLAG;
+            r->escape_map[i] |= NEED_HTML_ESC_FLAG;
 
         if(!ISALNUM(ch)  &&  strchr("~-_.+!*(),%#@?=;:/$", ch) == NULL)
-            render.escape_map[i] |= NEED_URL_ESC_FLAG;
+            r->escape_map[i] |= NEED_URL_ESC_FLAG;
+    }
+
+    r->skip_unescaped = skip_unescaped_scalar;
+#ifdef MD_X86_SIMD
+    select_skip_unescaped(r);
+#endif
+}
+
+static int
+md_html_init_output(MD_HTML* r, MD_CHAR* local_buffer, MD_SIZE output_buffer_size)
+{
+    if(output_buffer_size > MD_HTML_LOCAL_BUFFER_SIZE) {
+        r->output_buffer = (MD_CHAR*) malloc(output_buffer_size * sizeof(MD_CHAR));
+        if(r->output_buffer == NULL)
+            return -1;
+    } else {
+        r->output_buffer = local_buffer;
     }
 
+    r->output_buffer_size = output_buffer_size;
+    r->output_buffer_used = 0;
+    return 0;
+}
+
+static void
+md_html_fini_output(MD_HTML* r, MD_CHAR* local_buffer)
+{
+    render_flush(r);
+    if(r->output_buffer != local_buffer)
+        free(r->output_buffer);
+}
+
+static void
+md_html_skip_bom(MD_HTML* r, const MD_CHAR** p_input, MD_SIZE* p_input_size)
+{
     /* Consider skipping UTF-8 byte order mark (BOM). */
-    if(renderer_flags & MD_HTML_FLAG_SKIP_UTF8_BOM  &&  sizeof(MD_CHAR) == 1) {
+    if(r->flags & MD_HTML_FLAG_SKIP_UTF8_BOM  &&  sizeof(MD_CHAR) == 1) {
         static const MD_CHAR bom[3] = { (char)0xef, (char)0xbb, (char)0xbf };
-        if(input_size >= sizeof(bom)  &&  memcmp(input, bom, sizeof(bom)) == 0) {
-            input += sizeof(bom);
-            input_size -= sizeof(bom);
+        if(*p_input_size >= sizeof(bom)  &&  memcmp(*p_input, bom, sizeof(bom)) == 0) {
+            *p_input += sizeof(bom);
+            *p_input_size -= sizeof(bom);
         }
     }
+}
+
+static void
+md_html_init_parser(MD_PARSER* parser, unsigned parser_flags)
+{
+    memset(parser, 0, sizeof(MD_PARSER));
+    parser->flags = parser_flags;
+    parser->enter_block = enter_block_callback;
+    parser->leave_block = leave_block_callback;
+    parser->enter_span = enter_span_callback;
+    parser->leave_span = leave_span_callback;
+    parser->text = text_callback;
+    parser->debug_log = debug_log_callback;
+}
 
-    return md_parse(input, input_size, &parser, (void*) &render);
+int
+md_html(const MD_CHAR* input, MD_SIZE input_size,
+        void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+        void* userdata, unsigned parser_flags, unsigned renderer_flags)
+{
+    return md_html_ex(input, input_size, process_output, userdata,
+                parser_flags, renderer_flags, MD_HTML_OUTPUT_BUFFER_SIZE);
+}
+
+int
+md_html_ex(const MD_CHAR* input, MD_SIZE input_size,
+        void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+        void* userdata, unsigned parser_flags, unsigned renderer_flags,
+        MD_SIZE output_buffer_size)
+{
+    MD_HTML render;
+    MD_PARSER parser;
+    MD_CHAR local_buffer[MD_HTML_LOCAL_BUFFER_SIZE];
+    int ret;
+
+    md_html_init(&render, renderer_flags);
+    render.process_output = process_output;
+    render.userdata = userdata;
+    if(md_html_init_output(&render, local_buffer, output_buffer_size) != 0)
+        return -1;
+    md_html_init_parser(&parser, parser_flags);
+
+    md_html_skip_bom(&render, &input, &input_size);
+    ret = md_parse(input, input_size, &parser, (void*) &render);
+    md_html_fini_output(&render, local_buffer);
+    return ret;
+}
+
+#ifdef MD4C_AMALGAMATION
+int
+md_html_direct(const MD_CHAR* input, MD_SIZE input_size,
+        void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+        void* userdata, unsigned parser_flags, unsigned renderer_flags)
+{
+    /* All the work is done by MD_CALL() in md4c.c: Whenever MD_PARSER refers
+     * to our callbacks, the parser calls them directly. */
+    return md_html_ex(input, input_size, process_output, userdata,
+                parser_flags, renderer_flags, MD_HTML_OUTPUT_BUFFER_SIZE);
+}
+#endif
+
+/* Input size is good estimation of output size. Add some more reserve to deal
+ * with the tags. */
+static MD_SIZE
+md_html_estimate_output_size(MD_SIZE input_size)
+{
+    MD_SIZE reserve = input_size / 8 + 64;
+
+    if(input_size > (MD_SIZE)(-1) - 1 - reserve)
+        return (MD_SIZE)(-1) - 1;
+    return input_size + reserve;
+}
+
+/* Render directly into render->output_buffer, set up by the caller. */
+static int
+md_html_to_memory(MD_HTML* render, const MD_CHAR* input, MD_SIZE input_size,
+                  unsigned parser_flags, MD_SIZE* p_output_size)
+{
+    MD_PARSER parser;
+    int ret;
+
+    md_html_init_parser(&parser, parser_flags);
+
+    md_html_skip_bom(render, &input, &input_size);
+    ret = md_parse(input, input_size, &parser, (void*) render);
+    if(ret == 0  &&  render->output_error)
+        ret = -1;
+
+    /* There is always place for the terminator: See the callers. */
+    render->output_buffer[render->output_buffer_used] = '\0';
+    *p_output_size = render->output_buffer_used + render->output_dropped;
+    return ret;
+}
+
+int
+md_html_to_buffer(const MD_CHAR* input, MD_SIZE input_size,
+        MD_CHAR* buffer, MD_SIZE buffer_size, MD_SIZE* p_output_size,
+        unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML render;
+    MD_CHAR dummy_buffer[1];
+    int ret;
+
+    md_html_init(&render, renderer_flags);
+    if(buffer_size > 0) {
+        render.output_buffer = buffer;
+        render.output_buffer_size = buffer_size - 1;
+    } else {
+        render.output_buffer = dummy_buffer;
+    }
+
+    ret = md_html_to_memory(&render, input, input_size, parser_flags, p_output_size);
+    if(ret != 0)
+        *p_output_size = 0;
+    return ret;
+}
+
+int
+md_html_to_new_buffer(const MD_CHAR* input, MD_SIZE input_size,
+        MD_CHAR** p_buffer, MD_SIZE* p_output_size,
+        unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML render;
+    int ret;
+
+    *p_buffer = NULL;
+    *p_output_size = 0;
+
+    md_html_init(&render, renderer_flags);
+    render.output_buffer_size = md_html_estimate_output_size(input_size);
+    render.output_buffer = (MD_CHAR*) malloc((render.output_buffer_size + 1) * sizeof(MD_CHAR));
+    if(render.output_buffer == NULL)
+        return -1;
+    render.output_buffer_growable = 1;
+
+    ret = md_html_to_memory(&render, input, input_size, parser_flags, p_output_size);
+    if(ret != 0) {
+        free(render.output_buffer);
+        *p_output_size = 0;
+        return ret;
+    }
+
+    *p_buffer = render.output_buffer;
+    return 0;
+}
+
+int
+md_html_render_events(int (*produce)(const MD_PARSER*, void*, void*), void* source,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata, unsigned renderer_flags)
+{
+    MD_HTML render;
+    MD_PARSER parser;
+    MD_CHAR local_buffer[MD_HTML_LOCAL_BUFFER_SIZE];
+    int ret;
+
+    md_html_init(&render, renderer_flags);
+    render.process_output = process_output;
+    render.userdata = userdata;
+    md_html_init_output(&render, local_buffer, MD_HTML_OUTPUT_BUFFER_SIZE);
+    md_html_init_parser(&parser, 0);
+
+    ret = produce(&parser, (void*) &render, source);
+    md_html_fini_output(&render, local_buffer);
+    return ret;
+}
+
+
+struct MD_HTML_SESSION_tag {
+    MD_HTML render;
+    MD_PARSER_SESSION* parser_session;
+    MD_CHAR output_buffer[MD_HTML_LOCAL_BUFFER_SIZE];
+};
+
+MD_HTML_SESSION*
+md_html_session_create(unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML_SESSION* session;
+    MD_PARSER parser;
+
+    session = (MD_HTML_SESSION*) malloc(sizeof(MD_HTML_SESSION));
+    if(session == NULL)
+        return NULL;
+
+    md_html_init(&session->render, renderer_flags);
+    md_html_init_parser(&parser, parser_flags);
+    session->parser_session = md_session_create(&parser);
+    if(session->parser_session == NULL) {
+        free(session);
+        return NULL;
+    }
+
+    return session;
+}
+
+int
+md_html_session_render(MD_HTML_SESSION* session,
+            const MD_CHAR* input, MD_SIZE input_size,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata)
+{
+    MD_HTML* r = &session->render;
+    int ret;
+
+    r->process_output = process_output;
+    r->userdata = userdata;
+    r->image_nesting_level = 0;
+    md_html_init_output(r, session->output_buffer, MD_HTML_OUTPUT_BUFFER_SIZE);
+
+    md_html_skip_bom(r, &input, &input_size);
+    ret = md_session_parse(session->parser_session, input, input_size, (void*) r);
+    md_html_fini_output(r, session->output_buffer);
+    return ret;
+}
+
+void
+md_html_session_reset(MD_HTML_SESSION* session)
+{
+    md_session_reset(session->parser_session);
+}
+
+void
+md_html_session_destroy(MD_HTML_SESSION* session)
+{
+    md_session_destroy(session->parser_session);
+    free(session);
 }
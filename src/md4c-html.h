@@ -60,6 +60,107 @@ int md_html(const MD_CHAR* input, MD_SIZE input_size,
             void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
             void* userdata, unsigned parser_flags, unsigned renderer_flags);
 
+/* Same as md_html() but with explicit size of the output buffer.
+ *
+ * The renderer collects the output in a buffer and calls process_output()
+ * only when the buffer is full, and once more (if needed) before returning.
+ * md_html() uses a buffer of MD_HTML_OUTPUT_BUFFER_SIZE characters (4096,
+ * unless MD4C-HTML is built with a different value). Param output_buffer_size
+ * specifies the size in MD_CHAR units; zero disables the buffering, i.e.
+ * process_output() then gets called with every fragment of the output as soon
+ * as it is generated.
+ *
+ * Returns -1 on error (if md_parse() fails or if the buffer cannot be
+ * allocated.)
+ * Returns 0 on success.
+ */
+int md_html_ex(const MD_CHAR* input, MD_SIZE input_size,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata, unsigned parser_flags, unsigned renderer_flags,
+            MD_SIZE output_buffer_size);
+
+
+/* Same as md_html() but available only in the amalgamated build (md4c_all.c,
+ * generated by scripts/build_amalgamation.py), where the parser and the HTML
+ * renderer are compiled as a single translation unit and the parser calls the
+ * renderer's callbacks directly rather than through function pointers.
+ *
+ * (md_html() and the other functions of MD4C-HTML benefit from this in the
+ * amalgamated build as well. Applications may call md_html_direct() to make
+ * sure, at link time, they get the amalgamated build.)
+ */
+int md_html_direct(const MD_CHAR* input, MD_SIZE input_size,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata, unsigned parser_flags, unsigned renderer_flags);
+
+/* Render Markdown into HTML in memory, without any output callback.
+ *
+ * md_html_to_buffer() writes the output into the caller-provided buffer of
+ * buffer_size characters. Like snprintf(), it writes at most buffer_size - 1
+ * characters of the output followed by a zero terminator (unless buffer_size
+ * is zero, in which case buffer may be NULL), and *p_output_size is set to
+ * the size of the complete output (not counting the terminator) even if it
+ * has been truncated. I.e. the output is complete if *p_output_size is less
+ * than buffer_size; otherwise the caller may try again with a buffer of
+ * *p_output_size + 1 characters.
+ *
+ * md_html_to_new_buffer() renders into a buffer allocated with malloc(),
+ * initially sized by estimation from input_size and reallocated when needed.
+ * On success, *p_buffer is set to the zero-terminated output, which the caller
+ * has to release with free(), and *p_output_size to its size.
+ *
+ * Other params are the same as for md_html().
+ *
+ * Returns -1 on error (if md_parse() fails, if memory allocation fails, or
+ * if the size of the output does not fit into MD_SIZE.) *p_output_size is then
+ * set to zero, and *p_buffer to NULL.
+ * Returns 0 on success.
+ */
+int md_html_to_buffer(const MD_CHAR* input, MD_SIZE input_size,
+            MD_CHAR* buffer, MD_SIZE buffer_size, MD_SIZE* p_output_size,
+            unsigned parser_flags, unsigned renderer_flags);
+int md_html_to_new_buffer(const MD_CHAR* input, MD_SIZE input_size,
+            MD_CHAR** p_buffer, MD_SIZE* p_output_size,
+            unsigned parser_flags, unsigned renderer_flags);
+
+
+/* Render HTML from parser callbacks which come from somewhere else than
+ * md_parse(), e.g. from a document recorded by md4c-ast.
+ *
+ * Function produce() gets the renderer's MD_PARSER structure, the userdata
+ * to pass to its callbacks and the param source. It has to call the callbacks
+ * in the same way as md_parse() would, and return zero on success, or the
+ * non-zero value returned by any of the callbacks.
+ *
+ * Returns the value returned by produce().
+ */
+int md_html_render_events(int (*produce)(const MD_PARSER* /*parser*/, void* /*parser_userdata*/, void* /*source*/),
+            void* source,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata, unsigned renderer_flags);
+
+
+/* Session for rendering many documents with the same flags.
+ *
+ * Calling md_html_session_render() is equivalent to calling md_html() but
+ * the session keeps the buffers of the underlying MD_PARSER_SESSION and the
+ * renderer's own precomputed tables for the next document.
+ *
+ * md_html_session_create() returns NULL on failure. md_html_session_render()
+ * returns the same values as md_html(). md_html_session_reset() releases the
+ * memory cached in the session. md_html_session_destroy() releases the
+ * session altogether.
+ */
+typedef struct MD_HTML_SESSION_tag MD_HTML_SESSION;
+
+MD_HTML_SESSION* md_html_session_create(unsigned parser_flags, unsigned renderer_flags);
+int md_html_session_render(MD_HTML_SESSION* session,
+            const MD_CHAR* input, MD_SIZE input_size,
+            void (*process_output)(const MD_CHAR*, MD_SIZE, void*),
+            void* userdata);
+void md_html_session_reset(MD_HTML_SESSION* session);
+void md_html_session_destroy(MD_HTML_SESSION* session);
+
 
 #ifdef __cplusplus
     }  /* extern "C" { */
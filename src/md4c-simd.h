@@ -0,0 +1,83 @@
+/*
+ * MD4C: Markdown parser for C
+ * (https://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2026 Martin Mitáš
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Internal header shared by md4c.c and md4c-html.c: detection of the x86 SIMD
+ * support, used to select the vectorized variants of their hot loops at run
+ * time. (Define MD4C_NO_SIMD to disable them altogether.) */
+
+#ifndef MD4C_SIMD_H
+#define MD4C_SIMD_H
+
+#if !defined MD4C_NO_SIMD  &&  !defined MD4C_USE_UTF16
+    #if (defined __GNUC__ || defined __clang__)  &&  (defined __x86_64__ || defined __i386__)
+        #include <immintrin.h>
+        #define MD_X86_SIMD                 1
+        #define MD_TARGET(isa)              __attribute__((target(isa)))
+        #define MD_CTZ(x)                   ((unsigned) __builtin_ctz(x))
+    #elif defined _MSC_VER  &&  _MSC_VER >= 1700  &&  (defined _M_X64 || defined _M_IX86)
+        #include <intrin.h>
+        #include <immintrin.h>
+        #define MD_X86_SIMD                 1
+        #define MD_TARGET(isa)
+        static __inline unsigned md_ctz(unsigned x) { unsigned long i; _BitScanForward(&i, x); return (unsigned) i; }
+        #define MD_CTZ(x)                   md_ctz(x)
+    #endif
+#endif
+
+#ifdef MD_X86_SIMD
+    #define MD_SIMD_NONE                0
+    #define MD_SIMD_SSSE3               1
+    #define MD_SIMD_AVX2                2
+
+/* Returns the best of MD_SIMD_xxx the CPU (and the OS) supports. */
+static int
+md_x86_simd_level(void)
+{
+#if defined _MSC_VER
+    int info[4];
+
+    __cpuid(info, 0);
+    if(info[0] < 1)
+        return MD_SIMD_NONE;
+    __cpuid(info, 1);
+    if(!(info[2] & (1 << 9)))           /* SSSE3 */
+        return MD_SIMD_NONE;
+    if((info[2] & (1 << 27))  &&  (_xgetbv(0) & 6) == 6) {  /* OSXSAVE, YMM state enabled. */
+        __cpuidex(info, 7, 0);
+        if(info[1] & (1 << 5))          /* AVX2 */
+            return MD_SIMD_AVX2;
+    }
+    return MD_SIMD_SSSE3;
+#else
+    if(__builtin_cpu_supports("avx2"))
+        return MD_SIMD_AVX2;
+    if(__builtin_cpu_supports("ssse3"))
+        return MD_SIMD_SSSE3;
+    return MD_SIMD_NONE;
+#endif
+}
+#endif  /* MD_X86_SIMD */
+
+#endif  /* MD4C_SIMD_H */
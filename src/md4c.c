@@ -29,8 +29,10 @@
 #include <stdlib.h>
 #include <stddef.h>
 #include <string.h>
+#include <time.h>
 
 #include "md4c.h"
+#include "md4c-simd.h"
 
 
 /*****************************
@@ -144,6 +146,7 @@ typedef struct MD_BLOCK_tag MD_BLOCK;
 typedef struct MD_CONTAINER_tag MD_CONTAINER;
 typedef struct MD_REF_DEF_tag MD_REF_DEF;
 typedef struct MD_FOOTNOTE_DEF_tag MD_FOOTNOTE_DEF;
+typedef struct MD_JOB_tag MD_JOB;
 
 /* Forward declaration; full definition is below with MD_LINE_tag. */
 typedef struct MD_LINE_tag MD_LINE;
@@ -155,6 +158,12 @@ struct MD_LABEL_HASH_ENTRY_tag {
     unsigned hash;
 };
 
+typedef struct MD_LABEL_HASH_SLOT_tag MD_LABEL_HASH_SLOT;
+struct MD_LABEL_HASH_SLOT_tag {
+    unsigned hash;
+    unsigned def_index;         /* 1-based index into defs[]; 0 = empty slot. */
+};
+
 typedef struct MD_LABEL_HASH_TABLE_tag MD_LABEL_HASH_TABLE;
 struct MD_LABEL_HASH_TABLE_tag {
     /* Flat array of all records. */
@@ -167,10 +176,15 @@ struct MD_LABEL_HASH_TABLE_tag {
     unsigned n_defs;
     unsigned alloc_defs;
 
-    /* The hashtable itself, where the actual entries are pointers into the
-     * array defs[] above. */
-    void** buckets;
-    unsigned n_buckets;
+    /* The hashtable itself: Open addressing with linear probing. The slots
+     * refer to defs[] above by index (so they survive its reallocation) and
+     * keep a copy of the hash (so the probing mostly does not touch defs[]).
+     * n_slots is zero or a power of two. */
+    MD_LABEL_HASH_SLOT* slots;
+    unsigned n_slots;
+    unsigned n_used_slots;
+    unsigned n_hashed_defs;     /* How many of defs[] the slots cover. */
+    unsigned hash_seed;
 };
 
 
@@ -192,6 +206,12 @@ struct MD_CTX_tag {
     MD_PARSER parser;
     void* userdata;
 
+    /* Bump-pointer arena (if MD_ALLOCATOR::arena_block_size is set). */
+    void* arena_blocks;     /* List of the blocks, linked via their headers. */
+    char* arena_ptr;        /* Free space in the current block. */
+    char* arena_end;
+    void* arena_last;       /* Last allocation; it may be resized in place. */
+
     /* When this is true, it allows some optimizations. */
     int doc_ends_with_newline;
 
@@ -205,8 +225,27 @@ struct MD_CTX_tag {
 
     /* Footnote definitions. */
     MD_LABEL_HASH_TABLE footnote_hashtable;
+
+    /* Seed of the label hashes in both the tables above. */
+    unsigned label_hash_seed;
     unsigned next_footnote_index;   /* 1-based counter for sequential numbering */
 
+    /* Input offset where MD_FLAG_EARLYBLOCKEMISSION last emitted blocks. */
+    OFF early_emission_off;
+
+    /* Jobs processing the blocks in parallel (with MD_PARSER::executor).
+     * It is a ring buffer of n_jobs slots, where n_pending_jobs jobs starting
+     * at job_head wait for replaying their records. */
+    MD_JOB* jobs;
+    unsigned n_jobs;
+    unsigned job_head;
+    unsigned n_pending_jobs;
+
+    /* If set, md_process_all_blocks() may return before all its jobs are
+     * replayed. (For overlapping the block analysis with processing of the
+     * blocks already known with MD_FLAG_EARLYBLOCKEMISSION.) */
+    int keep_jobs_pending;
+
     /* Stack of inline/span markers.
      * This is only used for parsing a single block contents but by storing it
      * here we may reuse the stack for subsequent blocks; i.e. we have fewer
@@ -215,12 +254,28 @@ struct MD_CTX_tag {
     int n_marks;
     int alloc_marks;
 
+    /* Counters for MD_PARSER::block_profiler, reset for each leaf block. */
+    unsigned profile_n_marks;
+    unsigned profile_n_passes;
+
 #if defined MD4C_USE_UTF16
     char mark_char_map[128];
 #else
     char mark_char_map[256];
 #endif
 
+    /* Finds the next char in mark_char_map[]. (See md_skip_non_mark_chars().) */
+    OFF (*skip_non_mark_chars)(MD_CTX* /*ctx*/, OFF /*off*/, OFF /*end*/);
+#ifdef MD_X86_SIMD
+    /* The same set as mark_char_map[] (all the mark chars are ASCII), in
+     * a form suitable for the SIMD lookup: For each low nibble, a bitmask of
+     * the high nibbles which form a mark char with it. */
+    unsigned char mark_char_nibble_map[16];
+#endif
+
+    /* Finds the end of the current line. (See md_skip_to_newline().) */
+    OFF (*skip_to_newline)(MD_CTX* /*ctx*/, OFF /*off*/);
+
     /* For resolving of inline spans. */
     MD_MARKSTACK opener_stacks[19];
 #define ASTERISK_OPENERS_oo_mod3_0      (ctx->opener_stacks[0])     /* Opener-only */
@@ -275,6 +330,12 @@ struct MD_CTX_tag {
     int n_block_bytes;
     int alloc_block_bytes;
 
+    /* End of the last container block in block_bytes. (If it equals
+     * n_block_bytes, the container block is the last thing there. Note we
+     * cannot tell that from the bytes themselves, as MD_LINE has the same
+     * size as MD_BLOCK.) */
+    int container_block_bytes_end;
+
     /* For container block analysis. */
     MD_CONTAINER* containers;
     int n_containers;
@@ -328,6 +389,236 @@ struct MD_VERBATIMLINE_tag {
 };
 
 
+/***************************
+ ***  Memory Management  ***
+ ***************************/
+
+/* Without MD_PARSER::allocator, we use the standard functions. */
+static void*
+md_raw_malloc(const MD_PARSER* parser, size_t size)
+{
+    if(parser->allocator != NULL  &&  parser->allocator->allocate != NULL)
+        return parser->allocator->allocate(size, parser->allocator->data);
+    return malloc(size);
+}
+
+static void*
+md_raw_realloc(const MD_PARSER* parser, void* ptr, size_t size)
+{
+    if(parser->allocator != NULL  &&  parser->allocator->reallocate != NULL)
+        return parser->allocator->reallocate(ptr, size, parser->allocator->data);
+    return realloc(ptr, size);
+}
+
+static void
+md_raw_free(const MD_PARSER* parser, void* ptr)
+{
+    if(parser->allocator != NULL  &&  parser->allocator->release != NULL)
+        parser->allocator->release(ptr, parser->allocator->data);
+    else
+        free(ptr);
+}
+
+/* With MD_ALLOCATOR::arena_block_size, each arena block as well as each
+ * allocation served from it is prefixed with this header. For a block, it
+ * links the next block; for an allocation, it remembers its size so we can
+ * implement md_realloc(). (The union also ensures proper alignment.) */
+typedef union MD_ARENA_HEADER_tag MD_ARENA_HEADER;
+union MD_ARENA_HEADER_tag {
+    void* next;
+    size_t size;
+    double dummy_d;
+    long dummy_l;
+};
+
+#define MD_ARENA_ROUND(sz)                                                  \
+    (((sz) + sizeof(MD_ARENA_HEADER) - 1) / sizeof(MD_ARENA_HEADER) * sizeof(MD_ARENA_HEADER))
+
+static inline int
+md_uses_arena(MD_CTX* ctx)
+{
+    return (ctx->parser.allocator != NULL  &&  ctx->parser.allocator->arena_block_size > 0);
+}
+
+static void*
+md_arena_malloc(MD_CTX* ctx, size_t size)
+{
+    MD_ARENA_HEADER* hdr;
+
+    size = MD_ARENA_ROUND(size);
+    if(size + sizeof(MD_ARENA_HEADER) < size)
+        return NULL;
+
+    if((size_t)(ctx->arena_end - ctx->arena_ptr) < size + sizeof(MD_ARENA_HEADER)) {
+        size_t block_size = MAX(ctx->parser.allocator->arena_block_size,
+                                size + 2 * sizeof(MD_ARENA_HEADER));
+        MD_ARENA_HEADER* block;
+
+        if(block_size < size)
+            return NULL;
+        block = (MD_ARENA_HEADER*) md_raw_malloc(&ctx->parser, block_size);
+        if(block == NULL)
+            return NULL;
+
+        block->next = ctx->arena_blocks;
+        ctx->arena_blocks = block;
+        ctx->arena_ptr = (char*) (block + 1);
+        ctx->arena_end = (char*) block + block_size;
+    }
+
+    hdr = (MD_ARENA_HEADER*) ctx->arena_ptr;
+    hdr->size = size;
+    ctx->arena_ptr += sizeof(MD_ARENA_HEADER) + size;
+    ctx->arena_last = hdr + 1;
+    return hdr + 1;
+}
+
+static void*
+md_arena_realloc(MD_CTX* ctx, void* ptr, size_t size)
+{
+    MD_ARENA_HEADER* hdr;
+    void* new_ptr;
+
+    if(ptr == NULL)
+        return md_arena_malloc(ctx, size);
+
+    hdr = (MD_ARENA_HEADER*) ptr - 1;
+    if(size <= hdr->size)
+        return ptr;
+
+    /* If it is the last allocation, try to grow it in place. */
+    if(ptr == ctx->arena_last  &&
+       MD_ARENA_ROUND(size) >= size  &&
+       MD_ARENA_ROUND(size) <= (size_t)(ctx->arena_end - (char*) ptr))
+    {
+        hdr->size = MD_ARENA_ROUND(size);
+        ctx->arena_ptr = (char*) ptr + hdr->size;
+        return ptr;
+    }
+
+    new_ptr = md_arena_malloc(ctx, size);
+    if(new_ptr == NULL)
+        return NULL;
+    memcpy(new_ptr, ptr, hdr->size);
+    return new_ptr;
+}
+
+static void
+md_arena_free(MD_CTX* ctx, void* ptr)
+{
+    /* We may only reclaim the last allocation. */
+    if(ptr != NULL  &&  ptr == ctx->arena_last) {
+        ctx->arena_ptr = (char*) ((MD_ARENA_HEADER*) ptr - 1);
+        ctx->arena_last = NULL;
+    }
+}
+
+static void
+md_arena_release(MD_CTX* ctx)
+{
+    while(ctx->arena_blocks != NULL) {
+        MD_ARENA_HEADER* block = (MD_ARENA_HEADER*) ctx->arena_blocks;
+        ctx->arena_blocks = block->next;
+        md_raw_free(&ctx->parser, block);
+    }
+
+    ctx->arena_ptr = NULL;
+    ctx->arena_end = NULL;
+    ctx->arena_last = NULL;
+}
+
+static void*
+md_malloc(MD_CTX* ctx, size_t size)
+{
+    if(md_uses_arena(ctx))
+        return md_arena_malloc(ctx, size);
+    return md_raw_malloc(&ctx->parser, size);
+}
+
+static void*
+md_realloc(MD_CTX* ctx, void* ptr, size_t size)
+{
+    if(md_uses_arena(ctx))
+        return md_arena_realloc(ctx, ptr, size);
+    return md_raw_realloc(&ctx->parser, ptr, size);
+}
+
+static void
+md_free(MD_CTX* ctx, void* ptr)
+{
+    if(md_uses_arena(ctx))
+        md_arena_free(ctx, ptr);
+    else if(ptr != NULL)
+        md_raw_free(&ctx->parser, ptr);
+}
+
+
+/********************
+ ***  Statistics  ***
+ ********************/
+
+/* Wall-clock time in seconds, for MD_PARSER::stats. */
+static double
+md_stats_time(void)
+{
+#if defined CLOCK_MONOTONIC
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#elif (defined __STDC_VERSION__  &&  __STDC_VERSION__ >= 201112L  &&  defined TIME_UTC)  ||  \
+      (defined _MSC_VER  &&  _MSC_VER >= 1900)
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static double
+md_stats_time_sum(const MD_PARSE_STATS* stats)
+{
+    return stats->time_line_analysis + stats->time_label_tables + stats->time_block_emission +
+           stats->time_mark_collection + stats->time_inline_analysis + stats->time_inline_emission;
+}
+
+/* The phases nest (e.g. md_process_all_blocks() runs the inline phases for
+ * each block). MD_STATS_LEAVE() attributes the time since MD_STATS_ENTER() to
+ * the given phase, except the time attributed to other phases meanwhile. */
+typedef struct MD_STATS_MARK_tag MD_STATS_MARK;
+struct MD_STATS_MARK_tag {
+    double time;
+    double time_sum;
+};
+
+#define MD_STATS_ENTER(mark)                                                \
+    do {                                                                    \
+        if(ctx->parser.stats != NULL) {                                     \
+            (mark).time = md_stats_time();                                  \
+            (mark).time_sum = md_stats_time_sum(ctx->parser.stats);         \
+        } else {                                                            \
+            (mark).time = 0.0;  /* Just to make compilers happy. */         \
+            (mark).time_sum = 0.0;                                          \
+        }                                                                   \
+    } while(0)
+
+#define MD_STATS_LEAVE(mark, phase)                                         \
+    do {                                                                    \
+        if(ctx->parser.stats != NULL) {                                     \
+            MD_PARSE_STATS* stats_ = ctx->parser.stats;                     \
+            double elapsed_ = md_stats_time() - (mark).time;                \
+            double nested_ = md_stats_time_sum(stats_) - (mark).time_sum;   \
+            stats_->phase += elapsed_ - nested_;                            \
+        }                                                                   \
+    } while(0)
+
+#define MD_STATS_INC(counter)                                               \
+    do {                                                                    \
+        if(ctx->parser.stats != NULL)                                       \
+            ctx->parser.stats->counter++;                                   \
+    } while(0)
+
+
 /*****************
  ***  Helpers  ***
  *****************/
@@ -406,6 +697,29 @@ md_ascii_eq(const CHAR* s1, const CHAR* s2, SZ n)
     return memcmp(s1, s2, n * sizeof(CHAR)) == 0;
 }
 
+/* Call the given callback of MD_PARSER.
+ *
+ * In the amalgamated build (md4c_all.c, see scripts/build_amalgamation.py),
+ * MD4C-HTML precedes us in the same translation unit and it names its
+ * callbacks with the macros MD4C_DIRECT_xxxx. Whenever MD_PARSER refers to
+ * them, we call them directly, so that the compiler may inline them. */
+#ifdef MD4C_DIRECT_TEXT
+    #define MD_CALL(callback, direct_callback, args)                        \
+        (ctx->parser.callback == direct_callback                            \
+            ? direct_callback args : ctx->parser.callback args)
+    #define MD_CALL_ENTER_BLOCK(args)   MD_CALL(enter_block, MD4C_DIRECT_ENTER_BLOCK, args)
+    #define MD_CALL_LEAVE_BLOCK(args)   MD_CALL(leave_block, MD4C_DIRECT_LEAVE_BLOCK, args)
+    #define MD_CALL_ENTER_SPAN(args)    MD_CALL(enter_span, MD4C_DIRECT_ENTER_SPAN, args)
+    #define MD_CALL_LEAVE_SPAN(args)    MD_CALL(leave_span, MD4C_DIRECT_LEAVE_SPAN, args)
+    #define MD_CALL_TEXT(args)          MD_CALL(text, MD4C_DIRECT_TEXT, args)
+#else
+    #define MD_CALL_ENTER_BLOCK(args)   (ctx->parser.enter_block args)
+    #define MD_CALL_LEAVE_BLOCK(args)   (ctx->parser.leave_block args)
+    #define MD_CALL_ENTER_SPAN(args)    (ctx->parser.enter_span args)
+    #define MD_CALL_LEAVE_SPAN(args)    (ctx->parser.leave_span args)
+    #define MD_CALL_TEXT(args)          (ctx->parser.text args)
+#endif
+
 static int
 md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ size)
 {
@@ -417,7 +731,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
             off++;
 
         if(off > 0) {
-            ret = ctx->parser.text(type, str, off, ctx->userdata);
+            ret = MD_CALL_TEXT((type, str, off, ctx->userdata));
             if(ret != 0)
                 return ret;
 
@@ -429,7 +743,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
         if(off >= size)
             return 0;
 
-        ret = ctx->parser.text(MD_TEXT_NULLCHAR, _T(""), 1, ctx->userdata);
+        ret = MD_CALL_TEXT((MD_TEXT_NULLCHAR, _T(""), 1, ctx->userdata));
         if(ret != 0)
             return ret;
         off++;
@@ -451,7 +765,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
             CHAR* new_buffer;                                               \
             SZ new_size = ((sz) + (sz) / 2 + 128) & ~127;                   \
                                                                             \
-            new_buffer = realloc(ctx->buffer, new_size);                    \
+            new_buffer = md_realloc(ctx, ctx->buffer, new_size);            \
             if(new_buffer == NULL) {                                        \
                 MD_LOG("realloc() failed.");                                \
                 ret = -1;                                                   \
@@ -460,13 +774,14 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
                                                                             \
             ctx->buffer = new_buffer;                                       \
             ctx->alloc_buffer = new_size;                                   \
+            MD_STATS_INC(buffer_reallocs);                                  \
         }                                                                   \
     } while(0)
 
 
 #define MD_ENTER_BLOCK(type, arg)                                           \
     do {                                                                    \
-        ret = ctx->parser.enter_block((type), (arg), ctx->userdata);        \
+        ret = MD_CALL_ENTER_BLOCK(((type), (arg), ctx->userdata));          \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from enter_block() callback.");                 \
             goto abort;                                                     \
@@ -475,7 +790,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 
 #define MD_LEAVE_BLOCK(type, arg)                                           \
     do {                                                                    \
-        ret = ctx->parser.leave_block((type), (arg), ctx->userdata);        \
+        ret = MD_CALL_LEAVE_BLOCK(((type), (arg), ctx->userdata));          \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from leave_block() callback.");                 \
             goto abort;                                                     \
@@ -484,7 +799,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 
 #define MD_ENTER_SPAN(type, arg)                                            \
     do {                                                                    \
-        ret = ctx->parser.enter_span((type), (arg), ctx->userdata);         \
+        ret = MD_CALL_ENTER_SPAN(((type), (arg), ctx->userdata));           \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from enter_span() callback.");                  \
             goto abort;                                                     \
@@ -493,7 +808,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 
 #define MD_LEAVE_SPAN(type, arg)                                            \
     do {                                                                    \
-        ret = ctx->parser.leave_span((type), (arg), ctx->userdata);         \
+        ret = MD_CALL_LEAVE_SPAN(((type), (arg), ctx->userdata));           \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from leave_span() callback.");                  \
             goto abort;                                                     \
@@ -503,7 +818,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 #define MD_TEXT(type, str, size)                                            \
     do {                                                                    \
         if(size > 0) {                                                      \
-            ret = ctx->parser.text((type), (str), (size), ctx->userdata);   \
+            ret = MD_CALL_TEXT(((type), (str), (size), ctx->userdata));     \
             if(ret != 0) {                                                  \
                 MD_LOG("Aborted from text() callback.");                    \
                 goto abort;                                                 \
@@ -570,229 +885,628 @@ struct MD_UNICODE_FOLD_INFO_tag {
 
 
 #if defined MD4C_USE_UTF16 || defined MD4C_USE_UTF8
-    /* Binary search over sorted "map" of codepoints. Consecutive sequences
-     * of codepoints may be encoded in the map by just using the
-     * (MIN_CODEPOINT | 0x40000000) and (MAX_CODEPOINT | 0x80000000).
-     *
-     * Returns index of the found record in the map (in the case of ranges,
-     * the minimal value is used); or -1 on failure. */
-    static int
-    md_unicode_bsearch__(unsigned codepoint, const unsigned* map, size_t map_size)
-    {
-        int beg, end;
-        int pivot_beg, pivot_end;
-
-        beg = 0;
-        end = (int) map_size-1;
-        while(beg <= end) {
-            /* Pivot may be a range, not just a single value. */
-            pivot_beg = pivot_end = (beg + end) / 2;
-            if(map[pivot_end] & 0x40000000)
-                pivot_end++;
-            if(map[pivot_beg] & 0x80000000)
-                pivot_beg--;
-
-            if(codepoint < (map[pivot_beg] & 0x00ffffff))
-                end = pivot_beg - 1;
-            else if(codepoint > (map[pivot_end] & 0x00ffffff))
-                beg = pivot_end + 1;
-            else
-                return pivot_beg;
-        }
-
-        return -1;
-    }
+    /* Lookup in a two-stage table generated by scripts/build_xxxx_map.py. The
+     * 1st stage maps each block of 128 codepoints to an index of a bitmap in
+     * the 2nd stage (16 bytes per bitmap). Blocks beyond the 1st stage contain
+     * no codepoint of interest. */
+    #define MD_UNICODE_MAP_LOOKUP(map_1, map_2, codepoint)                      \
+            (((codepoint) >> 7) < SIZEOF_ARRAY(map_1)  &&                       \
+             ((map_2)[(map_1)[(codepoint) >> 7] * 16 + (((codepoint) & 0x7f) >> 3)] & (1 << ((codepoint) & 0x7))))
 
     static int
     md_is_unicode_whitespace__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
         /* Unicode "Zs" category.
          * (generated by scripts/build_whitespace_map.py) */
-        static const unsigned WHITESPACE_MAP[] = {
-            S(0x0020), S(0x00a0), S(0x1680), R(0x2000,0x200a), S(0x202f), S(0x205f), S(0x3000)
+        static const unsigned char WHITESPACE_MAP_1[] = {
+            0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2
+        };
+        static const unsigned char WHITESPACE_MAP_2[] = {
+            0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00,
+            0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00
         };
-#undef R
-#undef S
 
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISWHITESPACE_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, WHITESPACE_MAP, SIZEOF_ARRAY(WHITESPACE_MAP)) >= 0);
+        return MD_UNICODE_MAP_LOOKUP(WHITESPACE_MAP_1, WHITESPACE_MAP_2, codepoint);
     }
 
     static int
     md_is_unicode_punct__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
         /* Unicode general "P" and "S" categories.
          * (generated by scripts/build_punct_map.py) */
-        static const unsigned PUNCT_MAP[] = {
-            R(0x0021,0x002f), R(0x003a,0x0040), R(0x005b,0x0060), R(0x007b,0x007e), R(0x00a1,0x00a9),
-            R(0x00ab,0x00ac), R(0x00ae,0x00b1), S(0x00b4), R(0x00b6,0x00b8), S(0x00bb), S(0x00bf), S(0x00d7),
-            S(0x00f7), R(0x02c2,0x02c5), R(0x02d2,0x02df), R(0x02e5,0x02eb), S(0x02ed), R(0x02ef,0x02ff), S(0x0375),
-            S(0x037e), R(0x0384,0x0385), S(0x0387), S(0x03f6), S(0x0482), R(0x055a,0x055f), R(0x0589,0x058a),
-            R(0x058d,0x058f), S(0x05be), S(0x05c0), S(0x05c3), S(0x05c6), R(0x05f3,0x05f4), R(0x0606,0x060f),
-            S(0x061b), R(0x061d,0x061f), R(0x066a,0x066d), S(0x06d4), S(0x06de), S(0x06e9), R(0x06fd,0x06fe),
-            R(0x0700,0x070d), R(0x07f6,0x07f9), R(0x07fe,0x07ff), R(0x0830,0x083e), S(0x085e), S(0x0888),
-            R(0x0964,0x0965), S(0x0970), R(0x09f2,0x09f3), R(0x09fa,0x09fb), S(0x09fd), S(0x0a76), R(0x0af0,0x0af1),
-            S(0x0b70), R(0x0bf3,0x0bfa), S(0x0c77), S(0x0c7f), S(0x0c84), S(0x0d4f), S(0x0d79), S(0x0df4), S(0x0e3f),
-            S(0x0e4f), R(0x0e5a,0x0e5b), R(0x0f01,0x0f17), R(0x0f1a,0x0f1f), S(0x0f34), S(0x0f36), S(0x0f38),
-            R(0x0f3a,0x0f3d), S(0x0f85), R(0x0fbe,0x0fc5), R(0x0fc7,0x0fcc), R(0x0fce,0x0fda), R(0x104a,0x104f),
-            R(0x109e,0x109f), S(0x10fb), R(0x1360,0x1368), R(0x1390,0x1399), S(0x1400), R(0x166d,0x166e),
-            R(0x169b,0x169c), R(0x16eb,0x16ed), R(0x1735,0x1736), R(0x17d4,0x17d6), R(0x17d8,0x17db),
-            R(0x1800,0x180a), S(0x1940), R(0x1944,0x1945), R(0x19de,0x19ff), R(0x1a1e,0x1a1f), R(0x1aa0,0x1aa6),
-            R(0x1aa8,0x1aad), R(0x1b4e,0x1b4f), R(0x1b5a,0x1b6a), R(0x1b74,0x1b7f), R(0x1bfc,0x1bff),
-            R(0x1c3b,0x1c3f), R(0x1c7e,0x1c7f), R(0x1cc0,0x1cc7), S(0x1cd3), S(0x1fbd), R(0x1fbf,0x1fc1),
-            R(0x1fcd,0x1fcf), R(0x1fdd,0x1fdf), R(0x1fed,0x1fef), R(0x1ffd,0x1ffe), R(0x2010,0x2027),
-            R(0x2030,0x205e), R(0x207a,0x207e), R(0x208a,0x208e), R(0x20a0,0x20c4), R(0x2100,0x2101),
-            R(0x2103,0x2106), R(0x2108,0x2109), S(0x2114), R(0x2116,0x2118), R(0x211e,0x2123), S(0x2125), S(0x2127),
-            S(0x2129), S(0x212e), R(0x213a,0x213b), R(0x2140,0x2144), R(0x214a,0x214d), S(0x214f), R(0x218a,0x218b),
-            R(0x2190,0x2429), R(0x2440,0x244a), R(0x249c,0x24e9), R(0x2500,0x2775), R(0x2794,0x2b73),
-            R(0x2b76,0x2bff), R(0x2ce5,0x2cea), R(0x2cf9,0x2cfc), R(0x2cfe,0x2cff), S(0x2d70), R(0x2e00,0x2e2e),
-            R(0x2e30,0x2e5d), R(0x2e60,0x2e63), R(0x2e80,0x2e99), R(0x2e9b,0x2ef3), R(0x2f00,0x2fd5),
-            R(0x2ff0,0x2fff), R(0x3001,0x3004), R(0x3008,0x3020), S(0x3030), R(0x3036,0x3037), R(0x303d,0x303f),
-            R(0x309b,0x309c), S(0x30a0), S(0x30fb), R(0x3190,0x3191), R(0x3196,0x319f), R(0x31c0,0x31e5), S(0x31ef),
-            R(0x3200,0x321e), R(0x322a,0x3247), S(0x3250), R(0x3260,0x327f), R(0x328a,0x32b0), R(0x32c0,0x33ff),
-            R(0x4dc0,0x4dff), R(0xa490,0xa4c6), R(0xa4fe,0xa4ff), R(0xa60d,0xa60f), S(0xa673), S(0xa67e),
-            R(0xa6f2,0xa6f7), R(0xa700,0xa716), R(0xa720,0xa721), R(0xa789,0xa78a), R(0xa828,0xa82b),
-            R(0xa836,0xa839), R(0xa874,0xa877), R(0xa8ce,0xa8cf), R(0xa8f8,0xa8fa), S(0xa8fc), R(0xa92e,0xa92f),
-            S(0xa95f), R(0xa9c1,0xa9cd), R(0xa9de,0xa9df), R(0xaa5c,0xaa5f), R(0xaa77,0xaa79), R(0xaade,0xaadf),
-            R(0xaaf0,0xaaf1), S(0xab5b), R(0xab6a,0xab6b), S(0xabeb), S(0xfb29), R(0xfbb2,0xfbd2), R(0xfd3e,0xfd4f),
-            R(0xfd90,0xfd91), R(0xfdc8,0xfdcf), R(0xfdfc,0xfdff), R(0xfe10,0xfe19), R(0xfe30,0xfe52),
-            R(0xfe54,0xfe66), R(0xfe68,0xfe6b), R(0xff01,0xff0f), R(0xff1a,0xff20), R(0xff3b,0xff40),
-            R(0xff5b,0xff65), R(0xffe0,0xffe6), R(0xffe8,0xffee), R(0xfffc,0xfffd), R(0x10100,0x10102),
-            R(0x10137,0x1013f), R(0x10179,0x10189), R(0x1018c,0x1018e), R(0x10190,0x1019c), S(0x101a0),
-            R(0x101d0,0x101fc), S(0x1039f), S(0x103d0), S(0x1056f), S(0x10857), R(0x10877,0x10878), S(0x1091f),
-            S(0x1093f), R(0x10a50,0x10a58), S(0x10a7f), S(0x10ac8), R(0x10af0,0x10af6), R(0x10b39,0x10b3f),
-            R(0x10b99,0x10b9c), S(0x10d6e), R(0x10d8e,0x10d8f), S(0x10ead), R(0x10ec9,0x10eca), R(0x10ed0,0x10ed8),
-            R(0x10f55,0x10f59), R(0x10f86,0x10f89), R(0x11047,0x1104d), R(0x110bb,0x110bc), R(0x110be,0x110c1),
-            R(0x11140,0x11143), R(0x11174,0x11175), R(0x111c5,0x111c8), S(0x111cd), S(0x111db), R(0x111dd,0x111df),
-            R(0x11238,0x1123d), S(0x112a9), R(0x113d4,0x113d5), R(0x113d7,0x113d8), R(0x1144b,0x1144f),
-            R(0x1145a,0x1145b), S(0x1145d), S(0x114c6), R(0x115c1,0x115d7), R(0x11641,0x11643), R(0x11660,0x1166c),
-            S(0x116b9), R(0x1173c,0x1173f), S(0x1183b), R(0x11944,0x11946), S(0x119e2), R(0x11a3f,0x11a46),
-            R(0x11a9a,0x11a9c), R(0x11a9e,0x11aa2), R(0x11b00,0x11b09), S(0x11be1), R(0x11c41,0x11c45),
-            R(0x11c70,0x11c71), R(0x11ef7,0x11ef8), R(0x11f43,0x11f4f), R(0x11fd5,0x11ff1), S(0x11fff),
-            R(0x12470,0x12474), R(0x12ff1,0x12ff2), R(0x16a6e,0x16a6f), S(0x16af5), R(0x16b37,0x16b3f),
-            R(0x16b44,0x16b45), R(0x16d6d,0x16d6f), R(0x16e97,0x16e9a), S(0x16fe2), S(0x1bc9c), S(0x1bc9f),
-            R(0x1cc00,0x1ccef), R(0x1ccfa,0x1ccfc), R(0x1cd00,0x1ceb3), R(0x1ceba,0x1ced0), R(0x1ced2,0x1ced4),
-            R(0x1cedd,0x1cefd), R(0x1cf50,0x1cfc3), R(0x1d000,0x1d0f5), R(0x1d100,0x1d126), R(0x1d129,0x1d164),
-            R(0x1d16a,0x1d16c), R(0x1d183,0x1d184), R(0x1d18c,0x1d1a9), R(0x1d1ae,0x1d241), S(0x1d245),
-            R(0x1d253,0x1d25a), R(0x1d25d,0x1d25e), R(0x1d260,0x1d27f), R(0x1d300,0x1d356), S(0x1d6c1), S(0x1d6db),
-            S(0x1d6fb), S(0x1d715), S(0x1d735), S(0x1d74f), S(0x1d76f), S(0x1d789), S(0x1d7a9), S(0x1d7c3),
-            R(0x1d800,0x1d9ff), R(0x1da37,0x1da3a), R(0x1da6d,0x1da74), R(0x1da76,0x1da83), R(0x1da85,0x1da8b),
-            R(0x1db00,0x1db1c), S(0x1e14f), S(0x1e2ff), S(0x1e5ff), R(0x1e95e,0x1e95f), S(0x1ecac), S(0x1ecb0),
-            S(0x1ed2e), R(0x1eef0,0x1eef1), R(0x1f000,0x1f02b), R(0x1f030,0x1f093), R(0x1f0a0,0x1f0ae),
-            R(0x1f0b1,0x1f0bf), R(0x1f0c1,0x1f0cf), R(0x1f0d1,0x1f0f5), R(0x1f10d,0x1f1ae), R(0x1f1e6,0x1f202),
-            R(0x1f210,0x1f23b), R(0x1f240,0x1f248), R(0x1f250,0x1f251), R(0x1f260,0x1f265), R(0x1f300,0x1f6d9),
-            R(0x1f6dc,0x1f6ec), R(0x1f6f0,0x1f6fc), R(0x1f700,0x1f7db), R(0x1f7e0,0x1f7eb), R(0x1f7f0,0x1f80b),
-            R(0x1f810,0x1f847), R(0x1f850,0x1f859), R(0x1f860,0x1f887), R(0x1f890,0x1f8ad), R(0x1f8b0,0x1f8bb),
-            R(0x1f8c0,0x1f8c1), R(0x1f8d0,0x1f8d8), R(0x1f900,0x1fa57), R(0x1fa60,0x1fa6d), R(0x1fa70,0x1fa7c),
-            R(0x1fa80,0x1fac6), S(0x1fac8), R(0x1facc,0x1fadd), R(0x1fadf,0x1faeb), R(0x1faef,0x1fafa),
-            R(0x1fb00,0x1fb92), R(0x1fb94,0x1fbef), S(0x1fbfa)
+        static const unsigned char PUNCT_MAP_1[] = {
+            0, 1, 2, 2, 2, 3, 4, 5, 2, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 2,
+            26, 27, 28, 29, 2, 2, 2, 2, 30, 31, 32, 2, 2, 2, 33, 34, 35, 36, 37, 2, 38, 39, 40, 41, 42, 43, 44, 45, 2,
+            2, 2, 2, 2, 46, 47, 48, 49, 50, 51, 51, 51, 51, 52, 53, 51, 51, 51, 51, 54, 55, 51, 51, 51, 51, 51, 51,
+            56, 51, 2, 57, 19, 2, 58, 59, 51, 60, 61, 62, 2, 63, 64, 65, 51, 51, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 66, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 67, 2, 2, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 80, 81, 2, 2, 82, 83, 84, 2, 85, 86, 2, 2, 87, 88, 2, 2, 2, 89, 2, 2, 90, 2, 2, 2, 2, 2,
+            91, 2, 92, 2, 93, 94, 95, 96, 2, 2, 97, 98, 2, 99, 100, 101, 102, 103, 104, 105, 106, 80, 2, 107, 108,
+            109, 2, 110, 111, 112, 113, 2, 114, 2, 115, 116, 117, 118, 119, 120, 121, 2, 2, 2, 2, 122, 123, 124, 2, 2,
+            2, 2, 2, 2, 2, 2, 125, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 126, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 127, 128, 129, 2, 2, 2, 130, 2, 2, 131, 2, 116, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 132, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 51, 133,
+            51, 51, 51, 134, 135, 136, 51, 54, 137, 138, 139, 2, 140, 2, 2, 2, 2, 2, 2, 141, 142, 143, 51, 51, 51, 51,
+            144, 145, 146, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 147, 2, 2, 148, 2, 2, 2, 2, 2, 148, 2, 2, 2, 2, 2, 2, 149,
+            2, 2, 2, 2, 2, 2, 150, 151, 2, 2, 18, 2, 2, 152, 153, 154, 155, 156, 2, 51, 51, 51, 51, 51, 51, 51, 157,
+            51, 158, 159, 160, 51, 51, 161, 162, 51, 163
+        };
+        static const unsigned char PUNCT_MAP_2[] = {
+            0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x78, 0x00,
+            0x00, 0x00, 0x00, 0xfe, 0xdb, 0xd3, 0x89, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0xfc, 0xff, 0xe0, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0xb0, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+            0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xc0, 0xff, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x10, 0x40, 0x00, 0x02, 0x00, 0x60, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0xc0, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x40, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x01,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2c,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+            0x00, 0x80, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x50, 0x3d, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xbf, 0xdf,
+            0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3f, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xc0, 0x00, 0xfc, 0xff, 0x07, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x08,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x03, 0xe0, 0x00, 0xe0,
+            0x00, 0xe0, 0x00, 0x60, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00,
+            0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x7b, 0x03, 0xd0, 0xc1, 0xaf, 0x42, 0x00, 0x0c, 0x1f, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xf0, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0x3f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff, 0x01, 0x00, 0xc1, 0xe0, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc3, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+            0x3f, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0xff,
+            0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+            0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xff, 0xff,
+            0x7f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x0f, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xfe, 0x3f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xf0, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x7f, 0x0f, 0x00, 0x00,
+            0xfe, 0xff, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x30, 0x07, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x73, 0xff,
+            0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x80,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+            0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x40, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0xff, 0x01, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00,
+            0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0xf8, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+            0x00, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0xdc, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x30, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xff, 0xff, 0x1d, 0xe0, 0xff, 0xff, 0xff,
+            0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+            0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1c, 0x00, 0x00, 0x18, 0xf0,
+            0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x00, 0xf8, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+            0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00,
+            0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xdf, 0xff, 0xef, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0x0f, 0x00, 0xff, 0x7f, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00,
+            0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x07, 0x00, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x01, 0x03, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0x00, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x3f, 0xff,
+            0x0f, 0x03, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+            0xf1, 0xff, 0xbf, 0xff, 0x8f, 0xff, 0x07, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xff, 0xff, 0xff, 0xff, 0x00, 0x04
         };
-#undef R
-#undef S
 
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISPUNCT_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, PUNCT_MAP, SIZEOF_ARRAY(PUNCT_MAP)) >= 0);
+        return MD_UNICODE_MAP_LOOKUP(PUNCT_MAP_1, PUNCT_MAP_2, codepoint);
     }
 
     static void
     md_get_unicode_fold_info(unsigned codepoint, MD_UNICODE_FOLD_INFO* info)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode "Pc", "Pd", "Pe", "Pf", "Pi", "Po", "Ps" categories.
+        /* Unicode "C" and "F" foldings, in a two-stage lookup table. The 1st
+         * stage maps each block of 64 codepoints to a record of 64 entries in
+         * the 2nd stage. Each entry is zero (no folding), or (N << 14) | I for
+         * the folding FOLD_MAP_<N>_DATA[I].
          * (generated by scripts/build_folding_map.py) */
-        static const unsigned FOLD_MAP_1[] = {
-            R(0x0041,0x005a), S(0x00b5), R(0x00c0,0x00d6), R(0x00d8,0x00de), R(0x0100,0x012e), R(0x0132,0x0136),
-            R(0x0139,0x0147), R(0x014a,0x0176), S(0x0178), R(0x0179,0x017d), S(0x017f), S(0x0181), S(0x0182),
-            S(0x0184), S(0x0186), S(0x0187), S(0x0189), S(0x018a), S(0x018b), S(0x018e), S(0x018f), S(0x0190),
-            S(0x0191), S(0x0193), S(0x0194), S(0x0196), S(0x0197), S(0x0198), S(0x019c), S(0x019d), S(0x019f),
-            R(0x01a0,0x01a4), S(0x01a6), S(0x01a7), S(0x01a9), S(0x01ac), S(0x01ae), S(0x01af), S(0x01b1), S(0x01b2),
-            S(0x01b3), S(0x01b5), S(0x01b7), S(0x01b8), S(0x01bc), S(0x01c4), S(0x01c5), S(0x01c7), S(0x01c8),
-            S(0x01ca), R(0x01cb,0x01db), R(0x01de,0x01ee), S(0x01f1), S(0x01f2), S(0x01f4), S(0x01f6), S(0x01f7),
-            R(0x01f8,0x021e), S(0x0220), R(0x0222,0x0232), S(0x023a), S(0x023b), S(0x023d), S(0x023e), S(0x0241),
-            S(0x0243), S(0x0244), S(0x0245), R(0x0246,0x024e), S(0x0345), S(0x0370), S(0x0372), S(0x0376), S(0x037f),
-            S(0x0386), R(0x0388,0x038a), S(0x038c), S(0x038e), S(0x038f), R(0x0391,0x03a1), R(0x03a3,0x03ab),
-            S(0x03c2), S(0x03cf), S(0x03d0), S(0x03d1), S(0x03d5), S(0x03d6), R(0x03d8,0x03ee), S(0x03f0), S(0x03f1),
-            S(0x03f4), S(0x03f5), S(0x03f7), S(0x03f9), S(0x03fa), R(0x03fd,0x03ff), R(0x0400,0x040f),
-            R(0x0410,0x042f), R(0x0460,0x0480), R(0x048a,0x04be), S(0x04c0), R(0x04c1,0x04cd), R(0x04d0,0x052e),
-            R(0x0531,0x0556), R(0x10a0,0x10c5), S(0x10c7), S(0x10cd), R(0x13f8,0x13fd), S(0x1c80), S(0x1c81),
-            S(0x1c82), S(0x1c83), S(0x1c84), S(0x1c85), S(0x1c86), S(0x1c87), S(0x1c88), S(0x1c89), R(0x1c90,0x1cba),
-            R(0x1cbd,0x1cbf), R(0x1e00,0x1e94), S(0x1e9b), R(0x1ea0,0x1efe), R(0x1f08,0x1f0f), R(0x1f18,0x1f1d),
-            R(0x1f28,0x1f2f), R(0x1f38,0x1f3f), R(0x1f48,0x1f4d), S(0x1f59), S(0x1f5b), S(0x1f5d), S(0x1f5f),
-            R(0x1f68,0x1f6f), S(0x1fb8), S(0x1fb9), S(0x1fba), S(0x1fbb), S(0x1fbe), R(0x1fc8,0x1fcb), S(0x1fd8),
-            S(0x1fd9), S(0x1fda), S(0x1fdb), S(0x1fe8), S(0x1fe9), S(0x1fea), S(0x1feb), S(0x1fec), S(0x1ff8),
-            S(0x1ff9), S(0x1ffa), S(0x1ffb), S(0x2126), S(0x212a), S(0x212b), S(0x2132), R(0x2160,0x216f), S(0x2183),
-            R(0x24b6,0x24cf), R(0x2c00,0x2c2f), S(0x2c60), S(0x2c62), S(0x2c63), S(0x2c64), R(0x2c67,0x2c6b),
-            S(0x2c6d), S(0x2c6e), S(0x2c6f), S(0x2c70), S(0x2c72), S(0x2c75), S(0x2c7e), S(0x2c7f), R(0x2c80,0x2ce2),
-            S(0x2ceb), S(0x2ced), S(0x2cf2), R(0xa640,0xa66c), R(0xa680,0xa69a), R(0xa722,0xa72e), R(0xa732,0xa76e),
-            S(0xa779), S(0xa77b), S(0xa77d), R(0xa77e,0xa786), S(0xa78b), S(0xa78d), S(0xa790), S(0xa792),
-            R(0xa796,0xa7a8), S(0xa7aa), S(0xa7ab), S(0xa7ac), S(0xa7ad), S(0xa7ae), S(0xa7b0), S(0xa7b1), S(0xa7b2),
-            S(0xa7b3), R(0xa7b4,0xa7c2), S(0xa7c4), S(0xa7c5), S(0xa7c6), S(0xa7c7), S(0xa7c9), S(0xa7cb),
-            R(0xa7cc,0xa7da), S(0xa7dc), S(0xa7dd), S(0xa7e2), S(0xa7f5), S(0xab6c), S(0xab6d), R(0xab70,0xabbf),
-            R(0xff21,0xff3a), R(0x10400,0x10427), R(0x104b0,0x104d3), R(0x10570,0x1057a), R(0x1057c,0x1058a),
-            R(0x1058c,0x10592), S(0x10594), S(0x10595), R(0x10c80,0x10cb2), R(0x10d50,0x10d65), R(0x118a0,0x118bf),
-            R(0x16e40,0x16e5f), R(0x16ea0,0x16eb8), S(0x1df40), S(0x1df48), S(0x1df4a), S(0x1df4d), S(0x1df51),
-            R(0x1df68,0x1df6e), R(0x1df72,0x1df7e), R(0x1e900,0x1e921)
+        static const unsigned char FOLD_MAP_INDEX_1[] = {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+            21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 24, 25, 26, 27, 28, 29, 30, 31, 0, 0, 0, 0, 32, 33,
+            34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 37, 38, 39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 43, 44, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 48, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            51, 0, 52, 53, 0, 54, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            56, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 59, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 61, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 63
         };
-        static const unsigned FOLD_MAP_1_DATA[] = {
-            0x0061, 0x007a, 0x03bc, 0x00e0, 0x00f6, 0x00f8, 0x00fe, 0x0101, 0x012f, 0x0133, 0x0137, 0x013a, 0x0148,
-            0x014b, 0x0177, 0x00ff, 0x017a, 0x017e, 0x0073, 0x0253, 0x0183, 0x0185, 0x0254, 0x0188, 0x0256, 0x0257,
-            0x018c, 0x01dd, 0x0259, 0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f, 0x0272, 0x0275,
-            0x01a1, 0x01a5, 0x0280, 0x01a8, 0x0283, 0x01ad, 0x0288, 0x01b0, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292,
-            0x01b9, 0x01bd, 0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc, 0x01dc, 0x01df, 0x01ef, 0x01f3, 0x01f3,
-            0x01f5, 0x0195, 0x01bf, 0x01f9, 0x021f, 0x019e, 0x0223, 0x0233, 0x2c65, 0x023c, 0x019a, 0x2c66, 0x0242,
-            0x0180, 0x0289, 0x028c, 0x0247, 0x024f, 0x03b9, 0x0371, 0x0373, 0x0377, 0x03f3, 0x03ac, 0x03ad, 0x03af,
-            0x03cc, 0x03cd, 0x03ce, 0x03b1, 0x03c1, 0x03c3, 0x03cb, 0x03c3, 0x03d7, 0x03b2, 0x03b8, 0x03c6, 0x03c0,
-            0x03d9, 0x03ef, 0x03ba, 0x03c1, 0x03b8, 0x03b5, 0x03f8, 0x03f2, 0x03fb, 0x037b, 0x037d, 0x0450, 0x045f,
-            0x0430, 0x044f, 0x0461, 0x0481, 0x048b, 0x04bf, 0x04cf, 0x04c2, 0x04ce, 0x04d1, 0x052f, 0x0561, 0x0586,
-            0x2d00, 0x2d25, 0x2d27, 0x2d2d, 0x13f0, 0x13f5, 0x0432, 0x0434, 0x043e, 0x0441, 0x0442, 0x0442, 0x044a,
-            0x0463, 0xa64b, 0x1c8a, 0x10d0, 0x10fa, 0x10fd, 0x10ff, 0x1e01, 0x1e95, 0x1e61, 0x1ea1, 0x1eff, 0x1f00,
-            0x1f07, 0x1f10, 0x1f15, 0x1f20, 0x1f27, 0x1f30, 0x1f37, 0x1f40, 0x1f45, 0x1f51, 0x1f53, 0x1f55, 0x1f57,
-            0x1f60, 0x1f67, 0x1fb0, 0x1fb1, 0x1f70, 0x1f71, 0x03b9, 0x1f72, 0x1f75, 0x1fd0, 0x1fd1, 0x1f76, 0x1f77,
-            0x1fe0, 0x1fe1, 0x1f7a, 0x1f7b, 0x1fe5, 0x1f78, 0x1f79, 0x1f7c, 0x1f7d, 0x03c9, 0x006b, 0x00e5, 0x214e,
-            0x2170, 0x217f, 0x2184, 0x24d0, 0x24e9, 0x2c30, 0x2c5f, 0x2c61, 0x026b, 0x1d7d, 0x027d, 0x2c68, 0x2c6c,
-            0x0251, 0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76, 0x023f, 0x0240, 0x2c81, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3,
-            0xa641, 0xa66d, 0xa681, 0xa69b, 0xa723, 0xa72f, 0xa733, 0xa76f, 0xa77a, 0xa77c, 0x1d79, 0xa77f, 0xa787,
-            0xa78c, 0x0265, 0xa791, 0xa793, 0xa797, 0xa7a9, 0x0266, 0x025c, 0x0261, 0x026c, 0x026a, 0x029e, 0x0287,
-            0x029d, 0xab53, 0xa7b5, 0xa7c3, 0xa794, 0x0282, 0x1d8e, 0xa7c8, 0xa7ca, 0x0264, 0xa7cd, 0xa7db, 0x019b,
-            0x0277, 0x027c, 0xa7f6, 0xab4b, 0xab4c, 0x13a0, 0x13ef, 0xff41, 0xff5a, 0x10428, 0x1044f, 0x104d8,
-            0x104fb, 0x10597, 0x105a1, 0x105a3, 0x105b1, 0x105b3, 0x105b9, 0x105bb, 0x105bc, 0x10cc0, 0x10cf2,
-            0x10d70, 0x10d85, 0x118c0, 0x118df, 0x16e60, 0x16e7f, 0x16ebb, 0x16ed3, 0x1df41, 0x1df49, 0x1df4b,
-            0x1df4e, 0x1df52, 0x1df69, 0x1df6f, 0x1df73, 0x1df7f, 0x1e922, 0x1e943
+        static const unsigned short FOLD_MAP_INDEX_2[] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 16385,
+            16386, 16387, 16388, 16389, 16390, 16391, 16392, 16393, 16394, 16395, 16396, 16397, 16398, 16399, 16400,
+            16401, 16402, 16403, 16404, 16405, 16406, 16407, 16408, 16409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 16410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16411, 16412, 16413, 16414, 16415, 16416, 16417,
+            16418, 16419, 16420, 16421, 16422, 16423, 16424, 16425, 16426, 16427, 16428, 16429, 16430, 16431, 16432,
+            16433, 0, 16434, 16435, 16436, 16437, 16438, 16439, 16440, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16441, 0, 16442, 0, 16443, 0, 16444, 0, 16445, 0,
+            16446, 0, 16447, 0, 16448, 0, 16449, 0, 16450, 0, 16451, 0, 16452, 0, 16453, 0, 16454, 0, 16455, 0, 16456,
+            0, 16457, 0, 16458, 0, 16459, 0, 16460, 0, 16461, 0, 16462, 0, 16463, 0, 16464, 0, 32769, 0, 16465, 0,
+            16466, 0, 16467, 0, 0, 16468, 0, 16469, 0, 16470, 0, 16471, 0, 16472, 0, 16473, 0, 16474, 0, 16475, 0,
+            32770, 16476, 0, 16477, 0, 16478, 0, 16479, 0, 16480, 0, 16481, 0, 16482, 0, 16483, 0, 16484, 0, 16485, 0,
+            16486, 0, 16487, 0, 16488, 0, 16489, 0, 16490, 0, 16491, 0, 16492, 0, 16493, 0, 16494, 0, 16495, 0, 16496,
+            0, 16497, 0, 16498, 0, 16499, 16500, 0, 16501, 0, 16502, 0, 16503, 0, 16504, 16505, 0, 16506, 0, 16507,
+            16508, 0, 16509, 16510, 16511, 0, 0, 16512, 16513, 16514, 16515, 0, 16516, 16517, 0, 16518, 16519, 16520,
+            0, 0, 0, 16521, 16522, 0, 16523, 16524, 0, 16525, 0, 16526, 0, 16527, 16528, 0, 16529, 0, 0, 16530, 0,
+            16531, 16532, 0, 16533, 16534, 16535, 0, 16536, 0, 16537, 16538, 0, 0, 0, 16539, 0, 0, 0, 0, 0, 0, 0,
+            16540, 16541, 0, 16542, 16543, 0, 16544, 16545, 0, 16546, 0, 16547, 0, 16548, 0, 16549, 0, 16550, 0,
+            16551, 0, 16552, 0, 16553, 0, 0, 16554, 0, 16555, 0, 16556, 0, 16557, 0, 16558, 0, 16559, 0, 16560, 0,
+            16561, 0, 16562, 0, 32771, 16563, 16564, 0, 16565, 0, 16566, 16567, 16568, 0, 16569, 0, 16570, 0, 16571,
+            0, 16572, 0, 16573, 0, 16574, 0, 16575, 0, 16576, 0, 16577, 0, 16578, 0, 16579, 0, 16580, 0, 16581, 0,
+            16582, 0, 16583, 0, 16584, 0, 16585, 0, 16586, 0, 16587, 0, 16588, 0, 16589, 0, 16590, 0, 16591, 0, 16592,
+            0, 16593, 0, 16594, 0, 16595, 0, 16596, 0, 16597, 0, 0, 0, 0, 0, 0, 0, 16598, 16599, 0, 16600, 16601, 0,
+            0, 16602, 0, 16603, 16604, 16605, 16606, 0, 16607, 0, 16608, 0, 16609, 0, 16610, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16612, 0, 16613, 0, 0, 0, 16614, 0, 0, 0, 0,
+            0, 0, 0, 0, 16615, 0, 0, 0, 0, 0, 0, 16616, 0, 16617, 16618, 16619, 0, 16620, 0, 16621, 16622, 49152,
+            16623, 16624, 16625, 16626, 16627, 16628, 16629, 16630, 16631, 16632, 16633, 16634, 16635, 16636, 16637,
+            16638, 16639, 0, 16640, 16641, 16642, 16643, 16644, 16645, 16646, 16647, 16648, 0, 0, 0, 0, 49153, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16650, 16651,
+            16652, 0, 0, 0, 16653, 16654, 0, 16655, 0, 16656, 0, 16657, 0, 16658, 0, 16659, 0, 16660, 0, 16661, 0,
+            16662, 0, 16663, 0, 16664, 0, 16665, 0, 16666, 0, 16667, 16668, 0, 0, 16669, 16670, 0, 16671, 0, 16672,
+            16673, 0, 0, 16674, 16675, 16676, 16677, 16678, 16679, 16680, 16681, 16682, 16683, 16684, 16685, 16686,
+            16687, 16688, 16689, 16690, 16691, 16692, 16693, 16694, 16695, 16696, 16697, 16698, 16699, 16700, 16701,
+            16702, 16703, 16704, 16705, 16706, 16707, 16708, 16709, 16710, 16711, 16712, 16713, 16714, 16715, 16716,
+            16717, 16718, 16719, 16720, 16721, 16722, 16723, 16724, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16725, 0,
+            16726, 0, 16727, 0, 16728, 0, 16729, 0, 16730, 0, 16731, 0, 16732, 0, 16733, 0, 16734, 0, 16735, 0, 16736,
+            0, 16737, 0, 16738, 0, 16739, 0, 16740, 0, 16741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16742, 0, 16743, 0, 16744, 0,
+            16745, 0, 16746, 0, 16747, 0, 16748, 0, 16749, 0, 16750, 0, 16751, 0, 16752, 0, 16753, 0, 16754, 0, 16755,
+            0, 16756, 0, 16757, 0, 16758, 0, 16759, 0, 16760, 0, 16761, 0, 16762, 0, 16763, 0, 16764, 0, 16765, 0,
+            16766, 0, 16767, 0, 16768, 0, 16769, 16770, 0, 16771, 0, 16772, 0, 16773, 0, 16774, 0, 16775, 0, 16776, 0,
+            0, 16777, 0, 16778, 0, 16779, 0, 16780, 0, 16781, 0, 16782, 0, 16783, 0, 16784, 0, 16785, 0, 16786, 0,
+            16787, 0, 16788, 0, 16789, 0, 16790, 0, 16791, 0, 16792, 0, 16793, 0, 16794, 0, 16795, 0, 16796, 0, 16797,
+            0, 16798, 0, 16799, 0, 16800, 0, 16801, 0, 16802, 0, 16803, 0, 16804, 0, 16805, 0, 16806, 0, 16807, 0,
+            16808, 0, 16809, 0, 16810, 0, 16811, 0, 16812, 0, 16813, 0, 16814, 0, 16815, 0, 16816, 0, 16817, 0, 16818,
+            0, 16819, 0, 16820, 0, 16821, 0, 16822, 0, 16823, 0, 16824, 0, 0, 16825, 16826, 16827, 16828, 16829,
+            16830, 16831, 16832, 16833, 16834, 16835, 16836, 16837, 16838, 16839, 16840, 16841, 16842, 16843, 16844,
+            16845, 16846, 16847, 16848, 16849, 16850, 16851, 16852, 16853, 16854, 16855, 16856, 16857, 16858, 16859,
+            16860, 16861, 16862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32772, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 16863, 16864, 16865, 16866, 16867, 16868, 16869, 16870, 16871, 16872, 16873, 16874, 16875,
+            16876, 16877, 16878, 16879, 16880, 16881, 16882, 16883, 16884, 16885, 16886, 16887, 16888, 16889, 16890,
+            16891, 16892, 16893, 16894, 16895, 16896, 16897, 16898, 16899, 16900, 0, 16901, 0, 0, 0, 0, 0, 16902, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            16903, 16904, 16905, 16906, 16907, 16908, 0, 0, 16909, 16910, 16911, 16912, 16913, 16914, 16915, 16916,
+            16917, 16918, 0, 0, 0, 0, 0, 0, 16919, 16920, 16921, 16922, 16923, 16924, 16925, 16926, 16927, 16928,
+            16929, 16930, 16931, 16932, 16933, 16934, 16935, 16936, 16937, 16938, 16939, 16940, 16941, 16942, 16943,
+            16944, 16945, 16946, 16947, 16948, 16949, 16950, 16951, 16952, 16953, 16954, 16955, 16956, 16957, 16958,
+            16959, 16960, 16961, 0, 0, 16962, 16963, 16964, 16965, 0, 16966, 0, 16967, 0, 16968, 0, 16969, 0, 16970,
+            0, 16971, 0, 16972, 0, 16973, 0, 16974, 0, 16975, 0, 16976, 0, 16977, 0, 16978, 0, 16979, 0, 16980, 0,
+            16981, 0, 16982, 0, 16983, 0, 16984, 0, 16985, 0, 16986, 0, 16987, 0, 16988, 0, 16989, 0, 16990, 0, 16991,
+            0, 16992, 0, 16993, 0, 16994, 0, 16995, 0, 16996, 0, 16997, 0, 16998, 0, 16999, 0, 17000, 0, 17001, 0,
+            17002, 0, 17003, 0, 17004, 0, 17005, 0, 17006, 0, 17007, 0, 17008, 0, 17009, 0, 17010, 0, 17011, 0, 17012,
+            0, 17013, 0, 17014, 0, 17015, 0, 17016, 0, 17017, 0, 17018, 0, 17019, 0, 17020, 0, 17021, 0, 17022, 0,
+            17023, 0, 17024, 0, 17025, 0, 17026, 0, 17027, 0, 17028, 0, 17029, 0, 17030, 0, 17031, 0, 17032, 0, 17033,
+            0, 17034, 0, 17035, 0, 17036, 0, 17037, 0, 17038, 0, 17039, 0, 32773, 32774, 32775, 32776, 32777, 17040,
+            0, 0, 32778, 0, 17041, 0, 17042, 0, 17043, 0, 17044, 0, 17045, 0, 17046, 0, 17047, 0, 17048, 0, 17049, 0,
+            17050, 0, 17051, 0, 17052, 0, 17053, 0, 17054, 0, 17055, 0, 17056, 0, 17057, 0, 17058, 0, 17059, 0, 17060,
+            0, 17061, 0, 17062, 0, 17063, 0, 17064, 0, 17065, 0, 17066, 0, 17067, 0, 17068, 0, 17069, 0, 17070, 0,
+            17071, 0, 17072, 0, 17073, 0, 17074, 0, 17075, 0, 17076, 0, 17077, 0, 17078, 0, 17079, 0, 17080, 0, 17081,
+            0, 17082, 0, 17083, 0, 17084, 0, 17085, 0, 17086, 0, 17087, 0, 17088, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17089,
+            17090, 17091, 17092, 17093, 17094, 17095, 17096, 0, 0, 0, 0, 0, 0, 0, 0, 17097, 17098, 17099, 17100,
+            17101, 17102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17103, 17104, 17105, 17106, 17107, 17108, 17109, 17110, 0, 0,
+            0, 0, 0, 0, 0, 0, 17111, 17112, 17113, 17114, 17115, 17116, 17117, 17118, 0, 0, 0, 0, 0, 0, 0, 0, 17119,
+            17120, 17121, 17122, 17123, 17124, 0, 0, 32779, 0, 49154, 0, 49155, 0, 49156, 0, 0, 17125, 0, 17126, 0,
+            17127, 0, 17128, 0, 0, 0, 0, 0, 0, 0, 0, 17129, 17130, 17131, 17132, 17133, 17134, 17135, 17136, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32780, 32781, 32782, 32783, 32784, 32785, 32786, 32787, 32788,
+            32789, 32790, 32791, 32792, 32793, 32794, 32795, 32796, 32797, 32798, 32799, 32800, 32801, 32802, 32803,
+            32804, 32805, 32806, 32807, 32808, 32809, 32810, 32811, 32812, 32813, 32814, 32815, 32816, 32817, 32818,
+            32819, 32820, 32821, 32822, 32823, 32824, 32825, 32826, 32827, 0, 0, 32828, 32829, 32830, 0, 32831, 49157,
+            17137, 17138, 17139, 17140, 32832, 0, 17141, 0, 0, 0, 32833, 32834, 32835, 0, 32836, 49158, 17142, 17143,
+            17144, 17145, 32837, 0, 0, 0, 0, 0, 49159, 49160, 0, 0, 32838, 49161, 17146, 17147, 17148, 17149, 0, 0, 0,
+            0, 0, 0, 49162, 49163, 32839, 0, 32840, 49164, 17150, 17151, 17152, 17153, 17154, 0, 0, 0, 0, 0, 32841,
+            32842, 32843, 0, 32844, 49165, 17155, 17156, 17157, 17158, 32845, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17159, 0, 0, 0, 17160,
+            17161, 0, 0, 0, 0, 0, 0, 17162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17163, 17164, 17165, 17166, 17167, 17168,
+            17169, 17170, 17171, 17172, 17173, 17174, 17175, 17176, 17177, 17178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 17179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17180, 17181, 17182, 17183, 17184, 17185, 17186,
+            17187, 17188, 17189, 17190, 17191, 17192, 17193, 17194, 17195, 17196, 17197, 17198, 17199, 17200, 17201,
+            17202, 17203, 17204, 17205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17206, 17207, 17208, 17209, 17210,
+            17211, 17212, 17213, 17214, 17215, 17216, 17217, 17218, 17219, 17220, 17221, 17222, 17223, 17224, 17225,
+            17226, 17227, 17228, 17229, 17230, 17231, 17232, 17233, 17234, 17235, 17236, 17237, 17238, 17239, 17240,
+            17241, 17242, 17243, 17244, 17245, 17246, 17247, 17248, 17249, 17250, 17251, 17252, 17253, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 17254, 0, 17255, 17256, 17257, 0, 0, 17258, 0, 17259, 0, 17260, 0, 17261, 17262,
+            17263, 17264, 0, 17265, 0, 0, 17266, 0, 0, 0, 0, 0, 0, 0, 0, 17267, 17268, 17269, 0, 17270, 0, 17271, 0,
+            17272, 0, 17273, 0, 17274, 0, 17275, 0, 17276, 0, 17277, 0, 17278, 0, 17279, 0, 17280, 0, 17281, 0, 17282,
+            0, 17283, 0, 17284, 0, 17285, 0, 17286, 0, 17287, 0, 17288, 0, 17289, 0, 17290, 0, 17291, 0, 17292, 0,
+            17293, 0, 17294, 0, 17295, 0, 17296, 0, 17297, 0, 17298, 0, 17299, 0, 17300, 0, 17301, 0, 17302, 0, 17303,
+            0, 17304, 0, 17305, 0, 17306, 0, 17307, 0, 17308, 0, 17309, 0, 17310, 0, 17311, 0, 17312, 0, 17313, 0,
+            17314, 0, 17315, 0, 17316, 0, 17317, 0, 17318, 0, 0, 0, 0, 0, 0, 0, 0, 17319, 0, 17320, 0, 0, 0, 0, 17321,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17322, 0, 17323, 0, 17324, 0, 17325, 0, 17326, 0, 17327, 0, 17328,
+            0, 17329, 0, 17330, 0, 17331, 0, 17332, 0, 17333, 0, 17334, 0, 17335, 0, 17336, 0, 17337, 0, 17338, 0,
+            17339, 0, 17340, 0, 17341, 0, 17342, 0, 17343, 0, 17344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 17345, 0, 17346, 0, 17347, 0, 17348, 0, 17349, 0, 17350, 0, 17351, 0, 17352, 0, 17353, 0, 17354,
+            0, 17355, 0, 17356, 0, 17357, 0, 17358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17359, 0, 17360, 0, 17361, 0, 17362, 0, 17363, 0, 17364, 0,
+            17365, 0, 0, 0, 17366, 0, 17367, 0, 17368, 0, 17369, 0, 17370, 0, 17371, 0, 17372, 0, 17373, 0, 17374, 0,
+            17375, 0, 17376, 0, 17377, 0, 17378, 0, 17379, 0, 17380, 0, 17381, 0, 17382, 0, 17383, 0, 17384, 0, 17385,
+            0, 17386, 0, 17387, 0, 17388, 0, 17389, 0, 17390, 0, 17391, 0, 17392, 0, 17393, 0, 17394, 0, 17395, 0,
+            17396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17397, 0, 17398, 0, 17399, 17400, 0, 17401, 0, 17402, 0, 17403, 0,
+            17404, 0, 0, 0, 0, 17405, 0, 17406, 0, 0, 17407, 0, 17408, 0, 0, 0, 17409, 0, 17410, 0, 17411, 0, 17412,
+            0, 17413, 0, 17414, 0, 17415, 0, 17416, 0, 17417, 0, 17418, 0, 17419, 17420, 17421, 17422, 17423, 0,
+            17424, 17425, 17426, 17427, 17428, 0, 17429, 0, 17430, 0, 17431, 0, 17432, 0, 17433, 0, 17434, 0, 17435,
+            0, 17436, 17437, 17438, 17439, 0, 17440, 0, 17441, 17442, 0, 17443, 0, 17444, 0, 17445, 0, 17446, 0,
+            17447, 0, 17448, 0, 17449, 0, 17450, 17451, 0, 0, 0, 0, 17452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 17453, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17454, 17455, 0, 0, 17456,
+            17457, 17458, 17459, 17460, 17461, 17462, 17463, 17464, 17465, 17466, 17467, 17468, 17469, 17470, 17471,
+            17472, 17473, 17474, 17475, 17476, 17477, 17478, 17479, 17480, 17481, 17482, 17483, 17484, 17485, 17486,
+            17487, 17488, 17489, 17490, 17491, 17492, 17493, 17494, 17495, 17496, 17497, 17498, 17499, 17500, 17501,
+            17502, 17503, 17504, 17505, 17506, 17507, 17508, 17509, 17510, 17511, 17512, 17513, 17514, 17515, 17516,
+            17517, 17518, 17519, 17520, 17521, 17522, 17523, 17524, 17525, 17526, 17527, 17528, 17529, 17530, 17531,
+            17532, 17533, 17534, 17535, 32846, 32847, 32848, 49166, 49167, 32849, 32850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 32851, 32852, 32853, 32854, 32855, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17536, 17537, 17538, 17539, 17540, 17541, 17542, 17543,
+            17544, 17545, 17546, 17547, 17548, 17549, 17550, 17551, 17552, 17553, 17554, 17555, 17556, 17557, 17558,
+            17559, 17560, 17561, 0, 0, 0, 0, 0, 17562, 17563, 17564, 17565, 17566, 17567, 17568, 17569, 17570, 17571,
+            17572, 17573, 17574, 17575, 17576, 17577, 17578, 17579, 17580, 17581, 17582, 17583, 17584, 17585, 17586,
+            17587, 17588, 17589, 17590, 17591, 17592, 17593, 17594, 17595, 17596, 17597, 17598, 17599, 17600, 17601,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 17602, 17603, 17604, 17605, 17606, 17607, 17608, 17609, 17610, 17611, 17612, 17613, 17614, 17615,
+            17616, 17617, 17618, 17619, 17620, 17621, 17622, 17623, 17624, 17625, 17626, 17627, 17628, 17629, 17630,
+            17631, 17632, 17633, 17634, 17635, 17636, 17637, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 17638, 17639, 17640, 17641, 17642, 17643, 17644, 17645, 17646, 17647, 17648, 0, 17649, 17650,
+            17651, 17652, 17653, 17654, 17655, 17656, 17657, 17658, 17659, 17660, 17661, 17662, 17663, 0, 17664,
+            17665, 17666, 17667, 17668, 17669, 17670, 0, 17671, 17672, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17673, 17674, 17675, 17676,
+            17677, 17678, 17679, 17680, 17681, 17682, 17683, 17684, 17685, 17686, 17687, 17688, 17689, 17690, 17691,
+            17692, 17693, 17694, 17695, 17696, 17697, 17698, 17699, 17700, 17701, 17702, 17703, 17704, 17705, 17706,
+            17707, 17708, 17709, 17710, 17711, 17712, 17713, 17714, 17715, 17716, 17717, 17718, 17719, 17720, 17721,
+            17722, 17723, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            17724, 17725, 17726, 17727, 17728, 17729, 17730, 17731, 17732, 17733, 17734, 17735, 17736, 17737, 17738,
+            17739, 17740, 17741, 17742, 17743, 17744, 17745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 17746, 17747, 17748, 17749, 17750, 17751, 17752, 17753, 17754, 17755, 17756, 17757, 17758,
+            17759, 17760, 17761, 17762, 17763, 17764, 17765, 17766, 17767, 17768, 17769, 17770, 17771, 17772, 17773,
+            17774, 17775, 17776, 17777, 17778, 17779, 17780, 17781, 17782, 17783, 17784, 17785, 17786, 17787, 17788,
+            17789, 17790, 17791, 17792, 17793, 17794, 17795, 17796, 17797, 17798, 17799, 17800, 17801, 17802, 17803,
+            17804, 17805, 17806, 17807, 17808, 17809, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 17810, 17811, 17812, 17813, 17814, 17815, 17816, 17817, 17818, 17819, 17820,
+            17821, 17822, 17823, 17824, 17825, 17826, 17827, 17828, 17829, 17830, 17831, 17832, 17833, 17834, 0, 0, 0,
+            0, 0, 0, 0, 17835, 0, 0, 0, 0, 0, 0, 0, 17836, 0, 17837, 0, 0, 17838, 0, 0, 0, 17839, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17840, 0, 17841, 0, 17842, 0, 17843, 0, 0, 0, 17844, 0,
+            17845, 0, 17846, 0, 17847, 0, 17848, 0, 17849, 0, 17850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 32856, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17851, 17852, 17853, 17854, 17855, 17856, 17857, 17858,
+            17859, 17860, 17861, 17862, 17863, 17864, 17865, 17866, 17867, 17868, 17869, 17870, 17871, 17872, 17873,
+            17874, 17875, 17876, 17877, 17878, 17879, 17880, 17881, 17882, 17883, 17884, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
         };
-        static const unsigned FOLD_MAP_2[] = {
-            S(0x00df), S(0x0130), S(0x0149), S(0x01f0), S(0x0587), S(0x1e96), S(0x1e97), S(0x1e98), S(0x1e99),
-            S(0x1e9a), S(0x1e9e), S(0x1f50), R(0x1f80,0x1f87), R(0x1f88,0x1f8f), R(0x1f90,0x1f97), R(0x1f98,0x1f9f),
-            R(0x1fa0,0x1fa7), R(0x1fa8,0x1faf), S(0x1fb2), S(0x1fb3), S(0x1fb4), S(0x1fb6), S(0x1fbc), S(0x1fc2),
-            S(0x1fc3), S(0x1fc4), S(0x1fc6), S(0x1fcc), S(0x1fd6), S(0x1fe4), S(0x1fe6), S(0x1ff2), S(0x1ff3),
-            S(0x1ff4), S(0x1ff6), S(0x1ffc), S(0xfb00), S(0xfb01), S(0xfb02), S(0xfb05), S(0xfb06), S(0xfb13),
-            S(0xfb14), S(0xfb15), S(0xfb16), S(0xfb17), S(0x1df95)
+        static const unsigned FOLD_MAP_1_DATA[] = {
+            0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+            0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a,
+            0x03bc, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb,
+            0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f8, 0x00f9,
+            0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x0101, 0x0103, 0x0105, 0x0107, 0x0109, 0x010b, 0x010d, 0x010f,
+            0x0111, 0x0113, 0x0115, 0x0117, 0x0119, 0x011b, 0x011d, 0x011f, 0x0121, 0x0123, 0x0125, 0x0127, 0x0129,
+            0x012b, 0x012d, 0x012f, 0x0133, 0x0135, 0x0137, 0x013a, 0x013c, 0x013e, 0x0140, 0x0142, 0x0144, 0x0146,
+            0x0148, 0x014b, 0x014d, 0x014f, 0x0151, 0x0153, 0x0155, 0x0157, 0x0159, 0x015b, 0x015d, 0x015f, 0x0161,
+            0x0163, 0x0165, 0x0167, 0x0169, 0x016b, 0x016d, 0x016f, 0x0171, 0x0173, 0x0175, 0x0177, 0x00ff, 0x017a,
+            0x017c, 0x017e, 0x0073, 0x0253, 0x0183, 0x0185, 0x0254, 0x0188, 0x0256, 0x0257, 0x018c, 0x01dd, 0x0259,
+            0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f, 0x0272, 0x0275, 0x01a1, 0x01a3, 0x01a5,
+            0x0280, 0x01a8, 0x0283, 0x01ad, 0x0288, 0x01b0, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292, 0x01b9, 0x01bd,
+            0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc, 0x01ce, 0x01d0, 0x01d2, 0x01d4, 0x01d6, 0x01d8, 0x01da,
+            0x01dc, 0x01df, 0x01e1, 0x01e3, 0x01e5, 0x01e7, 0x01e9, 0x01eb, 0x01ed, 0x01ef, 0x01f3, 0x01f3, 0x01f5,
+            0x0195, 0x01bf, 0x01f9, 0x01fb, 0x01fd, 0x01ff, 0x0201, 0x0203, 0x0205, 0x0207, 0x0209, 0x020b, 0x020d,
+            0x020f, 0x0211, 0x0213, 0x0215, 0x0217, 0x0219, 0x021b, 0x021d, 0x021f, 0x019e, 0x0223, 0x0225, 0x0227,
+            0x0229, 0x022b, 0x022d, 0x022f, 0x0231, 0x0233, 0x2c65, 0x023c, 0x019a, 0x2c66, 0x0242, 0x0180, 0x0289,
+            0x028c, 0x0247, 0x0249, 0x024b, 0x024d, 0x024f, 0x03b9, 0x0371, 0x0373, 0x0377, 0x03f3, 0x03ac, 0x03ad,
+            0x03ae, 0x03af, 0x03cc, 0x03cd, 0x03ce, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8,
+            0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c3, 0x03c4, 0x03c5, 0x03c6,
+            0x03c7, 0x03c8, 0x03c9, 0x03ca, 0x03cb, 0x03c3, 0x03d7, 0x03b2, 0x03b8, 0x03c6, 0x03c0, 0x03d9, 0x03db,
+            0x03dd, 0x03df, 0x03e1, 0x03e3, 0x03e5, 0x03e7, 0x03e9, 0x03eb, 0x03ed, 0x03ef, 0x03ba, 0x03c1, 0x03b8,
+            0x03b5, 0x03f8, 0x03f2, 0x03fb, 0x037b, 0x037c, 0x037d, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455,
+            0x0456, 0x0457, 0x0458, 0x0459, 0x045a, 0x045b, 0x045c, 0x045d, 0x045e, 0x045f, 0x0430, 0x0431, 0x0432,
+            0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+            0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044a, 0x044b, 0x044c,
+            0x044d, 0x044e, 0x044f, 0x0461, 0x0463, 0x0465, 0x0467, 0x0469, 0x046b, 0x046d, 0x046f, 0x0471, 0x0473,
+            0x0475, 0x0477, 0x0479, 0x047b, 0x047d, 0x047f, 0x0481, 0x048b, 0x048d, 0x048f, 0x0491, 0x0493, 0x0495,
+            0x0497, 0x0499, 0x049b, 0x049d, 0x049f, 0x04a1, 0x04a3, 0x04a5, 0x04a7, 0x04a9, 0x04ab, 0x04ad, 0x04af,
+            0x04b1, 0x04b3, 0x04b5, 0x04b7, 0x04b9, 0x04bb, 0x04bd, 0x04bf, 0x04cf, 0x04c2, 0x04c4, 0x04c6, 0x04c8,
+            0x04ca, 0x04cc, 0x04ce, 0x04d1, 0x04d3, 0x04d5, 0x04d7, 0x04d9, 0x04db, 0x04dd, 0x04df, 0x04e1, 0x04e3,
+            0x04e5, 0x04e7, 0x04e9, 0x04eb, 0x04ed, 0x04ef, 0x04f1, 0x04f3, 0x04f5, 0x04f7, 0x04f9, 0x04fb, 0x04fd,
+            0x04ff, 0x0501, 0x0503, 0x0505, 0x0507, 0x0509, 0x050b, 0x050d, 0x050f, 0x0511, 0x0513, 0x0515, 0x0517,
+            0x0519, 0x051b, 0x051d, 0x051f, 0x0521, 0x0523, 0x0525, 0x0527, 0x0529, 0x052b, 0x052d, 0x052f, 0x0561,
+            0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056a, 0x056b, 0x056c, 0x056d, 0x056e,
+            0x056f, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579, 0x057a, 0x057b,
+            0x057c, 0x057d, 0x057e, 0x057f, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x2d00, 0x2d01,
+            0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06, 0x2d07, 0x2d08, 0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d, 0x2d0e,
+            0x2d0f, 0x2d10, 0x2d11, 0x2d12, 0x2d13, 0x2d14, 0x2d15, 0x2d16, 0x2d17, 0x2d18, 0x2d19, 0x2d1a, 0x2d1b,
+            0x2d1c, 0x2d1d, 0x2d1e, 0x2d1f, 0x2d20, 0x2d21, 0x2d22, 0x2d23, 0x2d24, 0x2d25, 0x2d27, 0x2d2d, 0x13f0,
+            0x13f1, 0x13f2, 0x13f3, 0x13f4, 0x13f5, 0x0432, 0x0434, 0x043e, 0x0441, 0x0442, 0x0442, 0x044a, 0x0463,
+            0xa64b, 0x1c8a, 0x10d0, 0x10d1, 0x10d2, 0x10d3, 0x10d4, 0x10d5, 0x10d6, 0x10d7, 0x10d8, 0x10d9, 0x10da,
+            0x10db, 0x10dc, 0x10dd, 0x10de, 0x10df, 0x10e0, 0x10e1, 0x10e2, 0x10e3, 0x10e4, 0x10e5, 0x10e6, 0x10e7,
+            0x10e8, 0x10e9, 0x10ea, 0x10eb, 0x10ec, 0x10ed, 0x10ee, 0x10ef, 0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4,
+            0x10f5, 0x10f6, 0x10f7, 0x10f8, 0x10f9, 0x10fa, 0x10fd, 0x10fe, 0x10ff, 0x1e01, 0x1e03, 0x1e05, 0x1e07,
+            0x1e09, 0x1e0b, 0x1e0d, 0x1e0f, 0x1e11, 0x1e13, 0x1e15, 0x1e17, 0x1e19, 0x1e1b, 0x1e1d, 0x1e1f, 0x1e21,
+            0x1e23, 0x1e25, 0x1e27, 0x1e29, 0x1e2b, 0x1e2d, 0x1e2f, 0x1e31, 0x1e33, 0x1e35, 0x1e37, 0x1e39, 0x1e3b,
+            0x1e3d, 0x1e3f, 0x1e41, 0x1e43, 0x1e45, 0x1e47, 0x1e49, 0x1e4b, 0x1e4d, 0x1e4f, 0x1e51, 0x1e53, 0x1e55,
+            0x1e57, 0x1e59, 0x1e5b, 0x1e5d, 0x1e5f, 0x1e61, 0x1e63, 0x1e65, 0x1e67, 0x1e69, 0x1e6b, 0x1e6d, 0x1e6f,
+            0x1e71, 0x1e73, 0x1e75, 0x1e77, 0x1e79, 0x1e7b, 0x1e7d, 0x1e7f, 0x1e81, 0x1e83, 0x1e85, 0x1e87, 0x1e89,
+            0x1e8b, 0x1e8d, 0x1e8f, 0x1e91, 0x1e93, 0x1e95, 0x1e61, 0x1ea1, 0x1ea3, 0x1ea5, 0x1ea7, 0x1ea9, 0x1eab,
+            0x1ead, 0x1eaf, 0x1eb1, 0x1eb3, 0x1eb5, 0x1eb7, 0x1eb9, 0x1ebb, 0x1ebd, 0x1ebf, 0x1ec1, 0x1ec3, 0x1ec5,
+            0x1ec7, 0x1ec9, 0x1ecb, 0x1ecd, 0x1ecf, 0x1ed1, 0x1ed3, 0x1ed5, 0x1ed7, 0x1ed9, 0x1edb, 0x1edd, 0x1edf,
+            0x1ee1, 0x1ee3, 0x1ee5, 0x1ee7, 0x1ee9, 0x1eeb, 0x1eed, 0x1eef, 0x1ef1, 0x1ef3, 0x1ef5, 0x1ef7, 0x1ef9,
+            0x1efb, 0x1efd, 0x1eff, 0x1f00, 0x1f01, 0x1f02, 0x1f03, 0x1f04, 0x1f05, 0x1f06, 0x1f07, 0x1f10, 0x1f11,
+            0x1f12, 0x1f13, 0x1f14, 0x1f15, 0x1f20, 0x1f21, 0x1f22, 0x1f23, 0x1f24, 0x1f25, 0x1f26, 0x1f27, 0x1f30,
+            0x1f31, 0x1f32, 0x1f33, 0x1f34, 0x1f35, 0x1f36, 0x1f37, 0x1f40, 0x1f41, 0x1f42, 0x1f43, 0x1f44, 0x1f45,
+            0x1f51, 0x1f53, 0x1f55, 0x1f57, 0x1f60, 0x1f61, 0x1f62, 0x1f63, 0x1f64, 0x1f65, 0x1f66, 0x1f67, 0x1fb0,
+            0x1fb1, 0x1f70, 0x1f71, 0x03b9, 0x1f72, 0x1f73, 0x1f74, 0x1f75, 0x1fd0, 0x1fd1, 0x1f76, 0x1f77, 0x1fe0,
+            0x1fe1, 0x1f7a, 0x1f7b, 0x1fe5, 0x1f78, 0x1f79, 0x1f7c, 0x1f7d, 0x03c9, 0x006b, 0x00e5, 0x214e, 0x2170,
+            0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217a, 0x217b, 0x217c, 0x217d,
+            0x217e, 0x217f, 0x2184, 0x24d0, 0x24d1, 0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6, 0x24d7, 0x24d8, 0x24d9,
+            0x24da, 0x24db, 0x24dc, 0x24dd, 0x24de, 0x24df, 0x24e0, 0x24e1, 0x24e2, 0x24e3, 0x24e4, 0x24e5, 0x24e6,
+            0x24e7, 0x24e8, 0x24e9, 0x2c30, 0x2c31, 0x2c32, 0x2c33, 0x2c34, 0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39,
+            0x2c3a, 0x2c3b, 0x2c3c, 0x2c3d, 0x2c3e, 0x2c3f, 0x2c40, 0x2c41, 0x2c42, 0x2c43, 0x2c44, 0x2c45, 0x2c46,
+            0x2c47, 0x2c48, 0x2c49, 0x2c4a, 0x2c4b, 0x2c4c, 0x2c4d, 0x2c4e, 0x2c4f, 0x2c50, 0x2c51, 0x2c52, 0x2c53,
+            0x2c54, 0x2c55, 0x2c56, 0x2c57, 0x2c58, 0x2c59, 0x2c5a, 0x2c5b, 0x2c5c, 0x2c5d, 0x2c5e, 0x2c5f, 0x2c61,
+            0x026b, 0x1d7d, 0x027d, 0x2c68, 0x2c6a, 0x2c6c, 0x0251, 0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76, 0x023f,
+            0x0240, 0x2c81, 0x2c83, 0x2c85, 0x2c87, 0x2c89, 0x2c8b, 0x2c8d, 0x2c8f, 0x2c91, 0x2c93, 0x2c95, 0x2c97,
+            0x2c99, 0x2c9b, 0x2c9d, 0x2c9f, 0x2ca1, 0x2ca3, 0x2ca5, 0x2ca7, 0x2ca9, 0x2cab, 0x2cad, 0x2caf, 0x2cb1,
+            0x2cb3, 0x2cb5, 0x2cb7, 0x2cb9, 0x2cbb, 0x2cbd, 0x2cbf, 0x2cc1, 0x2cc3, 0x2cc5, 0x2cc7, 0x2cc9, 0x2ccb,
+            0x2ccd, 0x2ccf, 0x2cd1, 0x2cd3, 0x2cd5, 0x2cd7, 0x2cd9, 0x2cdb, 0x2cdd, 0x2cdf, 0x2ce1, 0x2ce3, 0x2cec,
+            0x2cee, 0x2cf3, 0xa641, 0xa643, 0xa645, 0xa647, 0xa649, 0xa64b, 0xa64d, 0xa64f, 0xa651, 0xa653, 0xa655,
+            0xa657, 0xa659, 0xa65b, 0xa65d, 0xa65f, 0xa661, 0xa663, 0xa665, 0xa667, 0xa669, 0xa66b, 0xa66d, 0xa681,
+            0xa683, 0xa685, 0xa687, 0xa689, 0xa68b, 0xa68d, 0xa68f, 0xa691, 0xa693, 0xa695, 0xa697, 0xa699, 0xa69b,
+            0xa723, 0xa725, 0xa727, 0xa729, 0xa72b, 0xa72d, 0xa72f, 0xa733, 0xa735, 0xa737, 0xa739, 0xa73b, 0xa73d,
+            0xa73f, 0xa741, 0xa743, 0xa745, 0xa747, 0xa749, 0xa74b, 0xa74d, 0xa74f, 0xa751, 0xa753, 0xa755, 0xa757,
+            0xa759, 0xa75b, 0xa75d, 0xa75f, 0xa761, 0xa763, 0xa765, 0xa767, 0xa769, 0xa76b, 0xa76d, 0xa76f, 0xa77a,
+            0xa77c, 0x1d79, 0xa77f, 0xa781, 0xa783, 0xa785, 0xa787, 0xa78c, 0x0265, 0xa791, 0xa793, 0xa797, 0xa799,
+            0xa79b, 0xa79d, 0xa79f, 0xa7a1, 0xa7a3, 0xa7a5, 0xa7a7, 0xa7a9, 0x0266, 0x025c, 0x0261, 0x026c, 0x026a,
+            0x029e, 0x0287, 0x029d, 0xab53, 0xa7b5, 0xa7b7, 0xa7b9, 0xa7bb, 0xa7bd, 0xa7bf, 0xa7c1, 0xa7c3, 0xa794,
+            0x0282, 0x1d8e, 0xa7c8, 0xa7ca, 0x0264, 0xa7cd, 0xa7cf, 0xa7d1, 0xa7d3, 0xa7d5, 0xa7d7, 0xa7d9, 0xa7db,
+            0x019b, 0x0277, 0x027c, 0xa7f6, 0xab4b, 0xab4c, 0x13a0, 0x13a1, 0x13a2, 0x13a3, 0x13a4, 0x13a5, 0x13a6,
+            0x13a7, 0x13a8, 0x13a9, 0x13aa, 0x13ab, 0x13ac, 0x13ad, 0x13ae, 0x13af, 0x13b0, 0x13b1, 0x13b2, 0x13b3,
+            0x13b4, 0x13b5, 0x13b6, 0x13b7, 0x13b8, 0x13b9, 0x13ba, 0x13bb, 0x13bc, 0x13bd, 0x13be, 0x13bf, 0x13c0,
+            0x13c1, 0x13c2, 0x13c3, 0x13c4, 0x13c5, 0x13c6, 0x13c7, 0x13c8, 0x13c9, 0x13ca, 0x13cb, 0x13cc, 0x13cd,
+            0x13ce, 0x13cf, 0x13d0, 0x13d1, 0x13d2, 0x13d3, 0x13d4, 0x13d5, 0x13d6, 0x13d7, 0x13d8, 0x13d9, 0x13da,
+            0x13db, 0x13dc, 0x13dd, 0x13de, 0x13df, 0x13e0, 0x13e1, 0x13e2, 0x13e3, 0x13e4, 0x13e5, 0x13e6, 0x13e7,
+            0x13e8, 0x13e9, 0x13ea, 0x13eb, 0x13ec, 0x13ed, 0x13ee, 0x13ef, 0xff41, 0xff42, 0xff43, 0xff44, 0xff45,
+            0xff46, 0xff47, 0xff48, 0xff49, 0xff4a, 0xff4b, 0xff4c, 0xff4d, 0xff4e, 0xff4f, 0xff50, 0xff51, 0xff52,
+            0xff53, 0xff54, 0xff55, 0xff56, 0xff57, 0xff58, 0xff59, 0xff5a, 0x10428, 0x10429, 0x1042a, 0x1042b,
+            0x1042c, 0x1042d, 0x1042e, 0x1042f, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436,
+            0x10437, 0x10438, 0x10439, 0x1043a, 0x1043b, 0x1043c, 0x1043d, 0x1043e, 0x1043f, 0x10440, 0x10441,
+            0x10442, 0x10443, 0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449, 0x1044a, 0x1044b, 0x1044c,
+            0x1044d, 0x1044e, 0x1044f, 0x104d8, 0x104d9, 0x104da, 0x104db, 0x104dc, 0x104dd, 0x104de, 0x104df,
+            0x104e0, 0x104e1, 0x104e2, 0x104e3, 0x104e4, 0x104e5, 0x104e6, 0x104e7, 0x104e8, 0x104e9, 0x104ea,
+            0x104eb, 0x104ec, 0x104ed, 0x104ee, 0x104ef, 0x104f0, 0x104f1, 0x104f2, 0x104f3, 0x104f4, 0x104f5,
+            0x104f6, 0x104f7, 0x104f8, 0x104f9, 0x104fa, 0x104fb, 0x10597, 0x10598, 0x10599, 0x1059a, 0x1059b,
+            0x1059c, 0x1059d, 0x1059e, 0x1059f, 0x105a0, 0x105a1, 0x105a3, 0x105a4, 0x105a5, 0x105a6, 0x105a7,
+            0x105a8, 0x105a9, 0x105aa, 0x105ab, 0x105ac, 0x105ad, 0x105ae, 0x105af, 0x105b0, 0x105b1, 0x105b3,
+            0x105b4, 0x105b5, 0x105b6, 0x105b7, 0x105b8, 0x105b9, 0x105bb, 0x105bc, 0x10cc0, 0x10cc1, 0x10cc2,
+            0x10cc3, 0x10cc4, 0x10cc5, 0x10cc6, 0x10cc7, 0x10cc8, 0x10cc9, 0x10cca, 0x10ccb, 0x10ccc, 0x10ccd,
+            0x10cce, 0x10ccf, 0x10cd0, 0x10cd1, 0x10cd2, 0x10cd3, 0x10cd4, 0x10cd5, 0x10cd6, 0x10cd7, 0x10cd8,
+            0x10cd9, 0x10cda, 0x10cdb, 0x10cdc, 0x10cdd, 0x10cde, 0x10cdf, 0x10ce0, 0x10ce1, 0x10ce2, 0x10ce3,
+            0x10ce4, 0x10ce5, 0x10ce6, 0x10ce7, 0x10ce8, 0x10ce9, 0x10cea, 0x10ceb, 0x10cec, 0x10ced, 0x10cee,
+            0x10cef, 0x10cf0, 0x10cf1, 0x10cf2, 0x10d70, 0x10d71, 0x10d72, 0x10d73, 0x10d74, 0x10d75, 0x10d76,
+            0x10d77, 0x10d78, 0x10d79, 0x10d7a, 0x10d7b, 0x10d7c, 0x10d7d, 0x10d7e, 0x10d7f, 0x10d80, 0x10d81,
+            0x10d82, 0x10d83, 0x10d84, 0x10d85, 0x118c0, 0x118c1, 0x118c2, 0x118c3, 0x118c4, 0x118c5, 0x118c6,
+            0x118c7, 0x118c8, 0x118c9, 0x118ca, 0x118cb, 0x118cc, 0x118cd, 0x118ce, 0x118cf, 0x118d0, 0x118d1,
+            0x118d2, 0x118d3, 0x118d4, 0x118d5, 0x118d6, 0x118d7, 0x118d8, 0x118d9, 0x118da, 0x118db, 0x118dc,
+            0x118dd, 0x118de, 0x118df, 0x16e60, 0x16e61, 0x16e62, 0x16e63, 0x16e64, 0x16e65, 0x16e66, 0x16e67,
+            0x16e68, 0x16e69, 0x16e6a, 0x16e6b, 0x16e6c, 0x16e6d, 0x16e6e, 0x16e6f, 0x16e70, 0x16e71, 0x16e72,
+            0x16e73, 0x16e74, 0x16e75, 0x16e76, 0x16e77, 0x16e78, 0x16e79, 0x16e7a, 0x16e7b, 0x16e7c, 0x16e7d,
+            0x16e7e, 0x16e7f, 0x16ebb, 0x16ebc, 0x16ebd, 0x16ebe, 0x16ebf, 0x16ec0, 0x16ec1, 0x16ec2, 0x16ec3,
+            0x16ec4, 0x16ec5, 0x16ec6, 0x16ec7, 0x16ec8, 0x16ec9, 0x16eca, 0x16ecb, 0x16ecc, 0x16ecd, 0x16ece,
+            0x16ecf, 0x16ed0, 0x16ed1, 0x16ed2, 0x16ed3, 0x1df41, 0x1df49, 0x1df4b, 0x1df4e, 0x1df52, 0x1df69,
+            0x1df6b, 0x1df6d, 0x1df6f, 0x1df73, 0x1df75, 0x1df77, 0x1df79, 0x1df7b, 0x1df7d, 0x1df7f, 0x1e922,
+            0x1e923, 0x1e924, 0x1e925, 0x1e926, 0x1e927, 0x1e928, 0x1e929, 0x1e92a, 0x1e92b, 0x1e92c, 0x1e92d,
+            0x1e92e, 0x1e92f, 0x1e930, 0x1e931, 0x1e932, 0x1e933, 0x1e934, 0x1e935, 0x1e936, 0x1e937, 0x1e938,
+            0x1e939, 0x1e93a, 0x1e93b, 0x1e93c, 0x1e93d, 0x1e93e, 0x1e93f, 0x1e940, 0x1e941, 0x1e942, 0x1e943
         };
         static const unsigned FOLD_MAP_2_DATA[] = {
             0x0073,0x0073, 0x0069,0x0307, 0x02bc,0x006e, 0x006a,0x030c, 0x0565,0x0582, 0x0068,0x0331, 0x0074,0x0308,
-            0x0077,0x030a, 0x0079,0x030a, 0x0061,0x02be, 0x0073,0x0073, 0x03c5,0x0313, 0x1f00,0x03b9, 0x1f07,0x03b9,
-            0x1f00,0x03b9, 0x1f07,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f60,0x03b9,
-            0x1f67,0x03b9, 0x1f60,0x03b9, 0x1f67,0x03b9, 0x1f70,0x03b9, 0x03b1,0x03b9, 0x03ac,0x03b9, 0x03b1,0x0342,
-            0x03b1,0x03b9, 0x1f74,0x03b9, 0x03b7,0x03b9, 0x03ae,0x03b9, 0x03b7,0x0342, 0x03b7,0x03b9, 0x03b9,0x0342,
-            0x03c1,0x0313, 0x03c5,0x0342, 0x1f7c,0x03b9, 0x03c9,0x03b9, 0x03ce,0x03b9, 0x03c9,0x0342, 0x03c9,0x03b9,
-            0x0066,0x0066, 0x0066,0x0069, 0x0066,0x006c, 0x0073,0x0074, 0x0073,0x0074, 0x0574,0x0576, 0x0574,0x0565,
-            0x0574,0x056b, 0x057e,0x0576, 0x0574,0x056d, 0x0073,0x0073
-        };
-        static const unsigned FOLD_MAP_3[] = {
-            S(0x0390), S(0x03b0), S(0x1f52), S(0x1f54), S(0x1f56), S(0x1fb7), S(0x1fc7), S(0x1fd2), S(0x1fd3),
-            S(0x1fd7), S(0x1fe2), S(0x1fe3), S(0x1fe7), S(0x1ff7), S(0xfb03), S(0xfb04)
+            0x0077,0x030a, 0x0079,0x030a, 0x0061,0x02be, 0x0073,0x0073, 0x03c5,0x0313, 0x1f00,0x03b9, 0x1f01,0x03b9,
+            0x1f02,0x03b9, 0x1f03,0x03b9, 0x1f04,0x03b9, 0x1f05,0x03b9, 0x1f06,0x03b9, 0x1f07,0x03b9, 0x1f00,0x03b9,
+            0x1f01,0x03b9, 0x1f02,0x03b9, 0x1f03,0x03b9, 0x1f04,0x03b9, 0x1f05,0x03b9, 0x1f06,0x03b9, 0x1f07,0x03b9,
+            0x1f20,0x03b9, 0x1f21,0x03b9, 0x1f22,0x03b9, 0x1f23,0x03b9, 0x1f24,0x03b9, 0x1f25,0x03b9, 0x1f26,0x03b9,
+            0x1f27,0x03b9, 0x1f20,0x03b9, 0x1f21,0x03b9, 0x1f22,0x03b9, 0x1f23,0x03b9, 0x1f24,0x03b9, 0x1f25,0x03b9,
+            0x1f26,0x03b9, 0x1f27,0x03b9, 0x1f60,0x03b9, 0x1f61,0x03b9, 0x1f62,0x03b9, 0x1f63,0x03b9, 0x1f64,0x03b9,
+            0x1f65,0x03b9, 0x1f66,0x03b9, 0x1f67,0x03b9, 0x1f60,0x03b9, 0x1f61,0x03b9, 0x1f62,0x03b9, 0x1f63,0x03b9,
+            0x1f64,0x03b9, 0x1f65,0x03b9, 0x1f66,0x03b9, 0x1f67,0x03b9, 0x1f70,0x03b9, 0x03b1,0x03b9, 0x03ac,0x03b9,
+            0x03b1,0x0342, 0x03b1,0x03b9, 0x1f74,0x03b9, 0x03b7,0x03b9, 0x03ae,0x03b9, 0x03b7,0x0342, 0x03b7,0x03b9,
+            0x03b9,0x0342, 0x03c1,0x0313, 0x03c5,0x0342, 0x1f7c,0x03b9, 0x03c9,0x03b9, 0x03ce,0x03b9, 0x03c9,0x0342,
+            0x03c9,0x03b9, 0x0066,0x0066, 0x0066,0x0069, 0x0066,0x006c, 0x0073,0x0074, 0x0073,0x0074, 0x0574,0x0576,
+            0x0574,0x0565, 0x0574,0x056b, 0x057e,0x0576, 0x0574,0x056d, 0x0073,0x0073
         };
         static const unsigned FOLD_MAP_3_DATA[] = {
             0x03b9,0x0308,0x0301, 0x03c5,0x0308,0x0301, 0x03c5,0x0313,0x0300, 0x03c5,0x0313,0x0301,
@@ -800,20 +1514,12 @@ struct MD_UNICODE_FOLD_INFO_tag {
             0x03b9,0x0308,0x0301, 0x03b9,0x0308,0x0342, 0x03c5,0x0308,0x0300, 0x03c5,0x0308,0x0301,
             0x03c5,0x0308,0x0342, 0x03c9,0x0342,0x03b9, 0x0066,0x0066,0x0069, 0x0066,0x0066,0x006c
         };
-#undef R
-#undef S
-        static const struct {
-            const unsigned* map;
-            const unsigned* data;
-            size_t map_size;
-            unsigned n_codepoints;
-        } FOLD_MAP_LIST[] = {
-            { FOLD_MAP_1, FOLD_MAP_1_DATA, SIZEOF_ARRAY(FOLD_MAP_1), 1 },
-            { FOLD_MAP_2, FOLD_MAP_2_DATA, SIZEOF_ARRAY(FOLD_MAP_2), 2 },
-            { FOLD_MAP_3, FOLD_MAP_3_DATA, SIZEOF_ARRAY(FOLD_MAP_3), 3 }
+        static const unsigned* FOLD_MAP_DATA_LIST[] = {
+            FOLD_MAP_1_DATA, FOLD_MAP_2_DATA, FOLD_MAP_3_DATA
         };
 
-        int i;
+        unsigned entry;
+        unsigned n_codepoints;
 
         /* Fast path for ASCII characters. */
         if(codepoint <= 0x7f) {
@@ -824,39 +1530,22 @@ struct MD_UNICODE_FOLD_INFO_tag {
             return;
         }
 
-        /* Try to locate the codepoint in any of the maps. */
-        for(i = 0; i < (int) SIZEOF_ARRAY(FOLD_MAP_LIST); i++) {
-            int index;
-
-            index = md_unicode_bsearch__(codepoint, FOLD_MAP_LIST[i].map, FOLD_MAP_LIST[i].map_size);
-            if(index >= 0) {
-                /* Found the mapping. */
-                unsigned n_codepoints = FOLD_MAP_LIST[i].n_codepoints;
-                const unsigned* map = FOLD_MAP_LIST[i].map;
-                const unsigned* codepoints = FOLD_MAP_LIST[i].data + (index * n_codepoints);
-
-                memcpy(info->codepoints, codepoints, sizeof(unsigned) * n_codepoints);
-                info->n_codepoints = n_codepoints;
-
-                if(FOLD_MAP_LIST[i].map[index] != codepoint) {
-                    /* The found mapping maps whole range of codepoints,
-                     * i.e. we have to offset info->codepoints[0] accordingly. */
-                    if((map[index] & 0x00ffffff)+1 == codepoints[0]) {
-                        /* Alternating type of the range. */
-                        info->codepoints[0] = codepoint + ((codepoint & 0x1) == (map[index] & 0x1) ? 1 : 0);
-                    } else {
-                        /* Range to range kind of mapping. */
-                        info->codepoints[0] += (codepoint - (map[index] & 0x00ffffff));
-                    }
-                }
+        if((codepoint >> 6) < SIZEOF_ARRAY(FOLD_MAP_INDEX_1))
+            entry = FOLD_MAP_INDEX_2[FOLD_MAP_INDEX_1[codepoint >> 6] * 64 + (codepoint & 0x3f)];
+        else
+            entry = 0;
 
-                return;
-            }
+        if(entry == 0) {
+            /* No mapping found. Map the codepoint to itself. */
+            info->codepoints[0] = codepoint;
+            info->n_codepoints = 1;
+            return;
         }
 
-        /* No mapping found. Map the codepoint to itself. */
-        info->codepoints[0] = codepoint;
-        info->n_codepoints = 1;
+        n_codepoints = entry >> 14;
+        memcpy(info->codepoints, FOLD_MAP_DATA_LIST[n_codepoints-1] + (entry & 0x3fff) * n_codepoints,
+               sizeof(unsigned) * n_codepoints);
+        info->n_codepoints = n_codepoints;
     }
 #endif
 
@@ -891,13 +1580,16 @@ struct MD_UNICODE_FOLD_INFO_tag {
         return CH(off-1);
     }
 
-    /* No whitespace uses surrogates, so no decoding needed here. */
+    /* No whitespace uses surrogates, so no decoding needed here.
+     * (For ASCII, we avoid also the function call.) */
     #define ISUNICODEWHITESPACE_(codepoint) md_is_unicode_whitespace__(codepoint)
-    #define ISUNICODEWHITESPACE(off)        md_is_unicode_whitespace__(CH(off))
-    #define ISUNICODEWHITESPACEBEFORE(off)  md_is_unicode_whitespace__(CH((off)-1))
+    #define ISUNICODEWHITESPACE(off)        (ISASCII(off) ? ISWHITESPACE(off) : md_is_unicode_whitespace__(CH(off)))
+    #define ISUNICODEWHITESPACEBEFORE(off)  (ISASCII((off)-1) ? ISWHITESPACE((off)-1) : md_is_unicode_whitespace__(CH((off)-1)))
 
-    #define ISUNICODEPUNCT(off)             md_is_unicode_punct__(md_decode_utf16le__(STR(off), ctx->size - (off), NULL))
-    #define ISUNICODEPUNCTBEFORE(off)       md_is_unicode_punct__(md_decode_utf16le_before__(ctx, off))
+    #define ISUNICODEPUNCT(off)             (ISASCII(off) ? ISPUNCT(off) :                                          \
+                                             md_is_unicode_punct__(md_decode_utf16le__(STR(off), ctx->size - (off), NULL)))
+    #define ISUNICODEPUNCTBEFORE(off)       (ISASCII((off)-1) ? ISPUNCT((off)-1) :                                  \
+                                             md_is_unicode_punct__(md_decode_utf16le_before__(ctx, off)))
 
     static inline int
     md_decode_unicode(const CHAR* str, OFF off, SZ str_size, SZ* p_char_size)
@@ -973,12 +1665,17 @@ struct MD_UNICODE_FOLD_INFO_tag {
         return (unsigned) CH(off-1);
     }
 
+    /* For ASCII, we skip the decoding (and the function call) altogether. */
     #define ISUNICODEWHITESPACE_(codepoint) md_is_unicode_whitespace__(codepoint)
-    #define ISUNICODEWHITESPACE(off)        md_is_unicode_whitespace__(md_decode_utf8__(STR(off), ctx->size - (off), NULL))
-    #define ISUNICODEWHITESPACEBEFORE(off)  md_is_unicode_whitespace__(md_decode_utf8_before__(ctx, off))
+    #define ISUNICODEWHITESPACE(off)        (ISASCII(off) ? ISWHITESPACE(off) :                                     \
+                                             md_is_unicode_whitespace__(md_decode_utf8__(STR(off), ctx->size - (off), NULL)))
+    #define ISUNICODEWHITESPACEBEFORE(off)  (ISASCII((off)-1) ? ISWHITESPACE((off)-1) :                             \
+                                             md_is_unicode_whitespace__(md_decode_utf8_before__(ctx, off)))
 
-    #define ISUNICODEPUNCT(off)             md_is_unicode_punct__(md_decode_utf8__(STR(off), ctx->size - (off), NULL))
-    #define ISUNICODEPUNCTBEFORE(off)       md_is_unicode_punct__(md_decode_utf8_before__(ctx, off))
+    #define ISUNICODEPUNCT(off)             (ISASCII(off) ? ISPUNCT(off) :                                          \
+                                             md_is_unicode_punct__(md_decode_utf8__(STR(off), ctx->size - (off), NULL)))
+    #define ISUNICODEPUNCTBEFORE(off)       (ISASCII((off)-1) ? ISPUNCT((off)-1) :                                  \
+                                             md_is_unicode_punct__(md_decode_utf8_before__(ctx, off)))
 
     static inline unsigned
     md_decode_unicode(const CHAR* str, OFF off, SZ str_size, SZ* p_char_size)
@@ -1066,7 +1763,7 @@ md_merge_lines_alloc(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines, MD_SIZ
 {
     CHAR* buffer;
 
-    buffer = (CHAR*) malloc(sizeof(CHAR) * (end - beg));
+    buffer = (CHAR*) md_malloc(ctx, sizeof(CHAR) * (end - beg));
     if(buffer == NULL) {
         MD_LOG("malloc() failed.");
         return -1;
@@ -1468,7 +2165,7 @@ md_build_attr_append_substr(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build,
                 ? build->substr_alloc + build->substr_alloc / 2
                 : 8);
 
-        new_substr_types = (MD_TEXTTYPE*) realloc(build->substr_types,
+        new_substr_types = (MD_TEXTTYPE*) md_realloc(ctx, build->substr_types,
                                     new_alloc * sizeof(MD_TEXTTYPE));
         if(new_substr_types == NULL) {
             MD_LOG("realloc() failed.");
@@ -1477,7 +2174,7 @@ md_build_attr_append_substr(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build,
         build->substr_types = new_substr_types;
 
         /* Note +1 to reserve space for final offset (== raw_size). */
-        new_substr_offsets = (OFF*) realloc(build->substr_offsets,
+        new_substr_offsets = (OFF*) md_realloc(ctx, build->substr_offsets,
                                     (new_alloc+1) * sizeof(OFF));
         if(new_substr_offsets == NULL) {
             MD_LOG("realloc() failed.");
@@ -1499,9 +2196,9 @@ md_free_attribute(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build)
     MD_UNUSED(ctx);
 
     if(build->substr_alloc > 0) {
-        free(build->text);
-        free(build->substr_types);
-        free(build->substr_offsets);
+        md_free(ctx, build->text);
+        md_free(ctx, build->substr_types);
+        md_free(ctx, build->substr_offsets);
     }
 }
 
@@ -1536,7 +2233,7 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
         build->trivial_offsets[1] = raw_size;
         off = raw_size;
     } else {
-        build->text = (CHAR*) malloc(raw_size * sizeof(CHAR));
+        build->text = (CHAR*) md_malloc(ctx, raw_size * sizeof(CHAR));
         if(build->text == NULL) {
             MD_LOG("malloc() failed.");
             goto abort;
@@ -1618,9 +2315,9 @@ md_fnv1a(unsigned base, const void* data, size_t n)
  * of two labels. */
 
 static unsigned
-md_label_hash(const CHAR* label, SZ size)
+md_label_hash(unsigned seed, const CHAR* label, SZ size)
 {
-    unsigned hash = MD_FNV1A_BASE;
+    unsigned hash = MD_FNV1A_BASE ^ seed;
     OFF off;
     unsigned codepoint;
     int is_whitespace = FALSE;
@@ -1629,6 +2326,16 @@ md_label_hash(const CHAR* label, SZ size)
     while(off < size) {
         SZ char_size;
 
+        /* Fast path for ASCII characters (other then whitespace). */
+        if(ISASCII_(label[off])  &&  !ISWHITESPACE_(label[off])  &&  !ISNEWLINE_(label[off])) {
+            codepoint = (unsigned) label[off];
+            if(ISUPPER_(codepoint))
+                codepoint += 'a' - 'A';
+            hash = md_fnv1a(hash, &codepoint, sizeof(unsigned));
+            off++;
+            continue;
+        }
+
         codepoint = md_decode_unicode(label, off, size, &char_size);
         is_whitespace = ISUNICODEWHITESPACE_(codepoint) || ISNEWLINE_(label[off]);
 
@@ -1645,6 +2352,13 @@ md_label_hash(const CHAR* label, SZ size)
         }
     }
 
+    /* Final mixing, so that the low bits (used to select the slot) depend on
+     * all the input. */
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16;
     return hash;
 }
 
@@ -1693,6 +2407,22 @@ md_label_cmp(const CHAR* a_label, SZ a_size, const CHAR* b_label, SZ b_size)
     while(a_off < a_size || a_fi_off < a_fi.n_codepoints ||
           b_off < b_size || b_fi_off < b_fi.n_codepoints)
     {
+        /* Fast path: Compare ASCII characters (other than whitespace) directly. */
+        if(a_fi_off >= a_fi.n_codepoints  &&  b_fi_off >= b_fi.n_codepoints  &&
+           a_off < a_size  &&  b_off < b_size  &&
+           ISASCII_(a_label[a_off])  &&  !ISWHITESPACE_(a_label[a_off])  &&  !ISNEWLINE_(a_label[a_off])  &&
+           ISASCII_(b_label[b_off])  &&  !ISWHITESPACE_(b_label[b_off])  &&  !ISNEWLINE_(b_label[b_off]))
+        {
+            int a_ch = (ISUPPER_(a_label[a_off]) ? a_label[a_off] + 'a' - 'A' : a_label[a_off]);
+            int b_ch = (ISUPPER_(b_label[b_off]) ? b_label[b_off] + 'a' - 'A' : b_label[b_off]);
+
+            if(b_ch != a_ch)
+                return b_ch - a_ch;
+            a_off++;
+            b_off++;
+            continue;
+        }
+
         /* If needed, load fold info for next char. */
         if(a_fi_off >= a_fi.n_codepoints) {
             a_fi_off = 0;
@@ -1714,233 +2444,170 @@ md_label_cmp(const CHAR* a_label, SZ a_size, const CHAR* b_label, SZ b_size)
     return 0;
 }
 
-typedef struct MD_LABEL_HASH_LIST_tag MD_LABEL_HASH_LIST;
-struct MD_LABEL_HASH_LIST_tag {
-    unsigned n_entries;
-    unsigned alloc_entries;
-    MD_LABEL_HASH_ENTRY* entries[];
-};
+/* Seed of the label hashes. The hash tables would degrade to linear search if
+ * many labels in the input collide, so we make the hash function different
+ * for each context: The seed is mixed from the (usually randomized) addresses
+ * and from the time, i.e. from things unknown to anyone who crafts the input.
+ */
+static unsigned
+md_label_hash_seed(const MD_CTX* ctx)
+{
+    uintptr_t addr_ctx = (uintptr_t) ctx;
+    uintptr_t addr_func = (uintptr_t) &md_label_hash_seed;
+    time_t now = time(NULL);
+    clock_t ticks = clock();
+    unsigned seed = MD_FNV1A_BASE;
+
+    seed = md_fnv1a(seed, &addr_ctx, sizeof(uintptr_t));
+    seed = md_fnv1a(seed, &addr_func, sizeof(uintptr_t));
+    seed = md_fnv1a(seed, &now, sizeof(time_t));
+    seed = md_fnv1a(seed, &ticks, sizeof(clock_t));
+    return seed;
+}
 
-static int
-md_label_hash_entry_cmp(const void* a, const void* b)
+#define MD_LABEL_HASH_DEF(table, slot)                                          \
+        ((MD_LABEL_HASH_ENTRY*) ((char*)(table)->defs + ((slot)->def_index - 1) * (table)->def_size))
+
+static void md_wait_for_jobs(MD_CTX* ctx);
+
+static void
+md_free_label_hashtable(MD_CTX* ctx, MD_LABEL_HASH_TABLE* table)
 {
-    const MD_LABEL_HASH_ENTRY* a_entry = *(const MD_LABEL_HASH_ENTRY**)a;
-    const MD_LABEL_HASH_ENTRY* b_entry = *(const MD_LABEL_HASH_ENTRY**)b;
+    if(table->slots != NULL) {
+        /* Jobs processing blocks in parallel may still use the table. (Note
+         * they do not touch the definitions if the slots are not built.) */
+        md_wait_for_jobs(ctx);
 
-    if(a_entry->hash < b_entry->hash)
-        return -1;
-    else if(a_entry->hash > b_entry->hash)
-        return +1;
-    else
-        return md_label_cmp(a_entry->label, a_entry->label_size,
-                    b_entry->label, b_entry->label_size);
+        md_free(ctx, table->slots);
+        table->slots = NULL;
+        table->n_slots = 0;
+        table->n_used_slots = 0;
+        table->n_hashed_defs = 0;
+    }
 }
 
+/* Make room in the table for n more entries, keeping the load factor at most
+ * 1/2. */
 static int
-md_label_hash_entry_cmp_for_sort(const void* a, const void* b)
+md_reserve_label_hashtable(MD_CTX* ctx, MD_LABEL_HASH_TABLE* table, unsigned n)
 {
-    int cmp;
+    MD_LABEL_HASH_SLOT* slots;
+    unsigned n_slots;
+    unsigned i;
 
-    cmp = md_label_hash_entry_cmp(a, b);
+    if(table->n_used_slots + n <= table->n_slots / 2)
+        return 0;
 
-    /* Ensure stability of the sorting. */
-    if(cmp == 0) {
-        const MD_LABEL_HASH_ENTRY* a_entry = *(const MD_LABEL_HASH_ENTRY**)a;
-        const MD_LABEL_HASH_ENTRY* b_entry = *(const MD_LABEL_HASH_ENTRY**)b;
+    n_slots = (table->n_slots > 0 ? table->n_slots : 16);
+    while(n_slots / 2 < table->n_used_slots + n)
+        n_slots *= 2;
 
-        if(a_entry < b_entry)
-            cmp = -1;
-        else if(a_entry > b_entry)
-            cmp = +1;
+    slots = (MD_LABEL_HASH_SLOT*) md_malloc(ctx, n_slots * sizeof(MD_LABEL_HASH_SLOT));
+    if(slots == NULL) {
+        MD_LOG("malloc() failed.");
+        return -1;
     }
+    memset(slots, 0, n_slots * sizeof(MD_LABEL_HASH_SLOT));
 
-    return cmp;
-}
+    /* Move the used slots. (All of them refer to different labels, so we need
+     * just to find a free slot for each.) */
+    for(i = 0; i < table->n_slots; i++) {
+        const MD_LABEL_HASH_SLOT* slot = &table->slots[i];
+        unsigned j;
 
-static int
-md_is_complex_label_bucket(MD_LABEL_HASH_TABLE* table, void* bucket)
-{
-    if(bucket == NULL)
-        return FALSE;
+        if(slot->def_index == 0)
+            continue;
 
-    return (MD_LABEL_HASH_ENTRY*) bucket < (MD_LABEL_HASH_ENTRY*) table->defs  ||
-           (MD_LABEL_HASH_ENTRY*) bucket >= (MD_LABEL_HASH_ENTRY*)((char*)table->defs + table->n_defs * table->def_size);
+        j = slot->hash & (n_slots - 1);
+        while(slots[j].def_index != 0)
+            j = (j + 1) & (n_slots - 1);
+        slots[j] = *slot;
+    }
+
+    md_free(ctx, table->slots);
+    table->slots = slots;
+    table->n_slots = n_slots;
+    return 0;
 }
 
+/* Insert all the definitions added since the last call into the slots. As
+ * CommonMark requires, the 1st definition of any label wins: Later duplicates
+ * are ignored. */
 static int
 md_build_label_hashtable(MD_CTX* ctx, MD_LABEL_HASH_TABLE* table)
 {
-    unsigned i, j;
+    unsigned i;
 
-    if(table->n_defs == 0)
+    /* With MD_FLAG_EARLYBLOCKEMISSION, we may get called repeatedly as new
+     * definitions are added. */
+    if(table->n_hashed_defs == table->n_defs)
         return 0;
 
-    table->n_buckets = (table->n_defs * 5) / 4;
-    table->buckets = malloc(table->n_buckets * sizeof(void*));
-    if(table->buckets == NULL) {
-        MD_LOG("malloc() failed.");
-        goto abort;
-    }
-    memset(table->buckets, 0, table->n_buckets * sizeof(void*));
+    /* Jobs processing blocks in parallel may read the slots. */
+    if(table->slots != NULL)
+        md_wait_for_jobs(ctx);
 
-    /* Each member of table->buckets[] can be:
-     *  -- NULL,
-     *  -- pointer to the MD_LABEL_HASH_ENTRY, or
-     *  -- pointer to a MD_LABEL_HASH_LIST, which holds multiple pointers to
-     *     such entries.
-     */
-    for(i = 0; i < table->n_defs; i++) {
-        MD_LABEL_HASH_ENTRY* entry = (MD_LABEL_HASH_ENTRY*) ((char*) table->defs + i * table->def_size);
-        void** p_bucket = &table->buckets[entry->hash % table->n_buckets];
-        MD_LABEL_HASH_LIST* list;
+    if(md_reserve_label_hashtable(ctx, table, table->n_defs - table->n_hashed_defs) != 0)
+        return -1;
 
-        if(*p_bucket == NULL) {
-            /* The bucket is empty. Make it just point to the entry. */
-            *p_bucket = entry;
-            continue;
-        }
+    for(i = table->n_hashed_defs; i < table->n_defs; i++) {
+        MD_LABEL_HASH_ENTRY* entry = (MD_LABEL_HASH_ENTRY*) ((char*) table->defs + i * table->def_size);
+        unsigned mask = table->n_slots - 1;
+        unsigned j = entry->hash & mask;
 
-        if(!md_is_complex_label_bucket(table, *p_bucket))
-        {
-            /* The bucket already contains one entry. Lets see whether it is the
-             * same label (duplicate) or different one (hash conflict). */
-            MD_LABEL_HASH_ENTRY* old_entry = (MD_LABEL_HASH_ENTRY*) *p_bucket;
+        while(table->slots[j].def_index != 0) {
+            const MD_LABEL_HASH_SLOT* slot = &table->slots[j];
 
-            if(md_label_cmp(entry->label, entry->label_size,
-                        old_entry->label, old_entry->label_size) == 0) {
-                /* Duplicate label: We may ignore this definition. */
-                continue;
-            }
+            if(slot->hash == entry->hash) {
+                MD_LABEL_HASH_ENTRY* old_entry = MD_LABEL_HASH_DEF(table, slot);
 
-            /* Make the bucket complex, i.e. able to hold more entries. */
-            list = (MD_LABEL_HASH_LIST*) malloc(sizeof(MD_LABEL_HASH_LIST) +
-                        2 * sizeof(MD_LABEL_HASH_ENTRY*));
-            if(list == NULL) {
-                MD_LOG("malloc() failed.");
-                goto abort;
+                if(md_label_cmp(entry->label, entry->label_size,
+                                old_entry->label, old_entry->label_size) == 0)
+                    break;
             }
-            list->entries[0] = old_entry;
-            list->entries[1] = entry;
-            list->n_entries = 2;
-            list->alloc_entries = 2;
-            *p_bucket = list;
-            continue;
-        }
 
-        /* Append the entry to the complex bucket list.
-         *
-         * Note in this case we ignore potential duplicates to avoid expensive
-         * iterating over the complex bucket. Below, we revisit all the complex
-         * buckets and handle it more cheaply after the complex bucket contents
-         * is sorted. */
-        list = (MD_LABEL_HASH_LIST*) *p_bucket;
-        if(list->n_entries >= list->alloc_entries) {
-            size_t alloc_entries = list->alloc_entries + list->alloc_entries / 2;
-            MD_LABEL_HASH_LIST* list_tmp = (MD_LABEL_HASH_LIST*) realloc(list,
-                        sizeof(MD_LABEL_HASH_LIST) + alloc_entries * sizeof(MD_LABEL_HASH_ENTRY*));
-            if(list_tmp == NULL) {
-                MD_LOG("realloc() failed.");
-                goto abort;
-            }
-            list = list_tmp;
-            list->alloc_entries = alloc_entries;
-            table->buckets[entry->hash % table->n_buckets] = list;
+            j = (j + 1) & mask;
         }
 
-        list->entries[list->n_entries] = entry;
-        list->n_entries++;
-    }
-
-    /* Sort the complex buckets so we can use bsearch() with them. */
-    for(i = 0; i < table->n_buckets; i++) {
-        void* bucket = table->buckets[i];
-        MD_LABEL_HASH_LIST* list;
-
-        if(bucket == NULL)
-            continue;
-
-        if(!md_is_complex_label_bucket(table, bucket))
+        /* Duplicate label: We may ignore this definition. */
+        if(table->slots[j].def_index != 0)
             continue;
 
-        list = (MD_LABEL_HASH_LIST*) bucket;
-        qsort(list->entries, list->n_entries, sizeof(MD_LABEL_HASH_ENTRY*),
-                    md_label_hash_entry_cmp_for_sort);
-
-        /* Disable all duplicates in the complex bucket by forcing all such
-         * records to point to the 1st such entry. I.e. no matter which
-         * record is found during the lookup, it will always point to the right
-         * definition. */
-        for(j = 1; j < list->n_entries; j++) {
-            if(md_label_hash_entry_cmp(&list->entries[j-1], &list->entries[j]) == 0)
-                list->entries[j] = list->entries[j-1];
-        }
+        table->slots[j].hash = entry->hash;
+        table->slots[j].def_index = i + 1;
+        table->n_used_slots++;
     }
 
+    table->n_hashed_defs = table->n_defs;
     return 0;
-
-abort:
-    return -1;
-}
-
-static void
-md_free_label_hashtable(MD_CTX* ctx, MD_LABEL_HASH_TABLE* table)
-{
-    MD_UNUSED(ctx);
-
-    if(table->buckets != NULL) {
-        unsigned i;
-
-        for(i = 0; i < table->n_buckets; i++) {
-            void* bucket = table->buckets[i];
-            if(md_is_complex_label_bucket(table, bucket))
-                free(bucket);
-        }
-
-        free(table->buckets);
-    }
 }
 
 static const MD_LABEL_HASH_ENTRY*
 md_lookup_label_hashtable(MD_CTX* ctx, MD_LABEL_HASH_TABLE* table, const CHAR* label, SZ label_size)
 {
     unsigned hash;
-    void* bucket;
+    unsigned mask;
+    unsigned j;
 
     MD_UNUSED(ctx);
 
-    if(table->n_buckets == 0)
+    if(table->n_slots == 0)
         return NULL;
 
-    hash = md_label_hash(label, label_size);
-    bucket = table->buckets[hash % table->n_buckets];
+    hash = md_label_hash(table->hash_seed, label, label_size);
+    mask = table->n_slots - 1;
+    for(j = hash & mask; table->slots[j].def_index != 0; j = (j + 1) & mask) {
+        const MD_LABEL_HASH_SLOT* slot = &table->slots[j];
 
-    if(bucket == NULL) {
-        return NULL;
-    } else if(!md_is_complex_label_bucket(table, bucket)) {
-        MD_LABEL_HASH_ENTRY* entry = (MD_LABEL_HASH_ENTRY*) bucket;
+        if(slot->hash == hash) {
+            MD_LABEL_HASH_ENTRY* entry = MD_LABEL_HASH_DEF(table, slot);
 
-        if(entry->hash == hash  &&
-           md_label_cmp(entry->label, entry->label_size, label, label_size) == 0)
-            return entry;
-        else
-            return NULL;
-    } else {
-        MD_LABEL_HASH_LIST* list = (MD_LABEL_HASH_LIST*) bucket;
-        MD_LABEL_HASH_ENTRY key_buf;
-        const MD_LABEL_HASH_ENTRY* key = &key_buf;
-        MD_LABEL_HASH_ENTRY** ret;
-
-        key_buf.label = (CHAR*) label;
-        key_buf.label_size = label_size;
-        key_buf.hash = hash;
-
-        ret = (MD_LABEL_HASH_ENTRY**) bsearch(&key, list->entries,
-                    list->n_entries, sizeof(MD_LABEL_HASH_ENTRY*), md_label_hash_entry_cmp);
-        if(ret != NULL)
-            return *ret;
-        else
-            return NULL;
+            if(md_label_cmp(entry->label, entry->label_size, label, label_size) == 0)
+                return entry;
+        }
     }
+
+    return NULL;
 }
 
 static void*
@@ -1952,10 +2619,15 @@ md_add_label_def(MD_CTX* ctx, MD_LABEL_HASH_TABLE* table, const CHAR* label, SZ
         size_t new_alloc_defs;
         void* new_defs;
 
+        /* Jobs processing blocks in parallel may read defs[] (if the slots
+         * are already built). */
+        if(table->slots != NULL)
+            md_wait_for_jobs(ctx);
+
         new_alloc_defs = (table->alloc_defs > 0
                 ? table->alloc_defs + table->alloc_defs / 2
                 : 8);
-        new_defs = realloc(table->defs, new_alloc_defs * table->def_size);
+        new_defs = md_realloc(ctx, table->defs, new_alloc_defs * table->def_size);
         if(new_defs == NULL) {
             MD_LOG("realloc() failed.");
             return NULL;
@@ -1969,7 +2641,7 @@ md_add_label_def(MD_CTX* ctx, MD_LABEL_HASH_TABLE* table, const CHAR* label, SZ
     memset(entry, 0, table->def_size);
     entry->label = label;
     entry->label_size = label_size;
-    entry->hash = md_label_hash(label, label_size);
+    entry->hash = md_label_hash(table->hash_seed, label, label_size);
 
     table->n_defs++;
 
@@ -2092,7 +2764,7 @@ md_is_footnote_definition(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
      * Lines 1..n-1 are stored verbatim (md4c strips indentation before
      * handing us MD_LINE, so no further adjustment is needed). */
     n_content_lines = (off >= lines[0].end  &&  n > 1) ? n - 1 : n;
-    content_lines = (MD_LINE*) malloc(n_content_lines * sizeof(MD_LINE));
+    content_lines = (MD_LINE*) md_malloc(ctx, n_content_lines * sizeof(MD_LINE));
     if(content_lines == NULL) {
         MD_LOG("malloc() failed.");
         ret = -1;
@@ -2120,7 +2792,7 @@ md_is_footnote_definition(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
     return (int) n;
 
 abort:
-    free(content_lines);
+    md_free(ctx, content_lines);
     return ret;
 }
 
@@ -2145,8 +2817,21 @@ md_free_footnote_defs(MD_CTX* ctx)
     md_free_label_hashtable(ctx, &ctx->footnote_hashtable);
 
     for(i = 0; i < ctx->footnote_hashtable.n_defs; i++)
-        free(ctx->footnote_hashtable.footnote_defs[i].content_lines);
-    free(ctx->footnote_hashtable.footnote_defs);
+        md_free(ctx, ctx->footnote_hashtable.footnote_defs[i].content_lines);
+    md_free(ctx, ctx->footnote_hashtable.footnote_defs);
+}
+
+/* Forget all but the first n definitions. (Those have to cover all the
+ * hashed ones.) */
+static void
+md_truncate_footnote_defs(MD_CTX* ctx, unsigned n)
+{
+    MD_ASSERT(n >= ctx->footnote_hashtable.n_hashed_defs);
+
+    while(ctx->footnote_hashtable.n_defs > n) {
+        ctx->footnote_hashtable.n_defs--;
+        md_free(ctx, ctx->footnote_hashtable.footnote_defs[ctx->footnote_hashtable.n_defs].content_lines);
+    }
 }
 
 
@@ -2473,15 +3158,18 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lin
                     _T(' '), &label, &label_size));
         def = (MD_REF_DEF*) md_add_label_def(ctx, &ctx->ref_def_hashtable, label, label_size);
         if(def == NULL) {
-            free(label);
+            md_free(ctx, label);
+            ret = -1;
             goto abort;
         }
         def->label_needs_free = TRUE;
     } else {
         def = (MD_REF_DEF*) md_add_label_def(ctx, &ctx->ref_def_hashtable,
                     STR(label_contents_beg), label_contents_end - label_contents_beg);
-        if(def == NULL)
+        if(def == NULL) {
+            ret = -1;
             goto abort;
+        }
     }
 
     if(title_is_multiline) {
@@ -2503,9 +3191,9 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lin
 abort:
     /* Failure. */
     if(def != NULL  &&  def->label_needs_free)
-        free((CHAR*) def->entry.label);
+        md_free(ctx, (CHAR*) def->entry.label);
     if(def != NULL  &&  def->title_needs_free)
-        free(def->title);
+        md_free(ctx, def->title);
     return ret;
 }
 
@@ -2542,6 +3230,14 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     }
 
     def = md_lookup_ref_def(ctx, label, label_size);
+
+    /* With MD_FLAG_EARLYBLOCKEMISSION, only definitions preceding the link
+     * may be used. (The hash table may already know some following ones if
+     * they were collected before the blocks got emitted, e.g. within the same
+     * top-level container, or within the same batch for the parallel jobs.) */
+    if(def != NULL  &&  (ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION)  &&  def->dest_beg > beg)
+        def = NULL;
+
     if(def != NULL) {
         attr->dest_beg = def->dest_beg;
         attr->dest_end = def->dest_end;
@@ -2551,7 +3247,7 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     }
 
     if(is_multiline)
-        free(label);
+        md_free(ctx, label);
 
     if(def != NULL) {
         /* See https://github.com/mity/md4c/issues/238 */
@@ -2665,6 +3361,17 @@ abort:
     return ret;
 }
 
+/* Limit of the output size generated by instantiation of the link reference
+ * definitions. (See https://github.com/mity/md4c/issues/238) It does not grow
+ * anymore for documents larger than MD_REF_DEF_OUTPUT_DOC_SIZE. */
+#define MD_REF_DEF_OUTPUT_DOC_SIZE      (1024 * 1024 / 16)
+
+static inline SZ
+md_max_ref_def_output(SZ doc_size)
+{
+    return 16 * MIN(doc_size, (MD_SIZE) MD_REF_DEF_OUTPUT_DOC_SIZE);
+}
+
 static void
 md_free_ref_defs(MD_CTX* ctx)
 {
@@ -2676,12 +3383,29 @@ md_free_ref_defs(MD_CTX* ctx)
         MD_REF_DEF* def = &ctx->ref_def_hashtable.ref_defs[i];
 
         if(def->label_needs_free)
-            free((void*) def->entry.label);
+            md_free(ctx, (void*) def->entry.label);
         if(def->title_needs_free)
-            free(def->title);
+            md_free(ctx, def->title);
     }
 
-    free(ctx->ref_def_hashtable.ref_defs);
+    md_free(ctx, ctx->ref_def_hashtable.ref_defs);
+}
+
+/* Forget all but the first n definitions. (Those have to cover all the
+ * hashed ones.) */
+static void
+md_truncate_ref_defs(MD_CTX* ctx, unsigned n)
+{
+    MD_ASSERT(n >= ctx->ref_def_hashtable.n_hashed_defs);
+
+    while(ctx->ref_def_hashtable.n_defs > n) {
+        MD_REF_DEF* def = &ctx->ref_def_hashtable.ref_defs[--ctx->ref_def_hashtable.n_defs];
+
+        if(def->label_needs_free)
+            md_free(ctx, (void*) def->entry.label);
+        if(def->title_needs_free)
+            md_free(ctx, def->title);
+    }
 }
 
 
@@ -2844,13 +3568,14 @@ md_add_mark(MD_CTX* ctx)
         ctx->alloc_marks = (ctx->alloc_marks > 0
                 ? ctx->alloc_marks + ctx->alloc_marks / 2
                 : 64);
-        new_marks = realloc(ctx->marks, ctx->alloc_marks * sizeof(MD_MARK));
+        new_marks = md_realloc(ctx, ctx->marks, ctx->alloc_marks * sizeof(MD_MARK));
         if(new_marks == NULL) {
             MD_LOG("realloc() failed.");
             return NULL;
         }
 
         ctx->marks = new_marks;
+        MD_STATS_INC(marks_reallocs);
     }
 
     return &ctx->marks[ctx->n_marks++];
@@ -2950,9 +3675,86 @@ md_disable_marks(MD_CTX* ctx, int mark_index0, int mark_index1)
     }
 }
 
-static void
-md_build_mark_char_map(MD_CTX* ctx)
-{
+#ifdef MD4C_USE_UTF16
+    /* For UTF-16, mark_char_map[] covers only ASCII. */
+    #define IS_MARK_CHAR(off)   ((CH(off) < SIZEOF_ARRAY(ctx->mark_char_map))  &&  \
+                                (ctx->mark_char_map[(unsigned char) CH(off)]))
+#else
+    /* For 8-bit encodings, mark_char_map[] covers all 256 elements. */
+    #define IS_MARK_CHAR(off)   (ctx->mark_char_map[(unsigned char) CH(off)])
+#endif
+
+static OFF
+md_skip_non_mark_chars_scalar(MD_CTX* ctx, OFF off, OFF end)
+{
+    /* Optimization: Use some loop unrolling. */
+    while(off + 3 < end  &&  !IS_MARK_CHAR(off+0)  &&  !IS_MARK_CHAR(off+1)
+                         &&  !IS_MARK_CHAR(off+2)  &&  !IS_MARK_CHAR(off+3))
+        off += 4;
+    while(off < end  &&  !IS_MARK_CHAR(off+0))
+        off++;
+    return off;
+}
+
+#ifdef MD_X86_SIMD
+/* The SIMD variants classify whole vectors of chars at once, with the
+ * "nibble lookup": Each byte b is a mark char if and only if
+ * (mark_char_nibble_map[b & 0x0f] & (1 << (b >> 4))) is non-zero. Both
+ * lookups are done by the PSHUFB instruction. (Bytes >= 0x80 are never mark
+ * chars and the second lookup table has zeroes for them.) */
+
+MD_TARGET("ssse3") static OFF
+md_skip_non_mark_chars_ssse3(MD_CTX* ctx, OFF off, OFF end)
+{
+    const __m128i lo_map = _mm_loadu_si128((const __m128i*) ctx->mark_char_nibble_map);
+    const __m128i hi_map = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+
+    while(end - off >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (ctx->text + off));
+        __m128i lo = _mm_shuffle_epi8(lo_map, _mm_and_si128(v, nibble_mask));
+        __m128i hi = _mm_shuffle_epi8(hi_map, _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask));
+        unsigned hits = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero)) ^ 0xffff;
+
+        if(hits != 0)
+            return off + MD_CTZ(hits);
+        off += 16;
+    }
+
+    return md_skip_non_mark_chars_scalar(ctx, off, end);
+}
+
+MD_TARGET("avx2") static OFF
+md_skip_non_mark_chars_avx2(MD_CTX* ctx, OFF off, OFF end)
+{
+    const __m128i lo_map128 = _mm_loadu_si128((const __m128i*) ctx->mark_char_nibble_map);
+    const __m256i lo_map = _mm256_broadcastsi128_si256(lo_map128);
+    const __m256i hi_map = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+                                            1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while(end - off >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (ctx->text + off));
+        __m256i lo = _mm256_shuffle_epi8(lo_map, _mm256_and_si256(v, nibble_mask));
+        __m256i hi = _mm256_shuffle_epi8(hi_map, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask));
+        unsigned hits = ~(unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), zero));
+
+        if(hits != 0)
+            return off + MD_CTZ(hits);
+        off += 32;
+    }
+
+    /* Avoid the AVX-SSE transition penalty in the legacy SSE code. */
+    _mm256_zeroupper();
+    return md_skip_non_mark_chars_ssse3(ctx, off, end);
+}
+#endif
+
+static void
+md_build_mark_char_map(MD_CTX* ctx)
+{
     memset(ctx->mark_char_map, 0, sizeof(ctx->mark_char_map));
 
     ctx->mark_char_map['\\'] = 1;
@@ -3001,6 +3803,47 @@ md_build_mark_char_map(MD_CTX* ctx)
                 ctx->mark_char_map[i] = 1;
         }
     }
+
+    ctx->skip_non_mark_chars = md_skip_non_mark_chars_scalar;
+
+#ifdef MD_X86_SIMD
+    {
+        int i;
+
+        memset(ctx->mark_char_nibble_map, 0, sizeof(ctx->mark_char_nibble_map));
+        for(i = 0; i < 128; i++) {
+            if(ctx->mark_char_map[i])
+                ctx->mark_char_nibble_map[i & 0x0f] |= (unsigned char) (1 << (i >> 4));
+        }
+
+        switch(md_x86_simd_level()) {
+            case MD_SIMD_AVX2:  ctx->skip_non_mark_chars = md_skip_non_mark_chars_avx2; break;
+            case MD_SIMD_SSSE3: ctx->skip_non_mark_chars = md_skip_non_mark_chars_ssse3; break;
+            default:            break;
+        }
+    }
+#endif
+}
+
+/* Returns offset of the first char in mark_char_map[] in the range [off, end),
+ * or end if there is none. (The caller may pass off > end, e.g. after an
+ * escape at the very end of a line.) */
+static inline OFF
+md_skip_non_mark_chars(MD_CTX* ctx, OFF off, OFF end)
+{
+    OFF stop = (off + 8 < end) ? off + 8 : end;
+
+    /* Marks often come close to each other. Check few chars inline before
+     * paying for the indirect call. */
+    while(off < stop) {
+        if(IS_MARK_CHAR(off))
+            return off;
+        off++;
+    }
+
+    if(off >= end)
+        return end;
+    return ctx->skip_non_mark_chars(ctx, off, end);
 }
 
 static int
@@ -3246,22 +4089,7 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table_m
         while(TRUE) {
             CHAR ch;
 
-#ifdef MD4C_USE_UTF16
-    /* For UTF-16, mark_char_map[] covers only ASCII. */
-    #define IS_MARK_CHAR(off)   ((CH(off) < SIZEOF_ARRAY(ctx->mark_char_map))  &&  \
-                                (ctx->mark_char_map[(unsigned char) CH(off)]))
-#else
-    /* For 8-bit encodings, mark_char_map[] covers all 256 elements. */
-    #define IS_MARK_CHAR(off)   (ctx->mark_char_map[(unsigned char) CH(off)])
-#endif
-
-            /* Optimization: Use some loop unrolling. */
-            while(off + 3 < line->end  &&  !IS_MARK_CHAR(off+0)  &&  !IS_MARK_CHAR(off+1)
-                                       &&  !IS_MARK_CHAR(off+2)  &&  !IS_MARK_CHAR(off+3))
-                off += 4;
-            while(off < line->end  &&  !IS_MARK_CHAR(off+0))
-                off++;
-
+            off = md_skip_non_mark_chars(ctx, off, line->end);
             if(off >= line->end)
                 break;
 
@@ -3845,6 +4673,8 @@ md_resolve_bracket_footnote(MD_CTX* ctx, MD_MARK* opener, MD_MARK* closer,
     def = md_lookup_footnote_def(ctx, STR(label_beg), label_end - label_beg);
     if(def == NULL)
         return FALSE;
+    if((ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION)  &&  def->entry.label > STR(label_beg))
+        return FALSE;
 
     /* Assign index on first reference. */
     if(def->index == 0)
@@ -3925,7 +4755,7 @@ md_resolve_bracket_link(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
                         if(ctx->marks[mark->next].beg >= inline_link_end) {
                             /* Cancel the link status. */
                             if(attr.title_needs_free)
-                                free(attr.title);
+                                md_free(ctx, attr.title);
                             is_link = FALSE;
                             break;
                         }
@@ -4556,6 +5386,8 @@ md_analyze_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     MD_UNUSED(lines);
     MD_UNUSED(n_lines);
 
+    ctx->profile_n_passes++;
+
     while(i < mark_end) {
         MD_MARK* mark = &ctx->marks[i];
 
@@ -4613,10 +5445,30 @@ md_analyze_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     }
 }
 
+static void
+md_stats_count_marks(MD_CTX* ctx)
+{
+    MD_PARSE_STATS* stats = ctx->parser.stats;
+    int i;
+
+    for(i = 0; i < ctx->n_marks; i++) {
+        const MD_MARK* mark = &ctx->marks[i];
+
+        /* Skip the dummy marks. */
+        if(!ISASCII_(mark->ch)  ||  !ctx->mark_char_map[(unsigned char) mark->ch])
+            continue;
+
+        stats->marks_collected[(unsigned char) mark->ch]++;
+        if(mark->flags & MD_MARK_RESOLVED)
+            stats->marks_resolved[(unsigned char) mark->ch]++;
+    }
+}
+
 /* Analyze marks (build ctx->marks). */
 static int
 md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table_mode)
 {
+    MD_STATS_MARK stats_mark;
     int i;
     int ret;
 
@@ -4624,7 +5476,11 @@ md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table
     ctx->n_marks = 0;
 
     /* Collect all marks. */
+    MD_STATS_ENTER(stats_mark);
     MD_CHECK(md_collect_marks(ctx, lines, n_lines, table_mode));
+    MD_STATS_LEAVE(stats_mark, time_mark_collection);
+    ctx->profile_n_marks += (unsigned) ctx->n_marks;
+    MD_STATS_ENTER(stats_mark);
 
     /* (1) Bracket spans: links, wiki links, footnotes. */
     md_analyze_marks(ctx, lines, n_lines, 0, ctx->n_marks, _T("[]!"), NULL);
@@ -4643,11 +5499,14 @@ md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table
                mark->ch == '|' && mark->end - mark->beg == 1)
                 md_analyze_table_cell_boundary(ctx, i);
         }
-        return ret;
+    } else {
+        /* (3) Emphasis and strong emphasis; permissive autolinks. */
+        md_analyze_link_contents(ctx, lines, n_lines, 0, ctx->n_marks);
     }
 
-    /* (3) Emphasis and strong emphasis; permissive autolinks. */
-    md_analyze_link_contents(ctx, lines, n_lines, 0, ctx->n_marks);
+    if(ctx->parser.stats != NULL)
+        md_stats_count_marks(ctx);
+    MD_STATS_LEAVE(stats_mark, time_inline_analysis);
 
 abort:
     return ret;
@@ -5192,7 +6051,7 @@ md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
     /* We have to remember the cell boundaries in local buffer because
      * ctx->marks[] shall be reused during cell contents processing. */
     n = ctx->n_table_cell_boundaries + 2;
-    pipe_offs = (OFF*) malloc(n * sizeof(OFF));
+    pipe_offs = (OFF*) md_malloc(ctx, n * sizeof(OFF));
     if(pipe_offs == NULL) {
         MD_LOG("malloc() failed.");
         ret = -1;
@@ -5220,7 +6079,7 @@ md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
     MD_LEAVE_BLOCK(MD_BLOCK_TR, NULL);
 
 abort:
-    free(pipe_offs);
+    md_free(ctx, pipe_offs);
 
     ctx->table_cell_boundaries_head = -1;
     ctx->table_cell_boundaries_tail = -1;
@@ -5239,7 +6098,7 @@ md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines
      * with the underlines. */
     MD_ASSERT(n_lines >= 2);
 
-    align = malloc(col_count * sizeof(MD_ALIGN));
+    align = md_malloc(ctx, col_count * sizeof(MD_ALIGN));
     if(align == NULL) {
         MD_LOG("malloc() failed.");
         ret = -1;
@@ -5263,7 +6122,7 @@ md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines
     }
 
 abort:
-    free(align);
+    md_free(ctx, align);
     return ret;
 }
 
@@ -5277,6 +6136,7 @@ abort:
 #define MD_BLOCK_CONTAINER          (MD_BLOCK_CONTAINER_OPENER | MD_BLOCK_CONTAINER_CLOSER)
 #define MD_BLOCK_LOOSE_LIST         0x04
 #define MD_BLOCK_SETEXT_HEADER      0x08
+#define MD_BLOCK_IN_TIGHT_LIST      0x10    /* Only for md_process_blocks_in_parallel(). */
 
 struct MD_BLOCK_tag {
     MD_BLOCKTYPE type  :  8;
@@ -5314,16 +6174,19 @@ struct MD_CONTAINER_tag {
 static int
 md_process_normal_block_contents(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
 {
+    MD_STATS_MARK stats_mark;
     int i;
     int ret;
 
     MD_CHECK(md_analyze_inlines(ctx, lines, n_lines, FALSE));
+    MD_STATS_ENTER(stats_mark);
     MD_CHECK(md_process_inlines(ctx, lines, n_lines));
+    MD_STATS_LEAVE(stats_mark, time_inline_emission);
 
 abort:
     /* Free any temporary memory blocks stored within some dummy marks. */
     for(i = ctx->ptr_stack.top; i >= 0; i = ctx->marks[i].next)
-        free(md_mark_get_ptr(ctx, i));
+        md_free(ctx, md_mark_get_ptr(ctx, i));
     ctx->ptr_stack.top = -1;
 
     return ret;
@@ -5425,8 +6288,47 @@ abort:
     return ret;
 }
 
+/* Report the leaf block to MD_PARSER::block_profiler if its processing,
+ * started at time_beg, has been slow. */
+static void
+md_profile_leaf_block(MD_CTX* ctx, const MD_BLOCK* block, double time_beg)
+{
+    const MD_BLOCK_PROFILER* profiler = ctx->parser.block_profiler;
+    MD_BLOCK_PROFILE profile;
+
+    profile.time = md_stats_time() - time_beg;
+    if(profile.time < profiler->threshold)
+        return;
+
+    profile.type = block->type;
+    profile.beg = 0;
+    profile.end = 0;
+    profile.n_lines = block->n_lines;
+    if(block->type == MD_BLOCK_CODE  ||  block->type == MD_BLOCK_HTML) {
+        const MD_VERBATIMLINE* lines = (const MD_VERBATIMLINE*)(block + 1);
+
+        /* The first line of a fenced code block is the opening fence. */
+        if(block->type == MD_BLOCK_CODE  &&  block->data != 0) {
+            lines++;
+            profile.n_lines--;
+        }
+        if(profile.n_lines > 0) {
+            profile.beg = lines[0].beg;
+            profile.end = lines[profile.n_lines - 1].end;
+        }
+    } else if(block->n_lines > 0) {
+        const MD_LINE* lines = (const MD_LINE*)(block + 1);
+        profile.beg = lines[0].beg;
+        profile.end = lines[block->n_lines - 1].end;
+    }
+    profile.n_marks = ctx->profile_n_marks;
+    profile.n_passes = ctx->profile_n_passes;
+
+    profiler->slow_block(&profile, profiler->data);
+}
+
 static int
-md_process_leaf_block(MD_CTX* ctx, MD_BLOCK* block)
+md_process_leaf_block(MD_CTX* ctx, MD_BLOCK* block, int is_in_tight_list)
 {
     union {
         MD_BLOCK_H_DETAIL header;
@@ -5435,10 +6337,16 @@ md_process_leaf_block(MD_CTX* ctx, MD_BLOCK* block)
     } det;
     MD_ATTRIBUTE_BUILD info_build = { 0 };
     MD_ATTRIBUTE_BUILD lang_build = { 0 };
-    int is_in_tight_list;
     int clean_fence_code_detail = FALSE;
+    double profile_time = 0.0;
     int ret = 0;
 
+    if(ctx->parser.block_profiler != NULL) {
+        ctx->profile_n_marks = 0;
+        ctx->profile_n_passes = 0;
+        profile_time = md_stats_time();
+    }
+
     /* For large tables check the table density: If it's too low, lets suppress
      * its interpretation as a table, as a safety measure against quadratic
      * output size explosion. See https://github.com/mity/md4c/issues/345 */
@@ -5466,11 +6374,6 @@ md_process_leaf_block(MD_CTX* ctx, MD_BLOCK* block)
 
     memset(&det, 0, sizeof(det));
 
-    if(ctx->n_containers == 0)
-        is_in_tight_list = FALSE;
-    else
-        is_in_tight_list = !ctx->containers[ctx->n_containers-1].is_loose;
-
     switch(block->type) {
         case MD_BLOCK_H:
             det.header.level = block->data;
@@ -5529,6 +6432,9 @@ md_process_leaf_block(MD_CTX* ctx, MD_BLOCK* block)
     if(!is_in_tight_list  ||  block->type != MD_BLOCK_P)
         MD_LEAVE_BLOCK(block->type, (void*) &det);
 
+    if(ctx->parser.block_profiler != NULL)
+        md_profile_leaf_block(ctx, block, profile_time);
+
 abort:
     if(clean_fence_code_detail) {
         md_free_attribute(ctx, &info_build);
@@ -5540,1040 +6446,1842 @@ abort:
 static const MD_CHAR* MD_ADMONITION_TAGS[] = { _T("note"), _T("tip"), _T("important"), _T("warning"), _T("caution") };
 
 static int
-md_process_all_blocks(MD_CTX* ctx)
+md_process_container_block(MD_CTX* ctx, const MD_BLOCK* block)
 {
     MD_TEXTTYPE adm_substr_types[1] = { MD_TEXT_NORMAL };
     MD_OFFSET adm_substr_offsets[2];
-    int byte_off = 0;
+    union {
+        MD_BLOCK_UL_DETAIL ul;
+        MD_BLOCK_OL_DETAIL ol;
+        MD_BLOCK_LI_DETAIL li;
+        MD_BLOCK_ADMONITION_DETAIL adm;
+    } det;
     int ret = 0;
 
-    /* ctx->containers now is not needed for detection of lists and list items
-     * so we reuse it for tracking what lists are loose or tight. We rely
-     * on the fact the vector is large enough to hold the deepest nesting
-     * level of lists. */
-    ctx->n_containers = 0;
+    switch(block->type) {
+        case MD_BLOCK_UL:
+            det.ul.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
+            det.ul.mark = (CHAR) block->data;
+            break;
 
-    while(byte_off < ctx->n_block_bytes) {
-        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
-        union {
-            MD_BLOCK_UL_DETAIL ul;
-            MD_BLOCK_OL_DETAIL ol;
-            MD_BLOCK_LI_DETAIL li;
-            MD_BLOCK_ADMONITION_DETAIL adm;
-        } det;
-
-        switch(block->type) {
-            case MD_BLOCK_UL:
-                det.ul.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
-                det.ul.mark = (CHAR) block->data;
-                break;
+        case MD_BLOCK_OL:
+            det.ol.start = block->n_lines;
+            det.ol.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
+            det.ol.mark_delimiter = (CHAR) block->data;
+            break;
 
-            case MD_BLOCK_OL:
-                det.ol.start = block->n_lines;
-                det.ol.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
-                det.ol.mark_delimiter = (CHAR) block->data;
-                break;
+        case MD_BLOCK_LI:
+            det.li.is_task = (block->data != 0);
+            det.li.task_mark = (CHAR) block->data;
+            det.li.task_mark_offset = (OFF) block->n_lines;
+            break;
 
-            case MD_BLOCK_LI:
-                det.li.is_task = (block->data != 0);
-                det.li.task_mark = (CHAR) block->data;
-                det.li.task_mark_offset = (OFF) block->n_lines;
-                break;
+        case MD_BLOCK_ADMONITION:
+            adm_substr_offsets[0] = 0;
+            adm_substr_offsets[1] = md_strlen(MD_ADMONITION_TAGS[block->data]);
 
-            case MD_BLOCK_ADMONITION:
-                adm_substr_offsets[0] = 0;
-                adm_substr_offsets[1] = md_strlen(MD_ADMONITION_TAGS[block->data]);
+            det.adm.type.text = MD_ADMONITION_TAGS[block->data];
+            det.adm.type.size = adm_substr_offsets[1];
+            det.adm.type.substr_types = adm_substr_types;
+            det.adm.type.substr_offsets = adm_substr_offsets;
+            break;
 
-                det.adm.type.text = MD_ADMONITION_TAGS[block->data];
-                det.adm.type.size = adm_substr_offsets[1];
-                det.adm.type.substr_types = adm_substr_types;
-                det.adm.type.substr_offsets = adm_substr_offsets;
-                break;
+        default:
+            /* noop */
+            break;
+    }
 
-            default:
-                /* noop */
-                break;
+    if(block->flags & MD_BLOCK_CONTAINER_CLOSER)
+        MD_LEAVE_BLOCK(block->type, &det);
+    if(block->flags & MD_BLOCK_CONTAINER_OPENER)
+        MD_ENTER_BLOCK(block->type, &det);
+
+abort:
+    return ret;
+}
+
+/* ctx->containers is not needed for detection of lists and list items when
+ * we get to processing the blocks so we reuse it for tracking what lists are
+ * loose or tight. We rely on the fact the vector is large enough to hold the
+ * deepest nesting level of lists. */
+static void
+md_track_loose_containers(MD_CTX* ctx, const MD_BLOCK* block)
+{
+    if(block->flags & MD_BLOCK_CONTAINER_CLOSER) {
+        if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL ||
+           block->type == MD_BLOCK_QUOTE || block->type == MD_BLOCK_ADMONITION)
+            ctx->n_containers--;
+    }
+
+    if(block->flags & MD_BLOCK_CONTAINER_OPENER) {
+        if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL) {
+            ctx->containers[ctx->n_containers].is_loose = (block->flags & MD_BLOCK_LOOSE_LIST) ? TRUE : FALSE;
+            ctx->n_containers++;
+        } else if(block->type == MD_BLOCK_QUOTE  ||  block->type == MD_BLOCK_ADMONITION) {
+            /* This causes that any text in a block quote, even if
+             * nested inside a tight list item, is wrapped with
+             * <p>...</p>. */
+            ctx->containers[ctx->n_containers].is_loose = TRUE;
+            ctx->n_containers++;
         }
+    }
+}
 
-        if(block->flags & MD_BLOCK_CONTAINER) {
-            if(block->flags & MD_BLOCK_CONTAINER_CLOSER) {
-                MD_LEAVE_BLOCK(block->type, &det);
+static inline int
+md_is_in_tight_list(MD_CTX* ctx)
+{
+    if(ctx->n_containers == 0)
+        return FALSE;
+    return !ctx->containers[ctx->n_containers-1].is_loose;
+}
 
-                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL ||
-                   block->type == MD_BLOCK_QUOTE || block->type == MD_BLOCK_ADMONITION)
-                    ctx->n_containers--;
-            }
+/* Size of a leaf block, including its lines, in ctx->block_bytes. */
+static inline size_t
+md_leaf_block_bytes(const MD_BLOCK* block)
+{
+    if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+        return sizeof(MD_BLOCK) + block->n_lines * sizeof(MD_VERBATIMLINE);
+    else
+        return sizeof(MD_BLOCK) + block->n_lines * sizeof(MD_LINE);
+}
 
-            if(block->flags & MD_BLOCK_CONTAINER_OPENER) {
-                MD_ENTER_BLOCK(block->type, &det);
-
-                if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL) {
-                    ctx->containers[ctx->n_containers].is_loose = (block->flags & MD_BLOCK_LOOSE_LIST) ? TRUE : FALSE;
-                    ctx->n_containers++;
-                } else if(block->type == MD_BLOCK_QUOTE  ||  block->type == MD_BLOCK_ADMONITION) {
-                    /* This causes that any text in a block quote, even if
-                     * nested inside a tight list item, is wrapped with
-                     * <p>...</p>. */
-                    ctx->containers[ctx->n_containers].is_loose = TRUE;
-                    ctx->n_containers++;
-                }
-            }
-        } else {
-            MD_CHECK(md_process_leaf_block(ctx, block));
 
-            if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
-                byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
-            else
-                byte_off += block->n_lines * sizeof(MD_LINE);
-        }
+/******************************************
+ ***  Parallel Processing of the Blocks  ***
+ ******************************************/
 
-        byte_off += sizeof(MD_BLOCK);
-    }
+/* With MD_PARSER::executor, md_process_all_blocks() splits the blocks into
+ * runs of consecutive blocks and each run is processed by a job with its own
+ * MD_CTX (sharing the document and the label hash tables, which are only
+ * read by then). The job records all the callbacks it would make, and the
+ * main thread then replays the records of each job in the document order.
+ *
+ * Blocks do not depend on each other with the following exceptions:
+ *
+ *   -- Whether a paragraph is in a tight list is determined by its parent
+ *      containers; so it is precomputed by the main thread into the flag
+ *      MD_BLOCK_IN_TIGHT_LIST.
+ *
+ *   -- Footnote numbering follows the order of the references in the whole
+ *      document; so we do not process documents with any footnote
+ *      definitions in parallel at all.
+ *
+ *   -- The budget of MD_CTX::max_ref_def_output has to be spent in the
+ *      document order. We do not know how much of it the preceding jobs
+ *      use, so each job starts with all of the budget left when it is
+ *      submitted. When replaying, the job's consumption is subtracted; and
+ *      if it reaches what the preceding jobs have left, the job might have
+ *      resolved some link the serial processing would not, so it is run
+ *      again (synchronously) with the exact budget.
+ */
 
-    ctx->n_block_bytes = 0;
+/* Roughly, how much input text each job gets. */
+#define MD_PARALLEL_JOB_SIZE        (32 * 1024)
 
-abort:
-    return ret;
+#define MD_PARALLEL_DEFAULT_JOBS    8
+#define MD_PARALLEL_MAX_JOBS        256
+
+static unsigned
+md_executor_max_jobs(const MD_EXECUTOR* executor)
+{
+    if(executor->max_jobs == 0)
+        return MD_PARALLEL_DEFAULT_JOBS;
+    return MIN(executor->max_jobs, MD_PARALLEL_MAX_JOBS);
 }
 
+#define MD_RECORD_ENTER_BLOCK       1
+#define MD_RECORD_LEAVE_BLOCK       2
+#define MD_RECORD_ENTER_SPAN        3
+#define MD_RECORD_LEAVE_SPAN        4
+#define MD_RECORD_TEXT              5
+#define MD_RECORD_LOG               6
+
+typedef struct MD_RECORD_tag MD_RECORD;
+struct MD_RECORD_tag {
+    unsigned op;        /* MD_RECORD_xxx */
+    unsigned type;      /* MD_BLOCKTYPE, MD_SPANTYPE or MD_TEXTTYPE. */
+    const void* ptr;    /* Detail, text or log message. */
+    SZ size;            /* Text size. */
+};
 
-/************************************
- ***  Grouping Lines into Blocks  ***
- ************************************/
+struct MD_JOB_tag {
+    MD_CTX ctx;         /* Context of the job (ctx.userdata points back to the job). */
+
+    char* beg;          /* Range of the main ctx->block_bytes (or of block_copy) to process. */
+    char* end;
+    void* handle;       /* From MD_EXECUTOR::submit(), or NULL. */
+    SZ max_ref_def_output;  /* MD_CTX::max_ref_def_output the job has started with. */
+    int ret;
+
+    MD_RECORD* records;
+    unsigned n_records;
+    unsigned alloc_records;
+
+    /* With MD_CTX::keep_jobs_pending, the main thread reuses its block_bytes
+     * while the job is running, so the job gets a copy of them. */
+    char* block_copy;
+    int alloc_block_copy;
+
+    /* Memory for record details and for copies of any strings which do not
+     * live in the document itself. It is a list of chunks, each starting with
+     * MD_ARENA_HEADER which links the next one. */
+    void* pool_chunks;
+    char* pool_ptr;
+    char* pool_end;
+};
+
+#define MD_JOB_POOL_CHUNK_SIZE      (64 * 1024)
+
+/* Forward declarations; these are defined below with md_parse(). */
+static void md_init_ctx(MD_CTX* ctx, const MD_PARSER* parser);
+static void md_free_ctx_buffers(MD_CTX* ctx);
+static void md_setup_doc(MD_CTX* ctx, const MD_CHAR* text, MD_SIZE size, void* userdata);
 
 static void*
-md_push_block_bytes(MD_CTX* ctx, int n_bytes)
+md_job_alloc(MD_JOB* job, size_t size)
 {
     void* ptr;
 
-    if(ctx->n_block_bytes + n_bytes > ctx->alloc_block_bytes) {
-        void* new_block_bytes;
+    size = MD_ARENA_ROUND(size);
+    if(job->pool_ptr == NULL  ||  (size_t)(job->pool_end - job->pool_ptr) < size) {
+        size_t chunk_size = MAX(MD_JOB_POOL_CHUNK_SIZE, size + sizeof(MD_ARENA_HEADER));
+        MD_ARENA_HEADER* chunk;
 
-        ctx->alloc_block_bytes = (ctx->alloc_block_bytes > 0
-                ? ctx->alloc_block_bytes + ctx->alloc_block_bytes / 2
-                : 512);
-        new_block_bytes = realloc(ctx->block_bytes, ctx->alloc_block_bytes);
-        if(new_block_bytes == NULL) {
-            MD_LOG("realloc() failed.");
+        chunk = (MD_ARENA_HEADER*) md_raw_malloc(&job->ctx.parser, chunk_size);
+        if(chunk == NULL)
             return NULL;
-        }
-
-        /* Fix the ->current_block after the reallocation. */
-        if(ctx->current_block != NULL) {
-            OFF off_current_block = (OFF) ((char*) ctx->current_block - (char*) ctx->block_bytes);
-            ctx->current_block = (MD_BLOCK*) ((char*) new_block_bytes + off_current_block);
-        }
 
-        ctx->block_bytes = new_block_bytes;
+        chunk->next = job->pool_chunks;
+        job->pool_chunks = chunk;
+        job->pool_ptr = (char*) (chunk + 1);
+        job->pool_end = (char*) chunk + chunk_size;
     }
 
-    ptr = (char*)ctx->block_bytes + ctx->n_block_bytes;
-    ctx->n_block_bytes += n_bytes;
+    ptr = job->pool_ptr;
+    job->pool_ptr += size;
     return ptr;
 }
 
+static void
+md_job_release_pool(MD_JOB* job)
+{
+    while(job->pool_chunks != NULL) {
+        MD_ARENA_HEADER* chunk = (MD_ARENA_HEADER*) job->pool_chunks;
+        job->pool_chunks = chunk->next;
+        md_raw_free(&job->ctx.parser, chunk);
+    }
+
+    job->pool_ptr = NULL;
+    job->pool_end = NULL;
+}
+
+/* Strings inside the document stay valid until md_parse() returns. Anything
+ * else (e.g. contents of MD_CTX::buffer) has to be copied. */
+static const CHAR*
+md_job_keep_string(MD_JOB* job, const CHAR* str, SZ size)
+{
+    CHAR* copy;
+
+    if(str == NULL  ||  (str >= job->ctx.text  &&  str + size <= job->ctx.text + job->ctx.size))
+        return str;
+
+    copy = (CHAR*) md_job_alloc(job, size * sizeof(CHAR));
+    if(copy != NULL)
+        memcpy(copy, str, size * sizeof(CHAR));
+    return copy;
+}
+
 static int
-md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
+md_job_keep_attribute(MD_JOB* job, MD_ATTRIBUTE* attr)
 {
-    MD_BLOCK* block;
+    MD_TEXTTYPE* substr_types;
+    MD_OFFSET* substr_offsets;
+    unsigned n = 0;
 
-    MD_ASSERT(ctx->current_block == NULL);
+    if(attr->size > 0) {
+        attr->text = md_job_keep_string(job, attr->text, attr->size);
+        if(attr->text == NULL)
+            return -1;
+    }
 
-    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
-    if(block == NULL)
+    if(attr->substr_offsets == NULL)
+        return 0;
+
+    while(attr->substr_offsets[n] < attr->size)
+        n++;
+
+    substr_types = (MD_TEXTTYPE*) md_job_alloc(job, n * sizeof(MD_TEXTTYPE));
+    substr_offsets = (MD_OFFSET*) md_job_alloc(job, (n+1) * sizeof(MD_OFFSET));
+    if(substr_types == NULL  ||  substr_offsets == NULL)
         return -1;
+    memcpy(substr_types, attr->substr_types, n * sizeof(MD_TEXTTYPE));
+    memcpy(substr_offsets, attr->substr_offsets, (n+1) * sizeof(MD_OFFSET));
+    attr->substr_types = substr_types;
+    attr->substr_offsets = substr_offsets;
+    return 0;
+}
 
-    switch(line->type) {
-        case MD_LINE_HR:
-            block->type = MD_BLOCK_HR;
-            break;
+/* Blocks of types without any detail structure still get a pointer to zeroed
+ * memory from md_process_leaf_block(). When replaying, we pass this instead. */
+static union {
+    MD_BLOCK_H_DETAIL header;
+    MD_BLOCK_CODE_DETAIL code;
+    MD_BLOCK_TABLE_DETAIL table;
+} md_job_dummy_detail;
 
-        case MD_LINE_ATXHEADER:
-        case MD_LINE_SETEXTHEADER:
-            block->type = MD_BLOCK_H;
-            break;
+static int
+md_job_record(MD_JOB* job, unsigned op, unsigned type, const void* ptr, SZ size)
+{
+    MD_CTX* ctx = &job->ctx;
+    MD_RECORD* record;
+    size_t detail_size = 0;
+    MD_ATTRIBUTE* attrs[2];
+    int n_attrs = 0;
+    int i;
 
-        case MD_LINE_FENCEDCODE:
-        case MD_LINE_INDENTEDCODE:
-            block->type = MD_BLOCK_CODE;
+    if(job->n_records >= job->alloc_records) {
+        MD_RECORD* new_records;
+        unsigned new_alloc = (job->alloc_records > 0
+                ? job->alloc_records + job->alloc_records / 2 : 256);
+
+        new_records = (MD_RECORD*) md_raw_realloc(&ctx->parser, job->records,
+                                                  new_alloc * sizeof(MD_RECORD));
+        if(new_records == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
+        }
+
+        job->records = new_records;
+        job->alloc_records = new_alloc;
+    }
+
+    record = &job->records[job->n_records];
+    record->op = op;
+    record->type = type;
+    record->ptr = ptr;
+    record->size = size;
+
+    switch(op) {
+        case MD_RECORD_ENTER_BLOCK:
+        case MD_RECORD_LEAVE_BLOCK:
+            if(ptr == NULL)
+                break;
+            switch(type) {
+                case MD_BLOCK_UL:           detail_size = sizeof(MD_BLOCK_UL_DETAIL); break;
+                case MD_BLOCK_OL:           detail_size = sizeof(MD_BLOCK_OL_DETAIL); break;
+                case MD_BLOCK_LI:           detail_size = sizeof(MD_BLOCK_LI_DETAIL); break;
+                case MD_BLOCK_H:            detail_size = sizeof(MD_BLOCK_H_DETAIL); break;
+                case MD_BLOCK_TABLE:        detail_size = sizeof(MD_BLOCK_TABLE_DETAIL); break;
+                case MD_BLOCK_TH:           /* Pass through. */
+                case MD_BLOCK_TD:           detail_size = sizeof(MD_BLOCK_TD_DETAIL); break;
+                case MD_BLOCK_CODE:         detail_size = sizeof(MD_BLOCK_CODE_DETAIL); break;
+                case MD_BLOCK_ADMONITION:   detail_size = sizeof(MD_BLOCK_ADMONITION_DETAIL); break;
+                default:                    record->ptr = &md_job_dummy_detail; break;
+            }
             break;
 
-        case MD_LINE_TEXT:
-            block->type = MD_BLOCK_P;
+        case MD_RECORD_ENTER_SPAN:
+        case MD_RECORD_LEAVE_SPAN:
+            if(ptr == NULL)
+                break;
+            switch(type) {
+                case MD_SPAN_A:             detail_size = sizeof(MD_SPAN_A_DETAIL); break;
+                case MD_SPAN_IMG:           detail_size = sizeof(MD_SPAN_IMG_DETAIL); break;
+                case MD_SPAN_WIKILINK:      detail_size = sizeof(MD_SPAN_WIKILINK_DETAIL); break;
+                default:                    record->ptr = NULL; break;
+            }
             break;
 
-        case MD_LINE_HTML:
-            block->type = MD_BLOCK_HTML;
+        case MD_RECORD_TEXT:
+            record->ptr = md_job_keep_string(job, (const CHAR*) ptr, size);
+            if(record->ptr == NULL)
+                goto no_memory;
             break;
 
-        case MD_LINE_BLANK:
-        case MD_LINE_SETEXTUNDERLINE:
-        case MD_LINE_TABLEUNDERLINE:
-        default:
-            MD_UNREACHABLE();
+        case MD_RECORD_LOG:
+            record->ptr = md_job_alloc(job, strlen((const char*) ptr) + 1);
+            if(record->ptr == NULL)
+                goto no_memory;
+            strcpy((char*) record->ptr, (const char*) ptr);
             break;
     }
 
-    block->flags = 0;
-    block->data = line->data;
-    block->n_lines = 0;
+    if(detail_size > 0) {
+        void* detail = md_job_alloc(job, detail_size);
 
-    ctx->current_block = block;
+        if(detail == NULL)
+            goto no_memory;
+        memcpy(detail, ptr, detail_size);
+        record->ptr = detail;
+
+        if(op == MD_RECORD_ENTER_BLOCK  ||  op == MD_RECORD_LEAVE_BLOCK) {
+            if(type == MD_BLOCK_CODE) {
+                attrs[n_attrs++] = &((MD_BLOCK_CODE_DETAIL*) detail)->info;
+                attrs[n_attrs++] = &((MD_BLOCK_CODE_DETAIL*) detail)->lang;
+            } else if(type == MD_BLOCK_ADMONITION) {
+                attrs[n_attrs++] = &((MD_BLOCK_ADMONITION_DETAIL*) detail)->type;
+            }
+        } else {
+            if(type == MD_SPAN_A) {
+                attrs[n_attrs++] = &((MD_SPAN_A_DETAIL*) detail)->href;
+                attrs[n_attrs++] = &((MD_SPAN_A_DETAIL*) detail)->title;
+            } else if(type == MD_SPAN_IMG) {
+                attrs[n_attrs++] = &((MD_SPAN_IMG_DETAIL*) detail)->src;
+                attrs[n_attrs++] = &((MD_SPAN_IMG_DETAIL*) detail)->title;
+            } else if(type == MD_SPAN_WIKILINK) {
+                attrs[n_attrs++] = &((MD_SPAN_WIKILINK_DETAIL*) detail)->target;
+            }
+        }
+
+        for(i = 0; i < n_attrs; i++) {
+            if(md_job_keep_attribute(job, attrs[i]) != 0)
+                goto no_memory;
+        }
+    }
+
+    job->n_records++;
     return 0;
-}
 
-/* Eat from start of current (textual) block any reference definitions and/or
- * footnote definitions, and remember them.
- *
- * (Such definitions can only be at start of it as they cannot break a
- * paragraph.)
- */
+no_memory:
+    if(op != MD_RECORD_LOG)
+        MD_LOG("malloc() failed.");
+    return -1;
+}
+
 static int
-md_consume_link_reference_definitions(MD_CTX* ctx)
+md_job_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
 {
-    MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
-    MD_SIZE n_lines = ctx->current_block->n_lines;
-    MD_SIZE n = 0;
+    return md_job_record((MD_JOB*) userdata, MD_RECORD_ENTER_BLOCK, type, detail, 0);
+}
 
-    while(n < n_lines) {
-        int n_consumed = 0;
+static int
+md_job_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    return md_job_record((MD_JOB*) userdata, MD_RECORD_LEAVE_BLOCK, type, detail, 0);
+}
 
-        /* When footnotes are enabled, try footnote definition first for lines
-         * starting with [^, so they are not accidentally consumed as link ref
-         * definitions (which would also match [^label]: url). */
-        if((ctx->parser.flags & MD_FLAG_FOOTNOTES)  &&
-           lines[n].beg + 1 < ctx->size  &&
-           CH(lines[n].beg) == _T('[')  &&  CH(lines[n].beg + 1) == _T('^'))
-        {
-            n_consumed = md_is_footnote_definition(ctx, lines + n, n_lines - n);
-            if(n_consumed < 0)
-                return -1;
-        }
+static int
+md_job_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    return md_job_record((MD_JOB*) userdata, MD_RECORD_ENTER_SPAN, type, detail, 0);
+}
 
-        if(n_consumed == 0) {
-            n_consumed = md_is_link_reference_definition(ctx, lines + n, n_lines - n);
-            if(n_consumed < 0)
-                return -1;
-        }
+static int
+md_job_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    return md_job_record((MD_JOB*) userdata, MD_RECORD_LEAVE_SPAN, type, detail, 0);
+}
 
-        if(n_consumed == 0)
-            break;
+static int
+md_job_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    return md_job_record((MD_JOB*) userdata, MD_RECORD_TEXT, type, text, size);
+}
 
-        n += n_consumed;
-    }
+static void
+md_job_debug_log(const char* msg, void* userdata)
+{
+    md_job_record((MD_JOB*) userdata, MD_RECORD_LOG, 0, msg, 0);
+}
 
-    /* If there was at least one definition, we need to remove its lines from
-     * the block, or perhaps even the whole block. */
-    if(n > 0) {
-        if(n == n_lines) {
-            /* Remove complete block. */
-            ctx->n_block_bytes -= n * sizeof(MD_LINE);
-            ctx->n_block_bytes -= sizeof(MD_BLOCK);
-            ctx->current_block = NULL;
+/* Process blocks in the range [beg, end) of ctx->block_bytes (or of the
+ * main context's block_bytes when called for a job). The range has to be
+ * prepared by md_prepare_block_run(). */
+static int
+md_process_block_run(MD_CTX* ctx, char* beg, char* end)
+{
+    int ret = 0;
+
+    while(beg < end) {
+        MD_BLOCK* block = (MD_BLOCK*) beg;
+
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            MD_CHECK(md_process_container_block(ctx, block));
+            beg += sizeof(MD_BLOCK);
         } else {
-            /* Remove just some initial lines from the block. */
-            memmove(lines, lines + n, (n_lines - n) * sizeof(MD_LINE));
-            ctx->current_block->n_lines -= n;
-            ctx->n_block_bytes -= n * sizeof(MD_LINE);
+            /* Note md_process_leaf_block() may change the block type but
+             * not in a way which would affect the block size. */
+            size_t n = md_leaf_block_bytes(block);
+            MD_CHECK(md_process_leaf_block(ctx, block, (block->flags & MD_BLOCK_IN_TIGHT_LIST)));
+            beg += n;
         }
     }
 
-    return 0;
+abort:
+    return ret;
 }
 
-static int
-md_end_current_block(MD_CTX* ctx)
+static void
+md_job_run(void* arg)
 {
-    int ret = 0;
+    MD_JOB* job = (MD_JOB*) arg;
 
-    if(ctx->current_block == NULL)
-        return ret;
+    job->ret = md_process_block_run(&job->ctx, job->beg, job->end);
 
-    /* Check whether there is a reference definition. (We do this here instead
-     * of in md_analyze_line() because reference definition can take multiple
-     * lines.) */
-    if(ctx->current_block->type == MD_BLOCK_P  ||
-       (ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)))
-    {
-        MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
-        if(lines[0].beg < ctx->size  &&  CH(lines[0].beg) == _T('[')) {
-            MD_CHECK(md_consume_link_reference_definitions(ctx));
-            if(ctx->current_block == NULL)
-                return ret;
-        }
-    }
+    /* The arena (if any) does not outlive the job: md_setup_doc() would
+     * forget it. */
+    if(md_uses_arena(&job->ctx))
+        md_free_ctx_buffers(&job->ctx);
+}
 
-    if(ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)) {
-        MD_SIZE n_lines = ctx->current_block->n_lines;
+/* Determine the next run of blocks, starting at the offset *p_off of
+ * ctx->block_bytes, with roughly MD_PARALLEL_JOB_SIZE of input text. Also
+ * set MD_BLOCK_IN_TIGHT_LIST for all leaf blocks in the run. */
+static void
+md_prepare_block_run(MD_CTX* ctx, int* p_off)
+{
+    int off = *p_off;
+    SZ run_size = 0;
 
-        if(n_lines > 1) {
-            /* Get rid of the underline. */
-            ctx->current_block->n_lines--;
-            ctx->n_block_bytes -= sizeof(MD_LINE);
+    while(off < ctx->n_block_bytes  &&  run_size < MD_PARALLEL_JOB_SIZE) {
+        MD_BLOCK* block = (MD_BLOCK*) ((char*) ctx->block_bytes + off);
+
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            md_track_loose_containers(ctx, block);
+            off += sizeof(MD_BLOCK);
         } else {
-            /* Only the underline has left after eating the ref. defs.
-             * Keep the line as beginning of a new ordinary paragraph. */
-            ctx->current_block->type = MD_BLOCK_P;
-            return 0;
+            if(md_is_in_tight_list(ctx))
+                block->flags |= MD_BLOCK_IN_TIGHT_LIST;
+            else
+                block->flags &= ~MD_BLOCK_IN_TIGHT_LIST;
+
+            /* MD_LINE and MD_VERBATIMLINE both start with the members beg
+             * and end. */
+            if(block->n_lines > 0) {
+                const MD_LINE* first_line = (const MD_LINE*) (block + 1);
+                const MD_LINE* last_line;
+
+                if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+                    last_line = (const MD_LINE*) ((const MD_VERBATIMLINE*) first_line + block->n_lines - 1);
+                else
+                    last_line = first_line + block->n_lines - 1;
+                run_size += last_line->end - first_line->beg + 1;
+            }
+
+            off += (int) md_leaf_block_bytes(block);
         }
     }
 
-    /* Mark we are not building any block anymore. */
-    ctx->current_block = NULL;
-
-abort:
-    return ret;
+    *p_off = off;
 }
 
-static int
-md_add_line_into_current_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* analysis)
+/* Wait until all pending jobs finish, without replaying them. */
+static void
+md_wait_for_jobs(MD_CTX* ctx)
 {
-    MD_ASSERT(ctx->current_block != NULL);
+    unsigned i;
 
-    if(ctx->current_block->type == MD_BLOCK_CODE || ctx->current_block->type == MD_BLOCK_HTML) {
-        MD_VERBATIMLINE* line;
+    for(i = 0; i < ctx->n_pending_jobs; i++) {
+        MD_JOB* job = &ctx->jobs[(ctx->job_head + i) % ctx->n_jobs];
 
-        line = (MD_VERBATIMLINE*) md_push_block_bytes(ctx, sizeof(MD_VERBATIMLINE));
-        if(line == NULL)
-            return -1;
+        if(job->handle != NULL) {
+            ctx->parser.executor->wait(job->handle, ctx->parser.executor->data);
+            job->handle = NULL;
+        }
+    }
+}
 
-        line->indent = analysis->indent;
-        line->beg = analysis->beg;
-        line->end = analysis->end;
-    } else {
-        MD_LINE* line;
+static void
+md_release_jobs(MD_CTX* ctx)
+{
+    unsigned i;
 
-        line = (MD_LINE*) md_push_block_bytes(ctx, sizeof(MD_LINE));
-        if(line == NULL)
-            return -1;
+    if(ctx->jobs == NULL)
+        return;
 
-        line->beg = analysis->beg;
-        line->end = analysis->end;
+    md_wait_for_jobs(ctx);
+
+    for(i = 0; i < ctx->n_jobs; i++) {
+        md_free_ctx_buffers(&ctx->jobs[i].ctx);
+        md_job_release_pool(&ctx->jobs[i]);
+        md_raw_free(&ctx->parser, ctx->jobs[i].records);
+        md_raw_free(&ctx->parser, ctx->jobs[i].block_copy);
     }
-    ctx->current_block->n_lines++;
+    md_raw_free(&ctx->parser, ctx->jobs);
 
-    return 0;
+    ctx->jobs = NULL;
+    ctx->n_jobs = 0;
+    ctx->job_head = 0;
+    ctx->n_pending_jobs = 0;
 }
 
 static int
-md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
-                        unsigned data, unsigned flags)
+md_replay_job(MD_CTX* ctx, MD_JOB* job)
 {
-    MD_BLOCK* block;
+    unsigned i;
     int ret = 0;
 
-    MD_CHECK(md_end_current_block(ctx));
+    for(i = 0; i < job->n_records; i++) {
+        const MD_RECORD* record = &job->records[i];
 
-    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
-    if(block == NULL)
-        return -1;
+        switch(record->op) {
+            case MD_RECORD_ENTER_BLOCK:
+                MD_ENTER_BLOCK((MD_BLOCKTYPE) record->type, (void*) record->ptr);
+                break;
+            case MD_RECORD_LEAVE_BLOCK:
+                MD_LEAVE_BLOCK((MD_BLOCKTYPE) record->type, (void*) record->ptr);
+                break;
+            case MD_RECORD_ENTER_SPAN:
+                MD_ENTER_SPAN((MD_SPANTYPE) record->type, (void*) record->ptr);
+                break;
+            case MD_RECORD_LEAVE_SPAN:
+                MD_LEAVE_SPAN((MD_SPANTYPE) record->type, (void*) record->ptr);
+                break;
+            case MD_RECORD_TEXT:
+                MD_TEXT((MD_TEXTTYPE) record->type, (const CHAR*) record->ptr, record->size);
+                break;
+            case MD_RECORD_LOG:
+                MD_LOG((const char*) record->ptr);
+                break;
+        }
+    }
 
-    block->type = type;
-    block->flags = flags;
-    block->data = data;
-    block->n_lines = start;
+    ret = job->ret;
 
 abort:
     return ret;
 }
 
+/* Prepare the job's context (and forget any results of its previous run). */
+static void
+md_setup_job(MD_CTX* ctx, MD_JOB* job)
+{
+    md_setup_doc(&job->ctx, ctx->text, ctx->size, job);
+    job->ctx.ref_def_hashtable = ctx->ref_def_hashtable;
+    job->ctx.footnote_hashtable = ctx->footnote_hashtable;
 
+    job->max_ref_def_output = ctx->max_ref_def_output;
+    job->ctx.max_ref_def_output = job->max_ref_def_output;
 
-/***********************
- ***  Line Analysis  ***
- ***********************/
+    job->ret = 0;
+    job->n_records = 0;
+    md_job_release_pool(job);
+}
 
 static int
-md_is_hr_line(MD_CTX* ctx, OFF beg, OFF* p_end, OFF* p_killer)
+md_replay_oldest_job(MD_CTX* ctx)
 {
-    OFF off = beg + 1;
-    int n = 1;
+    MD_JOB* job = &ctx->jobs[ctx->job_head];
+    SZ used_output;
 
-    while(off < ctx->size  &&  (CH(off) == CH(beg) || CH(off) == _T(' ') || CH(off) == _T('\t'))) {
-        if(CH(off) == CH(beg))
-            n++;
-        off++;
-    }
-
-    if(n < 3) {
-        *p_killer = off;
-        return FALSE;
+    if(job->handle != NULL) {
+        ctx->parser.executor->wait(job->handle, ctx->parser.executor->data);
+        job->handle = NULL;
     }
+    ctx->job_head = (ctx->job_head + 1) % ctx->n_jobs;
+    ctx->n_pending_jobs--;
 
-    /* Nothing else can be present on the line. */
-    if(off < ctx->size  &&  !ISNEWLINE(off)) {
-        *p_killer = off;
-        return FALSE;
+    /* If the job has used less than the budget really left for it, it has
+     * resolved the same links as the serial processing would. (It has not
+     * exhausted its own budget either as that would leave it with zero.)
+     * Otherwise run it again with the right budget. */
+    used_output = job->max_ref_def_output - job->ctx.max_ref_def_output;
+    if(used_output > 0  &&  used_output >= ctx->max_ref_def_output) {
+        md_setup_job(ctx, job);
+        md_job_run(job);
+        used_output = job->max_ref_def_output - job->ctx.max_ref_def_output;
     }
+    ctx->max_ref_def_output -= used_output;
 
-    *p_end = off;
-    return TRUE;
+    return md_replay_job(ctx, job);
 }
 
 static int
-md_is_atxheader_line(MD_CTX* ctx, OFF beg, OFF* p_beg, OFF* p_end, unsigned* p_level)
+md_replay_jobs(MD_CTX* ctx)
 {
-    int n;
-    OFF off = beg + 1;
-
-    while(off < ctx->size  &&  CH(off) == _T('#')  &&  off - beg < 7)
-        off++;
-    n = off - beg;
-
-    if(n > 6)
-        return FALSE;
-    *p_level = n;
+    int ret = 0;
 
-    if(!(ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS)  &&  off < ctx->size  &&
-       !ISBLANK(off)  &&  !ISNEWLINE(off))
-        return FALSE;
+    while(ctx->n_pending_jobs > 0)
+        MD_CHECK(md_replay_oldest_job(ctx));
 
-    while(off < ctx->size  &&  ISBLANK(off))
-        off++;
-    *p_beg = off;
-    *p_end = off;
-    return TRUE;
+abort:
+    return ret;
 }
 
+/* Start a job for the blocks in the range [beg, end) of ctx->block_bytes,
+ * as prepared by md_prepare_block_run(). */
 static int
-md_is_setext_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_level)
+md_start_job(MD_CTX* ctx, int beg, int end)
 {
-    OFF off = beg + 1;
+    const MD_EXECUTOR* executor = ctx->parser.executor;
+    MD_JOB* job;
+    unsigned i;
+    int ret = 0;
 
-    while(off < ctx->size  &&  CH(off) == CH(beg))
-        off++;
+    if(ctx->jobs == NULL) {
+        ctx->n_jobs = md_executor_max_jobs(executor);
+        ctx->jobs = (MD_JOB*) md_raw_malloc(&ctx->parser, ctx->n_jobs * sizeof(MD_JOB));
+        if(ctx->jobs == NULL) {
+            MD_LOG("malloc() failed.");
+            ctx->n_jobs = 0;
+            ret = -1;
+            goto abort;
+        }
+        memset(ctx->jobs, 0, ctx->n_jobs * sizeof(MD_JOB));
+
+        for(i = 0; i < ctx->n_jobs; i++) {
+            MD_CTX* job_ctx = &ctx->jobs[i].ctx;
+
+            md_init_ctx(job_ctx, &ctx->parser);
+            job_ctx->parser.enter_block = md_job_enter_block;
+            job_ctx->parser.leave_block = md_job_leave_block;
+            job_ctx->parser.enter_span = md_job_enter_span;
+            job_ctx->parser.leave_span = md_job_leave_span;
+            job_ctx->parser.text = md_job_text;
+            if(ctx->parser.debug_log != NULL)
+                job_ctx->parser.debug_log = md_job_debug_log;
+            job_ctx->parser.executor = NULL;
+            job_ctx->parser.stats = NULL;
+            job_ctx->parser.block_profiler = NULL;
+        }
+    }
 
-    /* Optionally, space(s) or tabs can follow. */
-    while(off < ctx->size  &&  ISBLANK(off))
-        off++;
+    /* If all the slots are busy, make one free. */
+    if(ctx->n_pending_jobs >= ctx->n_jobs)
+        MD_CHECK(md_replay_oldest_job(ctx));
 
-    /* But nothing more is allowed on the line. */
-    if(off < ctx->size  &&  !ISNEWLINE(off))
-        return FALSE;
+    job = &ctx->jobs[(ctx->job_head + ctx->n_pending_jobs) % ctx->n_jobs];
+    md_setup_job(ctx, job);
 
-    *p_level = (CH(beg) == _T('=') ? 1 : 2);
-    *p_end = off;
-    return TRUE;
-}
+    if(ctx->keep_jobs_pending) {
+        if(end - beg > job->alloc_block_copy) {
+            char* new_block_copy;
 
-static int
-md_is_table_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_col_count)
-{
-    OFF off = beg;
-    int found_pipe = FALSE;
-    unsigned col_count = 0;
+            new_block_copy = (char*) md_raw_realloc(&ctx->parser, job->block_copy, end - beg);
+            if(new_block_copy == NULL) {
+                MD_LOG("realloc() failed.");
+                ret = -1;
+                goto abort;
+            }
+            job->block_copy = new_block_copy;
+            job->alloc_block_copy = end - beg;
+        }
 
-    if(off < ctx->size  &&  CH(off) == _T('|')) {
-        found_pipe = TRUE;
-        off++;
-        while(off < ctx->size  &&  ISWHITESPACE(off))
-            off++;
+        memcpy(job->block_copy, (char*) ctx->block_bytes + beg, end - beg);
+        job->beg = job->block_copy;
+        job->end = job->block_copy + (end - beg);
+    } else {
+        job->beg = (char*) ctx->block_bytes + beg;
+        job->end = (char*) ctx->block_bytes + end;
     }
 
-    while(1) {
-        int delimited = FALSE;
+    job->handle = executor->submit(md_job_run, job, executor->data);
+    if(job->handle == NULL)
+        md_job_run(job);
+    ctx->n_pending_jobs++;
 
-        /* Cell underline ("-----", ":----", "----:" or ":----:") */
-        if(off < ctx->size  &&  CH(off) == _T(':'))
-            off++;
-        if(off >= ctx->size  ||  CH(off) != _T('-'))
-            return FALSE;
-        while(off < ctx->size  &&  CH(off) == _T('-'))
-            off++;
-        if(off < ctx->size  &&  CH(off) == _T(':'))
-            off++;
+abort:
+    return ret;
+}
 
-        col_count++;
+static int
+md_process_blocks_in_parallel(MD_CTX* ctx)
+{
+    int off = 0;
+    int ret = 0;
 
-        /* Pipe delimiter (optional at the end of line). */
-        while(off < ctx->size  &&  ISWHITESPACE(off))
-            off++;
-        if(off < ctx->size  &&  CH(off) == _T('|')) {
-            delimited = TRUE;
-            found_pipe =  TRUE;
-            off++;
-            while(off < ctx->size  &&  ISWHITESPACE(off))
-                off++;
-        }
+    ctx->n_containers = 0;
 
-        /* Success, if we reach end of line. */
-        if(off >= ctx->size  ||  ISNEWLINE(off))
+    while(off < ctx->n_block_bytes) {
+        int beg = off;
+
+        md_prepare_block_run(ctx, &off);
+
+        /* If everything fits into a single job, do not bother. (Unless we
+         * continue with the analysis of the document meanwhile.) */
+        if(beg == 0  &&  off >= ctx->n_block_bytes  &&  ctx->n_pending_jobs == 0  &&
+           !ctx->keep_jobs_pending)
+        {
+            MD_CHECK(md_process_block_run(ctx, (char*) ctx->block_bytes,
+                                          (char*) ctx->block_bytes + off));
             break;
+        }
 
-        if(!delimited)
-            return FALSE;
+        MD_CHECK(md_start_job(ctx, beg, off));
     }
 
-    if(!found_pipe)
-        return FALSE;
+    if(!ctx->keep_jobs_pending)
+        MD_CHECK(md_replay_jobs(ctx));
 
-    *p_end = off;
-    *p_col_count = col_count;
-    return TRUE;
+abort:
+    return ret;
 }
 
 static int
-md_is_opening_code_fence(MD_CTX* ctx, OFF beg, OFF* p_end)
+md_process_all_blocks(MD_CTX* ctx)
 {
-    OFF off = beg;
-
-    while(off < ctx->size && CH(off) == CH(beg))
-        off++;
-
-    /* Fence must have at least three characters. */
-    if(off - beg < 3)
-        return FALSE;
-
-    ctx->code_fence_length = off - beg;
-
-    /* Optionally, space(s) can follow. */
-    while(off < ctx->size  &&  CH(off) == _T(' '))
-        off++;
+    int byte_off = 0;
+    int ret = 0;
 
-    /* Optionally, an info string can follow. */
-    while(off < ctx->size  &&  !ISNEWLINE(off)) {
-        /* Backtick-based fence must not contain '`' in the info string. */
-        if(CH(beg) == _T('`')  &&  CH(off) == _T('`'))
-            return FALSE;
-        off++;
+    if(ctx->parser.executor != NULL  &&  ctx->footnote_hashtable.n_defs == 0) {
+        MD_CHECK(md_process_blocks_in_parallel(ctx));
+        ctx->n_block_bytes = 0;
+        goto abort;
     }
 
-    *p_end = off;
-    return TRUE;
-}
+    /* Blocks sent to the jobs earlier have to be emitted first. */
+    MD_CHECK(md_replay_jobs(ctx));
 
-static int
-md_is_closing_code_fence(MD_CTX* ctx, CHAR ch, OFF beg, OFF* p_end)
-{
-    OFF off = beg;
-    int ret = FALSE;
+    ctx->n_containers = 0;
 
-    /* Closing fence must have at least the same length and use same char as
-     * opening one. */
-    while(off < ctx->size  &&  CH(off) == ch)
-        off++;
-    if(off - beg < ctx->code_fence_length)
-        goto out;
+    while(byte_off < ctx->n_block_bytes) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
 
-    /* Optionally, space(s) can follow */
-    while(off < ctx->size  &&  ISANYOF2(off, _T(' '), _T('\t')))
-        off++;
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            MD_CHECK(md_process_container_block(ctx, block));
+            md_track_loose_containers(ctx, block);
+            byte_off += sizeof(MD_BLOCK);
+        } else {
+            int is_in_tight_list = md_is_in_tight_list(ctx);
+            size_t n = md_leaf_block_bytes(block);
 
-    /* But nothing more is allowed on the line. */
-    if(off < ctx->size  &&  !ISNEWLINE(off))
-        goto out;
+            MD_CHECK(md_process_leaf_block(ctx, block, is_in_tight_list));
+            byte_off += (int) n;
+        }
+    }
 
-    ret = TRUE;
+    ctx->n_block_bytes = 0;
 
-out:
-    /* Note we set *p_end even on failure: If we are not closing fence, caller
-     * would eat the line anyway without any parsing. */
-    *p_end = off;
+abort:
     return ret;
 }
 
 
-/* Helper data for md_is_html_block_start_condition() and
- * md_is_html_block_end_condition() */
-typedef struct TAG_tag TAG;
-struct TAG_tag {
-    const CHAR* name;
-    unsigned len    : 8;
-};
+/************************************
+ ***  Grouping Lines into Blocks  ***
+ ************************************/
 
-#ifdef X
-    #undef X
-#endif
-#define X(name)     { _T(name), (sizeof(_T(name))-1) / sizeof(CHAR) }
-#define Xend        { NULL, 0 }
+static void*
+md_push_block_bytes(MD_CTX* ctx, int n_bytes)
+{
+    void* ptr;
 
-static const TAG t1[] = { X("pre"), X("script"), X("style"), X("textarea"), Xend };
+    if(ctx->n_block_bytes + n_bytes > ctx->alloc_block_bytes) {
+        void* new_block_bytes;
 
-static const TAG a6[] = { X("address"), X("article"), X("aside"), Xend };
-static const TAG b6[] = { X("base"), X("basefont"), X("blockquote"), X("body"), Xend };
-static const TAG c6[] = { X("caption"), X("center"), X("col"), X("colgroup"), Xend };
-static const TAG d6[] = { X("dd"), X("details"), X("dialog"), X("dir"),
-                          X("div"), X("dl"), X("dt"), Xend };
-static const TAG f6[] = { X("fieldset"), X("figcaption"), X("figure"), X("footer"),
-                          X("form"), X("frame"), X("frameset"), Xend };
-static const TAG h6[] = { X("h1"), X("h2"), X("h3"), X("h4"), X("h5"), X("h6"),
-                          X("head"), X("header"), X("hr"), X("html"), Xend };
-static const TAG i6[] = { X("iframe"), Xend };
-static const TAG l6[] = { X("legend"), X("li"), X("link"), Xend };
-static const TAG m6[] = { X("main"), X("menu"), X("menuitem"), Xend };
-static const TAG n6[] = { X("nav"), X("noframes"), Xend };
-static const TAG o6[] = { X("ol"), X("optgroup"), X("option"), Xend };
-static const TAG p6[] = { X("p"), X("param"), Xend };
-static const TAG s6[] = { X("search"), X("section"), X("summary"), Xend };
-static const TAG t6[] = { X("table"), X("tbody"), X("td"), X("tfoot"), X("th"),
-                          X("thead"), X("title"), X("tr"), X("track"), Xend };
-static const TAG u6[] = { X("ul"), Xend };
-static const TAG xx[] = { Xend };
+        ctx->alloc_block_bytes = (ctx->alloc_block_bytes > 0
+                ? ctx->alloc_block_bytes + ctx->alloc_block_bytes / 2
+                : 512);
+        new_block_bytes = md_realloc(ctx, ctx->block_bytes, ctx->alloc_block_bytes);
+        if(new_block_bytes == NULL) {
+            MD_LOG("realloc() failed.");
+            return NULL;
+        }
 
-#undef X
-#undef Xend
+        /* Fix the ->current_block after the reallocation. */
+        if(ctx->current_block != NULL) {
+            OFF off_current_block = (OFF) ((char*) ctx->current_block - (char*) ctx->block_bytes);
+            ctx->current_block = (MD_BLOCK*) ((char*) new_block_bytes + off_current_block);
+        }
+
+        ctx->block_bytes = new_block_bytes;
+        MD_STATS_INC(block_bytes_reallocs);
+    }
+
+    ptr = (char*)ctx->block_bytes + ctx->n_block_bytes;
+    ctx->n_block_bytes += n_bytes;
+    return ptr;
+}
 
-/* Returns type of the raw HTML block, or FALSE if it is not HTML block.
- * (Refer to CommonMark specification for details about the types.)
- */
 static int
-md_is_html_block_start_condition(MD_CTX* ctx, OFF beg)
+md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
 {
-    /* Type 6 is started by a long list of allowed tags. We use two-level
-     * tree to speed-up the search. */
-    static const TAG* map6[26] = {
-        a6, b6, c6, d6, xx, f6, xx, h6, i6, xx, xx, l6, m6,
-        n6, o6, p6, xx, xx, s6, t6, u6, xx, xx, xx, xx, xx
-    };
-    OFF off = beg + 1;
-    int i;
-
-    /* Check for type 1: <script, <pre, or <style */
-    for(i = 0; t1[i].name != NULL; i++) {
-        if(off + t1[i].len <= ctx->size) {
-            if(md_ascii_case_eq(STR(off), t1[i].name, t1[i].len))
-                return 1;
-        }
-    }
+    MD_BLOCK* block;
 
-    /* Check for type 2: <!-- */
-    if(off + 3 < ctx->size  &&  CH(off) == _T('!')  &&  CH(off+1) == _T('-')  &&  CH(off+2) == _T('-'))
-        return 2;
+    MD_ASSERT(ctx->current_block == NULL);
 
-    /* Check for type 3: <? */
-    if(off < ctx->size  &&  CH(off) == _T('?'))
-        return 3;
+    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
+    if(block == NULL)
+        return -1;
 
-    /* Check for type 4 or 5: <! */
-    if(off < ctx->size  &&  CH(off) == _T('!')) {
-        /* Check for type 4: <! followed by uppercase letter. */
-        if(off + 1 < ctx->size  &&  ISASCII(off+1))
-            return 4;
+    switch(line->type) {
+        case MD_LINE_HR:
+            block->type = MD_BLOCK_HR;
+            break;
 
-        /* Check for type 5: <![CDATA[ */
-        if(off + 8 < ctx->size) {
-            if(md_ascii_eq(STR(off), _T("![CDATA["), 8))
-                return 5;
-        }
-    }
+        case MD_LINE_ATXHEADER:
+        case MD_LINE_SETEXTHEADER:
+            block->type = MD_BLOCK_H;
+            break;
 
-    /* Check for type 6: Many possible starting tags listed above. */
-    if(off + 1 < ctx->size  &&  (ISALPHA(off) || (CH(off) == _T('/') && ISALPHA(off+1)))) {
-        int slot;
-        const TAG* tags;
+        case MD_LINE_FENCEDCODE:
+        case MD_LINE_INDENTEDCODE:
+            block->type = MD_BLOCK_CODE;
+            break;
 
-        if(CH(off) == _T('/'))
-            off++;
+        case MD_LINE_TEXT:
+            block->type = MD_BLOCK_P;
+            break;
 
-        slot = (ISUPPER(off) ? CH(off) - 'A' : CH(off) - 'a');
-        tags = map6[slot];
+        case MD_LINE_HTML:
+            block->type = MD_BLOCK_HTML;
+            break;
 
-        for(i = 0; tags[i].name != NULL; i++) {
-            if(off + tags[i].len <= ctx->size) {
-                if(md_ascii_case_eq(STR(off), tags[i].name, tags[i].len)) {
-                    OFF tmp = off + tags[i].len;
-                    if(tmp >= ctx->size)
-                        return 6;
-                    if(ISBLANK(tmp) || ISNEWLINE(tmp) || CH(tmp) == _T('>'))
-                        return 6;
-                    if(tmp+1 < ctx->size && CH(tmp) == _T('/') && CH(tmp+1) == _T('>'))
-                        return 6;
-                    break;
-                }
-            }
-        }
+        case MD_LINE_BLANK:
+        case MD_LINE_SETEXTUNDERLINE:
+        case MD_LINE_TABLEUNDERLINE:
+        default:
+            MD_UNREACHABLE();
+            break;
     }
 
-    /* Check for type 7: any COMPLETE other opening or closing tag. */
-    if(off + 1 < ctx->size) {
-        OFF end;
+    block->flags = 0;
+    block->data = line->data;
+    block->n_lines = 0;
 
-        if(md_is_html_tag(ctx, NULL, 0, beg, ctx->size, &end)) {
-            /* Only optional whitespace and new line may follow. */
-            while(end < ctx->size  &&  ISWHITESPACE(end))
-                end++;
-            if(end >= ctx->size  ||  ISNEWLINE(end))
-                return 7;
-        }
-    }
-
-    return FALSE;
+    ctx->current_block = block;
+    return 0;
 }
 
-/* Case sensitive check whether there is a substring 'what' between 'beg'
- * and end of line. */
+/* Eat from start of current (textual) block any reference definitions and/or
+ * footnote definitions, and remember them.
+ *
+ * (Such definitions can only be at start of it as they cannot break a
+ * paragraph.)
+ */
 static int
-md_line_contains(MD_CTX* ctx, OFF beg, const CHAR* what, SZ what_len, OFF* p_end)
+md_consume_link_reference_definitions(MD_CTX* ctx)
 {
-    OFF i;
-    for(i = beg; i + what_len < ctx->size; i++) {
-        if(ISNEWLINE(i))
+    MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
+    MD_SIZE n_lines = ctx->current_block->n_lines;
+    MD_SIZE n = 0;
+
+    while(n < n_lines) {
+        int n_consumed = 0;
+
+        /* When footnotes are enabled, try footnote definition first for lines
+         * starting with [^, so they are not accidentally consumed as link ref
+         * definitions (which would also match [^label]: url). */
+        if((ctx->parser.flags & MD_FLAG_FOOTNOTES)  &&
+           lines[n].beg + 1 < ctx->size  &&
+           CH(lines[n].beg) == _T('[')  &&  CH(lines[n].beg + 1) == _T('^'))
+        {
+            n_consumed = md_is_footnote_definition(ctx, lines + n, n_lines - n);
+            if(n_consumed < 0)
+                return -1;
+        }
+
+        if(n_consumed == 0) {
+            n_consumed = md_is_link_reference_definition(ctx, lines + n, n_lines - n);
+            if(n_consumed < 0)
+                return -1;
+        }
+
+        if(n_consumed == 0)
             break;
-        if(memcmp(STR(i), what, what_len * sizeof(CHAR)) == 0) {
-            *p_end = i + what_len;
-            return TRUE;
+
+        n += n_consumed;
+    }
+
+    /* If there was at least one definition, we need to remove its lines from
+     * the block, or perhaps even the whole block. */
+    if(n > 0) {
+        if(n == n_lines) {
+            /* Remove complete block. */
+            ctx->n_block_bytes -= n * sizeof(MD_LINE);
+            ctx->n_block_bytes -= sizeof(MD_BLOCK);
+            ctx->current_block = NULL;
+        } else {
+            /* Remove just some initial lines from the block. */
+            memmove(lines, lines + n, (n_lines - n) * sizeof(MD_LINE));
+            ctx->current_block->n_lines -= n;
+            ctx->n_block_bytes -= n * sizeof(MD_LINE);
         }
     }
 
-    *p_end = i;
-    return FALSE;
+    return 0;
 }
 
-/* Returns type of HTML block end condition or FALSE if not an end condition.
- *
- * Note it fills p_end even when it is not end condition as the caller
- * does not need to analyze contents of a raw HTML block.
- */
 static int
-md_is_html_block_end_condition(MD_CTX* ctx, OFF beg, OFF* p_end)
+md_end_current_block(MD_CTX* ctx)
 {
-    switch(ctx->html_block_type) {
-        case 1:
-        {
-            OFF off = beg;
-            int i;
-
-            while(off+1 < ctx->size  &&  !ISNEWLINE(off)) {
-                if(CH(off) == _T('<')  &&  CH(off+1) == _T('/')) {
-                    for(i = 0; t1[i].name != NULL; i++) {
-                        if(off + 2 + t1[i].len < ctx->size) {
-                            if(md_ascii_case_eq(STR(off+2), t1[i].name, t1[i].len)  &&
-                               CH(off+2+t1[i].len) == _T('>'))
-                            {
-                                *p_end = off+2+t1[i].len+1;
-                                return TRUE;
-                            }
-                        }
-                    }
-                }
-                off++;
-            }
-            *p_end = off;
-            return FALSE;
-        }
+    int ret = 0;
 
-        case 2:
-            return (md_line_contains(ctx, beg, _T("-->"), 3, p_end) ? 2 : FALSE);
+    if(ctx->current_block == NULL)
+        return ret;
 
-        case 3:
-            return (md_line_contains(ctx, beg, _T("?>"), 2, p_end) ? 3 : FALSE);
+    /* Check whether there is a reference definition. (We do this here instead
+     * of in md_analyze_line() because reference definition can take multiple
+     * lines.) */
+    if(ctx->current_block->type == MD_BLOCK_P  ||
+       (ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)))
+    {
+        MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
+        if(lines[0].beg < ctx->size  &&  CH(lines[0].beg) == _T('[')) {
+            MD_CHECK(md_consume_link_reference_definitions(ctx));
+            if(ctx->current_block == NULL)
+                return ret;
+        }
+    }
 
-        case 4:
-            return (md_line_contains(ctx, beg, _T(">"), 1, p_end) ? 4 : FALSE);
+    if(ctx->current_block->type == MD_BLOCK_H  &&  (ctx->current_block->flags & MD_BLOCK_SETEXT_HEADER)) {
+        MD_SIZE n_lines = ctx->current_block->n_lines;
 
-        case 5:
-            return (md_line_contains(ctx, beg, _T("]]>"), 3, p_end) ? 5 : FALSE);
+        if(n_lines > 1) {
+            /* Get rid of the underline. */
+            ctx->current_block->n_lines--;
+            ctx->n_block_bytes -= sizeof(MD_LINE);
+        } else {
+            /* Only the underline has left after eating the ref. defs.
+             * Keep the line as beginning of a new ordinary paragraph. */
+            ctx->current_block->type = MD_BLOCK_P;
+            return 0;
+        }
+    }
 
-        case 6:     /* Pass through */
-        case 7:
-            if(beg >= ctx->size  ||  ISNEWLINE(beg)) {
-                /* Blank line ends types 6 and 7. */
-                *p_end = beg;
-                return ctx->html_block_type;
-            }
-            return FALSE;
+    /* Mark we are not building any block anymore. */
+    ctx->current_block = NULL;
 
-        default:
-            MD_UNREACHABLE();
-    }
-    return FALSE;
+abort:
+    return ret;
 }
 
-
 static int
-md_is_container_compatible(const MD_CONTAINER* pivot, const MD_CONTAINER* container)
+md_add_line_into_current_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* analysis)
 {
-    /* Block quote has no "items" like lists. */
-    if(container->ch == _T('>'))
-        return FALSE;
+    MD_ASSERT(ctx->current_block != NULL);
 
-    if(container->ch != pivot->ch)
-        return FALSE;
-    if(container->mark_indent > pivot->contents_indent)
-        return FALSE;
+    if(ctx->current_block->type == MD_BLOCK_CODE || ctx->current_block->type == MD_BLOCK_HTML) {
+        MD_VERBATIMLINE* line;
 
-    return TRUE;
-}
+        line = (MD_VERBATIMLINE*) md_push_block_bytes(ctx, sizeof(MD_VERBATIMLINE));
+        if(line == NULL)
+            return -1;
 
-static int
-md_push_container(MD_CTX* ctx, const MD_CONTAINER* container)
-{
-    if(ctx->n_containers >= ctx->alloc_containers) {
-        MD_CONTAINER* new_containers;
+        line->indent = analysis->indent;
+        line->beg = analysis->beg;
+        line->end = analysis->end;
+    } else {
+        MD_LINE* line;
 
-        ctx->alloc_containers = (ctx->alloc_containers > 0
-                ? ctx->alloc_containers + ctx->alloc_containers / 2
-                : 16);
-        new_containers = realloc(ctx->containers, ctx->alloc_containers * sizeof(MD_CONTAINER));
-        if(new_containers == NULL) {
-            MD_LOG("realloc() failed.");
+        line = (MD_LINE*) md_push_block_bytes(ctx, sizeof(MD_LINE));
+        if(line == NULL)
             return -1;
-        }
 
-        ctx->containers = new_containers;
+        line->beg = analysis->beg;
+        line->end = analysis->end;
     }
+    ctx->current_block->n_lines++;
 
-    memcpy(&ctx->containers[ctx->n_containers++], container, sizeof(MD_CONTAINER));
     return 0;
 }
 
 static int
-md_enter_child_containers(MD_CTX* ctx, int n_children)
+md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
+                        unsigned data, unsigned flags)
 {
-    int i;
+    MD_BLOCK* block;
     int ret = 0;
 
-    for(i = ctx->n_containers - n_children; i < ctx->n_containers; i++) {
-        MD_CONTAINER* c = &ctx->containers[i];
-        int is_ordered_list = FALSE;
-
-        switch(c->ch) {
-            case _T(')'):
-            case _T('.'):
-                is_ordered_list = TRUE;
-                MD_FALLTHROUGH();
-
-            case _T('-'):
-            case _T('+'):
-            case _T('*'):
-                /* Remember offset in ctx->block_bytes so we can revisit the
-                 * block if we detect it is a loose list. */
-                md_end_current_block(ctx);
-                c->block_byte_off = ctx->n_block_bytes;
-
-                MD_CHECK(md_push_container_bytes(ctx,
-                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL),
-                                c->start, c->ch, MD_BLOCK_CONTAINER_OPENER));
-                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                                c->task_mark_off,
-                                (c->is_task ? CH(c->task_mark_off) : 0),
-                                MD_BLOCK_CONTAINER_OPENER));
-                break;
+    MD_CHECK(md_end_current_block(ctx));
 
-            case _T('>'):
-                MD_CHECK(md_push_container_bytes(ctx,
-                                (c->is_admonition ? MD_BLOCK_ADMONITION : MD_BLOCK_QUOTE),
-                                0, c->admonition_type, MD_BLOCK_CONTAINER_OPENER));
-                break;
+    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
+    if(block == NULL)
+        return -1;
 
-            default:
-                MD_UNREACHABLE();
-                break;
-        }
-    }
+    block->type = type;
+    block->flags = flags;
+    block->data = data;
+    block->n_lines = start;
+    ctx->container_block_bytes_end = ctx->n_block_bytes;
 
 abort:
     return ret;
 }
 
-static int
-md_leave_child_containers(MD_CTX* ctx, int n_keep)
-{
-    int ret = 0;
 
-    while(ctx->n_containers > n_keep) {
-        MD_CONTAINER* c = &ctx->containers[ctx->n_containers-1];
-        int is_ordered_list = FALSE;
 
-        switch(c->ch) {
-            case _T(')'):
-            case _T('.'):
-                is_ordered_list = TRUE;
-                MD_FALLTHROUGH();
+/***********************
+ ***  Line Analysis  ***
+ ***********************/
 
-            case _T('-'):
-            case _T('+'):
-            case _T('*'):
-                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                                c->task_mark_off, (c->is_task ? CH(c->task_mark_off) : 0),
-                                MD_BLOCK_CONTAINER_CLOSER));
-                MD_CHECK(md_push_container_bytes(ctx,
-                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL), 0,
-                                c->ch, MD_BLOCK_CONTAINER_CLOSER));
-                break;
+static int
+md_is_hr_line(MD_CTX* ctx, OFF beg, OFF* p_end, OFF* p_killer)
+{
+    OFF off = beg + 1;
+    int n = 1;
 
-            case _T('>'):
-                MD_CHECK(md_push_container_bytes(ctx,
-                                (c->is_admonition ? MD_BLOCK_ADMONITION : MD_BLOCK_QUOTE),
-                                0, c->admonition_type, MD_BLOCK_CONTAINER_CLOSER));
-                break;
+    while(off < ctx->size  &&  (CH(off) == CH(beg) || CH(off) == _T(' ') || CH(off) == _T('\t'))) {
+        if(CH(off) == CH(beg))
+            n++;
+        off++;
+    }
 
-            default:
-                MD_UNREACHABLE();
-                break;
-        }
+    if(n < 3) {
+        *p_killer = off;
+        return FALSE;
+    }
 
-        ctx->n_containers--;
+    /* Nothing else can be present on the line. */
+    if(off < ctx->size  &&  !ISNEWLINE(off)) {
+        *p_killer = off;
+        return FALSE;
     }
 
-abort:
-    return ret;
+    *p_end = off;
+    return TRUE;
 }
 
 static int
-md_is_container_mark(MD_CTX* ctx, unsigned indent, OFF beg, OFF* p_end, MD_CONTAINER* p_container)
+md_is_atxheader_line(MD_CTX* ctx, OFF beg, OFF* p_beg, OFF* p_end, unsigned* p_level)
 {
-    OFF off = beg;
-    OFF max_end;
-
-    if(off >= ctx->size  ||  indent >= ctx->code_indent_offset)
-        return FALSE;
+    int n;
+    OFF off = beg + 1;
 
-    /* Check for block quote mark. */
-    if(CH(off) == _T('>')) {
+    while(off < ctx->size  &&  CH(off) == _T('#')  &&  off - beg < 7)
         off++;
-        p_container->ch = _T('>');
-        p_container->is_loose = FALSE;
-        p_container->is_task = FALSE;
-        p_container->mark_indent = indent;
-        p_container->contents_indent = indent + 1;
-        *p_end = off;
-        return TRUE;
-    }
+    n = off - beg;
 
-    /* Check for list item bullet mark. */
-    if(ISANYOF(off, _T("-+*"))  &&  (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1))) {
-        p_container->ch = CH(off);
-        p_container->is_loose = FALSE;
-        p_container->is_task = FALSE;
-        p_container->mark_indent = indent;
-        p_container->contents_indent = indent + 1;
-        *p_end = off+1;
-        return TRUE;
-    }
+    if(n > 6)
+        return FALSE;
+    *p_level = n;
 
-    /* Check for ordered list item marks. */
-    max_end = off + 9;
-    if(max_end > ctx->size)
-        max_end = ctx->size;
-    p_container->start = 0;
-    while(off < max_end  &&  ISDIGIT(off)) {
-        p_container->start = p_container->start * 10 + CH(off) - _T('0');
-        off++;
-    }
-    if(off > beg  &&
-       off < ctx->size  &&
-       (CH(off) == _T('.') || CH(off) == _T(')'))  &&
-       (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1)))
-    {
-        p_container->ch = CH(off);
-        p_container->is_loose = FALSE;
-        p_container->is_task = FALSE;
-        p_container->mark_indent = indent;
-        p_container->contents_indent = indent + off - beg + 1;
-        *p_end = off+1;
-        return TRUE;
-    }
+    if(!(ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS)  &&  off < ctx->size  &&
+       !ISBLANK(off)  &&  !ISNEWLINE(off))
+        return FALSE;
 
-    return FALSE;
+    while(off < ctx->size  &&  ISBLANK(off))
+        off++;
+    *p_beg = off;
+    *p_end = off;
+    return TRUE;
 }
 
-static unsigned
-md_line_indentation(MD_CTX* ctx, unsigned total_indent, OFF beg, OFF* p_end)
+static int
+md_is_setext_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_level)
 {
-    OFF off = beg;
-    unsigned indent = total_indent;
+    OFF off = beg + 1;
 
-    while(off < ctx->size  &&  ISBLANK(off)) {
-        if(CH(off) == _T('\t'))
-            indent = (indent + 4) & ~3;
-        else
-            indent++;
+    while(off < ctx->size  &&  CH(off) == CH(beg))
         off++;
-    }
 
+    /* Optionally, space(s) or tabs can follow. */
+    while(off < ctx->size  &&  ISBLANK(off))
+        off++;
+
+    /* But nothing more is allowed on the line. */
+    if(off < ctx->size  &&  !ISNEWLINE(off))
+        return FALSE;
+
+    *p_level = (CH(beg) == _T('=') ? 1 : 2);
     *p_end = off;
-    return indent - total_indent;
+    return TRUE;
 }
 
-static const MD_LINE_ANALYSIS md_dummy_blank_line = { MD_LINE_BLANK, 0, 0, 0, 0, 0 };
-
-/* Analyze type of the line and find some its properties. This serves as a
- * main input for determining type and boundaries of a block. */
 static int
-md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
-                const MD_LINE_ANALYSIS* pivot_line, MD_LINE_ANALYSIS* line)
+md_is_table_underline(MD_CTX* ctx, OFF beg, OFF* p_end, unsigned* p_col_count)
 {
-    unsigned total_indent = 0;
-    int n_parents = 0;
-    int n_brothers = 0;
-    int n_children = 0;
-    MD_CONTAINER container = { 0 };
-    int prev_line_has_list_loosening_effect = ctx->last_line_has_list_loosening_effect;
     OFF off = beg;
-    OFF hr_killer = 0;
-    int ret = 0;
+    int found_pipe = FALSE;
+    unsigned col_count = 0;
 
-    line->indent = md_line_indentation(ctx, total_indent, off, &off);
-    total_indent += line->indent;
-    line->beg = off;
-    line->enforce_new_block = FALSE;
+    if(off < ctx->size  &&  CH(off) == _T('|')) {
+        found_pipe = TRUE;
+        off++;
+        while(off < ctx->size  &&  ISWHITESPACE(off))
+            off++;
+    }
 
-    /* Given the indentation and block quote marks '>', determine how many of
-     * the current containers are our parents. */
-    while(n_parents < ctx->n_containers) {
-        MD_CONTAINER* c = &ctx->containers[n_parents];
+    while(1) {
+        int delimited = FALSE;
 
-        if(c->ch == _T('>')  &&  line->indent < ctx->code_indent_offset  &&
-            off < ctx->size  &&  CH(off) == _T('>'))
-        {
-            /* Block quote mark. */
+        /* Cell underline ("-----", ":----", "----:" or ":----:") */
+        if(off < ctx->size  &&  CH(off) == _T(':'))
+            off++;
+        if(off >= ctx->size  ||  CH(off) != _T('-'))
+            return FALSE;
+        while(off < ctx->size  &&  CH(off) == _T('-'))
+            off++;
+        if(off < ctx->size  &&  CH(off) == _T(':'))
             off++;
-            total_indent++;
-            line->indent = md_line_indentation(ctx, total_indent, off, &off);
-            total_indent += line->indent;
-
-            /* The optional 1st space after '>' is part of the block quote mark. */
-            if(line->indent > 0)
-                line->indent--;
 
-            line->beg = off;
+        col_count++;
 
-        } else if(c->ch != _T('>')  &&  line->indent >= c->contents_indent) {
-            /* List. */
-            line->indent -= c->contents_indent;
-        } else {
-            break;
+        /* Pipe delimiter (optional at the end of line). */
+        while(off < ctx->size  &&  ISWHITESPACE(off))
+            off++;
+        if(off < ctx->size  &&  CH(off) == _T('|')) {
+            delimited = TRUE;
+            found_pipe =  TRUE;
+            off++;
+            while(off < ctx->size  &&  ISWHITESPACE(off))
+                off++;
         }
 
-        n_parents++;
-    }
+        /* Success, if we reach end of line. */
+        if(off >= ctx->size  ||  ISNEWLINE(off))
+            break;
 
-    if(off >= ctx->size  ||  ISNEWLINE(off)) {
-        /* Blank line does not need any real indentation to be nested inside
-         * a list. */
-        if(n_brothers + n_children == 0) {
-            while(n_parents < ctx->n_containers  &&  ctx->containers[n_parents].ch != _T('>'))
-                n_parents++;
-        }
+        if(!delimited)
+            return FALSE;
     }
 
-    while(TRUE) {
-        /* Check whether we are fenced code continuation. */
-        if(pivot_line->type == MD_LINE_FENCEDCODE) {
-            line->beg = off;
+    if(!found_pipe)
+        return FALSE;
 
-            /* We are another MD_LINE_FENCEDCODE unless we are closing fence
-             * which we transform into MD_LINE_BLANK. */
-            if(line->indent < ctx->code_indent_offset) {
-                if(md_is_closing_code_fence(ctx, CH(pivot_line->beg), off, &off)) {
-                    line->type = MD_LINE_BLANK;
-                    ctx->last_line_has_list_loosening_effect = FALSE;
-                    break;
-                }
-            }
+    *p_end = off;
+    *p_col_count = col_count;
+    return TRUE;
+}
 
-            /* Change indentation accordingly to the initial code fence. */
-            if(n_parents == ctx->n_containers) {
-                if(line->indent > pivot_line->indent)
-                    line->indent -= pivot_line->indent;
-                else
-                    line->indent = 0;
+static int
+md_is_opening_code_fence(MD_CTX* ctx, OFF beg, OFF* p_end)
+{
+    OFF off = beg;
 
-                line->type = MD_LINE_FENCEDCODE;
-                break;
-            }
-        }
+    while(off < ctx->size && CH(off) == CH(beg))
+        off++;
+
+    /* Fence must have at least three characters. */
+    if(off - beg < 3)
+        return FALSE;
+
+    ctx->code_fence_length = off - beg;
+
+    /* Optionally, space(s) can follow. */
+    while(off < ctx->size  &&  CH(off) == _T(' '))
+        off++;
+
+    /* Optionally, an info string can follow. */
+    while(off < ctx->size  &&  !ISNEWLINE(off)) {
+        /* Backtick-based fence must not contain '`' in the info string. */
+        if(CH(beg) == _T('`')  &&  CH(off) == _T('`'))
+            return FALSE;
+        off++;
+    }
+
+    *p_end = off;
+    return TRUE;
+}
+
+static int
+md_is_closing_code_fence(MD_CTX* ctx, CHAR ch, OFF beg, OFF* p_end)
+{
+    OFF off = beg;
+    int ret = FALSE;
+
+    /* Closing fence must have at least the same length and use same char as
+     * opening one. */
+    while(off < ctx->size  &&  CH(off) == ch)
+        off++;
+    if(off - beg < ctx->code_fence_length)
+        goto out;
+
+    /* Optionally, space(s) can follow */
+    while(off < ctx->size  &&  ISANYOF2(off, _T(' '), _T('\t')))
+        off++;
+
+    /* But nothing more is allowed on the line. */
+    if(off < ctx->size  &&  !ISNEWLINE(off))
+        goto out;
+
+    ret = TRUE;
+
+out:
+    /* Note we set *p_end even on failure: If we are not closing fence, caller
+     * would eat the line anyway without any parsing. */
+    *p_end = off;
+    return ret;
+}
+
+
+/* Helper data for md_is_html_block_start_condition() and
+ * md_is_html_block_end_condition() */
+typedef struct TAG_tag TAG;
+struct TAG_tag {
+    const CHAR* name;
+    unsigned len    : 8;
+};
+
+#ifdef X
+    #undef X
+#endif
+#define X(name)     { _T(name), (sizeof(_T(name))-1) / sizeof(CHAR) }
+#define Xend        { NULL, 0 }
+
+static const TAG t1[] = { X("pre"), X("script"), X("style"), X("textarea"), Xend };
+
+static const TAG a6[] = { X("address"), X("article"), X("aside"), Xend };
+static const TAG b6[] = { X("base"), X("basefont"), X("blockquote"), X("body"), Xend };
+static const TAG c6[] = { X("caption"), X("center"), X("col"), X("colgroup"), Xend };
+static const TAG d6[] = { X("dd"), X("details"), X("dialog"), X("dir"),
+                          X("div"), X("dl"), X("dt"), Xend };
+static const TAG f6[] = { X("fieldset"), X("figcaption"), X("figure"), X("footer"),
+                          X("form"), X("frame"), X("frameset"), Xend };
+static const TAG h6[] = { X("h1"), X("h2"), X("h3"), X("h4"), X("h5"), X("h6"),
+                          X("head"), X("header"), X("hr"), X("html"), Xend };
+static const TAG i6[] = { X("iframe"), Xend };
+static const TAG l6[] = { X("legend"), X("li"), X("link"), Xend };
+static const TAG m6[] = { X("main"), X("menu"), X("menuitem"), Xend };
+static const TAG n6[] = { X("nav"), X("noframes"), Xend };
+static const TAG o6[] = { X("ol"), X("optgroup"), X("option"), Xend };
+static const TAG p6[] = { X("p"), X("param"), Xend };
+static const TAG s6[] = { X("search"), X("section"), X("summary"), Xend };
+static const TAG t6[] = { X("table"), X("tbody"), X("td"), X("tfoot"), X("th"),
+                          X("thead"), X("title"), X("tr"), X("track"), Xend };
+static const TAG u6[] = { X("ul"), Xend };
+static const TAG xx[] = { Xend };
+
+#undef X
+#undef Xend
+
+/* Returns type of the raw HTML block, or FALSE if it is not HTML block.
+ * (Refer to CommonMark specification for details about the types.)
+ */
+static int
+md_is_html_block_start_condition(MD_CTX* ctx, OFF beg)
+{
+    /* Type 6 is started by a long list of allowed tags. We use two-level
+     * tree to speed-up the search. */
+    static const TAG* map6[26] = {
+        a6, b6, c6, d6, xx, f6, xx, h6, i6, xx, xx, l6, m6,
+        n6, o6, p6, xx, xx, s6, t6, u6, xx, xx, xx, xx, xx
+    };
+    OFF off = beg + 1;
+    int i;
+
+    /* Check for type 1: <script, <pre, or <style */
+    for(i = 0; t1[i].name != NULL; i++) {
+        if(off + t1[i].len <= ctx->size) {
+            if(md_ascii_case_eq(STR(off), t1[i].name, t1[i].len))
+                return 1;
+        }
+    }
+
+    /* Check for type 2: <!-- */
+    if(off + 3 < ctx->size  &&  CH(off) == _T('!')  &&  CH(off+1) == _T('-')  &&  CH(off+2) == _T('-'))
+        return 2;
+
+    /* Check for type 3: <? */
+    if(off < ctx->size  &&  CH(off) == _T('?'))
+        return 3;
+
+    /* Check for type 4 or 5: <! */
+    if(off < ctx->size  &&  CH(off) == _T('!')) {
+        /* Check for type 4: <! followed by uppercase letter. */
+        if(off + 1 < ctx->size  &&  ISASCII(off+1))
+            return 4;
+
+        /* Check for type 5: <![CDATA[ */
+        if(off + 8 < ctx->size) {
+            if(md_ascii_eq(STR(off), _T("![CDATA["), 8))
+                return 5;
+        }
+    }
+
+    /* Check for type 6: Many possible starting tags listed above. */
+    if(off + 1 < ctx->size  &&  (ISALPHA(off) || (CH(off) == _T('/') && ISALPHA(off+1)))) {
+        int slot;
+        const TAG* tags;
+
+        if(CH(off) == _T('/'))
+            off++;
+
+        slot = (ISUPPER(off) ? CH(off) - 'A' : CH(off) - 'a');
+        tags = map6[slot];
+
+        for(i = 0; tags[i].name != NULL; i++) {
+            if(off + tags[i].len <= ctx->size) {
+                if(md_ascii_case_eq(STR(off), tags[i].name, tags[i].len)) {
+                    OFF tmp = off + tags[i].len;
+                    if(tmp >= ctx->size)
+                        return 6;
+                    if(ISBLANK(tmp) || ISNEWLINE(tmp) || CH(tmp) == _T('>'))
+                        return 6;
+                    if(tmp+1 < ctx->size && CH(tmp) == _T('/') && CH(tmp+1) == _T('>'))
+                        return 6;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Check for type 7: any COMPLETE other opening or closing tag. */
+    if(off + 1 < ctx->size) {
+        OFF end;
+
+        if(md_is_html_tag(ctx, NULL, 0, beg, ctx->size, &end)) {
+            /* Only optional whitespace and new line may follow. */
+            while(end < ctx->size  &&  ISWHITESPACE(end))
+                end++;
+            if(end >= ctx->size  ||  ISNEWLINE(end))
+                return 7;
+        }
+    }
+
+    return FALSE;
+}
+
+/* Case sensitive check whether there is a substring 'what' between 'beg'
+ * and end of line. */
+static int
+md_line_contains(MD_CTX* ctx, OFF beg, const CHAR* what, SZ what_len, OFF* p_end)
+{
+    OFF i;
+    for(i = beg; i + what_len < ctx->size; i++) {
+        if(ISNEWLINE(i))
+            break;
+        if(memcmp(STR(i), what, what_len * sizeof(CHAR)) == 0) {
+            *p_end = i + what_len;
+            return TRUE;
+        }
+    }
+
+    *p_end = i;
+    return FALSE;
+}
+
+/* Returns type of HTML block end condition or FALSE if not an end condition.
+ *
+ * Note it fills p_end even when it is not end condition as the caller
+ * does not need to analyze contents of a raw HTML block.
+ */
+static int
+md_is_html_block_end_condition(MD_CTX* ctx, OFF beg, OFF* p_end)
+{
+    switch(ctx->html_block_type) {
+        case 1:
+        {
+            OFF off = beg;
+            int i;
+
+            while(off+1 < ctx->size  &&  !ISNEWLINE(off)) {
+                if(CH(off) == _T('<')  &&  CH(off+1) == _T('/')) {
+                    for(i = 0; t1[i].name != NULL; i++) {
+                        if(off + 2 + t1[i].len < ctx->size) {
+                            if(md_ascii_case_eq(STR(off+2), t1[i].name, t1[i].len)  &&
+                               CH(off+2+t1[i].len) == _T('>'))
+                            {
+                                *p_end = off+2+t1[i].len+1;
+                                return TRUE;
+                            }
+                        }
+                    }
+                }
+                off++;
+            }
+            *p_end = off;
+            return FALSE;
+        }
+
+        case 2:
+            return (md_line_contains(ctx, beg, _T("-->"), 3, p_end) ? 2 : FALSE);
+
+        case 3:
+            return (md_line_contains(ctx, beg, _T("?>"), 2, p_end) ? 3 : FALSE);
+
+        case 4:
+            return (md_line_contains(ctx, beg, _T(">"), 1, p_end) ? 4 : FALSE);
+
+        case 5:
+            return (md_line_contains(ctx, beg, _T("]]>"), 3, p_end) ? 5 : FALSE);
+
+        case 6:     /* Pass through */
+        case 7:
+            if(beg >= ctx->size  ||  ISNEWLINE(beg)) {
+                /* Blank line ends types 6 and 7. */
+                *p_end = beg;
+                return ctx->html_block_type;
+            }
+            return FALSE;
+
+        default:
+            MD_UNREACHABLE();
+    }
+    return FALSE;
+}
+
+
+static int
+md_is_container_compatible(const MD_CONTAINER* pivot, const MD_CONTAINER* container)
+{
+    /* Block quote has no "items" like lists. */
+    if(container->ch == _T('>'))
+        return FALSE;
+
+    if(container->ch != pivot->ch)
+        return FALSE;
+    if(container->mark_indent > pivot->contents_indent)
+        return FALSE;
+
+    return TRUE;
+}
+
+static int
+md_push_container(MD_CTX* ctx, const MD_CONTAINER* container)
+{
+    if(ctx->n_containers >= ctx->alloc_containers) {
+        MD_CONTAINER* new_containers;
+
+        ctx->alloc_containers = (ctx->alloc_containers > 0
+                ? ctx->alloc_containers + ctx->alloc_containers / 2
+                : 16);
+        new_containers = md_realloc(ctx, ctx->containers, ctx->alloc_containers * sizeof(MD_CONTAINER));
+        if(new_containers == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
+        }
+
+        ctx->containers = new_containers;
+        MD_STATS_INC(containers_reallocs);
+    }
+
+    memcpy(&ctx->containers[ctx->n_containers++], container, sizeof(MD_CONTAINER));
+    return 0;
+}
+
+static int
+md_enter_child_containers(MD_CTX* ctx, int n_children)
+{
+    int i;
+    int ret = 0;
+
+    for(i = ctx->n_containers - n_children; i < ctx->n_containers; i++) {
+        MD_CONTAINER* c = &ctx->containers[i];
+        int is_ordered_list = FALSE;
+
+        switch(c->ch) {
+            case _T(')'):
+            case _T('.'):
+                is_ordered_list = TRUE;
+                MD_FALLTHROUGH();
+
+            case _T('-'):
+            case _T('+'):
+            case _T('*'):
+                /* Remember offset in ctx->block_bytes so we can revisit the
+                 * block if we detect it is a loose list. */
+                md_end_current_block(ctx);
+                c->block_byte_off = ctx->n_block_bytes;
+
+                MD_CHECK(md_push_container_bytes(ctx,
+                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL),
+                                c->start, c->ch, MD_BLOCK_CONTAINER_OPENER));
+                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                                c->task_mark_off,
+                                (c->is_task ? CH(c->task_mark_off) : 0),
+                                MD_BLOCK_CONTAINER_OPENER));
+                break;
+
+            case _T('>'):
+                MD_CHECK(md_push_container_bytes(ctx,
+                                (c->is_admonition ? MD_BLOCK_ADMONITION : MD_BLOCK_QUOTE),
+                                0, c->admonition_type, MD_BLOCK_CONTAINER_OPENER));
+                break;
+
+            default:
+                MD_UNREACHABLE();
+                break;
+        }
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_leave_child_containers(MD_CTX* ctx, int n_keep)
+{
+    int ret = 0;
+
+    while(ctx->n_containers > n_keep) {
+        MD_CONTAINER* c = &ctx->containers[ctx->n_containers-1];
+        int is_ordered_list = FALSE;
+
+        switch(c->ch) {
+            case _T(')'):
+            case _T('.'):
+                is_ordered_list = TRUE;
+                MD_FALLTHROUGH();
+
+            case _T('-'):
+            case _T('+'):
+            case _T('*'):
+                MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                                c->task_mark_off, (c->is_task ? CH(c->task_mark_off) : 0),
+                                MD_BLOCK_CONTAINER_CLOSER));
+                MD_CHECK(md_push_container_bytes(ctx,
+                                (is_ordered_list ? MD_BLOCK_OL : MD_BLOCK_UL), 0,
+                                c->ch, MD_BLOCK_CONTAINER_CLOSER));
+                break;
+
+            case _T('>'):
+                MD_CHECK(md_push_container_bytes(ctx,
+                                (c->is_admonition ? MD_BLOCK_ADMONITION : MD_BLOCK_QUOTE),
+                                0, c->admonition_type, MD_BLOCK_CONTAINER_CLOSER));
+                break;
+
+            default:
+                MD_UNREACHABLE();
+                break;
+        }
+
+        ctx->n_containers--;
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_is_container_mark(MD_CTX* ctx, unsigned indent, OFF beg, OFF* p_end, MD_CONTAINER* p_container)
+{
+    OFF off = beg;
+    OFF max_end;
+
+    if(off >= ctx->size  ||  indent >= ctx->code_indent_offset)
+        return FALSE;
+
+    /* Check for block quote mark. */
+    if(CH(off) == _T('>')) {
+        off++;
+        p_container->ch = _T('>');
+        p_container->is_loose = FALSE;
+        p_container->is_task = FALSE;
+        p_container->mark_indent = indent;
+        p_container->contents_indent = indent + 1;
+        *p_end = off;
+        return TRUE;
+    }
+
+    /* Check for list item bullet mark. */
+    if(ISANYOF(off, _T("-+*"))  &&  (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1))) {
+        p_container->ch = CH(off);
+        p_container->is_loose = FALSE;
+        p_container->is_task = FALSE;
+        p_container->mark_indent = indent;
+        p_container->contents_indent = indent + 1;
+        *p_end = off+1;
+        return TRUE;
+    }
+
+    /* Check for ordered list item marks. */
+    max_end = off + 9;
+    if(max_end > ctx->size)
+        max_end = ctx->size;
+    p_container->start = 0;
+    while(off < max_end  &&  ISDIGIT(off)) {
+        p_container->start = p_container->start * 10 + CH(off) - _T('0');
+        off++;
+    }
+    if(off > beg  &&
+       off < ctx->size  &&
+       (CH(off) == _T('.') || CH(off) == _T(')'))  &&
+       (off+1 >= ctx->size || ISBLANK(off+1) || ISNEWLINE(off+1)))
+    {
+        p_container->ch = CH(off);
+        p_container->is_loose = FALSE;
+        p_container->is_task = FALSE;
+        p_container->mark_indent = indent;
+        p_container->contents_indent = indent + off - beg + 1;
+        *p_end = off+1;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+static unsigned
+md_line_indentation(MD_CTX* ctx, unsigned total_indent, OFF beg, OFF* p_end)
+{
+    OFF off = beg;
+    unsigned indent = total_indent;
+
+    while(off < ctx->size  &&  ISBLANK(off)) {
+        if(CH(off) == _T('\t'))
+            indent = (indent + 4) & ~3;
+        else
+            indent++;
+        off++;
+    }
+
+    *p_end = off;
+    return indent - total_indent;
+}
+
+static OFF
+md_skip_to_newline_scalar(MD_CTX* ctx, OFF off)
+{
+    /* Optimization: Use some loop unrolling. */
+    while(off + 3 < ctx->size  &&  !ISNEWLINE(off+0)  &&  !ISNEWLINE(off+1)
+                               &&  !ISNEWLINE(off+2)  &&  !ISNEWLINE(off+3))
+        off += 4;
+    while(off < ctx->size  &&  !ISNEWLINE(off))
+        off++;
+    return off;
+}
+
+#ifdef MD_X86_SIMD
+MD_TARGET("sse2") static OFF
+md_skip_to_newline_sse2(MD_CTX* ctx, OFF off)
+{
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+
+    while(ctx->size - off >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (ctx->text + off));
+        unsigned hits = (unsigned) _mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+
+        if(hits != 0)
+            return off + MD_CTZ(hits);
+        off += 16;
+    }
+
+    return md_skip_to_newline_scalar(ctx, off);
+}
+
+MD_TARGET("avx2") static OFF
+md_skip_to_newline_avx2(MD_CTX* ctx, OFF off)
+{
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+
+    while(ctx->size - off >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (ctx->text + off));
+        unsigned hits = (unsigned) _mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, lf)));
+
+        if(hits != 0)
+            return off + MD_CTZ(hits);
+        off += 32;
+    }
+
+    /* Avoid the AVX-SSE transition penalty in the legacy SSE code. */
+    _mm256_zeroupper();
+    return md_skip_to_newline_sse2(ctx, off);
+}
+#endif
+
+static void
+md_select_skip_to_newline(MD_CTX* ctx)
+{
+    ctx->skip_to_newline = md_skip_to_newline_scalar;
+
+#ifdef MD_X86_SIMD
+    /* SSSE3 implies SSE2. */
+    switch(md_x86_simd_level()) {
+        case MD_SIMD_AVX2:  ctx->skip_to_newline = md_skip_to_newline_avx2; break;
+        case MD_SIMD_SSSE3: ctx->skip_to_newline = md_skip_to_newline_sse2; break;
+        default:            break;
+    }
+#endif
+}
+
+/* Returns offset of the first '\r' or '\n' at or after off, or ctx->size if
+ * there is none. */
+static inline OFF
+md_skip_to_newline(MD_CTX* ctx, OFF off)
+{
+    return ctx->skip_to_newline(ctx, off);
+}
+
+/* Chars which may start a line of any block other than a paragraph (or its
+ * continuation), when the line is not indented enough to be an indented code.
+ * See md_analyze_line(). */
+static const unsigned char md_block_start_char_map[128] = {
+ /* 0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,     /* 0x00 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,     /* 0x10 */
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0,     /* 0x20:  # * + - */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0,     /* 0x30:  0-9 : < = > */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,     /* 0x40 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,     /* 0x50:  _ */
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,     /* 0x60:  ` */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0      /* 0x70:  | ~ */
+};
+
+#define ISBLOCKSTARTCHAR_(ch)           ((unsigned)(ch) < 128  &&  md_block_start_char_map[(unsigned)(ch)])
+#define ISBLOCKSTARTCHAR(off)           ISBLOCKSTARTCHAR_(CH(off))
+
+static const MD_LINE_ANALYSIS md_dummy_blank_line = { MD_LINE_BLANK, 0, 0, 0, 0, 0 };
+
+/* Analyze type of the line and find some its properties. This serves as a
+ * main input for determining type and boundaries of a block. */
+static int
+md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
+                const MD_LINE_ANALYSIS* pivot_line, MD_LINE_ANALYSIS* line)
+{
+    unsigned total_indent = 0;
+    int n_parents = 0;
+    int n_brothers = 0;
+    int n_children = 0;
+    MD_CONTAINER container = { 0 };
+    int prev_line_has_list_loosening_effect = ctx->last_line_has_list_loosening_effect;
+    OFF off = beg;
+    OFF hr_killer = 0;
+    int ret = 0;
+
+    line->indent = md_line_indentation(ctx, total_indent, off, &off);
+    total_indent += line->indent;
+    line->beg = off;
+    line->enforce_new_block = FALSE;
+
+    /* Given the indentation and block quote marks '>', determine how many of
+     * the current containers are our parents. */
+    while(n_parents < ctx->n_containers) {
+        MD_CONTAINER* c = &ctx->containers[n_parents];
+
+        if(c->ch == _T('>')  &&  line->indent < ctx->code_indent_offset  &&
+            off < ctx->size  &&  CH(off) == _T('>'))
+        {
+            /* Block quote mark. */
+            off++;
+            total_indent++;
+            line->indent = md_line_indentation(ctx, total_indent, off, &off);
+            total_indent += line->indent;
+
+            /* The optional 1st space after '>' is part of the block quote mark. */
+            if(line->indent > 0)
+                line->indent--;
+
+            line->beg = off;
+
+        } else if(c->ch != _T('>')  &&  line->indent >= c->contents_indent) {
+            /* List. */
+            line->indent -= c->contents_indent;
+        } else {
+            break;
+        }
+
+        n_parents++;
+    }
+
+    if(off >= ctx->size  ||  ISNEWLINE(off)) {
+        /* Blank line does not need any real indentation to be nested inside
+         * a list. */
+        if(n_brothers + n_children == 0) {
+            while(n_parents < ctx->n_containers  &&  ctx->containers[n_parents].ch != _T('>'))
+                n_parents++;
+        }
+    }
+
+    while(TRUE) {
+        /* Check whether we are fenced code continuation. */
+        if(pivot_line->type == MD_LINE_FENCEDCODE) {
+            line->beg = off;
+
+            /* We are another MD_LINE_FENCEDCODE unless we are closing fence
+             * which we transform into MD_LINE_BLANK. */
+            if(line->indent < ctx->code_indent_offset) {
+                if(md_is_closing_code_fence(ctx, CH(pivot_line->beg), off, &off)) {
+                    line->type = MD_LINE_BLANK;
+                    ctx->last_line_has_list_loosening_effect = FALSE;
+                    break;
+                }
+            }
+
+            /* Change indentation accordingly to the initial code fence. */
+            if(n_parents == ctx->n_containers) {
+                if(line->indent > pivot_line->indent)
+                    line->indent -= pivot_line->indent;
+                else
+                    line->indent = 0;
+
+                line->type = MD_LINE_FENCEDCODE;
+                break;
+            }
+        }
 
         /* Check whether we are HTML block continuation. */
         if(pivot_line->type == MD_LINE_HTML  &&  ctx->html_block_type > 0) {
@@ -6582,659 +8290,2171 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
                  * block ends. */
                 ctx->html_block_type = 0;
             } else {
-                int html_block_type;
+                int html_block_type;
+
+                html_block_type = md_is_html_block_end_condition(ctx, off, &off);
+                if(html_block_type > 0) {
+                    MD_ASSERT(html_block_type == ctx->html_block_type);
+
+                    /* Make sure this is the last line of the block. */
+                    ctx->html_block_type = 0;
+
+                    /* Some end conditions serve as blank lines at the same time. */
+                    if(html_block_type == 6 || html_block_type == 7) {
+                        line->type = MD_LINE_BLANK;
+                        line->indent = 0;
+                        break;
+                    }
+                }
+
+                line->type = MD_LINE_HTML;
+                n_parents = ctx->n_containers;
+                break;
+            }
+        }
+
+        /* Check for blank line. */
+        if(off >= ctx->size  ||  ISNEWLINE(off)) {
+            if(pivot_line->type == MD_LINE_INDENTEDCODE  &&  n_parents == ctx->n_containers) {
+                line->type = MD_LINE_INDENTEDCODE;
+                if(line->indent > ctx->code_indent_offset)
+                    line->indent -= ctx->code_indent_offset;
+                else
+                    line->indent = 0;
+                ctx->last_line_has_list_loosening_effect = FALSE;
+            } else {
+                line->type = MD_LINE_BLANK;
+                ctx->last_line_has_list_loosening_effect = (n_parents > 0  &&
+                        n_brothers + n_children == 0  &&
+                        ctx->containers[n_parents-1].ch != _T('>'));
+
+    #if 1
+                /* See https://github.com/mity/md4c/issues/6
+                 *
+                 * This ugly checking tests we are in (yet empty) list item but
+                 * not its very first line (i.e. not the line with the list
+                 * item mark).
+                 *
+                 * If we are such a blank line, then any following non-blank
+                 * line which would be part of the list item actually has to
+                 * end the list because according to the specification, "a list
+                 * item can begin with at most one blank line."
+                 */
+                if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
+                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
+                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK)  &&
+                   ctx->n_block_bytes == ctx->container_block_bytes_end)
+                {
+                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
+                    if(top_block->type == MD_BLOCK_LI)
+                        ctx->last_list_item_starts_with_two_blank_lines = TRUE;
+                }
+    #endif
+            }
+            break;
+        } else {
+    #if 1
+            /* This is the 2nd half of the hack. If the flag is set (i.e. there
+             * was a 2nd blank line at the beginning of the list item) and if
+             * we would otherwise still belong to the list item, we enforce
+             * the end of the list. */
+            if(ctx->last_list_item_starts_with_two_blank_lines) {
+                if(n_parents > 0  &&  n_parents == ctx->n_containers  &&
+                   ctx->containers[n_parents-1].ch != _T('>')  &&
+                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
+                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK)  &&
+                   ctx->n_block_bytes == ctx->container_block_bytes_end)
+                {
+                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
+                    if(top_block->type == MD_BLOCK_LI) {
+                        n_parents--;
+
+                        line->indent = total_indent;
+                        if(n_parents > 0)
+                            line->indent -= MIN(line->indent, ctx->containers[n_parents-1].contents_indent);
+                    }
+                }
+
+                ctx->last_list_item_starts_with_two_blank_lines = FALSE;
+            }
+    #endif
+            ctx->last_line_has_list_loosening_effect = FALSE;
+        }
+
+        /* Optimization: Most lines are just ordinary text lines. If the line
+         * cannot start any other block, skip all the checks below. (Only
+         * a table continuation has to be detected regardless the 1st char.) */
+        if(line->indent < ctx->code_indent_offset  &&  !ISBLOCKSTARTCHAR(off)  &&
+           pivot_line->type != MD_LINE_TABLE)
+            goto text_line;
+
+        /* Check whether we are Setext underline. */
+        if(line->indent < ctx->code_indent_offset  &&  pivot_line->type == MD_LINE_TEXT
+            &&  off < ctx->size  &&  ISANYOF2(off, _T('='), _T('-'))
+            &&  (n_parents == ctx->n_containers))
+        {
+            unsigned level;
+
+            if(md_is_setext_underline(ctx, off, &off, &level)) {
+                line->type = MD_LINE_SETEXTUNDERLINE;
+                line->data = level;
+                break;
+            }
+        }
+
+        /* Check for thematic break line. */
+        if(line->indent < ctx->code_indent_offset
+            &&  off < ctx->size  &&  off >= hr_killer
+            &&  ISANYOF(off, _T("-_*")))
+        {
+            if(md_is_hr_line(ctx, off, &off, &hr_killer)) {
+                line->type = MD_LINE_HR;
+                break;
+            }
+        }
+
+        /* Check for "brother" container. I.e. whether we are another list item
+         * in already started list. */
+        if(n_parents < ctx->n_containers  &&  n_brothers + n_children == 0) {
+            OFF tmp;
+
+            if(md_is_container_mark(ctx, line->indent, off, &tmp, &container)  &&
+               md_is_container_compatible(&ctx->containers[n_parents], &container))
+            {
+                pivot_line = &md_dummy_blank_line;
+
+                off = tmp;
+
+                total_indent += container.contents_indent - container.mark_indent;
+                line->indent = md_line_indentation(ctx, total_indent, off, &off);
+                total_indent += line->indent;
+                line->beg = off;
+
+                /* Some of the following whitespace actually still belongs to the mark. */
+                if(off >= ctx->size || ISNEWLINE(off)) {
+                    container.contents_indent++;
+                } else if(line->indent <= ctx->code_indent_offset) {
+                    container.contents_indent += line->indent;
+                    line->indent = 0;
+                } else {
+                    container.contents_indent += 1;
+                    line->indent--;
+                }
+
+                ctx->containers[n_parents].mark_indent = container.mark_indent;
+                ctx->containers[n_parents].contents_indent = container.contents_indent;
+
+                n_brothers++;
+                continue;
+            }
+        }
+
+        /* Check for indented code.
+         * Note indented code block cannot interrupt a paragraph. */
+        if(line->indent >= ctx->code_indent_offset  &&  (pivot_line->type != MD_LINE_TEXT)) {
+            line->type = MD_LINE_INDENTEDCODE;
+            line->indent -= ctx->code_indent_offset;
+            line->data = 0;
+            break;
+        }
+
+        /* Check for start of a new container block. */
+        if(line->indent < ctx->code_indent_offset  &&
+           md_is_container_mark(ctx, line->indent, off, &off, &container))
+        {
+            if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
+                        (off >= ctx->size || ISNEWLINE(off))  &&  container.ch != _T('>'))
+            {
+                /* Noop. List mark followed by a blank line cannot interrupt a paragraph. */
+            } else if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
+                        ISANYOF2_(container.ch, _T('.'), _T(')'))  &&  container.start != 1)
+            {
+                /* Noop. Ordered list cannot interrupt a paragraph unless the start index is 1. */
+            } else {
+                total_indent += container.contents_indent - container.mark_indent;
+                line->indent = md_line_indentation(ctx, total_indent, off, &off);
+                total_indent += line->indent;
+
+                line->beg = off;
+                line->data = container.ch;
+
+                /* Some of the following whitespace actually still belongs to the mark. */
+                if(off >= ctx->size || ISNEWLINE(off)) {
+                    container.contents_indent++;
+                } else if(line->indent <= ctx->code_indent_offset) {
+                    container.contents_indent += line->indent;
+                    line->indent = 0;
+                } else {
+                    container.contents_indent += 1;
+                    line->indent--;
+                }
+
+                if(n_brothers + n_children == 0)
+                    pivot_line = &md_dummy_blank_line;
+
+                if(n_children == 0)
+                    MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+
+                n_children++;
+                MD_CHECK(md_push_container(ctx, &container));
+                continue;
+            }
+        }
+
+        /* Check whether we are table continuation. */
+        if(pivot_line->type == MD_LINE_TABLE  &&  n_parents == ctx->n_containers) {
+            line->type = MD_LINE_TABLE;
+            break;
+        }
+
+        /* Check for ATX header. */
+        if(line->indent < ctx->code_indent_offset  &&
+                off < ctx->size  &&  CH(off) == _T('#'))
+        {
+            unsigned level;
+
+            if(md_is_atxheader_line(ctx, off, &line->beg, &off, &level)) {
+                line->type = MD_LINE_ATXHEADER;
+                line->data = level;
+                break;
+            }
+        }
+
+        /* Check whether we are starting code fence. */
+        if(line->indent < ctx->code_indent_offset  &&
+                off < ctx->size  &&  ISANYOF2(off, _T('`'), _T('~')))
+        {
+            if(md_is_opening_code_fence(ctx, off, &off)) {
+                line->type = MD_LINE_FENCEDCODE;
+                line->data = 1;
+                line->enforce_new_block = TRUE;
+                break;
+            }
+        }
+
+        /* Check for start of raw HTML block. */
+        if(off < ctx->size  &&  CH(off) == _T('<')
+            &&  !(ctx->parser.flags & MD_FLAG_NOHTMLBLOCKS))
+        {
+            ctx->html_block_type = md_is_html_block_start_condition(ctx, off);
+
+            /* HTML block type 7 cannot interrupt paragraph. */
+            if(ctx->html_block_type == 7  &&  pivot_line->type == MD_LINE_TEXT)
+                ctx->html_block_type = 0;
+
+            if(ctx->html_block_type > 0) {
+                /* The line itself also may immediately close the block. */
+                if(md_is_html_block_end_condition(ctx, off, &off) == ctx->html_block_type) {
+                    /* Make sure this is the last line of the block. */
+                    ctx->html_block_type = 0;
+                }
+
+                line->enforce_new_block = TRUE;
+                line->type = MD_LINE_HTML;
+                break;
+            }
+        }
+
+        /* Check for table underline. */
+        if((ctx->parser.flags & MD_FLAG_TABLES)  &&  pivot_line->type == MD_LINE_TEXT
+            &&  off < ctx->size  &&  ISANYOF3(off, _T('|'), _T('-'), _T(':'))
+            &&  n_parents == ctx->n_containers)
+        {
+            unsigned col_count;
+
+            if(ctx->current_block != NULL  &&  ctx->current_block->n_lines == 1  &&
+                md_is_table_underline(ctx, off, &off, &col_count))
+            {
+                line->data = col_count;
+                line->type = MD_LINE_TABLEUNDERLINE;
+                break;
+            }
+        }
+
+text_line:
+        /* By default, we are normal text line. */
+        line->type = MD_LINE_TEXT;
+        if(pivot_line->type == MD_LINE_TEXT  &&  n_brothers + n_children == 0) {
+            /* Lazy continuation. */
+            n_parents = ctx->n_containers;
+        }
+
+        /* Check for task mark. */
+        if((ctx->parser.flags & MD_FLAG_TASKLISTS)  &&  n_brothers + n_children > 0  &&
+           ISANYOF_(ctx->containers[ctx->n_containers-1].ch, _T("-+*.)")))
+        {
+            OFF tmp = off;
+
+            while(tmp < ctx->size  &&  tmp < off + 3  &&  ISBLANK(tmp))
+                tmp++;
+            if(tmp + 2 < ctx->size  &&  CH(tmp) == _T('[')  &&
+               ISANYOF(tmp+1, _T("xX "))  &&  CH(tmp+2) == _T(']')  &&
+               (tmp + 3 == ctx->size  ||  ISBLANK(tmp+3)  ||  ISNEWLINE(tmp+3)))
+            {
+                MD_CONTAINER* task_container = (n_children > 0 ? &ctx->containers[ctx->n_containers-1] : &container);
+                task_container->is_task = TRUE;
+                task_container->task_mark_off = tmp + 1;
+                off = tmp + 3;
+                while(off < ctx->size  &&  ISWHITESPACE(off))
+                    off++;
+                line->beg = off;
+            }
+        }
+
+        break;
+    }
+
+    /* Scan for end of the line. */
+    off = md_skip_to_newline(ctx, off);
+
+    /* Set end of the line. */
+    line->end = off;
+
+    /* But for ATX header, we should exclude the optional trailing mark. */
+    if(line->type == MD_LINE_ATXHEADER) {
+        OFF tmp = line->end;
+        while(tmp > line->beg && ISBLANK(tmp-1))
+            tmp--;
+        while(tmp > line->beg && CH(tmp-1) == _T('#'))
+            tmp--;
+        if(tmp == line->beg || ISBLANK(tmp-1) || (ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS))
+            line->end = tmp;
+    }
+
+    /* Trim trailing spaces. */
+    if(line->type != MD_LINE_INDENTEDCODE  &&  line->type != MD_LINE_FENCEDCODE  && line->type != MD_LINE_HTML) {
+        while(line->end > line->beg && ISBLANK(line->end-1))
+            line->end--;
+    }
+
+    /* Eat also the new line. */
+    if(off < ctx->size && CH(off) == _T('\r'))
+        off++;
+    if(off < ctx->size && CH(off) == _T('\n'))
+        off++;
+
+    *p_end = off;
+
+    /* If we belong to a list after seeing a blank line, the list is loose. */
+    if(prev_line_has_list_loosening_effect  &&  line->type != MD_LINE_BLANK  &&  n_parents + n_brothers > 0) {
+        MD_CONTAINER* c = &ctx->containers[n_parents + n_brothers - 1];
+        if(c->ch != _T('>')) {
+            MD_BLOCK* block = (MD_BLOCK*) (((char*)ctx->block_bytes) + c->block_byte_off);
+            block->flags |= MD_BLOCK_LOOSE_LIST;
+        }
+    }
+
+    /* Leave any containers we are not part of anymore. */
+    if(n_children == 0  &&  n_parents + n_brothers < ctx->n_containers)
+        MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+
+    /* Enter any container we found a mark for. */
+    if(n_brothers > 0) {
+        MD_ASSERT(n_brothers == 1);
+        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                    ctx->containers[n_parents].task_mark_off,
+                    (ctx->containers[n_parents].is_task ? CH(ctx->containers[n_parents].task_mark_off) : 0),
+                    MD_BLOCK_CONTAINER_CLOSER));
+        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
+                    container.task_mark_off,
+                    (container.is_task ? CH(container.task_mark_off) : 0),
+                    MD_BLOCK_CONTAINER_OPENER));
+        ctx->containers[n_parents].is_task = container.is_task;
+        ctx->containers[n_parents].task_mark_off = container.task_mark_off;
+    }
+
+    if(n_children > 0) {
+        /* Check for admonition tag. */
+        if((ctx->parser.flags & MD_FLAG_ADMONITIONS)  &&  n_children > 0  &&
+           ctx->containers[ctx->n_containers-1].ch == _T('>')  &&  line->type == MD_LINE_TEXT  &&
+           3 < line->end - line->beg  && line->end - line->beg < 16  &&
+           CH(line->beg) == _T('[') && CH(line->beg+1) == _T('!') && CH(line->end-1) == _T(']'))
+        {
+            unsigned i;
+
+            for(i = 0; i < SIZEOF_ARRAY(MD_ADMONITION_TAGS); i++) {
+                if(line->end - line->beg == md_strlen(MD_ADMONITION_TAGS[i]) + 3  &&
+                   md_ascii_case_eq(STR(line->beg+2), MD_ADMONITION_TAGS[i], line->end - line->beg - 3))
+                {
+                    ctx->containers[ctx->n_containers-1].is_admonition = TRUE;
+                    ctx->containers[ctx->n_containers-1].admonition_type = i;
+                    line->type = MD_LINE_BLANK;
+                    break;
+                }
+            }
+        }
+
+        /* Enter all the child container blocks. */
+        MD_CHECK(md_enter_child_containers(ctx, n_children));
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_process_line(MD_CTX* ctx, const MD_LINE_ANALYSIS** p_pivot_line, MD_LINE_ANALYSIS* line)
+{
+    const MD_LINE_ANALYSIS* pivot_line = *p_pivot_line;
+    int ret = 0;
+
+    /* Blank line ends current leaf block. */
+    if(line->type == MD_LINE_BLANK) {
+        MD_CHECK(md_end_current_block(ctx));
+        *p_pivot_line = &md_dummy_blank_line;
+        return 0;
+    }
+
+    if(line->enforce_new_block)
+        MD_CHECK(md_end_current_block(ctx));
+
+    /* Some line types form block on their own. */
+    if(line->type == MD_LINE_HR || line->type == MD_LINE_ATXHEADER) {
+        MD_CHECK(md_end_current_block(ctx));
+
+        /* Add our single-line block. */
+        MD_CHECK(md_start_new_block(ctx, line));
+        MD_CHECK(md_add_line_into_current_block(ctx, line));
+        MD_CHECK(md_end_current_block(ctx));
+        *p_pivot_line = &md_dummy_blank_line;
+        return 0;
+    }
+
+    /* MD_LINE_SETEXTUNDERLINE changes meaning of the current block and ends it. */
+    if(line->type == MD_LINE_SETEXTUNDERLINE) {
+        MD_ASSERT(ctx->current_block != NULL);
+        ctx->current_block->type = MD_BLOCK_H;
+        ctx->current_block->data = line->data;
+        ctx->current_block->flags |= MD_BLOCK_SETEXT_HEADER;
+        MD_CHECK(md_add_line_into_current_block(ctx, line));
+        MD_CHECK(md_end_current_block(ctx));
+        if(ctx->current_block == NULL) {
+            *p_pivot_line = &md_dummy_blank_line;
+        } else {
+            /* This happens if we have consumed all the body as link ref. defs.
+             * and downgraded the underline into start of a new paragraph block. */
+            line->type = MD_LINE_TEXT;
+            *p_pivot_line = line;
+        }
+        return 0;
+    }
+
+    /* MD_LINE_TABLEUNDERLINE changes meaning of the current block. */
+    if(line->type == MD_LINE_TABLEUNDERLINE) {
+        MD_ASSERT(ctx->current_block != NULL);
+        MD_ASSERT(ctx->current_block->n_lines == 1);
+        ctx->current_block->type = MD_BLOCK_TABLE;
+        ctx->current_block->data = line->data;
+        MD_ASSERT(pivot_line != &md_dummy_blank_line);
+        ((MD_LINE_ANALYSIS*)pivot_line)->type = MD_LINE_TABLE;
+        MD_CHECK(md_add_line_into_current_block(ctx, line));
+        return 0;
+    }
+
+    /* The current block also ends if the line has different type. */
+    if(line->type != pivot_line->type)
+        MD_CHECK(md_end_current_block(ctx));
+
+    /* The current line may start a new block. */
+    if(ctx->current_block == NULL) {
+        MD_CHECK(md_start_new_block(ctx, line));
+        *p_pivot_line = line;
+    }
+
+    /* In all other cases the line is just a continuation of the current block. */
+    MD_CHECK(md_add_line_into_current_block(ctx, line));
+
+abort:
+    return ret;
+}
+
+static int
+md_footnote_def_cmp_index(const void* a, const void* b)
+{
+    const MD_FOOTNOTE_DEF* da = (const MD_FOOTNOTE_DEF*) a;
+    const MD_FOOTNOTE_DEF* db = (const MD_FOOTNOTE_DEF*) b;
+
+    /* Unreferenced defs (index == 0) always sort after referenced ones. */
+    if(da->index == 0  &&  db->index == 0) return 0;
+    if(da->index == 0) return +1;
+    if(db->index == 0) return -1;
+    if(da->index < db->index) return -1;
+    if(da->index > db->index) return +1;
+    return 0;
+}
+
+static int
+md_process_footnote_def(MD_CTX* ctx, MD_FOOTNOTE_DEF* def)
+{
+    MD_BLOCK_FOOTNOTE_DEF_DETAIL det;
+    MD_ATTRIBUTE_BUILD label_build = { 0 };
+    int ret = 0;
+
+    memset(&det, 0, sizeof(MD_BLOCK_FOOTNOTE_DEF_DETAIL));
+    det.id = def->index;
+    det.ref_count = def->ref_count;
+    MD_CHECK(md_build_attribute(ctx, def->entry.label, def->entry.label_size, 0,
+                                &det.label, &label_build));
+
+    MD_ENTER_BLOCK(MD_BLOCK_FOOTNOTE_DEF, &det);
+    MD_CHECK(md_process_normal_block_contents(ctx, def->content_lines,
+                                              def->n_content_lines));
+    MD_LEAVE_BLOCK(MD_BLOCK_FOOTNOTE_DEF, &det);
+
+abort:
+    md_free_attribute(ctx, &label_build);
+    return ret;
+}
+
+/* Render footnote definitions that were actually referenced, in reference order.
+ * Called from md_process_doc() after md_process_all_blocks(). */
+static int
+md_process_footnote_defs(MD_CTX* ctx)
+{
+    unsigned i;
+    int ret = 0;
+
+    if(ctx->footnote_hashtable.n_defs == 0  ||  ctx->next_footnote_index == 0)
+        return 0;
+
+    /* Sort defs by index so we emit in reference order. */
+    qsort(ctx->footnote_hashtable.defs, ctx->footnote_hashtable.n_defs,
+          sizeof(MD_FOOTNOTE_DEF), md_footnote_def_cmp_index);
+
+    MD_ENTER_BLOCK(MD_BLOCK_FOOTNOTE_DEF_SECTION, NULL);
+
+    for(i = 0; i < ctx->footnote_hashtable.n_defs; i++) {
+        MD_FOOTNOTE_DEF* def = &ctx->footnote_hashtable.footnote_defs[i];
+        if(def->index == 0)
+            break;
+        MD_CHECK(md_process_footnote_def(ctx, def));
+    }
+
+    MD_LEAVE_BLOCK(MD_BLOCK_FOOTNOTE_DEF_SECTION, NULL);
+
+abort:
+    return ret;
+}
+
+/* With MD_FLAG_EARLYBLOCKEMISSION, this is called whenever no block is
+ * open on the top level, i.e. when nothing which follows may change the blocks
+ * collected so far, and it emits them.
+ *
+ * Before that, we have to add any definitions seen since the last time to
+ * the label hash tables. That is incremental (amortized constant time per
+ * definition), so we can afford to do it every time.
+ */
+static int
+md_process_early_blocks(MD_CTX* ctx, OFF off)
+{
+    MD_STATS_MARK stats_mark;
+    int ret = 0;
+
+    /* When the blocks are processed by parallel jobs, it makes sense only
+     * for large enough batches of them. */
+    if(ctx->keep_jobs_pending  &&  off - ctx->early_emission_off < MD_PARALLEL_JOB_SIZE)
+        return 0;
+
+    if(ctx->ref_def_hashtable.n_hashed_defs != ctx->ref_def_hashtable.n_defs  ||
+       ctx->footnote_hashtable.n_hashed_defs != ctx->footnote_hashtable.n_defs)
+    {
+        MD_STATS_ENTER(stats_mark);
+        MD_CHECK(md_build_ref_def_hashtable(ctx));
+        if(ctx->parser.flags & MD_FLAG_FOOTNOTES)
+            MD_CHECK(md_build_footnote_def_hashtable(ctx));
+        MD_STATS_LEAVE(stats_mark, time_label_tables);
+    }
+
+    MD_STATS_ENTER(stats_mark);
+    MD_CHECK(md_process_all_blocks(ctx));
+    MD_STATS_LEAVE(stats_mark, time_block_emission);
+    ctx->early_emission_off = off;
+
+abort:
+    return ret;
+}
+
+/* State of the line-by-line analysis, so that md_analyze_lines() may continue
+ * where it has stopped when more input becomes available (see
+ * MD_PARSER_STREAM). */
+typedef struct MD_LINE_LOOP_tag MD_LINE_LOOP;
+struct MD_LINE_LOOP_tag {
+    const MD_LINE_ANALYSIS* pivot_line;
+    MD_LINE_ANALYSIS* line;
+    MD_LINE_ANALYSIS line_buf[2];
+    OFF off;
+
+    /* With MD_FLAG_EARLYBLOCKEMISSION, the last top-level boundary where
+     * no block has been pending, i.e. where everything before it has been
+     * emitted, and what is needed to restart the analysis from there. (The
+     * pivot line is always the dummy blank line there.) */
+    OFF restart_off;
+    unsigned restart_n_ref_defs;
+    unsigned restart_n_footnote_defs;
+    int restart_last_line_has_list_loosening_effect;
+    int restart_last_list_item_starts_with_two_blank_lines;
+};
+
+static void
+md_init_line_loop(MD_LINE_LOOP* loop, OFF off)
+{
+    memset(loop, 0, sizeof(MD_LINE_LOOP));
+    loop->pivot_line = &md_dummy_blank_line;
+    loop->line = &loop->line_buf[0];
+    loop->off = off;
+    loop->restart_off = off;
+}
+
+/* Analyze lines from loop->off up to ctx->size. (Unless it is the end of the
+ * document, ctx->size has to be at the end of a line.) With
+ * MD_FLAG_EARLYBLOCKEMISSION, the blocks are emitted as soon as possible. */
+static int
+md_analyze_lines(MD_CTX* ctx, MD_LINE_LOOP* loop)
+{
+    int ret = 0;
+
+    while(loop->off < ctx->size) {
+        if(loop->line == loop->pivot_line)
+            loop->line = (loop->line == &loop->line_buf[0] ? &loop->line_buf[1] : &loop->line_buf[0]);
+
+        MD_CHECK(md_analyze_line(ctx, loop->off, &loop->off, loop->pivot_line, loop->line));
+        MD_CHECK(md_process_line(ctx, &loop->pivot_line, loop->line));
+
+        if((ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION)  &&
+           ctx->current_block == NULL  &&  ctx->n_containers == 0)
+        {
+            if(ctx->n_block_bytes > 0)
+                MD_CHECK(md_process_early_blocks(ctx, loop->off));
+
+            if(ctx->n_block_bytes == 0) {
+                MD_ASSERT(loop->pivot_line == &md_dummy_blank_line);
+                loop->restart_off = loop->off;
+                loop->restart_n_ref_defs = ctx->ref_def_hashtable.n_defs;
+                loop->restart_n_footnote_defs = ctx->footnote_hashtable.n_defs;
+                loop->restart_last_line_has_list_loosening_effect = ctx->last_line_has_list_loosening_effect;
+                loop->restart_last_list_item_starts_with_two_blank_lines = ctx->last_list_item_starts_with_two_blank_lines;
+            }
+        }
+    }
+
+abort:
+    return ret;
+}
+
+/* Analyze lines from beg, which has to be a top-level boundary in the sense
+ * of md_process_early_blocks(), up to the next such boundary (or the end of
+ * the document). Blank lines do not count, so the analyzed range always has
+ * some contents unless it is at the end of the document.
+ *
+ * This is used by the incremental parsing API.
+ */
+static int
+md_analyze_top_level_chunk(MD_CTX* ctx, OFF beg, OFF* p_end)
+{
+    const MD_LINE_ANALYSIS* pivot_line = &md_dummy_blank_line;
+    MD_LINE_ANALYSIS line_buf[2];
+    MD_LINE_ANALYSIS* line = &line_buf[0];
+    OFF off = beg;
+    int has_contents = FALSE;
+    int ret = 0;
+
+    while(off < ctx->size) {
+        if(line == pivot_line)
+            line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
+
+        MD_CHECK(md_analyze_line(ctx, off, &off, pivot_line, line));
+        MD_CHECK(md_process_line(ctx, &pivot_line, line));
+
+        if(line->type != MD_LINE_BLANK)
+            has_contents = TRUE;
+        if(has_contents  &&  ctx->current_block == NULL  &&  ctx->n_containers == 0)
+            break;
+    }
+
+    if(off >= ctx->size) {
+        MD_CHECK(md_end_current_block(ctx));
+        MD_CHECK(md_leave_child_containers(ctx, 0));
+    }
+
+    *p_end = off;
+
+abort:
+    return ret;
+}
+
+
+
+/*******************************************
+ ***  Parallel Analysis of Block Structure  ***
+ *******************************************/
+
+/* With MD_PARSER::executor, large documents are split into chunks which are
+ * analyzed by concurrent jobs, each with its own MD_CTX. A chunk begins at
+ * a line which follows a blank line and which is not indented. If the
+ * analysis of the preceding chunk then ends with no block and no container
+ * open (which is typical but not guaranteed; the split may be e.g. inside a
+ * fenced code block or between two items of a loose list), the state of the
+ * parser at the chunk start is the same as at the start of a document, and
+ * the chunk can be analyzed independently.
+ *
+ * The main thread then appends results of each chunk (its block bytes and
+ * any link reference and footnote definitions) in the document order. So
+ * the first definition of a label still wins.
+ *
+ * If the analysis of a chunk does not end in the required state, the main
+ * thread discards it and analyzes the document by itself up to the start of
+ * some following chunk where the state is fine again.
+ */
+
+/* Roughly, how much input text each job gets. */
+#define MD_PARALLEL_SCAN_CHUNK_SIZE     (1024 * 1024)
+
+typedef struct MD_SCAN_JOB_tag MD_SCAN_JOB;
+struct MD_SCAN_JOB_tag {
+    MD_CTX ctx;
+    OFF beg;
+    OFF end;
+    void* handle;           /* From MD_EXECUTOR::submit(), or NULL. */
+    int ret;
+    int ends_at_top_level;  /* Nothing is open at the chunk end. */
+};
+
+/* Find the end of a chunk starting at the offset beg, i.e. the start of the
+ * next one. Returns ctx->size if there is none. */
+static OFF
+md_find_scan_chunk_end(MD_CTX* ctx, OFF beg)
+{
+    OFF off;
+    int prev_is_blank = FALSE;
+
+    if(ctx->size - beg <= MD_PARALLEL_SCAN_CHUNK_SIZE)
+        return ctx->size;
+    off = beg + MD_PARALLEL_SCAN_CHUNK_SIZE;
+
+    /* Skip to the start of the next line. */
+    while(off < ctx->size  &&  !ISNEWLINE(off))
+        off++;
+
+    while(off < ctx->size) {
+        OFF line_beg;
+
+        /* Eat the line break. */
+        if(CH(off) == _T('\r')  &&  off+1 < ctx->size  &&  CH(off+1) == _T('\n'))
+            off++;
+        off++;
+
+        line_beg = off;
+        if(prev_is_blank  &&  line_beg < ctx->size  &&  !ISWHITESPACE(line_beg))
+            return line_beg;
+
+        while(off < ctx->size  &&  ISBLANK(off))
+            off++;
+        prev_is_blank = (off >= ctx->size  ||  ISNEWLINE(off));
+        while(off < ctx->size  &&  !ISNEWLINE(off))
+            off++;
+    }
+
+    return ctx->size;
+}
+
+static void
+md_scan_job_run(void* arg)
+{
+    MD_SCAN_JOB* job = (MD_SCAN_JOB*) arg;
+    MD_CTX* ctx = &job->ctx;
+    const MD_LINE_ANALYSIS* pivot_line = &md_dummy_blank_line;
+    MD_LINE_ANALYSIS line_buf[2];
+    MD_LINE_ANALYSIS* line = &line_buf[0];
+    OFF off = job->beg;
+    int ret = 0;
+
+    while(off < job->end) {
+        if(line == pivot_line)
+            line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
+
+        MD_CHECK(md_analyze_line(ctx, off, &off, pivot_line, line));
+        MD_CHECK(md_process_line(ctx, &pivot_line, line));
+    }
+
+    if(job->end >= ctx->size) {
+        MD_CHECK(md_end_current_block(ctx));
+        MD_CHECK(md_leave_child_containers(ctx, 0));
+    }
+
+    job->ends_at_top_level = (ctx->current_block == NULL  &&  ctx->n_containers == 0);
+
+abort:
+    job->ret = ret;
+}
+
+static int
+md_submit_scan_job(MD_CTX* ctx, MD_SCAN_JOB* job, OFF beg, OFF end)
+{
+    const MD_EXECUTOR* executor = ctx->parser.executor;
+
+    md_init_ctx(&job->ctx, &ctx->parser);
+    job->ctx.parser.debug_log = NULL;   /* Not to be called from other threads. */
+    job->ctx.parser.executor = NULL;
+    job->ctx.parser.stats = NULL;
+    job->ctx.parser.block_profiler = NULL;
+    /* The definitions found by the job are merged into our tables together
+     * with their hashes. */
+    job->ctx.label_hash_seed = ctx->label_hash_seed;
+    md_setup_doc(&job->ctx, ctx->text, ctx->size, NULL);
+    job->beg = beg;
+    job->end = end;
+    job->ret = 0;
+    job->ends_at_top_level = FALSE;
+
+    job->handle = executor->submit(md_scan_job_run, job, executor->data);
+    if(job->handle == NULL)
+        md_scan_job_run(job);
+    return 0;
+}
+
+static void
+md_release_scan_job(MD_CTX* ctx, MD_SCAN_JOB* job)
+{
+    if(job->handle != NULL) {
+        ctx->parser.executor->wait(job->handle, ctx->parser.executor->data);
+        job->handle = NULL;
+    }
+
+    md_free_ref_defs(&job->ctx);
+    md_free_footnote_defs(&job->ctx);
+    md_free_ctx_buffers(&job->ctx);
+}
+
+static int
+md_append_label_defs(MD_CTX* ctx, MD_LABEL_HASH_TABLE* dst, MD_LABEL_HASH_TABLE* src)
+{
+    unsigned i;
+
+    for(i = 0; i < src->n_defs; i++) {
+        const MD_LABEL_HASH_ENTRY* src_def = (const MD_LABEL_HASH_ENTRY*)
+                    ((char*)src->defs + i * src->def_size);
+        void* dst_def;
+
+        dst_def = md_add_label_def(ctx, dst, src_def->label, src_def->label_size);
+        if(dst_def == NULL)
+            return -1;
+        memcpy(dst_def, src_def, src->def_size);
+    }
+
+    return 0;
+}
+
+/* Move all results of the job into ctx. (The job then only needs
+ * md_release_scan_job().) */
+static int
+md_adopt_scan_job(MD_CTX* ctx, MD_SCAN_JOB* job)
+{
+    MD_CTX* job_ctx = &job->ctx;
+    int ret = 0;
+
+    if(job_ctx->n_block_bytes > 0) {
+        if(ctx->n_block_bytes + job_ctx->n_block_bytes > ctx->alloc_block_bytes) {
+            int new_alloc = ctx->n_block_bytes + job_ctx->n_block_bytes;
+            void* new_block_bytes;
+
+            new_alloc += new_alloc / 2;
+            new_block_bytes = md_realloc(ctx, ctx->block_bytes, new_alloc);
+            if(new_block_bytes == NULL) {
+                MD_LOG("realloc() failed.");
+                ret = -1;
+                goto abort;
+            }
+
+            ctx->block_bytes = new_block_bytes;
+            ctx->alloc_block_bytes = new_alloc;
+            MD_STATS_INC(block_bytes_reallocs);
+        }
+
+        memcpy((char*)ctx->block_bytes + ctx->n_block_bytes, job_ctx->block_bytes, job_ctx->n_block_bytes);
+        ctx->n_block_bytes += job_ctx->n_block_bytes;
+    }
+
+    /* md_process_all_blocks() relies on ctx->containers being large enough
+     * for the deepest nesting of the containers. */
+    if(job_ctx->alloc_containers > ctx->alloc_containers) {
+        MD_CONTAINER* new_containers;
+
+        new_containers = (MD_CONTAINER*) md_realloc(ctx, ctx->containers,
+                    job_ctx->alloc_containers * sizeof(MD_CONTAINER));
+        if(new_containers == NULL) {
+            MD_LOG("realloc() failed.");
+            ret = -1;
+            goto abort;
+        }
+
+        ctx->containers = new_containers;
+        ctx->alloc_containers = job_ctx->alloc_containers;
+        MD_STATS_INC(containers_reallocs);
+    }
+
+    /* The definitions (e.g. their titles) may refer to memory allocated by
+     * the job, so we take ownership of it. */
+    MD_CHECK(md_append_label_defs(ctx, &ctx->ref_def_hashtable, &job_ctx->ref_def_hashtable));
+    job_ctx->ref_def_hashtable.n_defs = 0;
+    MD_CHECK(md_append_label_defs(ctx, &ctx->footnote_hashtable, &job_ctx->footnote_hashtable));
+    job_ctx->footnote_hashtable.n_defs = 0;
+
+    if(md_uses_arena(job_ctx)  &&  job_ctx->arena_blocks != NULL) {
+        MD_ARENA_HEADER* tail = (MD_ARENA_HEADER*) job_ctx->arena_blocks;
+
+        while(tail->next != NULL)
+            tail = (MD_ARENA_HEADER*) tail->next;
+        tail->next = ctx->arena_blocks;
+        ctx->arena_blocks = job_ctx->arena_blocks;
+
+        /* Everything the job has allocated lives there now. */
+        memset(job_ctx, 0, sizeof(MD_CTX));
+    }
+
+abort:
+    return ret;
+}
+
+/* Analyze the block structure of the whole document, as the main loop of
+ * md_process_doc() does (without MD_FLAG_EARLYBLOCKEMISSION), including
+ * closing of all the blocks and containers at its end. */
+static int
+md_analyze_doc_in_parallel(MD_CTX* ctx)
+{
+    const MD_LINE_ANALYSIS* pivot_line;
+    MD_LINE_ANALYSIS line_buf[2];
+    MD_LINE_ANALYSIS* line = &line_buf[0];
+    MD_SCAN_JOB* jobs;
+    unsigned n_jobs;
+    unsigned head = 0;      /* The oldest job in flight. */
+    unsigned n_running = 0;
+    OFF next_beg = 0;       /* Start of the next chunk to submit. */
+    OFF off = 0;            /* Everything before is analyzed. */
+    int ret = 0;
+
+    n_jobs = md_executor_max_jobs(ctx->parser.executor);
+    jobs = (MD_SCAN_JOB*) md_raw_malloc(&ctx->parser, n_jobs * sizeof(MD_SCAN_JOB));
+    if(jobs == NULL) {
+        MD_LOG("malloc() failed.");
+        return -1;
+    }
+
+    while(off < ctx->size) {
+        MD_SCAN_JOB* job;
+        OFF target;
+        int is_adopted;
+
+        /* Start new jobs while we have free slots for them. */
+        while(next_beg < ctx->size  &&  n_running < n_jobs) {
+            OFF end = md_find_scan_chunk_end(ctx, next_beg);
+
+            MD_CHECK(md_submit_scan_job(ctx, &jobs[(head + n_running) % n_jobs], next_beg, end));
+            n_running++;
+            next_beg = end;
+        }
+
+        /* Take results of the oldest job if its analysis ends in the right
+         * state. */
+        job = &jobs[head];
+        MD_ASSERT(job->beg == off);
+        if(job->handle != NULL) {
+            ctx->parser.executor->wait(job->handle, ctx->parser.executor->data);
+            job->handle = NULL;
+        }
+        is_adopted = (job->ret == 0  &&  job->ends_at_top_level);
+        if(is_adopted)
+            ret = md_adopt_scan_job(ctx, job);
+        target = job->end;
+        md_release_scan_job(ctx, job);
+        head = (head + 1) % n_jobs;
+        n_running--;
+        if(ret != 0)
+            goto abort;
+        if(is_adopted) {
+            off = target;
+            continue;
+        }
+
+        /* Otherwise, analyze the chunk by ourselves. Then continue as long as
+         * we do not reach a start of a chunk at the top level. */
+        pivot_line = &md_dummy_blank_line;
+        while(TRUE) {
+            while(off < target) {
+                if(line == pivot_line)
+                    line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
+
+                MD_CHECK(md_analyze_line(ctx, off, &off, pivot_line, line));
+                MD_CHECK(md_process_line(ctx, &pivot_line, line));
+            }
+
+            if(off >= ctx->size) {
+                MD_CHECK(md_end_current_block(ctx));
+                MD_CHECK(md_leave_child_containers(ctx, 0));
+                break;
+            }
+
+            if(ctx->current_block == NULL  &&  ctx->n_containers == 0)
+                break;
+
+            /* Skip the next chunk too. */
+            if(n_running > 0) {
+                target = jobs[head].end;
+                md_release_scan_job(ctx, &jobs[head]);
+                head = (head + 1) % n_jobs;
+                n_running--;
+            } else {
+                target = md_find_scan_chunk_end(ctx, next_beg);
+                next_beg = target;
+            }
+        }
+    }
+
+abort:
+    /* On error, we still have to wait for the jobs in flight as they use
+     * our memory. */
+    while(n_running > 0) {
+        md_release_scan_job(ctx, &jobs[head]);
+        head = (head + 1) % n_jobs;
+        n_running--;
+    }
+    md_raw_free(&ctx->parser, jobs);
+    return ret;
+}
+
+/* Start the document: Reset the statistics and enter MD_BLOCK_DOC. */
+static int
+md_enter_doc(MD_CTX* ctx)
+{
+    int ret = 0;
+
+    if(ctx->parser.stats != NULL)
+        memset(ctx->parser.stats, 0, sizeof(MD_PARSE_STATS));
+
+    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+
+abort:
+    return ret;
+}
+
+/* Finish the document when all its lines have been analyzed: Process all
+ * the remaining blocks, the footnotes, and leave MD_BLOCK_DOC. */
+static int
+md_leave_doc(MD_CTX* ctx)
+{
+    MD_STATS_MARK stats_mark;
+    int ret = 0;
+
+    MD_STATS_ENTER(stats_mark);
+    MD_CHECK(md_build_ref_def_hashtable(ctx));
+    if(ctx->parser.flags & MD_FLAG_FOOTNOTES)
+        MD_CHECK(md_build_footnote_def_hashtable(ctx));
+    MD_STATS_LEAVE(stats_mark, time_label_tables);
+
+    /* Process all blocks. */
+    MD_STATS_ENTER(stats_mark);
+    MD_CHECK(md_leave_child_containers(ctx, 0));
+    MD_CHECK(md_process_all_blocks(ctx));
+
+    /* Emit footnote definitions that were referenced, in reference order. */
+    if(ctx->parser.flags & MD_FLAG_FOOTNOTES)
+        MD_CHECK(md_process_footnote_defs(ctx));
+
+    MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+    MD_STATS_LEAVE(stats_mark, time_block_emission);
+
+abort:
+    return ret;
+}
+
+static void
+md_collect_buffer_stats(MD_CTX* ctx)
+{
+    if(ctx->parser.stats != NULL) {
+        MD_PARSE_STATS* stats = ctx->parser.stats;
+
+        stats->block_bytes_size = ctx->alloc_block_bytes;
+        stats->marks_size = ctx->alloc_marks * sizeof(MD_MARK);
+        stats->containers_size = ctx->alloc_containers * sizeof(MD_CONTAINER);
+        stats->buffer_size = ctx->alloc_buffer * sizeof(MD_CHAR);
+    }
+}
+
+static int
+md_process_doc(MD_CTX *ctx)
+{
+    MD_LINE_LOOP loop;
+    MD_STATS_MARK stats_mark;
+    int ret = 0;
+
+    MD_CHECK(md_enter_doc(ctx));
+
+    MD_STATS_ENTER(stats_mark);
+    if(ctx->parser.executor != NULL  &&  !(ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION)  &&
+       ctx->size >= 2 * MD_PARALLEL_SCAN_CHUNK_SIZE)
+    {
+        MD_CHECK(md_analyze_doc_in_parallel(ctx));
+    } else {
+        /* With MD_FLAG_EARLYBLOCKEMISSION, the executor's jobs process the
+         * blocks we have emitted while we continue with the analysis. */
+        ctx->keep_jobs_pending = (ctx->parser.executor != NULL  &&
+                    (ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION));
 
-                html_block_type = md_is_html_block_end_condition(ctx, off, &off);
-                if(html_block_type > 0) {
-                    MD_ASSERT(html_block_type == ctx->html_block_type);
+        md_init_line_loop(&loop, 0);
+        MD_CHECK(md_analyze_lines(ctx, &loop));
 
-                    /* Make sure this is the last line of the block. */
-                    ctx->html_block_type = 0;
+        MD_CHECK(md_end_current_block(ctx));
+        ctx->keep_jobs_pending = FALSE;
+    }
+    MD_STATS_LEAVE(stats_mark, time_line_analysis);
 
-                    /* Some end conditions serve as blank lines at the same time. */
-                    if(html_block_type == 6 || html_block_type == 7) {
-                        line->type = MD_LINE_BLANK;
-                        line->indent = 0;
-                        break;
-                    }
-                }
+    MD_CHECK(md_leave_doc(ctx));
 
-                line->type = MD_LINE_HTML;
-                n_parents = ctx->n_containers;
-                break;
-            }
-        }
+abort:
+    md_collect_buffer_stats(ctx);
+    return ret;
+}
 
-        /* Check for blank line. */
-        if(off >= ctx->size  ||  ISNEWLINE(off)) {
-            if(pivot_line->type == MD_LINE_INDENTEDCODE  &&  n_parents == ctx->n_containers) {
-                line->type = MD_LINE_INDENTEDCODE;
-                if(line->indent > ctx->code_indent_offset)
-                    line->indent -= ctx->code_indent_offset;
-                else
-                    line->indent = 0;
-                ctx->last_line_has_list_loosening_effect = FALSE;
-            } else {
-                line->type = MD_LINE_BLANK;
-                ctx->last_line_has_list_loosening_effect = (n_parents > 0  &&
-                        n_brothers + n_children == 0  &&
-                        ctx->containers[n_parents-1].ch != _T('>'));
 
-    #if 1
-                /* See https://github.com/mity/md4c/issues/6
-                 *
-                 * This ugly checking tests we are in (yet empty) list item but
-                 * not its very first line (i.e. not the line with the list
-                 * item mark).
-                 *
-                 * If we are such a blank line, then any following non-blank
-                 * line which would be part of the list item actually has to
-                 * end the list because according to the specification, "a list
-                 * item can begin with at most one blank line."
-                 */
-                if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
-                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
-                {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI)
-                        ctx->last_list_item_starts_with_two_blank_lines = TRUE;
-                }
-    #endif
-            }
-            break;
-        } else {
-    #if 1
-            /* This is the 2nd half of the hack. If the flag is set (i.e. there
-             * was a 2nd blank line at the beginning of the list item) and if
-             * we would otherwise still belong to the list item, we enforce
-             * the end of the list. */
-            if(ctx->last_list_item_starts_with_two_blank_lines) {
-                if(n_parents > 0  &&  n_parents == ctx->n_containers  &&
-                   ctx->containers[n_parents-1].ch != _T('>')  &&
-                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
-                {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI) {
-                        n_parents--;
+static void
+md_copy_parser(MD_PARSER* dst, const MD_PARSER* src)
+{
+    /* With abi_version == 0, the caller's structure ends before the member
+     * MD_PARSER::allocator. */
+    if(src->abi_version == 0) {
+        memset(dst, 0, sizeof(MD_PARSER));
+        memcpy(dst, src, offsetof(MD_PARSER, allocator));
+    } else {
+        memcpy(dst, src, sizeof(MD_PARSER));
+    }
+}
 
-                        line->indent = total_indent;
-                        if(n_parents > 0)
-                            line->indent -= MIN(line->indent, ctx->containers[n_parents-1].contents_indent);
-                    }
-                }
+static void
+md_init_ctx(MD_CTX* ctx, const MD_PARSER* parser)
+{
+    memset(ctx, 0, sizeof(MD_CTX));
+    md_copy_parser(&ctx->parser, parser);
+    ctx->code_indent_offset = (ctx->parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
+    md_build_mark_char_map(ctx);
+    md_select_skip_to_newline(ctx);
+    ctx->label_hash_seed = md_label_hash_seed(ctx);
+}
 
-                ctx->last_list_item_starts_with_two_blank_lines = FALSE;
-            }
-    #endif
-            ctx->last_line_has_list_loosening_effect = FALSE;
-        }
+static void
+md_free_ctx_buffers(MD_CTX* ctx)
+{
+    md_free(ctx, ctx->buffer);
+    md_free(ctx, ctx->marks);
+    md_free(ctx, ctx->block_bytes);
+    md_free(ctx, ctx->containers);
+    md_arena_release(ctx);
+
+    ctx->buffer = NULL;
+    ctx->alloc_buffer = 0;
+    ctx->marks = NULL;
+    ctx->alloc_marks = 0;
+    ctx->block_bytes = NULL;
+    ctx->alloc_block_bytes = 0;
+    ctx->containers = NULL;
+    ctx->alloc_containers = 0;
+}
 
-        /* Check whether we are Setext underline. */
-        if(line->indent < ctx->code_indent_offset  &&  pivot_line->type == MD_LINE_TEXT
-            &&  off < ctx->size  &&  ISANYOF2(off, _T('='), _T('-'))
-            &&  (n_parents == ctx->n_containers))
-        {
-            unsigned level;
+/* Prepare a context initialized by md_init_ctx() for a new document. Buffers
+ * and other state which does not depend on the document (possibly left in the
+ * context by parsing a previous document) are reused. */
+static void
+md_setup_doc(MD_CTX* ctx, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_CTX tmp;
+    int i;
 
-            if(md_is_setext_underline(ctx, off, &off, &level)) {
-                line->type = MD_LINE_SETEXTUNDERLINE;
-                line->data = level;
-                break;
-            }
-        }
+    /* Reset everything but the stuff we want to reuse. */
+    memcpy(&tmp, ctx, sizeof(MD_CTX));
+    memset(ctx, 0, sizeof(MD_CTX));
+    memcpy(&ctx->parser, &tmp.parser, sizeof(MD_PARSER));
+    memcpy(ctx->mark_char_map, tmp.mark_char_map, sizeof(ctx->mark_char_map));
+    ctx->skip_non_mark_chars = tmp.skip_non_mark_chars;
+    ctx->skip_to_newline = tmp.skip_to_newline;
+#ifdef MD_X86_SIMD
+    memcpy(ctx->mark_char_nibble_map, tmp.mark_char_nibble_map, sizeof(ctx->mark_char_nibble_map));
+#endif
+    ctx->code_indent_offset = tmp.code_indent_offset;
+    ctx->label_hash_seed = tmp.label_hash_seed;
+    ctx->buffer = tmp.buffer;
+    ctx->alloc_buffer = tmp.alloc_buffer;
+    ctx->marks = tmp.marks;
+    ctx->alloc_marks = tmp.alloc_marks;
+    ctx->block_bytes = tmp.block_bytes;
+    ctx->alloc_block_bytes = tmp.alloc_block_bytes;
+    ctx->containers = tmp.containers;
+    ctx->alloc_containers = tmp.alloc_containers;
+
+    /* Setup the document. */
+    ctx->text = text;
+    ctx->size = size;
+    ctx->userdata = userdata;
+    ctx->doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
+    ctx->ref_def_hashtable.def_size = sizeof(MD_REF_DEF);
+    ctx->ref_def_hashtable.hash_seed = ctx->label_hash_seed;
+    ctx->max_ref_def_output = md_max_ref_def_output(size);
+    ctx->footnote_hashtable.def_size = sizeof(MD_FOOTNOTE_DEF);
+    ctx->footnote_hashtable.hash_seed = ctx->label_hash_seed;
 
-        /* Check for thematic break line. */
-        if(line->indent < ctx->code_indent_offset
-            &&  off < ctx->size  &&  off >= hr_killer
-            &&  ISANYOF(off, _T("-_*")))
-        {
-            if(md_is_hr_line(ctx, off, &off, &hr_killer)) {
-                line->type = MD_LINE_HR;
-                break;
-            }
-        }
+    /* Reset all mark stacks and lists. */
+    for(i = 0; i < (int) SIZEOF_ARRAY(ctx->opener_stacks); i++)
+        ctx->opener_stacks[i].top = -1;
+    ctx->ptr_stack.top = -1;
+    ctx->unresolved_link_head = -1;
+    ctx->unresolved_link_tail = -1;
+    ctx->table_cell_boundaries_head = -1;
+    ctx->table_cell_boundaries_tail = -1;
+}
 
-        /* Check for "brother" container. I.e. whether we are another list item
-         * in already started list. */
-        if(n_parents < ctx->n_containers  &&  n_brothers + n_children == 0) {
-            OFF tmp;
+/* Clean-up of what belongs to the document. */
+static void
+md_finish_doc(MD_CTX* ctx)
+{
+    md_release_jobs(ctx);
+    md_free_ref_defs(ctx);
+    md_free_footnote_defs(ctx);
 
-            if(md_is_container_mark(ctx, line->indent, off, &tmp, &container)  &&
-               md_is_container_compatible(&ctx->containers[n_parents], &container))
-            {
-                pivot_line = &md_dummy_blank_line;
+    /* The arena cannot outlive the document. */
+    if(md_uses_arena(ctx))
+        md_free_ctx_buffers(ctx);
+}
 
-                off = tmp;
+static int
+md_parse_in_ctx(MD_CTX* ctx, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    int ret;
 
-                total_indent += container.contents_indent - container.mark_indent;
-                line->indent = md_line_indentation(ctx, total_indent, off, &off);
-                total_indent += line->indent;
-                line->beg = off;
+    md_setup_doc(ctx, text, size, userdata);
+    ret = md_process_doc(ctx);
+    md_finish_doc(ctx);
 
-                /* Some of the following whitespace actually still belongs to the mark. */
-                if(off >= ctx->size || ISNEWLINE(off)) {
-                    container.contents_indent++;
-                } else if(line->indent <= ctx->code_indent_offset) {
-                    container.contents_indent += line->indent;
-                    line->indent = 0;
-                } else {
-                    container.contents_indent += 1;
-                    line->indent--;
-                }
+    return ret;
+}
 
-                ctx->containers[n_parents].mark_indent = container.mark_indent;
-                ctx->containers[n_parents].contents_indent = container.contents_indent;
 
-                n_brothers++;
-                continue;
-            }
+/********************
+ ***  Public API  ***
+ ********************/
+
+int
+md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+{
+    MD_CTX ctx;
+    int ret;
+
+    if(parser->abi_version > 1) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return -1;
+    }
+
+    md_init_ctx(&ctx, parser);
+    ret = md_parse_in_ctx(&ctx, text, size, userdata);
+    md_free_ctx_buffers(&ctx);
+
+    return ret;
+}
+
+/* Without MD_FLAG_EARLYBLOCKEMISSION, the stream just collects the document
+ * and parses it in md_parser_finish().
+ *
+ * With it, md_parser_feed() analyzes all the complete lines fed so far, and
+ * the blocks are emitted as soon as they are complete, exactly as md_parse()
+ * would emit them. The input before the last top-level boundary where nothing
+ * is pending (MD_LINE_LOOP::restart_off) is not needed anymore, except for
+ * the text of link reference and footnote definitions. So whenever the buffer
+ * gets full, we move the text of the definitions to its start (where it stays,
+ * in the document order, so it still precedes anything which follows), and
+ * then the input since the boundary. (Definitions losing to an earlier one
+ * of the same label are forgotten instead.) The offsets in the moved
+ * definitions are updated, and the analysis of the lines after the boundary
+ * is thrown away and repeated, so we do not have to update the block bytes
+ * and the containers. (The buffer grows so that the repeated work stays
+ * linear in total.)
+ */
+struct MD_PARSER_STREAM_tag {
+    MD_CTX ctx;
+    MD_LINE_LOOP loop;
+
+    /* The input we keep. ctx.text points here too, but ctx.size covers just
+     * the complete lines. */
+    MD_CHAR* text;
+    MD_SIZE size;
+    MD_SIZE alloc;
+
+    /* The text of the first n_stored_ref_defs link reference definitions
+     * and n_stored_footnote_defs footnote definitions, at the start of the
+     * text[] above. */
+    MD_SIZE n_stored;
+    unsigned n_stored_ref_defs;
+    unsigned n_stored_footnote_defs;
+
+    MD_SIZE n_fed;      /* Size of all the input so far (saturated). */
+    int ret;            /* Error from a callback, or -1. */
+};
+
+/* Make ref. definitions pointing into old_text point into new_text. */
+static void
+md_stream_move_ref_defs(MD_CTX* ctx, unsigned beg, unsigned end,
+                        const MD_CHAR* old_text, MD_CHAR* new_text)
+{
+    unsigned i;
+
+    for(i = beg; i < end; i++) {
+        MD_REF_DEF* def = &ctx->ref_def_hashtable.ref_defs[i];
+
+        if(!def->label_needs_free)
+            def->entry.label = new_text + (def->entry.label - old_text);
+        if(!def->title_needs_free)
+            def->title = new_text + (def->title - old_text);
+    }
+}
+
+static void
+md_stream_move_footnote_defs(MD_CTX* ctx, unsigned beg, unsigned end,
+                             const MD_CHAR* old_text, MD_CHAR* new_text)
+{
+    unsigned i;
+
+    for(i = beg; i < end; i++) {
+        MD_FOOTNOTE_DEF* def = &ctx->footnote_hashtable.footnote_defs[i];
+
+        def->entry.label = new_text + (def->entry.label - old_text);
+    }
+}
+
+/* Get the range of the input holding the definition. */
+static void
+md_stream_ref_def_range(MD_CTX* ctx, const MD_REF_DEF* def, OFF* p_beg, OFF* p_end)
+{
+    OFF beg = def->dest_beg;
+    OFF end = def->dest_end;
+
+    if(!def->label_needs_free) {
+        beg = MIN(beg, (OFF) (def->entry.label - ctx->text));
+        end = MAX(end, (OFF) (def->entry.label - ctx->text) + def->entry.label_size);
+    }
+    if(!def->title_needs_free) {
+        beg = MIN(beg, (OFF) (def->title - ctx->text));
+        end = MAX(end, (OFF) (def->title - ctx->text) + def->title_size);
+    }
+
+    *p_beg = beg;
+    *p_end = end;
+}
+
+static void
+md_stream_footnote_def_range(MD_CTX* ctx, const MD_FOOTNOTE_DEF* def, OFF* p_beg, OFF* p_end)
+{
+    /* The label precedes the contents. */
+    *p_beg = (OFF) (def->entry.label - ctx->text);
+    *p_end = (def->n_content_lines > 0
+                ? def->content_lines[def->n_content_lines - 1].end
+                : *p_beg + def->entry.label_size);
+}
+
+/* Move the range [beg, end) of the old buffer to the end of the stored
+ * definitions in the new one (which may be the same buffer) and return how
+ * far it has moved. */
+static OFF
+md_stream_store_range(MD_PARSER_STREAM* stream, MD_CHAR* new_text, OFF beg, OFF end)
+{
+    MD_CTX* ctx = &stream->ctx;
+    OFF delta = beg - stream->n_stored;
+
+    MD_UNUSED(ctx);
+    MD_ASSERT(beg >= stream->n_stored);
+    memmove(new_text + stream->n_stored, stream->text + beg, (end - beg) * sizeof(MD_CHAR));
+    stream->n_stored += end - beg;
+    return delta;
+}
+
+/* Forget the definitions from defs[beg] on which lose to an earlier one with
+ * the same label: Nothing can ever use them, so we do not need to store their
+ * text. */
+static int
+md_stream_forget_duplicate_ref_defs(MD_CTX* ctx, unsigned beg)
+{
+    MD_LABEL_HASH_TABLE* table = &ctx->ref_def_hashtable;
+    unsigned i, n;
+    int ret = 0;
+
+    MD_CHECK(md_build_ref_def_hashtable(ctx));
+
+    /* Free the losers and mark them with NULL label first. (The lookup would
+     * not work anymore once we start moving the defs.) */
+    n = beg;
+    for(i = beg; i < table->n_defs; i++) {
+        MD_REF_DEF* def = &table->ref_defs[i];
+
+        if(md_lookup_ref_def(ctx, def->entry.label, def->entry.label_size) == def) {
+            n++;
+            continue;
         }
 
-        /* Check for indented code.
-         * Note indented code block cannot interrupt a paragraph. */
-        if(line->indent >= ctx->code_indent_offset  &&  (pivot_line->type != MD_LINE_TEXT)) {
-            line->type = MD_LINE_INDENTEDCODE;
-            line->indent -= ctx->code_indent_offset;
-            line->data = 0;
-            break;
+        if(def->label_needs_free)
+            md_free(ctx, (void*) def->entry.label);
+        if(def->title_needs_free)
+            md_free(ctx, def->title);
+        def->entry.label = NULL;
+    }
+
+    if(n == table->n_defs)
+        return 0;
+
+    n = beg;
+    for(i = beg; i < table->n_defs; i++) {
+        if(table->ref_defs[i].entry.label != NULL)
+            table->ref_defs[n++] = table->ref_defs[i];
+    }
+    table->n_defs = n;
+
+    /* The slots refer to the defs by index. */
+    md_free_label_hashtable(ctx, table);
+    MD_CHECK(md_build_ref_def_hashtable(ctx));
+
+abort:
+    return ret;
+}
+
+static int
+md_stream_forget_duplicate_footnote_defs(MD_CTX* ctx, unsigned beg)
+{
+    MD_LABEL_HASH_TABLE* table = &ctx->footnote_hashtable;
+    unsigned i, n;
+    int ret = 0;
+
+    MD_CHECK(md_build_footnote_def_hashtable(ctx));
+
+    n = beg;
+    for(i = beg; i < table->n_defs; i++) {
+        MD_FOOTNOTE_DEF* def = &table->footnote_defs[i];
+
+        if(md_lookup_footnote_def(ctx, def->entry.label, def->entry.label_size) == def) {
+            n++;
+            continue;
         }
 
-        /* Check for start of a new container block. */
-        if(line->indent < ctx->code_indent_offset  &&
-           md_is_container_mark(ctx, line->indent, off, &off, &container))
-        {
-            if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
-                        (off >= ctx->size || ISNEWLINE(off))  &&  container.ch != _T('>'))
-            {
-                /* Noop. List mark followed by a blank line cannot interrupt a paragraph. */
-            } else if(pivot_line->type == MD_LINE_TEXT  &&  n_parents == ctx->n_containers  &&
-                        ISANYOF2_(container.ch, _T('.'), _T(')'))  &&  container.start != 1)
-            {
-                /* Noop. Ordered list cannot interrupt a paragraph unless the start index is 1. */
-            } else {
-                total_indent += container.contents_indent - container.mark_indent;
-                line->indent = md_line_indentation(ctx, total_indent, off, &off);
-                total_indent += line->indent;
+        md_free(ctx, def->content_lines);
+        def->entry.label = NULL;
+    }
 
-                line->beg = off;
-                line->data = container.ch;
+    if(n == table->n_defs)
+        return 0;
 
-                /* Some of the following whitespace actually still belongs to the mark. */
-                if(off >= ctx->size || ISNEWLINE(off)) {
-                    container.contents_indent++;
-                } else if(line->indent <= ctx->code_indent_offset) {
-                    container.contents_indent += line->indent;
-                    line->indent = 0;
-                } else {
-                    container.contents_indent += 1;
-                    line->indent--;
-                }
+    n = beg;
+    for(i = beg; i < table->n_defs; i++) {
+        if(table->footnote_defs[i].entry.label != NULL)
+            table->footnote_defs[n++] = table->footnote_defs[i];
+    }
+    table->n_defs = n;
 
-                if(n_brothers + n_children == 0)
-                    pivot_line = &md_dummy_blank_line;
+    md_free_label_hashtable(ctx, table);
+    MD_CHECK(md_build_footnote_def_hashtable(ctx));
 
-                if(n_children == 0)
-                    MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+abort:
+    return ret;
+}
 
-                n_children++;
-                MD_CHECK(md_push_container(ctx, &container));
-                continue;
-            }
-        }
+/* Move what we keep from the input into new_text (which may be the same
+ * buffer as stream->text): The stored definitions, the definitions before
+ * stream->loop.restart_off, and everything after it. Then restart the line
+ * analysis from there. */
+static int
+md_stream_drop_input(MD_PARSER_STREAM* stream, MD_CHAR* new_text)
+{
+    MD_CTX* ctx = &stream->ctx;
+    MD_LINE_LOOP* loop = &stream->loop;
+    unsigned i_ref = stream->n_stored_ref_defs;
+    unsigned i_fn = stream->n_stored_footnote_defs;
+    OFF delta;
+    int ret = 0;
 
-        /* Check whether we are table continuation. */
-        if(pivot_line->type == MD_LINE_TABLE  &&  n_parents == ctx->n_containers) {
-            line->type = MD_LINE_TABLE;
-            break;
-        }
+    /* Definitions after the boundary are to be found again. */
+    md_truncate_ref_defs(ctx, loop->restart_n_ref_defs);
+    md_truncate_footnote_defs(ctx, loop->restart_n_footnote_defs);
 
-        /* Check for ATX header. */
-        if(line->indent < ctx->code_indent_offset  &&
-                off < ctx->size  &&  CH(off) == _T('#'))
-        {
-            unsigned level;
+    if(ctx->ref_def_hashtable.n_defs > i_ref)
+        MD_CHECK(md_stream_forget_duplicate_ref_defs(ctx, i_ref));
+    if(ctx->footnote_hashtable.n_defs > i_fn)
+        MD_CHECK(md_stream_forget_duplicate_footnote_defs(ctx, i_fn));
 
-            if(md_is_atxheader_line(ctx, off, &line->beg, &off, &level)) {
-                line->type = MD_LINE_ATXHEADER;
-                line->data = level;
-                break;
-            }
-        }
+    if(new_text != stream->text) {
+        memcpy(new_text, stream->text, stream->n_stored * sizeof(MD_CHAR));
+        md_stream_move_ref_defs(ctx, 0, i_ref, stream->text, new_text);
+        md_stream_move_footnote_defs(ctx, 0, i_fn, stream->text, new_text);
+    }
 
-        /* Check whether we are starting code fence. */
-        if(line->indent < ctx->code_indent_offset  &&
-                off < ctx->size  &&  ISANYOF2(off, _T('`'), _T('~')))
+    /* Append the new definitions to the stored ones, in the document order
+     * (so a range never overwrites one which is still to be moved). */
+    while(i_ref < ctx->ref_def_hashtable.n_defs  ||  i_fn < ctx->footnote_hashtable.n_defs) {
+        OFF ref_beg = 0, ref_end = 0;
+        OFF fn_beg = 0, fn_end = 0;
+
+        if(i_ref < ctx->ref_def_hashtable.n_defs)
+            md_stream_ref_def_range(ctx, &ctx->ref_def_hashtable.ref_defs[i_ref], &ref_beg, &ref_end);
+        if(i_fn < ctx->footnote_hashtable.n_defs)
+            md_stream_footnote_def_range(ctx, &ctx->footnote_hashtable.footnote_defs[i_fn], &fn_beg, &fn_end);
+
+        if(i_fn >= ctx->footnote_hashtable.n_defs  ||
+           (i_ref < ctx->ref_def_hashtable.n_defs  &&  ref_beg < fn_beg))
         {
-            if(md_is_opening_code_fence(ctx, off, &off)) {
-                line->type = MD_LINE_FENCEDCODE;
-                line->data = 1;
-                line->enforce_new_block = TRUE;
-                break;
+            MD_REF_DEF* def = &ctx->ref_def_hashtable.ref_defs[i_ref];
+
+            delta = md_stream_store_range(stream, new_text, ref_beg, ref_end);
+            def->dest_beg -= delta;
+            def->dest_end -= delta;
+            if(!def->label_needs_free)
+                def->entry.label = new_text + (def->entry.label - stream->text) - delta;
+            if(!def->title_needs_free)
+                def->title = new_text + (def->title - stream->text) - delta;
+            i_ref++;
+        } else {
+            MD_FOOTNOTE_DEF* def = &ctx->footnote_hashtable.footnote_defs[i_fn];
+            MD_SIZE i;
+
+            delta = md_stream_store_range(stream, new_text, fn_beg, fn_end);
+            def->entry.label = new_text + (def->entry.label - stream->text) - delta;
+            for(i = 0; i < def->n_content_lines; i++) {
+                def->content_lines[i].beg -= delta;
+                def->content_lines[i].end -= delta;
             }
+            i_fn++;
         }
+    }
+    stream->n_stored_ref_defs = i_ref;
+    stream->n_stored_footnote_defs = i_fn;
 
-        /* Check for start of raw HTML block. */
-        if(off < ctx->size  &&  CH(off) == _T('<')
-            &&  !(ctx->parser.flags & MD_FLAG_NOHTMLBLOCKS))
-        {
-            ctx->html_block_type = md_is_html_block_start_condition(ctx, off);
+    /* Append the input after the boundary. */
+    delta = loop->restart_off - stream->n_stored;
+    memmove(new_text + stream->n_stored, stream->text + loop->restart_off,
+            (stream->size - loop->restart_off) * sizeof(MD_CHAR));
+    stream->text = new_text;
+    stream->size -= delta;
+    ctx->text = new_text;
+    ctx->size -= delta;
 
-            /* HTML block type 7 cannot interrupt paragraph. */
-            if(ctx->html_block_type == 7  &&  pivot_line->type == MD_LINE_TEXT)
-                ctx->html_block_type = 0;
+    /* Restart the analysis. */
+    ctx->n_block_bytes = 0;
+    ctx->current_block = NULL;
+    ctx->n_containers = 0;
+    ctx->last_line_has_list_loosening_effect = loop->restart_last_line_has_list_loosening_effect;
+    ctx->last_list_item_starts_with_two_blank_lines = loop->restart_last_list_item_starts_with_two_blank_lines;
+    ctx->html_comment_horizon = 0;
+    ctx->html_proc_instr_horizon = 0;
+    ctx->html_decl_horizon = 0;
+    ctx->html_cdata_horizon = 0;
+    ctx->early_emission_off = (ctx->early_emission_off > delta ? ctx->early_emission_off - delta : 0);
+    md_init_line_loop(loop, stream->n_stored);
+    loop->restart_n_ref_defs = i_ref;
+    loop->restart_n_footnote_defs = i_fn;
+    loop->restart_last_line_has_list_loosening_effect = ctx->last_line_has_list_loosening_effect;
+    loop->restart_last_list_item_starts_with_two_blank_lines = ctx->last_list_item_starts_with_two_blank_lines;
 
-            if(ctx->html_block_type > 0) {
-                /* The line itself also may immediately close the block. */
-                if(md_is_html_block_end_condition(ctx, off, &off) == ctx->html_block_type) {
-                    /* Make sure this is the last line of the block. */
-                    ctx->html_block_type = 0;
-                }
+abort:
+    return ret;
+}
 
-                line->enforce_new_block = TRUE;
-                line->type = MD_LINE_HTML;
-                break;
-            }
-        }
+/* Make room for at least size more chars in the buffer. */
+static int
+md_stream_reserve(MD_PARSER_STREAM* stream, MD_SIZE size)
+{
+    MD_CTX* ctx = &stream->ctx;
+    int is_early = (ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION);
+    MD_CHAR* new_text;
+    MD_SIZE new_size;
+    MD_SIZE new_alloc;
+    int ret = 0;
 
-        /* Check for table underline. */
-        if((ctx->parser.flags & MD_FLAG_TABLES)  &&  pivot_line->type == MD_LINE_TEXT
-            &&  off < ctx->size  &&  ISANYOF3(off, _T('|'), _T('-'), _T(':'))
-            &&  n_parents == ctx->n_containers)
-        {
-            unsigned col_count;
+    if(is_early) {
+        /* The jobs read the input. */
+        MD_CHECK(md_replay_jobs(ctx));
 
-            if(ctx->current_block != NULL  &&  ctx->current_block->n_lines == 1  &&
-                md_is_table_underline(ctx, off, &off, &col_count))
-            {
-                line->data = col_count;
-                line->type = MD_LINE_TABLEUNDERLINE;
-                break;
-            }
-        }
+        /* Drop what we can in place, unless there is nothing to drop. */
+        if(stream->loop.restart_off > stream->n_stored)
+            MD_CHECK(md_stream_drop_input(stream, stream->text));
 
-        /* By default, we are normal text line. */
-        line->type = MD_LINE_TEXT;
-        if(pivot_line->type == MD_LINE_TEXT  &&  n_brothers + n_children == 0) {
-            /* Lazy continuation. */
-            n_parents = ctx->n_containers;
-        }
+        /* Keep some spare room after that, or we would end up dropping
+         * just small bits all the time. */
+        if(size <= stream->alloc - stream->size  &&
+           stream->size / 2 <= stream->alloc - stream->size - size)
+            return 0;
+    }
 
-        /* Check for task mark. */
-        if((ctx->parser.flags & MD_FLAG_TASKLISTS)  &&  n_brothers + n_children > 0  &&
-           ISANYOF_(ctx->containers[ctx->n_containers-1].ch, _T("-+*.)")))
-        {
-            OFF tmp = off;
+    if(size > (MD_SIZE)(-1) - stream->size) {
+        MD_LOG("Document too large.");
+        ret = -1;
+        goto abort;
+    }
 
-            while(tmp < ctx->size  &&  tmp < off + 3  &&  ISBLANK(tmp))
-                tmp++;
-            if(tmp + 2 < ctx->size  &&  CH(tmp) == _T('[')  &&
-               ISANYOF(tmp+1, _T("xX "))  &&  CH(tmp+2) == _T(']')  &&
-               (tmp + 3 == ctx->size  ||  ISBLANK(tmp+3)  ||  ISNEWLINE(tmp+3)))
-            {
-                MD_CONTAINER* task_container = (n_children > 0 ? &ctx->containers[ctx->n_containers-1] : &container);
-                task_container->is_task = TRUE;
-                task_container->task_mark_off = tmp + 1;
-                off = tmp + 3;
-                while(off < ctx->size  &&  ISWHITESPACE(off))
-                    off++;
-                line->beg = off;
-            }
-        }
+    new_size = stream->size + size;
+    new_alloc = (new_size <= (MD_SIZE)(-1) - stream->size / 2 ? new_size + stream->size / 2 : new_size);
+    if(new_alloc < 64 * 1024)
+        new_alloc = 64 * 1024;
 
-        break;
+    new_text = (MD_CHAR*) md_raw_malloc(&ctx->parser, new_alloc * sizeof(MD_CHAR));
+    if(new_text == NULL) {
+        MD_LOG("malloc() failed.");
+        ret = -1;
+        goto abort;
     }
 
-    /* Scan for end of the line. */
-    /* Optimization: Use some loop unrolling. */
-    while(off + 3 < ctx->size  &&  !ISNEWLINE(off+0)  &&  !ISNEWLINE(off+1)
-                               &&  !ISNEWLINE(off+2)  &&  !ISNEWLINE(off+3))
-        off += 4;
-    while(off < ctx->size  &&  !ISNEWLINE(off))
-        off++;
+    if(stream->text != NULL) {
+        memcpy(new_text, stream->text, stream->size * sizeof(MD_CHAR));
+        md_stream_move_ref_defs(ctx, 0, ctx->ref_def_hashtable.n_defs, stream->text, new_text);
+        md_stream_move_footnote_defs(ctx, 0, ctx->footnote_hashtable.n_defs, stream->text, new_text);
+        md_raw_free(&ctx->parser, stream->text);
+    }
 
-    /* Set end of the line. */
-    line->end = off;
+    stream->text = new_text;
+    stream->alloc = new_alloc;
+    ctx->text = new_text;
 
-    /* But for ATX header, we should exclude the optional trailing mark. */
-    if(line->type == MD_LINE_ATXHEADER) {
-        OFF tmp = line->end;
-        while(tmp > line->beg && ISBLANK(tmp-1))
-            tmp--;
-        while(tmp > line->beg && CH(tmp-1) == _T('#'))
-            tmp--;
-        if(tmp == line->beg || ISBLANK(tmp-1) || (ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS))
-            line->end = tmp;
+abort:
+    return ret;
+}
+
+MD_PARSER_STREAM*
+md_parser_create(const MD_PARSER* parser, void* userdata)
+{
+    MD_PARSER_STREAM* stream;
+
+    if(parser->abi_version > 1) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return NULL;
     }
 
-    /* Trim trailing spaces. */
-    if(line->type != MD_LINE_INDENTEDCODE  &&  line->type != MD_LINE_FENCEDCODE  && line->type != MD_LINE_HTML) {
-        while(line->end > line->beg && ISBLANK(line->end-1))
-            line->end--;
+    stream = (MD_PARSER_STREAM*) md_raw_malloc(parser, sizeof(MD_PARSER_STREAM));
+    if(stream == NULL) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("malloc() failed.", userdata);
+        return NULL;
     }
 
-    /* Eat also the new line. */
-    if(off < ctx->size && CH(off) == _T('\r'))
-        off++;
-    if(off < ctx->size && CH(off) == _T('\n'))
-        off++;
+    md_init_ctx(&stream->ctx, parser);
+    md_setup_doc(&stream->ctx, NULL, 0, userdata);
+    md_init_line_loop(&stream->loop, 0);
+    stream->text = NULL;
+    stream->size = 0;
+    stream->alloc = 0;
+    stream->n_stored = 0;
+    stream->n_stored_ref_defs = 0;
+    stream->n_stored_footnote_defs = 0;
+    stream->n_fed = 0;
+    stream->ret = 0;
 
-    *p_end = off;
+    /* With MD_FLAG_EARLYBLOCKEMISSION, the document starts right away. */
+    if(stream->ctx.parser.flags & MD_FLAG_EARLYBLOCKEMISSION) {
+        MD_CTX* ctx = &stream->ctx;
 
-    /* If we belong to a list after seeing a blank line, the list is loose. */
-    if(prev_line_has_list_loosening_effect  &&  line->type != MD_LINE_BLANK  &&  n_parents + n_brothers > 0) {
-        MD_CONTAINER* c = &ctx->containers[n_parents + n_brothers - 1];
-        if(c->ch != _T('>')) {
-            MD_BLOCK* block = (MD_BLOCK*) (((char*)ctx->block_bytes) + c->block_byte_off);
-            block->flags |= MD_BLOCK_LOOSE_LIST;
-        }
+        stream->ret = md_enter_doc(ctx);
+        ctx->keep_jobs_pending = (ctx->parser.executor != NULL);
     }
 
-    /* Leave any containers we are not part of anymore. */
-    if(n_children == 0  &&  n_parents + n_brothers < ctx->n_containers)
-        MD_CHECK(md_leave_child_containers(ctx, n_parents + n_brothers));
+    return stream;
+}
 
-    /* Enter any container we found a mark for. */
-    if(n_brothers > 0) {
-        MD_ASSERT(n_brothers == 1);
-        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                    ctx->containers[n_parents].task_mark_off,
-                    (ctx->containers[n_parents].is_task ? CH(ctx->containers[n_parents].task_mark_off) : 0),
-                    MD_BLOCK_CONTAINER_CLOSER));
-        MD_CHECK(md_push_container_bytes(ctx, MD_BLOCK_LI,
-                    container.task_mark_off,
-                    (container.is_task ? CH(container.task_mark_off) : 0),
-                    MD_BLOCK_CONTAINER_OPENER));
-        ctx->containers[n_parents].is_task = container.is_task;
-        ctx->containers[n_parents].task_mark_off = container.task_mark_off;
+int
+md_parser_feed(MD_PARSER_STREAM* stream, const MD_CHAR* text, MD_SIZE size)
+{
+    MD_CTX* ctx = &stream->ctx;
+    MD_STATS_MARK stats_mark;
+    MD_SIZE n_fed;
+    OFF beg, off;
+    int ret = 0;
+
+    if(stream->ret != 0)
+        return stream->ret;
+
+    if(size > stream->alloc - stream->size)
+        MD_CHECK(md_stream_reserve(stream, size));
+
+    /* Only the new input, and possibly a CR just before it, may contain a new
+     * line end (unless we have not started the analysis yet, see below). */
+    beg = ctx->size;
+    if(stream->size > ctx->size  &&  stream->n_fed >= MD_REF_DEF_OUTPUT_DOC_SIZE)
+        beg = stream->size - 1;
+
+    if(size > 0) {
+        memcpy(stream->text + stream->size, text, size * sizeof(MD_CHAR));
+        stream->size += size;
     }
 
-    if(n_children > 0) {
-        /* Check for admonition tag. */
-        if((ctx->parser.flags & MD_FLAG_ADMONITIONS)  &&  n_children > 0  &&
-           ctx->containers[ctx->n_containers-1].ch == _T('>')  &&  line->type == MD_LINE_TEXT  &&
-           3 < line->end - line->beg  && line->end - line->beg < 16  &&
-           CH(line->beg) == _T('[') && CH(line->beg+1) == _T('!') && CH(line->end-1) == _T(']'))
-        {
-            unsigned i;
+    n_fed = (size <= (MD_SIZE)(-1) - stream->n_fed ? stream->n_fed + size : (MD_SIZE)(-1));
+    if(!(ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION)) {
+        stream->n_fed = n_fed;
+        return 0;
+    }
 
-            for(i = 0; i < SIZEOF_ARRAY(MD_ADMONITION_TAGS); i++) {
-                if(line->end - line->beg == md_strlen(MD_ADMONITION_TAGS[i]) + 3  &&
-                   md_ascii_case_eq(STR(line->beg+2), MD_ADMONITION_TAGS[i], line->end - line->beg - 3))
-                {
-                    ctx->containers[ctx->n_containers-1].is_admonition = TRUE;
-                    ctx->containers[ctx->n_containers-1].admonition_type = i;
-                    line->type = MD_LINE_BLANK;
-                    break;
-                }
-            }
-        }
+    /* md_parse() derives the limit from the document size. We can only do
+     * so from the input fed so far, so we start the analysis only when the
+     * limit does not grow anymore (or in md_parser_finish()). Then it is the
+     * same as md_parse() would use. */
+    ctx->max_ref_def_output += md_max_ref_def_output(n_fed) - md_max_ref_def_output(stream->n_fed);
+    stream->n_fed = n_fed;
+    if(n_fed < MD_REF_DEF_OUTPUT_DOC_SIZE)
+        return 0;
+
+    /* Find the end of the complete lines. (A CR at the very end may still be
+     * followed by LF.) */
+    off = stream->size;
+    if(off > beg  &&  stream->text[off-1] == _T('\r'))
+        off--;
+    while(off > beg  &&  !ISNEWLINE_(stream->text[off-1]))
+        off--;
+    if(off > beg)
+        ctx->size = off;
+
+    MD_STATS_ENTER(stats_mark);
+    MD_CHECK(md_analyze_lines(ctx, &stream->loop));
+    MD_STATS_LEAVE(stats_mark, time_line_analysis);
+
+abort:
+    if(ret != 0)
+        stream->ret = ret;
+    return ret;
+}
 
-        /* Enter all the child container blocks. */
-        MD_CHECK(md_enter_child_containers(ctx, n_children));
+int
+md_parser_finish(MD_PARSER_STREAM* stream)
+{
+    MD_CTX* ctx = &stream->ctx;
+    MD_STATS_MARK stats_mark;
+    int ret = stream->ret;
+
+    if(ret != 0)
+        goto abort;
+
+    if(!(ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION)) {
+        md_setup_doc(ctx, stream->text, stream->size, ctx->userdata);
+        ret = md_process_doc(ctx);
+        goto abort;
     }
 
+    ctx->size = stream->size;
+    MD_STATS_ENTER(stats_mark);
+    MD_CHECK(md_analyze_lines(ctx, &stream->loop));
+    MD_CHECK(md_end_current_block(ctx));
+    ctx->keep_jobs_pending = FALSE;
+    MD_STATS_LEAVE(stats_mark, time_line_analysis);
+
+    MD_CHECK(md_leave_doc(ctx));
+
 abort:
+    if(ctx->parser.flags & MD_FLAG_EARLYBLOCKEMISSION)
+        md_collect_buffer_stats(ctx);
+    md_parser_destroy(stream);
     return ret;
 }
 
-static int
-md_process_line(MD_CTX* ctx, const MD_LINE_ANALYSIS** p_pivot_line, MD_LINE_ANALYSIS* line)
+void
+md_parser_destroy(MD_PARSER_STREAM* stream)
 {
-    const MD_LINE_ANALYSIS* pivot_line = *p_pivot_line;
-    int ret = 0;
+    MD_CTX* ctx = &stream->ctx;
 
-    /* Blank line ends current leaf block. */
-    if(line->type == MD_LINE_BLANK) {
-        MD_CHECK(md_end_current_block(ctx));
-        *p_pivot_line = &md_dummy_blank_line;
-        return 0;
-    }
+    md_finish_doc(ctx);
+    md_free_ctx_buffers(ctx);
+    if(stream->text != NULL)
+        md_raw_free(&ctx->parser, stream->text);
+    md_raw_free(&ctx->parser, stream);
+}
 
-    if(line->enforce_new_block)
-        MD_CHECK(md_end_current_block(ctx));
 
-    /* Some line types form block on their own. */
-    if(line->type == MD_LINE_HR || line->type == MD_LINE_ATXHEADER) {
-        MD_CHECK(md_end_current_block(ctx));
+struct MD_PARSER_SESSION_tag {
+    MD_CTX ctx;
+};
 
-        /* Add our single-line block. */
-        MD_CHECK(md_start_new_block(ctx, line));
-        MD_CHECK(md_add_line_into_current_block(ctx, line));
-        MD_CHECK(md_end_current_block(ctx));
-        *p_pivot_line = &md_dummy_blank_line;
-        return 0;
-    }
+MD_PARSER_SESSION*
+md_session_create(const MD_PARSER* parser)
+{
+    MD_PARSER_SESSION* session;
 
-    /* MD_LINE_SETEXTUNDERLINE changes meaning of the current block and ends it. */
-    if(line->type == MD_LINE_SETEXTUNDERLINE) {
-        MD_ASSERT(ctx->current_block != NULL);
-        ctx->current_block->type = MD_BLOCK_H;
-        ctx->current_block->data = line->data;
-        ctx->current_block->flags |= MD_BLOCK_SETEXT_HEADER;
-        MD_CHECK(md_add_line_into_current_block(ctx, line));
-        MD_CHECK(md_end_current_block(ctx));
-        if(ctx->current_block == NULL) {
-            *p_pivot_line = &md_dummy_blank_line;
-        } else {
-            /* This happens if we have consumed all the body as link ref. defs.
-             * and downgraded the underline into start of a new paragraph block. */
-            line->type = MD_LINE_TEXT;
-            *p_pivot_line = line;
-        }
-        return 0;
-    }
+    /* Note we cannot call parser->debug_log() here as we have no userdata
+     * for it yet. */
+    if(parser->abi_version > 1)
+        return NULL;
 
-    /* MD_LINE_TABLEUNDERLINE changes meaning of the current block. */
-    if(line->type == MD_LINE_TABLEUNDERLINE) {
-        MD_ASSERT(ctx->current_block != NULL);
-        MD_ASSERT(ctx->current_block->n_lines == 1);
-        ctx->current_block->type = MD_BLOCK_TABLE;
-        ctx->current_block->data = line->data;
-        MD_ASSERT(pivot_line != &md_dummy_blank_line);
-        ((MD_LINE_ANALYSIS*)pivot_line)->type = MD_LINE_TABLE;
-        MD_CHECK(md_add_line_into_current_block(ctx, line));
-        return 0;
-    }
+    session = (MD_PARSER_SESSION*) md_raw_malloc(parser, sizeof(MD_PARSER_SESSION));
+    if(session == NULL)
+        return NULL;
 
-    /* The current block also ends if the line has different type. */
-    if(line->type != pivot_line->type)
-        MD_CHECK(md_end_current_block(ctx));
+    md_init_ctx(&session->ctx, parser);
+    return session;
+}
 
-    /* The current line may start a new block. */
-    if(ctx->current_block == NULL) {
-        MD_CHECK(md_start_new_block(ctx, line));
-        *p_pivot_line = line;
-    }
+int
+md_session_parse(MD_PARSER_SESSION* session, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    return md_parse_in_ctx(&session->ctx, text, size, userdata);
+}
 
-    /* In all other cases the line is just a continuation of the current block. */
-    MD_CHECK(md_add_line_into_current_block(ctx, line));
+void
+md_session_reset(MD_PARSER_SESSION* session)
+{
+    md_free_ctx_buffers(&session->ctx);
+}
 
-abort:
-    return ret;
+void
+md_session_destroy(MD_PARSER_SESSION* session)
+{
+    md_free_ctx_buffers(&session->ctx);
+    md_raw_free(&session->ctx.parser, session);
 }
 
-static int
-md_footnote_def_cmp_index(const void* a, const void* b)
+
+typedef struct MD_INCREMENTAL_CHUNK_tag MD_INCREMENTAL_CHUNK;
+struct MD_INCREMENTAL_CHUNK_tag {
+    OFF beg;
+    unsigned defs_hash;     /* Hash of link reference definitions in the chunk. */
+    unsigned char has_ref_defs;
+    unsigned char has_footnote_defs;
+};
+
+struct MD_INCREMENTAL_tag {
+    MD_CTX ctx;
+    SZ size;
+    MD_INCREMENTAL_CHUNK* chunks;
+    unsigned n_chunks;
+    unsigned alloc_chunks;
+};
+
+static MD_INCREMENTAL_CHUNK*
+md_incremental_push_chunk(MD_INCREMENTAL* inc, MD_INCREMENTAL_CHUNK** p_chunks,
+                          unsigned* p_n_chunks, unsigned* p_alloc_chunks)
 {
-    const MD_FOOTNOTE_DEF* da = (const MD_FOOTNOTE_DEF*) a;
-    const MD_FOOTNOTE_DEF* db = (const MD_FOOTNOTE_DEF*) b;
+    if(*p_n_chunks >= *p_alloc_chunks) {
+        MD_INCREMENTAL_CHUNK* new_chunks;
+        unsigned new_alloc_chunks;
 
-    /* Unreferenced defs (index == 0) always sort after referenced ones. */
-    if(da->index == 0  &&  db->index == 0) return 0;
-    if(da->index == 0) return +1;
-    if(db->index == 0) return -1;
-    if(da->index < db->index) return -1;
-    if(da->index > db->index) return +1;
-    return 0;
+        new_alloc_chunks = (*p_alloc_chunks > 0
+                ? *p_alloc_chunks + *p_alloc_chunks / 2
+                : 64);
+        new_chunks = (MD_INCREMENTAL_CHUNK*) md_raw_realloc(&inc->ctx.parser,
+                    *p_chunks, new_alloc_chunks * sizeof(MD_INCREMENTAL_CHUNK));
+        if(new_chunks == NULL) {
+            MD_CTX* ctx = &inc->ctx;
+            MD_LOG("realloc() failed.");
+            return NULL;
+        }
+
+        *p_chunks = new_chunks;
+        *p_alloc_chunks = new_alloc_chunks;
+    }
+
+    return &(*p_chunks)[(*p_n_chunks)++];
 }
 
+/* Analyze a chunk starting at beg, without emitting anything, and describe it
+ * in *chunk. */
 static int
-md_process_footnote_def(MD_CTX* ctx, MD_FOOTNOTE_DEF* def)
+md_incremental_scan_chunk(MD_INCREMENTAL* inc, OFF beg, MD_INCREMENTAL_CHUNK* chunk, OFF* p_end)
 {
-    MD_BLOCK_FOOTNOTE_DEF_DETAIL det;
-    MD_ATTRIBUTE_BUILD label_build = { 0 };
+    MD_CTX* ctx = &inc->ctx;
+    unsigned n_ref_defs = ctx->ref_def_hashtable.n_defs;
+    unsigned n_footnote_defs = ctx->footnote_hashtable.n_defs;
+    unsigned hash = MD_FNV1A_BASE;
+    unsigned i;
     int ret = 0;
 
-    memset(&det, 0, sizeof(MD_BLOCK_FOOTNOTE_DEF_DETAIL));
-    det.id = def->index;
-    det.ref_count = def->ref_count;
-    MD_CHECK(md_build_attribute(ctx, def->entry.label, def->entry.label_size, 0,
-                                &det.label, &label_build));
+    MD_CHECK(md_analyze_top_level_chunk(ctx, beg, p_end));
+    ctx->n_block_bytes = 0;
 
-    MD_ENTER_BLOCK(MD_BLOCK_FOOTNOTE_DEF, &det);
-    MD_CHECK(md_process_normal_block_contents(ctx, def->content_lines,
-                                              def->n_content_lines));
-    MD_LEAVE_BLOCK(MD_BLOCK_FOOTNOTE_DEF, &det);
+    for(i = n_ref_defs; i < ctx->ref_def_hashtable.n_defs; i++) {
+        const MD_REF_DEF* def = &ctx->ref_def_hashtable.ref_defs[i];
+
+        hash = md_fnv1a(hash, &def->entry.hash, sizeof(unsigned));
+        hash = md_fnv1a(hash, STR(def->dest_beg), (def->dest_end - def->dest_beg) * sizeof(CHAR));
+        hash = md_fnv1a(hash, def->title, def->title_size * sizeof(CHAR));
+    }
+
+    chunk->beg = beg;
+    chunk->defs_hash = hash;
+    chunk->has_ref_defs = (ctx->ref_def_hashtable.n_defs > n_ref_defs);
+    chunk->has_footnote_defs = (ctx->footnote_hashtable.n_defs > n_footnote_defs);
 
 abort:
-    md_free_attribute(ctx, &label_build);
     return ret;
 }
 
-/* Render footnote definitions that were actually referenced, in reference order.
- * Called from md_process_doc() after md_process_all_blocks(). */
-static int
-md_process_footnote_defs(MD_CTX* ctx)
+static unsigned
+md_incremental_defs_hash(const MD_INCREMENTAL_CHUNK* chunks, unsigned n_chunks)
 {
+    unsigned hash = MD_FNV1A_BASE;
     unsigned i;
-    int ret = 0;
 
-    if(ctx->footnote_hashtable.n_defs == 0  ||  ctx->next_footnote_index == 0)
-        return 0;
+    for(i = 0; i < n_chunks; i++) {
+        if(chunks[i].has_ref_defs)
+            hash = md_fnv1a(hash, &chunks[i].defs_hash, sizeof(unsigned));
+    }
 
-    /* Sort defs by index so we emit in reference order. */
-    qsort(ctx->footnote_hashtable.defs, ctx->footnote_hashtable.n_defs,
-          sizeof(MD_FOOTNOTE_DEF), md_footnote_def_cmp_index);
+    return hash;
+}
 
-    MD_ENTER_BLOCK(MD_BLOCK_FOOTNOTE_DEF_SECTION, NULL);
+MD_INCREMENTAL*
+md_incremental_create(const MD_PARSER* parser, void* userdata)
+{
+    MD_INCREMENTAL* inc;
 
-    for(i = 0; i < ctx->footnote_hashtable.n_defs; i++) {
-        MD_FOOTNOTE_DEF* def = &ctx->footnote_hashtable.footnote_defs[i];
-        if(def->index == 0)
-            break;
-        MD_CHECK(md_process_footnote_def(ctx, def));
+    if(parser->abi_version > 1) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return NULL;
     }
 
-    MD_LEAVE_BLOCK(MD_BLOCK_FOOTNOTE_DEF_SECTION, NULL);
+    inc = (MD_INCREMENTAL*) md_raw_malloc(parser, sizeof(MD_INCREMENTAL));
+    if(inc == NULL) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("malloc() failed.", userdata);
+        return NULL;
+    }
 
-abort:
-    return ret;
+    md_init_ctx(&inc->ctx, parser);
+    inc->ctx.parser.stats = NULL;      /* Not supported by the incremental API. */
+    inc->ctx.userdata = userdata;
+    inc->size = 0;
+    inc->chunks = NULL;
+    inc->n_chunks = 0;
+    inc->alloc_chunks = 0;
+    return inc;
 }
 
-static int
-md_process_doc(MD_CTX *ctx)
+int
+md_incremental_parse(MD_INCREMENTAL* inc, const MD_CHAR* text, MD_SIZE size)
 {
-    const MD_LINE_ANALYSIS* pivot_line = &md_dummy_blank_line;
-    MD_LINE_ANALYSIS line_buf[2];
-    MD_LINE_ANALYSIS* line = &line_buf[0];
+    MD_CTX* ctx = &inc->ctx;
+    MD_INCREMENTAL_CHUNK* chunk;
     OFF off = 0;
     int ret = 0;
 
-    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
-
-    while(off < ctx->size) {
-        if(line == pivot_line)
-            line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
+    md_setup_doc(ctx, text, size, ctx->userdata);
+    inc->size = size;
+    inc->n_chunks = 0;
 
-        MD_CHECK(md_analyze_line(ctx, off, &off, pivot_line, line));
-        MD_CHECK(md_process_line(ctx, &pivot_line, line));
+    while(off < size) {
+        chunk = md_incremental_push_chunk(inc, &inc->chunks, &inc->n_chunks, &inc->alloc_chunks);
+        if(chunk == NULL) {
+            ret = -1;
+            goto abort;
+        }
+        MD_CHECK(md_incremental_scan_chunk(inc, off, chunk, &off));
     }
 
-    md_end_current_block(ctx);
+abort:
+    if(ret != 0)
+        inc->n_chunks = 0;
+    md_finish_doc(ctx);
+    return ret;
+}
 
-    MD_CHECK(md_build_ref_def_hashtable(ctx));
-    if(ctx->parser.flags & MD_FLAG_FOOTNOTES)
-        MD_CHECK(md_build_footnote_def_hashtable(ctx));
+int
+md_incremental_update(MD_INCREMENTAL* inc, const MD_CHAR* text, MD_SIZE size,
+                      MD_OFFSET edit_beg, MD_SIZE old_size, MD_SIZE new_size,
+                      MD_INCREMENTAL_CHANGE* change)
+{
+    MD_CTX* ctx = &inc->ctx;
+    MD_INCREMENTAL_CHUNK* new_chunks = NULL;
+    unsigned n_new_chunks = 0;
+    unsigned alloc_new_chunks = 0;
+    MD_INCREMENTAL_CHUNK* chunk;
+    OFF old_end = edit_beg + old_size;
+    OFF new_end = edit_beg + new_size;
+    unsigned n_chunks;
+    unsigned n_old_chunks;
+    unsigned lo, hi, k, j, i;
+    int has_footnote_defs = FALSE;
+    OFF off;
+    int ret = 0;
 
-    /* Process all blocks. */
-    MD_CHECK(md_leave_child_containers(ctx, 0));
-    MD_CHECK(md_process_all_blocks(ctx));
+    if(edit_beg > inc->size  ||  old_size > inc->size - edit_beg  ||
+       size != inc->size - old_size + new_size  ||  new_size > size - edit_beg)
+    {
+        MD_LOG("Edit does not match the document.");
+        return -1;
+    }
 
-    /* Emit footnote definitions that were referenced, in reference order. */
-    if(ctx->parser.flags & MD_FLAG_FOOTNOTES)
-        MD_CHECK(md_process_footnote_defs(ctx));
+    if(inc->n_chunks == 0) {
+        ret = md_incremental_parse(inc, text, size);
+        change->first = 0;
+        change->n_old = 0;
+        change->n_new = inc->n_chunks;
+        return ret;
+    }
 
-    MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+    /* Find the last chunk beginning at or before the edit. Nothing before it
+     * can be affected by the edit, and it begins in a state we can resume
+     * the analysis from. */
+    lo = 0;
+    hi = inc->n_chunks - 1;
+    while(lo < hi) {
+        unsigned pivot = lo + (hi - lo + 1) / 2;
+        if(inc->chunks[pivot].beg <= edit_beg)
+            lo = pivot;
+        else
+            hi = pivot - 1;
+    }
+    k = lo;
 
-abort:
+    /* Re-analyze until we reach a boundary behind the edit which also was
+     * a boundary of an old chunk. Everything after that is the same as
+     * before, just shifted. */
+    md_setup_doc(ctx, text, size, ctx->userdata);
+    j = k + 1;
+    off = inc->chunks[k].beg;
+    while(off < size) {
+        chunk = md_incremental_push_chunk(inc, &new_chunks, &n_new_chunks, &alloc_new_chunks);
+        if(chunk == NULL) {
+            ret = -1;
+            goto abort;
+        }
+        MD_CHECK(md_incremental_scan_chunk(inc, off, chunk, &off));
 
-#if 0
-    /* Output some memory consumption statistics. */
-    {
-        char buffer[256];
-        sprintf(buffer, "Alloced %u bytes for block buffer.",
-                    (unsigned)(ctx->alloc_block_bytes));
-        MD_LOG(buffer);
+        if(off >= new_end) {
+            OFF old_off = off - new_end + old_end;
+
+            while(j < inc->n_chunks  &&  inc->chunks[j].beg < old_off)
+                j++;
+            if(j < inc->n_chunks  &&  inc->chunks[j].beg == old_off)
+                break;
+        }
+    }
+    if(off >= size)
+        j = inc->n_chunks;
+
+    change->first = k;
+    change->n_old = j - k;
+    change->n_new = n_new_chunks;
+
+    /* If the link reference definitions have changed, any chunk may render
+     * differently. */
+    if(md_incremental_defs_hash(inc->chunks + k, j - k) !=
+       md_incremental_defs_hash(new_chunks, n_new_chunks))
+        change->first = 0;
+
+    /* Footnote numbering depends on all the preceding footnote references.
+     * Keep it simple and consider everything changed if there are (or were)
+     * any footnotes at all. */
+    if(ctx->parser.flags & MD_FLAG_FOOTNOTES) {
+        for(i = 0; i < inc->n_chunks; i++) {
+            if(inc->chunks[i].has_footnote_defs)
+                has_footnote_defs = TRUE;
+        }
+        for(i = 0; i < n_new_chunks; i++) {
+            if(new_chunks[i].has_footnote_defs)
+                has_footnote_defs = TRUE;
+        }
+    }
+    if(has_footnote_defs)
+        change->first = 0;
 
-        sprintf(buffer, "Alloced %u bytes for containers buffer.",
-                    (unsigned)(ctx->alloc_containers * sizeof(MD_CONTAINER)));
-        MD_LOG(buffer);
+    /* Splice the new chunks in. */
+    n_chunks = k + n_new_chunks + (inc->n_chunks - j);
+    if(n_chunks > inc->alloc_chunks) {
+        MD_INCREMENTAL_CHUNK* tmp;
 
-        sprintf(buffer, "Alloced %u bytes for marks buffer.",
-                    (unsigned)(ctx->alloc_marks * sizeof(MD_MARK)));
-        MD_LOG(buffer);
+        tmp = (MD_INCREMENTAL_CHUNK*) md_raw_realloc(&ctx->parser, inc->chunks,
+                    n_chunks * sizeof(MD_INCREMENTAL_CHUNK));
+        if(tmp == NULL) {
+            MD_LOG("realloc() failed.");
+            ret = -1;
+            goto abort;
+        }
+        inc->chunks = tmp;
+        inc->alloc_chunks = n_chunks;
+    }
+    memmove(inc->chunks + k + n_new_chunks, inc->chunks + j,
+            (inc->n_chunks - j) * sizeof(MD_INCREMENTAL_CHUNK));
+    if(n_new_chunks > 0)
+        memcpy(inc->chunks + k, new_chunks, n_new_chunks * sizeof(MD_INCREMENTAL_CHUNK));
+    for(i = k + n_new_chunks; i < n_chunks; i++)
+        inc->chunks[i].beg = inc->chunks[i].beg - old_size + new_size;
+    n_old_chunks = inc->n_chunks;
+    inc->n_chunks = n_chunks;
+    inc->size = size;
 
-        sprintf(buffer, "Alloced %u bytes for aux. buffer.",
-                    (unsigned)(ctx->alloc_buffer * sizeof(MD_CHAR)));
-        MD_LOG(buffer);
+    if(change->first == 0) {
+        change->n_old = n_old_chunks;
+        change->n_new = n_chunks;
     }
-#endif
 
+abort:
+    if(new_chunks != NULL)
+        md_raw_free(&ctx->parser, new_chunks);
+    if(ret != 0)
+        inc->n_chunks = 0;  /* Force full re-parse next time. */
+    md_finish_doc(ctx);
     return ret;
 }
 
+unsigned
+md_incremental_chunk_count(const MD_INCREMENTAL* inc)
+{
+    return inc->n_chunks;
+}
 
-/********************
- ***  Public API  ***
- ********************/
+MD_OFFSET
+md_incremental_chunk_offset(const MD_INCREMENTAL* inc, unsigned i)
+{
+    return (i < inc->n_chunks ? inc->chunks[i].beg : inc->size);
+}
 
 int
-md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+md_incremental_render(MD_INCREMENTAL* inc, const MD_CHAR* text, MD_SIZE size,
+                      unsigned first, unsigned n)
 {
-    MD_CTX ctx;
-    int i;
-    int ret;
+    MD_CTX* ctx = &inc->ctx;
+    unsigned end;
+    unsigned i;
+    int ret = 0;
 
-    if(parser->abi_version != 0) {
-        if(parser->debug_log != NULL)
-            parser->debug_log("Unsupported abi_version.", userdata);
+    if(size != inc->size) {
+        MD_LOG("Text does not match the document.");
         return -1;
     }
 
-    /* Setup context structure. */
-    memset(&ctx, 0, sizeof(MD_CTX));
-    ctx.text = text;
-    ctx.size = size;
-    memcpy(&ctx.parser, parser, sizeof(MD_PARSER));
-    ctx.userdata = userdata;
-    ctx.code_indent_offset = (ctx.parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
-    md_build_mark_char_map(&ctx);
-    ctx.doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
-    ctx.ref_def_hashtable.def_size = sizeof(MD_REF_DEF);
-    ctx.max_ref_def_output = 16 * MIN(size, (MD_SIZE)(1024 * 1024 / 16));
-    ctx.footnote_hashtable.def_size = sizeof(MD_FOOTNOTE_DEF);
+    if(first > inc->n_chunks)
+        first = inc->n_chunks;
+    end = (n > inc->n_chunks - first ? inc->n_chunks : first + n);
 
-    /* Reset all mark stacks and lists. */
-    for(i = 0; i < (int) SIZEOF_ARRAY(ctx.opener_stacks); i++)
-        ctx.opener_stacks[i].top = -1;
-    ctx.ptr_stack.top = -1;
-    ctx.unresolved_link_head = -1;
-    ctx.unresolved_link_tail = -1;
-    ctx.table_cell_boundaries_head = -1;
-    ctx.table_cell_boundaries_tail = -1;
-
-    /* All the work. */
-    ret = md_process_doc(&ctx);
-
-    /* Clean-up. */
-    md_free_ref_defs(&ctx);
-    md_free_footnote_defs(&ctx);
-    free(ctx.buffer);
-    free(ctx.marks);
-    free(ctx.block_bytes);
-    free(ctx.containers);
+    md_setup_doc(ctx, text, size, ctx->userdata);
 
+    /* Analyze the requested chunks, and also all the other chunks with any
+     * definitions (but forget their blocks). */
+    for(i = 0; i < inc->n_chunks; i++) {
+        const MD_INCREMENTAL_CHUNK* chunk = &inc->chunks[i];
+        int n_block_bytes = ctx->n_block_bytes;
+        OFF chunk_end;
+
+        if(first <= i  &&  i < end) {
+            MD_CHECK(md_analyze_top_level_chunk(ctx, chunk->beg, &chunk_end));
+        } else if(chunk->has_ref_defs  ||  chunk->has_footnote_defs) {
+            MD_CHECK(md_analyze_top_level_chunk(ctx, chunk->beg, &chunk_end));
+            ctx->n_block_bytes = n_block_bytes;
+        }
+    }
+
+    MD_CHECK(md_build_ref_def_hashtable(ctx));
+    if(ctx->parser.flags & MD_FLAG_FOOTNOTES)
+        MD_CHECK(md_build_footnote_def_hashtable(ctx));
+
+    MD_CHECK(md_process_all_blocks(ctx));
+
+    if((ctx->parser.flags & MD_FLAG_FOOTNOTES)  &&  end == inc->n_chunks)
+        MD_CHECK(md_process_footnote_defs(ctx));
+
+abort:
+    md_finish_doc(ctx);
     return ret;
 }
+
+void
+md_incremental_destroy(MD_INCREMENTAL* inc)
+{
+    md_free_ctx_buffers(&inc->ctx);
+    if(inc->chunks != NULL)
+        md_raw_free(&inc->ctx.parser, inc->chunks);
+    md_raw_free(&inc->ctx.parser, inc);
+}
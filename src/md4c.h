@@ -26,6 +26,8 @@
 #ifndef MD4C_H
 #define MD4C_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
     extern "C" {
 #endif
@@ -389,10 +391,21 @@ typedef struct MD_BLOCK_FOOTNOTE_DEF_DETAIL {
 #define MD_FLAG_ADMONITIONS                 0x80000 /* Enable admonitions extension. */
 #define MD_FLAG_FOOTNOTES                   0x100000 /* Enable [^label] footnote references. */
 #define MD_FLAG_HIGHLIGHT                   0x200000 /* Enable ==highlight== spans. */
+#define MD_FLAG_EARLYBLOCKEMISSION          0x400000 /* Emit top-level blocks as soon as they are complete. See below. */
 
 #define MD_FLAG_PERMISSIVEAUTOLINKS         (MD_FLAG_PERMISSIVEEMAILAUTOLINKS | MD_FLAG_PERMISSIVEURLAUTOLINKS | MD_FLAG_PERMISSIVEWWWAUTOLINKS)
 #define MD_FLAG_NOHTML                      (MD_FLAG_NOHTMLBLOCKS | MD_FLAG_NOHTMLSPANS)
 
+/* MD_FLAG_EARLYBLOCKEMISSION deviates from CommonMark: Normally, the parser
+ * has to see the whole document before calling any callback for its blocks
+ * because a link reference definition (or a footnote definition) may follow
+ * the links which use it. With this flag, each top-level block is emitted
+ * as soon as the parser knows it is complete, and any definition applies only
+ * to the links which follow it in the document.
+ *
+ * This shortens the time to the first callback for large documents.
+ */
+
 /* Convenient sets of flags corresponding to well-known Markdown dialects.
  *
  * Note we may only support subset of features of the referred dialect.
@@ -405,10 +418,145 @@ typedef struct MD_BLOCK_FOOTNOTE_DEF_DETAIL {
 #define MD_DIALECT_COMMONMARK               0
 #define MD_DIALECT_GITHUB                   (MD_FLAG_PERMISSIVEAUTOLINKS | MD_FLAG_TABLES | MD_FLAG_STRIKETHROUGH | MD_FLAG_TASKLISTS | MD_FLAG_ADMONITIONS | MD_FLAG_FOOTNOTES)
 
+/* Custom memory allocator (see MD_PARSER::allocator).
+ */
+typedef struct MD_ALLOCATOR {
+    /* Callbacks with semantics of malloc(), realloc() and free(). Any of them
+     * may be NULL, in which case the respective standard function is used.
+     */
+    void* (*allocate)(size_t /*size*/, void* /*data*/);
+    void* (*reallocate)(void* /*ptr*/, size_t /*size*/, void* /*data*/);
+    void (*release)(void* /*ptr*/, void* /*data*/);
+
+    /* Propagated into the callbacks above. */
+    void* data;
+
+    /* If non-zero, md_parse() does not allocate its internal data directly via
+     * the callbacks above. Instead, it obtains from them memory blocks of
+     * (at least) this size and serves its allocations from them as from
+     * a bump-pointer arena. All the blocks are then released at once at the
+     * end of md_parse() (or md_session_parse()).
+     *
+     * This makes individual allocations very cheap, at the cost of some
+     * memory being wasted while the document is being parsed.
+     */
+    size_t arena_block_size;
+} MD_ALLOCATOR;
+
+
+/* Executor for running some parts of the parsing concurrently (see
+ * MD_PARSER::executor). MD4C itself does not create any threads; instead,
+ * it hands independent jobs to the application, e.g. to its thread pool.
+ */
+typedef struct MD_EXECUTOR {
+    /* Start job(arg) asynchronously and return a non-NULL handle identifying
+     * it. If the job cannot be started, return NULL: The parser then runs the
+     * job by itself.
+     */
+    void* (*submit)(void (*job)(void*), void* /*arg*/, void* /*data*/);
+
+    /* Wait until the job identified by the handle finishes. The handle is not
+     * used by the parser anymore after this.
+     */
+    void (*wait)(void* /*handle*/, void* /*data*/);
+
+    /* Propagated into the callbacks above. */
+    void* data;
+
+    /* Maximal count of jobs submitted and not waited for at any time (which
+     * also bounds the memory used for results the jobs have computed ahead).
+     * If zero, a default of 8 is used.
+     */
+    unsigned max_jobs;
+} MD_EXECUTOR;
+
+
+/* Statistics about parsing of a document (see MD_PARSER::stats).
+ */
+typedef struct MD_PARSE_STATS {
+    /* Wall-clock time (in seconds) spent in the individual phases of the
+     * parsing. Time spent in the callbacks counts into the phase which has
+     * called them. Nested phases do not count into the outer ones (e.g. the
+     * inline phases are not included in time_block_emission).
+     */
+    double time_line_analysis;      /* Analysis of lines into blocks. */
+    double time_label_tables;       /* Building hash tables of link reference
+                                     * definitions and footnote definitions. */
+    double time_block_emission;     /* Emitting the blocks. */
+    double time_mark_collection;    /* Collecting potential inline marks. */
+    double time_inline_analysis;    /* Resolving the marks into spans. */
+    double time_inline_emission;    /* Emitting inline contents. */
+
+    /* Sizes (in bytes) the internal buffers have grown to, and how many times
+     * they have been reallocated during the parsing.
+     */
+    size_t block_bytes_size;        /* Buffer of the analyzed blocks. */
+    size_t marks_size;              /* Buffer of the inline marks. */
+    size_t containers_size;         /* Stack of the container blocks. */
+    size_t buffer_size;             /* Temporary helper buffer. */
+    unsigned block_bytes_reallocs;
+    unsigned marks_reallocs;
+    unsigned containers_reallocs;
+    unsigned buffer_reallocs;
+
+    /* Count of the inline marks collected, and of those which have been
+     * resolved (i.e. which have ended up forming a span or some other inline
+     * construct), indexed by the mark character (e.g. '*' or '[').
+     */
+    unsigned marks_collected[128];
+    unsigned marks_resolved[128];
+} MD_PARSE_STATS;
+
+
+/* Profile of a leaf block (see MD_BLOCK_PROFILER).
+ */
+typedef struct MD_BLOCK_PROFILE {
+    /* Type of the block. */
+    MD_BLOCKTYPE type;
+
+    /* Range of the block contents in the input (in MD_CHAR units), i.e. from
+     * the start of its first line to the end of its last line. (For a fenced
+     * code block, the fences are not included. The range is empty if the
+     * block has no lines.)
+     */
+    MD_OFFSET beg;
+    MD_OFFSET end;
+    MD_SIZE n_lines;
+
+    /* Count of inline marks collected (i.e. of places which might start or
+     * end an inline construct), and count of the passes over them which
+     * resolved them into the inline constructs.
+     */
+    unsigned n_marks;
+    unsigned n_passes;
+
+    /* Wall-clock time (in seconds) spent processing the block. (This includes
+     * time spent in the callbacks called for it.)
+     */
+    double time;
+} MD_BLOCK_PROFILE;
+
+/* Profiler reporting leaf blocks which are expensive to process (see
+ * MD_PARSER::block_profiler). This helps to find out which part of a document
+ * makes its parsing slow.
+ */
+typedef struct MD_BLOCK_PROFILER {
+    /* Called for each leaf block whose processing has taken at least the
+     * threshold time (in seconds).
+     */
+    void (*slow_block)(const MD_BLOCK_PROFILE* /*profile*/, void* /*data*/);
+    double threshold;
+
+    /* Propagated into the callback above. */
+    void* data;
+} MD_BLOCK_PROFILER;
+
+
 /* Parser structure.
  */
 typedef struct MD_PARSER {
-    /* Reserved. Set to zero.
+    /* Version of this structure. Set to zero, or to 1 in order to use
+     * the members after MD_PARSER::syntax.
      */
     unsigned abi_version;
 
@@ -451,6 +599,60 @@ typedef struct MD_PARSER {
     /* Reserved. Set to NULL.
      */
     void (*syntax)(void);
+
+    /* Memory allocator. Optional (may be NULL), and used only if
+     * abi_version >= 1.
+     *
+     * If provided, all memory the parser needs is allocated through it.
+     * The structure must stay valid as long as the parser (or any
+     * MD_PARSER_STREAM or MD_PARSER_SESSION created with it) is used.
+     */
+    const MD_ALLOCATOR* allocator;
+
+    /* Executor. Optional (may be NULL), and used only if abi_version >= 1.
+     *
+     * If provided, the block structure of large documents is analyzed by
+     * multiple concurrent jobs, each processing a different part of the
+     * document (unless MD_FLAG_EARLYBLOCKEMISSION is used). Then the inline
+     * contents of the blocks (i.e. the processing of emphasis, links etc.)
+     * is analyzed by multiple concurrent jobs as well. The callbacks above
+     * are still called from the thread which called md_parse(), in the
+     * document order, with the same arguments as without the executor.
+     *
+     * With MD_FLAG_EARLYBLOCKEMISSION, the jobs process batches of the
+     * top-level blocks as soon as they are complete, while the parser
+     * continues with the analysis of the rest of the document.
+     *
+     * Note that with the executor, the allocator (if any) has to be thread-safe.
+     * Also note the parallel processing of the inline contents is suppressed
+     * when the document has any footnote definitions, as their numbering
+     * depends on the order of the references in the document.
+     */
+    const MD_EXECUTOR* executor;
+
+    /* Statistics. Optional (may be NULL), and used only if abi_version >= 1.
+     *
+     * If provided, md_parse() (as well as md_session_parse() and
+     * md_parser_finish()) resets the structure when it starts parsing
+     * a document, and fills it in during the parsing. It is not used by the
+     * incremental parsing API.
+     *
+     * With the executor, the work done by the concurrent jobs is not
+     * included. (The time the parser spends waiting for them is.)
+     */
+    MD_PARSE_STATS* stats;
+
+    /* Block profiler. Optional (may be NULL), and used only if
+     * abi_version >= 1.
+     *
+     * If provided, the parser measures processing of each leaf block (i.e.
+     * analysis of its inline contents and calling the callbacks for it), and
+     * reports the slow ones via MD_BLOCK_PROFILER::slow_block().
+     *
+     * With the executor, the blocks processed by the concurrent jobs are not
+     * reported.
+     */
+    const MD_BLOCK_PROFILER* block_profiler;
 } MD_PARSER;
 
 
@@ -471,6 +673,131 @@ typedef MD_PARSER MD_RENDERER;
 int md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
 
 
+/* Interface for input which is not available as a single contiguous buffer
+ * (e.g. when read from a pipe in chunks).
+ *
+ * Without MD_FLAG_EARLYBLOCKEMISSION, the stream merely collects the chunks,
+ * and the whole document is parsed by md_parser_finish(). (Markdown link
+ * reference definitions may follow the links which use them, so the parser
+ * cannot emit anything before the complete document is known.)
+ *
+ * With MD_FLAG_EARLYBLOCKEMISSION, this is a streaming parser: Each
+ * md_parser_feed() analyzes all the complete lines fed so far, and every
+ * top-level block is emitted (i.e. the callbacks are called) as soon as it is
+ * closed, so the caller may render the output while more input is still being
+ * read. The stream then keeps only the input since the last closed top-level
+ * block, and the text of the link reference definitions and footnote
+ * definitions seen so far (only the first one of each label). Memory from
+ * the arena (MD_ALLOCATOR::arena_block_size) is still released only at the
+ * end, though.
+ *
+ * The parser limits the output the links may generate from link reference
+ * definitions in proportion to the document size (up to the size of 64 KB),
+ * against malicious inputs. To use the same limit as md_parse() would, the
+ * stream emits nothing before it is fed 64 KB (or md_parser_finish() is
+ * called).
+ *
+ * md_parser_create() allocates a new stream. The MD_PARSER structure is
+ * copied so the caller does not need to keep it alive. NULL is returned
+ * on failure (e.g. unsupported abi_version, or out of memory). With
+ * MD_FLAG_EARLYBLOCKEMISSION, it already enters the document (MD_BLOCK_DOC).
+ *
+ * md_parser_feed() appends a chunk of the document. The chunk may end at any
+ * position, even in the middle of a line or a multi-byte character. It
+ * returns zero on success. Otherwise (-1 on error, or the value a callback
+ * has returned to abort the parsing), the stream is of no further use, and
+ * md_parser_finish() only returns the same value.
+ *
+ * md_parser_finish() parses the rest of the document and destroys the stream.
+ * Its return value has the same meaning as the one of md_parse().
+ *
+ * md_parser_destroy() destroys the stream without parsing the rest of it.
+ * (With MD_FLAG_EARLYBLOCKEMISSION, the callbacks may have been called for
+ * its beginning, but the document is then never left.)
+ */
+typedef struct MD_PARSER_STREAM_tag MD_PARSER_STREAM;
+
+MD_PARSER_STREAM* md_parser_create(const MD_PARSER* parser, void* userdata);
+int md_parser_feed(MD_PARSER_STREAM* stream, const MD_CHAR* text, MD_SIZE size);
+int md_parser_finish(MD_PARSER_STREAM* stream);
+void md_parser_destroy(MD_PARSER_STREAM* stream);
+
+
+/* Parser session, for applications which parse many documents with the same
+ * MD_PARSER settings (e.g. a lot of short user comments).
+ *
+ * Calling md_session_parse() is equivalent to calling md_parse() except
+ * that the session keeps its internal buffers and other precomputed state
+ * for the next document instead of allocating and freeing them again.
+ *
+ * md_session_create() copies the MD_PARSER structure and returns NULL on
+ * failure. md_session_parse() returns the same values as md_parse().
+ * md_session_reset() releases the memory cached in the session (e.g. after
+ * a huge document) but the session can still be used. md_session_destroy()
+ * releases the session altogether.
+ *
+ * The session must not be used by multiple threads at the same time.
+ */
+typedef struct MD_PARSER_SESSION_tag MD_PARSER_SESSION;
+
+MD_PARSER_SESSION* md_session_create(const MD_PARSER* parser);
+int md_session_parse(MD_PARSER_SESSION* session, const MD_CHAR* text, MD_SIZE size, void* userdata);
+void md_session_reset(MD_PARSER_SESSION* session);
+void md_session_destroy(MD_PARSER_SESSION* session);
+
+
+/* Incremental parsing, for editors which re-render the document as the user
+ * types.
+ *
+ * The document is split into chunks, i.e. runs of top-level blocks between
+ * which the parser carries no state (no container or leaf block spans over
+ * the boundary). After an edit, only the chunks touched by it are analyzed
+ * again, until the analysis meets an old chunk boundary again.
+ *
+ * md_incremental_parse() analyzes a whole document. It does not call any
+ * callbacks but debug_log().
+ *
+ * md_incremental_update() is then called after each edit, with the new text
+ * of the document: Bytes [edit_beg, edit_beg + old_size) of the previous text
+ * have been replaced with bytes [edit_beg, edit_beg + new_size) of the new
+ * one. On success, it fills *change with the range of chunks which have to be
+ * rendered again: MD_INCREMENTAL_CHANGE::n_old chunks starting at index
+ * MD_INCREMENTAL_CHANGE::first have been replaced with n_new new ones. If the
+ * edit changes any link reference definition (or if the document uses any
+ * footnotes when MD_FLAG_FOOTNOTES is enabled), all the chunks are reported
+ * as changed.
+ *
+ * md_incremental_render() emits the blocks of n chunks starting with the
+ * chunk first, as md_parse() would, except that MD_BLOCK_DOC is not entered
+ * or left. The footnote section is emitted only if the range includes the
+ * last chunk. (Footnote numbering is correct only if all chunks are
+ * rendered.) md_incremental_chunk_offset() returns the offset of the chunk
+ * in the text so that the application can map the output to the source.
+ *
+ * All the functions taking the text expect the same text as the last call to
+ * md_incremental_parse() or md_incremental_update(). If any of them fails,
+ * the next update re-analyzes the whole document.
+ */
+typedef struct MD_INCREMENTAL_tag MD_INCREMENTAL;
+
+typedef struct MD_INCREMENTAL_CHANGE {
+    unsigned first;
+    unsigned n_old;
+    unsigned n_new;
+} MD_INCREMENTAL_CHANGE;
+
+MD_INCREMENTAL* md_incremental_create(const MD_PARSER* parser, void* userdata);
+int md_incremental_parse(MD_INCREMENTAL* inc, const MD_CHAR* text, MD_SIZE size);
+int md_incremental_update(MD_INCREMENTAL* inc, const MD_CHAR* text, MD_SIZE size,
+                          MD_OFFSET edit_beg, MD_SIZE old_size, MD_SIZE new_size,
+                          MD_INCREMENTAL_CHANGE* change);
+unsigned md_incremental_chunk_count(const MD_INCREMENTAL* inc);
+MD_OFFSET md_incremental_chunk_offset(const MD_INCREMENTAL* inc, unsigned i);
+int md_incremental_render(MD_INCREMENTAL* inc, const MD_CHAR* text, MD_SIZE size,
+                          unsigned first, unsigned n);
+void md_incremental_destroy(MD_INCREMENTAL* inc);
+
+
 #ifdef __cplusplus
     }  /* extern "C" { */
 #endif
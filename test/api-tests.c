@@ -0,0 +1,2692 @@
+/*
+ * MD4C: Markdown parser for C
+ * (https://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2026 Martin Mitáš
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Tests of the C API which the spec test suites (driven through md2html)
+ * cannot reach.
+ *
+ * Most tests render some documents through the tested API into HTML and
+ * compare the output with what plain md_html() generates for the same
+ * document and flags.
+ *
+ * Usage: api-tests [FILTER]
+ * Only tests whose name contains FILTER are run (all of them by default).
+ * Exit code is non-zero if any test fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "md4c.h"
+#include "md4c-html.h"
+#ifdef TEST_MD4C_AST
+    #include "md4c-ast.h"
+#endif
+#ifdef TEST_MD4C_EVLOG
+    #include "md4c-evlog.h"
+#endif
+#ifdef TEST_THREADS
+    #include <pthread.h>
+#endif
+
+
+/****************
+ ***  Helpers  ***
+ ****************/
+
+/* Check the condition. If it does not hold, report it and fail the test
+ * (i.e. return -1 from the function). */
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if(!(cond)) {                                                       \
+            fprintf(stderr, "  %s:%d: check failed: %s\n",                  \
+                    __FILE__, __LINE__, #cond);                             \
+            return -1;                                                      \
+        }                                                                   \
+    } while(0)
+
+struct buffer {
+    char* data;
+    size_t size;
+    size_t asize;
+};
+
+static void
+buffer_append(struct buffer* buf, const char* data, size_t size)
+{
+    if(size == 0)
+        return;
+    if(buf->asize < buf->size + size) {
+        size_t new_asize = buf->size + buf->size / 2 + size + 64;
+
+        buf->data = (char*) realloc(buf->data, new_asize);
+        if(buf->data == NULL) {
+            fprintf(stderr, "buffer_append: realloc() failed.\n");
+            exit(1);
+        }
+        buf->asize = new_asize;
+    }
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+}
+
+static void
+buffer_fini(struct buffer* buf)
+{
+    free(buf->data);
+    buf->data = NULL;
+    buf->size = 0;
+    buf->asize = 0;
+}
+
+static void
+process_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    buffer_append((struct buffer*) userdata, text, size);
+}
+
+/* Compare the output of the tested API with the expected one. If they
+ * differ, report where. */
+static int
+check_output(const char* what, const struct buffer* expected, const struct buffer* got)
+{
+    size_t i = 0;
+
+    if(expected->size == got->size  &&  memcmp(expected->data, got->data, got->size) == 0)
+        return 0;
+
+    while(i < expected->size  &&  i < got->size  &&  expected->data[i] == got->data[i])
+        i++;
+
+    fprintf(stderr, "  %s: output differs at offset %lu (expected %lu bytes, got %lu):\n",
+            what, (unsigned long) i, (unsigned long) expected->size, (unsigned long) got->size);
+    fprintf(stderr, "    expected: \"%.40s\"\n", (i < expected->size ? expected->data + i : ""));
+    fprintf(stderr, "    got:      \"%.40s\"\n", (i < got->size ? got->data + i : ""));
+    return -1;
+}
+
+/* The reference output: plain md_html(). */
+static int
+render_reference(const char* text, size_t size, unsigned parser_flags, struct buffer* out)
+{
+    out->size = 0;
+    return md_html(text, (MD_SIZE) size, process_output, out, parser_flags, 0);
+}
+
+/* Callbacks which do nothing, for tests which are not interested in the
+ * output. */
+static int
+nop_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) type; (void) detail; (void) userdata;
+    return 0;
+}
+
+static int
+nop_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    (void) type; (void) detail; (void) userdata;
+    return 0;
+}
+
+static int
+nop_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    (void) type; (void) text; (void) size; (void) userdata;
+    return 0;
+}
+
+
+/******************
+ ***  Documents  ***
+ ******************/
+
+/* Small documents exercising various block and inline constructs. The link
+ * reference definitions follow their uses on purpose. */
+static const char* sample_docs[] = {
+    "",
+
+    "Hello *world*!\n",
+
+    "# Header\n"
+    "\n"
+    "Paragraph with **strong**, _emph_, `code` and a [link][ref].\n"
+    "Second line of the paragraph with a hard  \n"
+    "break.\n"
+    "\n"
+    "Setext header\n"
+    "-------------\n"
+    "\n"
+    "[ref]: /url \"Title\"\n",
+
+    "* tight\n"
+    "* list\n"
+    "  1. nested\n"
+    "  2. ordered\n"
+    "\n"
+    "- loose\n"
+    "\n"
+    "- list\n"
+    "\n"
+    "  > with a quote\n"
+    "  > and [foo]\n"
+    "\n"
+    "[foo]: <http://example.com/foo> 'Foo'\n",
+
+    "```c\n"
+    "int main(void) { return 0; }\n"
+    "```\n"
+    "\n"
+    "    indented\n"
+    "    code\n"
+    "\n"
+    "<div>\n"
+    "*raw* HTML\n"
+    "</div>\n"
+    "\n"
+    "Entities: &amp; &copy; &#35; &#x1F600; &bogus;\n",
+
+    "| a | b |\n"
+    "|---|:-:|\n"
+    "| 1 | ~~2~~ |\n"
+    "| [x] | www.example.com |\n"
+    "\n"
+    "- [ ] task\n"
+    "- [x] done\n",
+
+    "\xC5\x98\xC3\xAD\xC5\xA1" "e \xC4\x8D" "esk\xC3\xA9 *\xC5\xBE\xC3\xA1" "by* a "
+    "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E **\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88**\n"
+    "\n"
+    "> # Quoted header\n"
+    "> text\n"
+    "lazy continuation\n"
+    "\n"
+    "***\n"
+    "\n"
+    "[![image](/img.png)](/target)\n",
+};
+
+#define SAMPLE_DOC_COUNT    (sizeof(sample_docs) / sizeof(sample_docs[0]))
+
+/* Parser flags the sample documents are tested with. */
+static const unsigned sample_flags[] = {
+    0,
+    MD_DIALECT_GITHUB,
+    MD_DIALECT_GITHUB | MD_FLAG_EARLYBLOCKEMISSION,
+};
+
+#define SAMPLE_FLAGS_COUNT  (sizeof(sample_flags) / sizeof(sample_flags[0]))
+
+
+/* Concatenate the sample documents repeatedly, until the result has at least
+ * min_size bytes. */
+static void
+make_big_doc(struct buffer* out, size_t min_size)
+{
+    unsigned i = 0;
+
+    out->size = 0;
+    while(out->size < min_size) {
+        buffer_append(out, sample_docs[i], strlen(sample_docs[i]));
+        buffer_append(out, "\n", 1);
+        i = (i + 1) % SAMPLE_DOC_COUNT;
+    }
+}
+
+
+/*************************
+ ***  Stream Interface  ***
+ *************************/
+
+struct stream_source {
+    const char* text;
+    size_t size;
+    size_t chunk_size;
+    unsigned parser_flags;
+};
+
+/* Parse the text with MD_PARSER_STREAM, feeding it in chunks of the given
+ * size. */
+static int
+parse_via_stream(const MD_PARSER* parser, void* userdata,
+                 const char* text, size_t size, size_t chunk_size)
+{
+    MD_PARSER_STREAM* stream;
+    size_t off;
+
+    stream = md_parser_create(parser, userdata);
+    if(stream == NULL)
+        return -1;
+
+    for(off = 0; off < size; off += chunk_size) {
+        size_t n = size - off;
+
+        if(n > chunk_size)
+            n = chunk_size;
+        if(md_parser_feed(stream, text + off, (MD_SIZE) n) != 0)
+            break;
+    }
+
+    /* After a failed md_parser_feed(), md_parser_finish() reports the error. */
+    return md_parser_finish(stream);
+}
+
+static int
+produce_via_stream(const MD_PARSER* renderer, void* userdata, void* source)
+{
+    struct stream_source* src = (struct stream_source*) source;
+    MD_PARSER parser = *renderer;
+
+    parser.flags = src->parser_flags;
+    return parse_via_stream(&parser, userdata, src->text, src->size, src->chunk_size);
+}
+
+static int
+test_stream(void)
+{
+    static const size_t chunk_sizes[] = { 1, 2, 3, 7, 64, 100000 };
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct stream_source src;
+    unsigned i, j, k;
+    int ret = 0;
+
+    for(i = 0; i < SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+        for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+            src.text = sample_docs[i];
+            src.size = strlen(sample_docs[i]);
+            src.parser_flags = sample_flags[j];
+            if(render_reference(src.text, src.size, src.parser_flags, &expected) != 0) {
+                ret = -1;
+                break;
+            }
+
+            for(k = 0; k < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); k++) {
+                src.chunk_size = chunk_sizes[k];
+                got.size = 0;
+                if(md_html_render_events(produce_via_stream, &src, process_output, &got, 0) != 0) {
+                    fprintf(stderr, "  document %u: md_parser_finish() failed\n", i);
+                    ret = -1;
+                    break;
+                }
+                if(check_output("md_parser_feed()", &expected, &got) != 0) {
+                    fprintf(stderr, "  (document %u, flags 0x%x, chunk size %lu)\n",
+                            i, src.parser_flags, (unsigned long) src.chunk_size);
+                    ret = -1;
+                    break;
+                }
+            }
+        }
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+static int
+test_stream_destroy(void)
+{
+    MD_PARSER parser;
+    MD_PARSER_STREAM* stream;
+
+    /* Destroying the stream without parsing must not call any callback. */
+    memset(&parser, 0, sizeof(parser));
+    stream = md_parser_create(&parser, NULL);
+    CHECK(stream != NULL);
+    CHECK(md_parser_feed(stream, "# Title\n", 8) == 0);
+    md_parser_destroy(stream);
+
+    /* Unsupported ABI version. */
+    parser.abi_version = 1000;
+    CHECK(md_parser_create(&parser, NULL) == NULL);
+    return 0;
+}
+
+static int
+count_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) type; (void) detail;
+    (*(unsigned*) userdata)++;
+    return 0;
+}
+
+/* With MD_FLAG_EARLYBLOCKEMISSION, a closed top-level block is emitted from
+ * md_parser_feed() (once the limit of the output from reference definitions
+ * stops growing with the input, i.e. after 64 KB); without it, nothing is
+ * emitted before md_parser_finish(). */
+static int
+test_stream_early(void)
+{
+    static const char preamble[] = "Preamble paragraph.\n\n";
+    MD_PARSER parser;
+    MD_PARSER_STREAM* stream;
+    unsigned n_leaves = 0;
+    unsigned n_preamble = 0;
+    size_t n_fed = 0;
+
+    memset(&parser, 0, sizeof(parser));
+    parser.enter_block = nop_block;
+    parser.leave_block = count_leave_block;
+    parser.enter_span = nop_span;
+    parser.leave_span = nop_span;
+    parser.text = nop_text;
+
+    parser.flags = MD_FLAG_EARLYBLOCKEMISSION;
+    stream = md_parser_create(&parser, &n_leaves);
+    CHECK(stream != NULL);
+    while(n_fed + sizeof(preamble) - 1 < 64 * 1024) {
+        CHECK(md_parser_feed(stream, preamble, sizeof(preamble) - 1) == 0);
+        n_fed += sizeof(preamble) - 1;
+        n_preamble++;
+    }
+    while(n_fed < 64 * 1024 - 1) {
+        CHECK(md_parser_feed(stream, "\n", 1) == 0);
+        n_fed++;
+    }
+    CHECK(n_leaves == 0);
+    CHECK(md_parser_feed(stream, "# Title\nSome", 12) == 0);
+    CHECK(n_leaves == n_preamble + 1);      /* <h1> */
+    CHECK(md_parser_feed(stream, " paragraph\n", 11) == 0);
+    CHECK(n_leaves == n_preamble + 1);      /* The paragraph may still continue. */
+    CHECK(md_parser_feed(stream, "\n> quote\n\n", 10) == 0);
+    CHECK(n_leaves == n_preamble + 4);      /* <p>, and <blockquote> with its <p> */
+    CHECK(md_parser_finish(stream) == 0);
+    CHECK(n_leaves == n_preamble + 5);      /* The document. */
+
+    n_leaves = 0;
+    parser.flags = 0;
+    stream = md_parser_create(&parser, &n_leaves);
+    CHECK(stream != NULL);
+    CHECK(md_parser_feed(stream, "# Title\n\nParagraph\n\n", 20) == 0);
+    CHECK(n_leaves == 0);
+    CHECK(md_parser_finish(stream) == 0);
+    CHECK(n_leaves == 3);
+    return 0;
+}
+
+
+/************************
+ ***  Parser Sessions  ***
+ ************************/
+
+struct session_source {
+    MD_PARSER_SESSION* session;
+    unsigned parser_flags;
+    const char* text;
+    size_t size;
+};
+
+static int
+produce_via_session(const MD_PARSER* renderer, void* userdata, void* source)
+{
+    struct session_source* src = (struct session_source*) source;
+
+    /* The renderer's callbacks are the same for each document, so the
+     * session is created on the first use. */
+    if(src->session == NULL) {
+        MD_PARSER parser = *renderer;
+
+        parser.flags = src->parser_flags;
+        src->session = md_session_create(&parser);
+        if(src->session == NULL)
+            return -1;
+    }
+
+    return md_session_parse(src->session, src->text, (MD_SIZE) src->size, userdata);
+}
+
+static int
+check_session_doc(struct session_source* src, const char* text, size_t size,
+                  struct buffer* expected, struct buffer* got)
+{
+    src->text = text;
+    src->size = size;
+    CHECK(render_reference(text, size, src->parser_flags, expected) == 0);
+    got->size = 0;
+    CHECK(md_html_render_events(produce_via_session, src, process_output, got, 0) == 0);
+    return check_output("md_session_parse()", expected, got);
+}
+
+static int
+test_session(void)
+{
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct buffer big = { 0 };
+    struct session_source src;
+    unsigned i, j, pass;
+    int ret = 0;
+
+    make_big_doc(&big, 256 * 1024);
+
+    for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+        memset(&src, 0, sizeof(src));
+        src.parser_flags = sample_flags[j];
+
+        /* The 2nd pass reuses the buffers grown by the big document, the 3rd
+         * one follows md_session_reset(). */
+        for(pass = 0; pass < 3  &&  ret == 0; pass++) {
+            for(i = 0; i < SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+                ret = check_session_doc(&src, sample_docs[i], strlen(sample_docs[i]), &expected, &got);
+                if(ret != 0)
+                    fprintf(stderr, "  (document %u, flags 0x%x, pass %u)\n", i, src.parser_flags, pass);
+            }
+
+            if(ret == 0  &&  pass == 0)
+                ret = check_session_doc(&src, big.data, big.size, &expected, &got);
+            if(pass == 1  &&  src.session != NULL)
+                md_session_reset(src.session);
+        }
+
+        if(src.session != NULL)
+            md_session_destroy(src.session);
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    buffer_fini(&big);
+    return ret;
+}
+
+static int
+test_html_session(void)
+{
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    MD_HTML_SESSION* session;
+    unsigned i, j, pass;
+    int ret = 0;
+
+    for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+        session = md_html_session_create(sample_flags[j], 0);
+        CHECK(session != NULL);
+
+        for(pass = 0; pass < 2  &&  ret == 0; pass++) {
+            for(i = 0; i < SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+                const char* text = sample_docs[i];
+
+                got.size = 0;
+                if(render_reference(text, strlen(text), sample_flags[j], &expected) != 0  ||
+                   md_html_session_render(session, text, (MD_SIZE) strlen(text), process_output, &got) != 0)
+                {
+                    fprintf(stderr, "  document %u: rendering failed\n", i);
+                    ret = -1;
+                    break;
+                }
+                ret = check_output("md_html_session_render()", &expected, &got);
+                if(ret != 0)
+                    fprintf(stderr, "  (document %u, flags 0x%x, pass %u)\n", i, sample_flags[j], pass);
+            }
+            md_html_session_reset(session);
+        }
+
+        md_html_session_destroy(session);
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+
+/********************
+ ***  HTML Output  ***
+ ********************/
+
+/* Output collected through md_html_ex(), along with the sizes of the chunks
+ * passed to process_output(). */
+struct chunked_output {
+    struct buffer out;
+    MD_SIZE buffer_size;
+    MD_SIZE prev_chunk_size;
+    unsigned n_chunks;
+    int broken;
+};
+
+static void
+process_chunked_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    struct chunked_output* co = (struct chunked_output*) userdata;
+
+    /* Each chunk is a non-empty piece of the output. With buffering, the
+     * renderer flushes only when the next piece does not fit into the buffer,
+     * so any two consecutive chunks cannot fit in it together. */
+    if(size == 0)
+        co->broken = 1;
+    if(co->buffer_size > 0  &&  co->n_chunks > 0  &&  co->prev_chunk_size + size <= co->buffer_size)
+        co->broken = 1;
+
+    buffer_append(&co->out, text, size);
+    co->prev_chunk_size = size;
+    co->n_chunks++;
+}
+
+static int
+test_html_output_buffer(void)
+{
+    static const MD_SIZE buffer_sizes[] = { 0, 1, 2, 7, 64, 4096, 1024 * 1024 };
+    struct buffer expected = { 0 };
+    struct buffer big = { 0 };
+    struct chunked_output co;
+    unsigned n_chunks_unbuffered = 0;
+    unsigned i, j, k;
+    int ret = 0;
+
+    memset(&co, 0, sizeof(co));
+    make_big_doc(&big, 64 * 1024);
+
+    for(i = 0; i <= SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+        const char* text = (i < SAMPLE_DOC_COUNT ? sample_docs[i] : big.data);
+        size_t size = (i < SAMPLE_DOC_COUNT ? strlen(sample_docs[i]) : big.size);
+
+        for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+            if(render_reference(text, size, sample_flags[j], &expected) != 0) {
+                ret = -1;
+                break;
+            }
+
+            for(k = 0; k < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); k++) {
+                co.out.size = 0;
+                co.buffer_size = buffer_sizes[k];
+                co.prev_chunk_size = 0;
+                co.n_chunks = 0;
+                co.broken = 0;
+                if(md_html_ex(text, (MD_SIZE) size, process_chunked_output, &co,
+                              sample_flags[j], 0, buffer_sizes[k]) != 0)
+                {
+                    fprintf(stderr, "  document %u: md_html_ex() failed\n", i);
+                    ret = -1;
+                } else if(check_output("md_html_ex()", &expected, &co.out) != 0) {
+                    ret = -1;
+                } else if(co.broken) {
+                    fprintf(stderr, "  md_html_ex(): chunk of unexpected size\n");
+                    ret = -1;
+                } else if(buffer_sizes[k] == 0) {
+                    n_chunks_unbuffered = co.n_chunks;
+                } else if(co.n_chunks > n_chunks_unbuffered) {
+                    fprintf(stderr, "  md_html_ex(): %u chunks, %u without buffering\n",
+                            co.n_chunks, n_chunks_unbuffered);
+                    ret = -1;
+                } else if(buffer_sizes[k] >= expected.size  &&  co.n_chunks > 1) {
+                    fprintf(stderr, "  md_html_ex(): output fitting in the buffer came in %u chunks\n",
+                            co.n_chunks);
+                    ret = -1;
+                }
+
+                if(ret != 0) {
+                    fprintf(stderr, "  (document %u, flags 0x%x, buffer size %lu)\n",
+                            i, sample_flags[j], (unsigned long) buffer_sizes[k]);
+                    break;
+                }
+            }
+        }
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&co.out);
+    buffer_fini(&big);
+    return ret;
+}
+
+static int
+check_html_to_buffer(const char* text, size_t size, unsigned parser_flags,
+                     const struct buffer* expected)
+{
+    MD_SIZE buffer_sizes[7];
+    MD_SIZE output_size;
+    MD_SIZE len;
+    MD_CHAR* buffer;
+    unsigned k;
+
+    /* Sizes around the output size, and some much smaller. */
+    buffer_sizes[0] = 0;
+    buffer_sizes[1] = 1;
+    buffer_sizes[2] = 2;
+    buffer_sizes[3] = (MD_SIZE) expected->size / 2 + 1;
+    buffer_sizes[4] = (MD_SIZE) expected->size;
+    buffer_sizes[5] = (MD_SIZE) expected->size + 1;
+    buffer_sizes[6] = (MD_SIZE) expected->size + 100;
+
+    for(k = 0; k < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); k++) {
+        MD_SIZE n = buffer_sizes[k];
+
+        /* Guard the end of the buffer to detect writes past it. */
+        buffer = (MD_CHAR*) malloc(n + 1);
+        CHECK(buffer != NULL);
+        buffer[n] = '#';
+
+        output_size = (MD_SIZE) -1;
+        if(md_html_to_buffer(text, (MD_SIZE) size, (n > 0 ? buffer : NULL), n, &output_size,
+                             parser_flags, 0) != 0)
+        {
+            fprintf(stderr, "  md_html_to_buffer() failed (buffer size %lu)\n", (unsigned long) n);
+            free(buffer);
+            return -1;
+        }
+
+        /* The buffer holds the zero-terminated prefix which fits into it. */
+        len = (n <= expected->size ? n - 1 : (MD_SIZE) expected->size);
+        if(output_size != expected->size  ||  buffer[n] != '#'  ||
+           (n > 0  &&  ((len > 0  &&  memcmp(buffer, expected->data, len) != 0)  ||  buffer[len] != '\0')))
+        {
+            fprintf(stderr, "  md_html_to_buffer(): bad output (buffer size %lu, output size %lu, expected %lu)\n",
+                    (unsigned long) n, (unsigned long) output_size, (unsigned long) expected->size);
+            free(buffer);
+            return -1;
+        }
+
+        free(buffer);
+    }
+
+    buffer = NULL;
+    CHECK(md_html_to_new_buffer(text, (MD_SIZE) size, &buffer, &output_size, parser_flags, 0) == 0);
+    CHECK(buffer != NULL);
+    if(output_size != expected->size  ||  buffer[output_size] != '\0'  ||
+       (output_size > 0  &&  memcmp(buffer, expected->data, output_size) != 0))
+    {
+        fprintf(stderr, "  md_html_to_new_buffer(): bad output (output size %lu, expected %lu)\n",
+                (unsigned long) output_size, (unsigned long) expected->size);
+        free(buffer);
+        return -1;
+    }
+    free(buffer);
+    return 0;
+}
+
+static int
+test_html_to_buffer(void)
+{
+    struct buffer expected = { 0 };
+    struct buffer big = { 0 };
+    unsigned i, j;
+    int ret = 0;
+
+    /* The big document outgrows the initial estimation of md_html_to_new_buffer()
+     * as it is full of tags. */
+    big.size = 0;
+    while(big.size < 64 * 1024)
+        buffer_append(&big, "* *a*\n", 6);
+
+    for(i = 0; i <= SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+        const char* text = (i < SAMPLE_DOC_COUNT ? sample_docs[i] : big.data);
+        size_t size = (i < SAMPLE_DOC_COUNT ? strlen(sample_docs[i]) : big.size);
+
+        for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+            if(render_reference(text, size, sample_flags[j], &expected) != 0) {
+                ret = -1;
+                break;
+            }
+            ret = check_html_to_buffer(text, size, sample_flags[j], &expected);
+            if(ret != 0)
+                fprintf(stderr, "  (document %u, flags 0x%x)\n", i, sample_flags[j]);
+        }
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&big);
+    return ret;
+}
+
+/**************************
+ ***  Custom Allocators  ***
+ **************************/
+
+/* Allocator counting the live allocations and bytes, which may be told to
+ * fail the n-th allocation. */
+struct test_allocator {
+    MD_ALLOCATOR allocator;
+    unsigned n_allocs;      /* Count of (successful) allocations so far. */
+    unsigned n_live;        /* Count of not yet released allocations. */
+    unsigned fail_at;       /* If non-zero, fail the fail_at-th allocation. */
+    size_t n_bytes;         /* Size of the not yet released allocations. */
+    size_t peak_bytes;      /* Maximum of n_bytes so far. */
+};
+
+/* Each allocation is prefixed with its size. (The union ensures proper
+ * alignment of the memory handed out.) */
+union test_allocation_header {
+    size_t size;
+    void* ptr;
+    double d;
+    long l;
+};
+
+static int
+test_allocator_may_allocate(struct test_allocator* ta)
+{
+    if(ta->fail_at != 0  &&  ta->n_allocs + 1 >= ta->fail_at)
+        return 0;
+    ta->n_allocs++;
+    return 1;
+}
+
+static void
+test_allocator_account(struct test_allocator* ta, size_t old_size, size_t new_size)
+{
+    ta->n_bytes = ta->n_bytes - old_size + new_size;
+    if(ta->n_bytes > ta->peak_bytes)
+        ta->peak_bytes = ta->n_bytes;
+}
+
+static void*
+test_allocate(size_t size, void* data)
+{
+    struct test_allocator* ta = (struct test_allocator*) data;
+    union test_allocation_header* hdr;
+
+    if(!test_allocator_may_allocate(ta))
+        return NULL;
+    hdr = (union test_allocation_header*) malloc(sizeof(union test_allocation_header) + size);
+    if(hdr == NULL)
+        return NULL;
+    hdr->size = size;
+    ta->n_live++;
+    test_allocator_account(ta, 0, size);
+    return hdr + 1;
+}
+
+static void*
+test_reallocate(void* ptr, size_t size, void* data)
+{
+    struct test_allocator* ta = (struct test_allocator*) data;
+    union test_allocation_header* hdr;
+    size_t old_size;
+
+    if(ptr == NULL)
+        return test_allocate(size, data);
+    if(!test_allocator_may_allocate(ta))
+        return NULL;
+    hdr = (union test_allocation_header*) ptr - 1;
+    old_size = hdr->size;
+    hdr = (union test_allocation_header*) realloc(hdr, sizeof(union test_allocation_header) + size);
+    if(hdr == NULL)
+        return NULL;
+    hdr->size = size;
+    test_allocator_account(ta, old_size, size);
+    return hdr + 1;
+}
+
+static void
+test_release(void* ptr, void* data)
+{
+    struct test_allocator* ta = (struct test_allocator*) data;
+    union test_allocation_header* hdr;
+
+    if(ptr != NULL) {
+        hdr = (union test_allocation_header*) ptr - 1;
+        ta->n_live--;
+        test_allocator_account(ta, hdr->size, 0);
+        free(hdr);
+    }
+}
+
+static void
+test_allocator_init(struct test_allocator* ta, size_t arena_block_size)
+{
+    memset(ta, 0, sizeof(struct test_allocator));
+    ta->allocator.allocate = test_allocate;
+    ta->allocator.reallocate = test_reallocate;
+    ta->allocator.release = test_release;
+    ta->allocator.data = ta;
+    ta->allocator.arena_block_size = arena_block_size;
+}
+
+struct allocator_source {
+    const MD_ALLOCATOR* allocator;
+    unsigned parser_flags;
+    const char* text;
+    size_t size;
+    size_t chunk_size;      /* If non-zero, feed the text to MD_PARSER_STREAM in such chunks. */
+};
+
+static int
+produce_with_allocator(const MD_PARSER* renderer, void* userdata, void* source)
+{
+    struct allocator_source* src = (struct allocator_source*) source;
+    MD_PARSER parser = *renderer;
+
+    parser.abi_version = 1;
+    parser.flags = src->parser_flags;
+    parser.allocator = src->allocator;
+    if(src->chunk_size == 0)
+        return md_parse(src->text, (MD_SIZE) src->size, &parser, userdata);
+    return parse_via_stream(&parser, userdata, src->text, src->size, src->chunk_size);
+}
+
+/* Arena block sizes to test with. Zero means no arena; the tiny size forces
+ * a new block for nearly every allocation. */
+static const size_t arena_block_sizes[] = { 0, 64, 4096, 1024 * 1024 };
+
+#define ARENA_BLOCK_SIZES_COUNT     (sizeof(arena_block_sizes) / sizeof(arena_block_sizes[0]))
+
+static int
+test_allocator(void)
+{
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct buffer big = { 0 };
+    struct test_allocator ta;
+    struct allocator_source src;
+    unsigned i, j, k;
+    int ret = 0;
+
+    make_big_doc(&big, 64 * 1024);
+
+    for(k = 0; k < ARENA_BLOCK_SIZES_COUNT  &&  ret == 0; k++) {
+        for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+            for(i = 0; i <= SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+                test_allocator_init(&ta, arena_block_sizes[k]);
+                src.allocator = &ta.allocator;
+                src.chunk_size = 0;
+                src.parser_flags = sample_flags[j];
+                src.text = (i < SAMPLE_DOC_COUNT ? sample_docs[i] : big.data);
+                src.size = (i < SAMPLE_DOC_COUNT ? strlen(sample_docs[i]) : big.size);
+
+                got.size = 0;
+                if(render_reference(src.text, src.size, src.parser_flags, &expected) != 0  ||
+                   md_html_render_events(produce_with_allocator, &src, process_output, &got, 0) != 0)
+                {
+                    fprintf(stderr, "  rendering failed\n");
+                    ret = -1;
+                } else {
+                    ret = check_output("md_parse() with allocator", &expected, &got);
+                }
+
+                if(ret == 0  &&  src.size > 0  &&  ta.n_allocs == 0) {
+                    fprintf(stderr, "  the allocator has not been used\n");
+                    ret = -1;
+                }
+                if(ret == 0  &&  ta.n_live != 0) {
+                    fprintf(stderr, "  %u allocations not released\n", ta.n_live);
+                    ret = -1;
+                }
+                if(ret != 0) {
+                    fprintf(stderr, "  (document %u, flags 0x%x, arena block size %lu)\n",
+                            i, src.parser_flags, (unsigned long) arena_block_sizes[k]);
+                }
+            }
+        }
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    buffer_fini(&big);
+    return ret;
+}
+
+static int
+test_allocator_failure(void)
+{
+    /* The parser is tested both on the whole document and fed through
+     * MD_PARSER_STREAM in small chunks, with blocks emitted during the
+     * feeding. */
+    static const struct {
+        unsigned parser_flags;
+        size_t chunk_size;
+    } modes[] = {
+        { MD_DIALECT_GITHUB, 0 },
+        { MD_DIALECT_GITHUB | MD_FLAG_EARLYBLOCKEMISSION, 7 },
+    };
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct test_allocator ta;
+    struct allocator_source src;
+    unsigned n_allocs;
+    unsigned fail_at;
+    unsigned i, j, k;
+    int ret = 0;
+
+    for(k = 0; k < ARENA_BLOCK_SIZES_COUNT  &&  ret == 0; k++) {
+        for(j = 0; j < sizeof(modes) / sizeof(modes[0])  &&  ret == 0; j++) {
+            for(i = 0; i < SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+                src.allocator = &ta.allocator;
+                src.parser_flags = modes[j].parser_flags;
+                src.chunk_size = modes[j].chunk_size;
+                src.text = sample_docs[i];
+                src.size = strlen(sample_docs[i]);
+                CHECK(render_reference(src.text, src.size, src.parser_flags, &expected) == 0);
+
+                /* Count the allocations a successful parsing needs. */
+                test_allocator_init(&ta, arena_block_sizes[k]);
+                got.size = 0;
+                CHECK(md_html_render_events(produce_with_allocator, &src, process_output, &got, 0) == 0);
+                n_allocs = ta.n_allocs;
+
+                /* Then make each of them fail in turn. The parser has to
+                 * either fail, or (if it can do without the memory) succeed
+                 * with the correct output; and it must not leak anything
+                 * either way. (A failing stream may have already emitted a
+                 * part of the output.) */
+                for(fail_at = 1; fail_at <= n_allocs  &&  ret == 0; fail_at++) {
+                    int parse_ret;
+
+                    test_allocator_init(&ta, arena_block_sizes[k]);
+                    ta.fail_at = fail_at;
+                    got.size = 0;
+                    parse_ret = md_html_render_events(produce_with_allocator, &src, process_output, &got, 0);
+                    if(parse_ret == 0)
+                        ret = check_output("md_parse() with allocator", &expected, &got);
+                    else if(parse_ret != -1) {
+                        fprintf(stderr, "  unexpected return value %d\n", parse_ret);
+                        ret = -1;
+                    }
+                    if(ret == 0  &&  ta.n_live != 0) {
+                        fprintf(stderr, "  %u allocations not released\n", ta.n_live);
+                        ret = -1;
+                    }
+                    if(ret != 0) {
+                        fprintf(stderr, "  (document %u, flags 0x%x, chunk size %lu, arena block size %lu, "
+                                        "allocation %u of %u failed)\n",
+                                i, src.parser_flags, (unsigned long) src.chunk_size,
+                                (unsigned long) arena_block_sizes[k], fail_at, n_allocs);
+                    }
+                }
+            }
+        }
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+/* With MD_FLAG_EARLYBLOCKEMISSION, the stream must not keep the whole
+ * document in memory: Only the unfinished tail and the definitions. (The big
+ * document repeats the same few definitions over and over.) */
+static int
+test_stream_memory(void)
+{
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct buffer big = { 0 };
+    struct test_allocator ta;
+    struct allocator_source src;
+    int ret = 0;
+
+    make_big_doc(&big, 4 * 1024 * 1024);
+
+    test_allocator_init(&ta, 0);
+    src.allocator = &ta.allocator;
+    src.parser_flags = MD_DIALECT_GITHUB | MD_FLAG_EARLYBLOCKEMISSION;
+    src.text = big.data;
+    src.size = big.size;
+    src.chunk_size = 4096;
+
+    if(render_reference(src.text, src.size, src.parser_flags, &expected) != 0  ||
+       md_html_render_events(produce_with_allocator, &src, process_output, &got, 0) != 0)
+    {
+        fprintf(stderr, "  rendering failed\n");
+        ret = -1;
+    } else {
+        ret = check_output("md_parser_feed() with allocator", &expected, &got);
+    }
+
+    if(ret == 0  &&  ta.n_live != 0) {
+        fprintf(stderr, "  %u allocations not released\n", ta.n_live);
+        ret = -1;
+    }
+    /* About the 64 KB buffer and the few distinct definitions. */
+    if(ret == 0  &&  ta.peak_bytes > 256 * 1024) {
+        fprintf(stderr, "  peak memory %lu bytes for a document of %lu bytes\n",
+                (unsigned long) ta.peak_bytes, (unsigned long) big.size);
+        ret = -1;
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    buffer_fini(&big);
+    return ret;
+}
+
+
+/*****************
+ ***  Executor  ***
+ *****************/
+
+/* The executor does not run any threads. Instead, it runs the jobs at
+ * various (deterministic) times, in various orders, so that the parser sees
+ * them finishing in all kinds of ways possible with real threads. */
+#define EXECUTOR_INLINE         0   /* Run each job when submitted. */
+#define EXECUTOR_DEFERRED       1   /* Run each job when waited for. */
+#define EXECUTOR_REVERSE        2   /* On any wait, run all pending jobs, the newest first. */
+#define EXECUTOR_REFUSING       3   /* Refuse every other job, defer the rest. */
+
+struct test_job {
+    void (*func)(void*);
+    void* arg;
+    int done;
+    struct test_job* next_pending;
+};
+
+struct test_executor {
+    MD_EXECUTOR executor;
+    int mode;
+    unsigned n_submitted;
+    struct test_job* pending;   /* Newest first. */
+};
+
+static void
+test_job_run(struct test_executor* te, struct test_job* job)
+{
+    struct test_job** pp = &te->pending;
+
+    while(*pp != job)
+        pp = &(*pp)->next_pending;
+    *pp = job->next_pending;
+
+    job->func(job->arg);
+    job->done = 1;
+}
+
+static void*
+test_submit(void (*func)(void*), void* arg, void* data)
+{
+    struct test_executor* te = (struct test_executor*) data;
+    struct test_job* job;
+
+    te->n_submitted++;
+    if(te->mode == EXECUTOR_REFUSING  &&  te->n_submitted % 2 == 0)
+        return NULL;
+
+    job = (struct test_job*) malloc(sizeof(struct test_job));
+    if(job == NULL)
+        return NULL;
+    job->func = func;
+    job->arg = arg;
+    job->done = 0;
+    job->next_pending = te->pending;
+    te->pending = job;
+
+    if(te->mode == EXECUTOR_INLINE)
+        test_job_run(te, job);
+    return job;
+}
+
+static void
+test_wait(void* handle, void* data)
+{
+    struct test_executor* te = (struct test_executor*) data;
+    struct test_job* job = (struct test_job*) handle;
+
+    if(te->mode == EXECUTOR_REVERSE) {
+        while(te->pending != NULL)
+            test_job_run(te, te->pending);
+    } else if(!job->done) {
+        test_job_run(te, job);
+    }
+
+    free(job);
+}
+
+static void
+test_executor_init(struct test_executor* te, int mode, unsigned max_jobs)
+{
+    memset(te, 0, sizeof(struct test_executor));
+    te->executor.submit = test_submit;
+    te->executor.wait = test_wait;
+    te->executor.data = te;
+    te->executor.max_jobs = max_jobs;
+    te->mode = mode;
+}
+
+struct executor_source {
+    const MD_EXECUTOR* executor;
+    unsigned parser_flags;
+    const char* text;
+    size_t size;
+    size_t chunk_size;      /* If non-zero, feed the text to MD_PARSER_STREAM in such chunks. */
+};
+
+static int
+produce_with_executor(const MD_PARSER* renderer, void* userdata, void* source)
+{
+    struct executor_source* src = (struct executor_source*) source;
+    MD_PARSER parser = *renderer;
+
+    parser.abi_version = 1;
+    parser.flags = src->parser_flags;
+    parser.executor = src->executor;
+    if(src->chunk_size == 0)
+        return md_parse(src->text, (MD_SIZE) src->size, &parser, userdata);
+    return parse_via_stream(&parser, userdata, src->text, src->size, src->chunk_size);
+}
+
+/* Check the output with the executor equals md_html() (without it) for all
+ * kinds of the executors. */
+static int
+check_executor_doc(const char* text, size_t size, unsigned parser_flags,
+                   struct buffer* expected, struct buffer* got)
+{
+    static const unsigned max_jobs[] = { 0, 1, 3 };
+    struct test_executor te;
+    struct executor_source src;
+    int mode;
+    unsigned i;
+
+    CHECK(render_reference(text, size, parser_flags, expected) == 0);
+
+    src.executor = &te.executor;
+    src.parser_flags = parser_flags;
+    src.text = text;
+    src.size = size;
+    src.chunk_size = 0;
+
+    for(mode = EXECUTOR_INLINE; mode <= EXECUTOR_REFUSING; mode++) {
+        for(i = 0; i < sizeof(max_jobs) / sizeof(max_jobs[0]); i++) {
+            test_executor_init(&te, mode, max_jobs[i]);
+            got->size = 0;
+            CHECK(md_html_render_events(produce_with_executor, &src, process_output, got, 0) == 0);
+            CHECK(te.pending == NULL);
+            if(check_output("md_parse() with executor", expected, got) != 0) {
+                fprintf(stderr, "  (executor mode %d, max_jobs %u, %u jobs submitted)\n",
+                        mode, max_jobs[i], te.n_submitted);
+                return -1;
+            }
+            if(te.n_submitted == 0) {
+                fprintf(stderr, "  no job submitted\n");
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* Generate a document with many instantiations of a reference definition with
+ * a long destination, scattered over the document, so that they exceed the
+ * limit of the output size generated by the reference definitions (see
+ * md_max_ref_def_output() in md4c.c) by the given percentage. (A negative one
+ * stays below it.) */
+static void
+make_ref_heavy_doc(struct buffer* out, int excess_percent)
+{
+    static const char filler[] = "Some plain text to make the document larger without any links. ";
+    const size_t dest_len = 1000;
+    const size_t doc_size = 256 * 1024;
+    const size_t max_output = 16 * 64 * 1024;   /* The limit for doc_size. */
+    size_t n_refs = max_output / (dest_len + 3) * (100 + excess_percent) / 100;
+    size_t n_paragraphs = doc_size / 1024;
+    size_t i, j;
+
+    out->size = 0;
+    buffer_append(out, "[ref]: /", 8);
+    for(i = 0; i < dest_len; i++)
+        buffer_append(out, "x", 1);
+    buffer_append(out, "\n\n", 2);
+
+    for(i = 0; i < n_paragraphs; i++) {
+        size_t n = n_refs * (i + 1) / n_paragraphs - n_refs * i / n_paragraphs;
+
+        for(j = 0; j < n; j++)
+            buffer_append(out, "[a][ref] ", 9);
+        while(out->size < (i + 1) * 1024)
+            buffer_append(out, filler, sizeof(filler) - 1);
+        buffer_append(out, "\n\n", 2);
+    }
+}
+
+/* Documents large enough for the block analysis to be split among the jobs
+ * (see MD_PARALLEL_SCAN_CHUNK_SIZE in md4c.c). */
+#define PARALLEL_DOC_SIZE       (2 * 1024 * 1024 + 512 * 1024)
+
+static int
+test_executor(void)
+{
+    static const unsigned flags[] = {
+        0,
+        MD_DIALECT_GITHUB,
+        MD_DIALECT_GITHUB | MD_FLAG_EARLYBLOCKEMISSION
+    };
+    struct buffer doc = { 0 };
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    unsigned i, j;
+    int ret = 0;
+
+    for(i = 0; i < 3  &&  ret == 0; i++) {
+        switch(i) {
+            case 0:
+                /* Many small blocks of all kinds. */
+                make_big_doc(&doc, PARALLEL_DOC_SIZE);
+                break;
+
+            case 1:
+                /* A block quote over the whole document: No chunk analyzed by
+                 * a job ends at the top level, so the parser has to analyze
+                 * them again by itself. */
+                doc.size = 0;
+                while(doc.size < PARALLEL_DOC_SIZE)
+                    buffer_append(&doc, "> quoted *text* with a [link](/url)\n", 36);
+                break;
+
+            case 2:
+                /* The same with a footnote, which disables the parallel
+                 * processing of the inline contents. */
+                buffer_append(&doc, "[^1]\n\n[^1]: Footnote.\n", 22);
+                break;
+        }
+
+        for(j = 0; j < sizeof(flags) / sizeof(flags[0])  &&  ret == 0; j++) {
+            ret = check_executor_doc(doc.data, doc.size, flags[j], &expected, &got);
+            if(ret != 0)
+                fprintf(stderr, "  (document %u, flags 0x%x)\n", i, flags[j]);
+        }
+    }
+
+    buffer_fini(&doc);
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+static int
+test_executor_ref_budget(void)
+{
+    static const int excess_percents[] = { -10, 50, 5000 };
+    static const unsigned flags[] = { 0, MD_FLAG_EARLYBLOCKEMISSION };
+    struct buffer doc = { 0 };
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    unsigned i, j;
+    int ret = 0;
+
+    for(i = 0; i < sizeof(excess_percents) / sizeof(excess_percents[0])  &&  ret == 0; i++) {
+        make_ref_heavy_doc(&doc, excess_percents[i]);
+        for(j = 0; j < sizeof(flags) / sizeof(flags[0])  &&  ret == 0; j++) {
+            ret = check_executor_doc(doc.data, doc.size, flags[j], &expected, &got);
+            if(ret != 0) {
+                fprintf(stderr, "  (references exceeding the limit by %d %%, flags 0x%x)\n",
+                        excess_percents[i], flags[j]);
+            }
+        }
+    }
+
+    buffer_fini(&doc);
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+#ifdef TEST_THREADS
+
+/* Executor with a pool of real threads, so that the jobs really run while the
+ * parser goes on (e.g. replays the callbacks recorded by older jobs). */
+#define THREAD_POOL_SIZE        4
+
+struct thread_job {
+    void (*func)(void*);
+    void* arg;
+    int done;
+    struct thread_job* next;
+};
+
+struct thread_executor {
+    MD_EXECUTOR executor;
+    pthread_t threads[THREAD_POOL_SIZE];
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;            /* Signals a new job, a finished job, or the end. */
+    struct thread_job* queue_head;  /* Jobs not yet taken by any thread. */
+    struct thread_job* queue_tail;
+    unsigned n_submitted;
+    int end;
+};
+
+static void*
+thread_worker(void* arg)
+{
+    struct thread_executor* te = (struct thread_executor*) arg;
+    struct thread_job* job;
+
+    pthread_mutex_lock(&te->mutex);
+    while(!te->end) {
+        if(te->queue_head == NULL) {
+            pthread_cond_wait(&te->cond, &te->mutex);
+            continue;
+        }
+
+        job = te->queue_head;
+        te->queue_head = job->next;
+        if(te->queue_head == NULL)
+            te->queue_tail = NULL;
+        pthread_mutex_unlock(&te->mutex);
+
+        job->func(job->arg);
+
+        pthread_mutex_lock(&te->mutex);
+        job->done = 1;
+        pthread_cond_broadcast(&te->cond);
+    }
+    pthread_mutex_unlock(&te->mutex);
+    return NULL;
+}
+
+static void*
+thread_submit(void (*func)(void*), void* arg, void* data)
+{
+    struct thread_executor* te = (struct thread_executor*) data;
+    struct thread_job* job;
+
+    job = (struct thread_job*) malloc(sizeof(struct thread_job));
+    if(job == NULL)
+        return NULL;
+    job->func = func;
+    job->arg = arg;
+    job->done = 0;
+    job->next = NULL;
+
+    pthread_mutex_lock(&te->mutex);
+    if(te->queue_tail != NULL)
+        te->queue_tail->next = job;
+    else
+        te->queue_head = job;
+    te->queue_tail = job;
+    te->n_submitted++;
+    pthread_cond_broadcast(&te->cond);
+    pthread_mutex_unlock(&te->mutex);
+    return job;
+}
+
+static void
+thread_wait(void* handle, void* data)
+{
+    struct thread_executor* te = (struct thread_executor*) data;
+    struct thread_job* job = (struct thread_job*) handle;
+
+    pthread_mutex_lock(&te->mutex);
+    while(!job->done)
+        pthread_cond_wait(&te->cond, &te->mutex);
+    pthread_mutex_unlock(&te->mutex);
+    free(job);
+}
+
+static int
+thread_executor_init(struct thread_executor* te, unsigned max_jobs)
+{
+    unsigned i;
+
+    memset(te, 0, sizeof(struct thread_executor));
+    te->executor.submit = thread_submit;
+    te->executor.wait = thread_wait;
+    te->executor.data = te;
+    te->executor.max_jobs = max_jobs;
+    CHECK(pthread_mutex_init(&te->mutex, NULL) == 0);
+    CHECK(pthread_cond_init(&te->cond, NULL) == 0);
+    for(i = 0; i < THREAD_POOL_SIZE; i++)
+        CHECK(pthread_create(&te->threads[i], NULL, thread_worker, te) == 0);
+    return 0;
+}
+
+static void
+thread_executor_fini(struct thread_executor* te)
+{
+    unsigned i;
+
+    pthread_mutex_lock(&te->mutex);
+    te->end = 1;
+    pthread_cond_broadcast(&te->cond);
+    pthread_mutex_unlock(&te->mutex);
+    for(i = 0; i < THREAD_POOL_SIZE; i++)
+        pthread_join(te->threads[i], NULL);
+    pthread_cond_destroy(&te->cond);
+    pthread_mutex_destroy(&te->mutex);
+}
+
+/* Check the output with the threaded executor equals md_html(). If
+ * chunk_size is non-zero, the document is fed to MD_PARSER_STREAM. */
+static int
+check_threaded_doc(struct thread_executor* te, const char* text, size_t size,
+                   unsigned parser_flags, size_t chunk_size,
+                   struct buffer* expected, struct buffer* got)
+{
+    struct executor_source src;
+    unsigned n_submitted = te->n_submitted;
+
+    CHECK(render_reference(text, size, parser_flags, expected) == 0);
+
+    src.executor = &te->executor;
+    src.parser_flags = parser_flags;
+    src.text = text;
+    src.size = size;
+    src.chunk_size = chunk_size;
+    got->size = 0;
+    CHECK(md_html_render_events(produce_with_executor, &src, process_output, got, 0) == 0);
+    CHECK(te->queue_head == NULL);
+    if(check_output("md_parse() with threads", expected, got) != 0)
+        return -1;
+    if(te->n_submitted == n_submitted) {
+        fprintf(stderr, "  no job submitted\n");
+        return -1;
+    }
+    return 0;
+}
+
+/* Generate a document where each paragraph uses the link reference
+ * definition which precedes it, one defined far before it, one which
+ * follows it, and one which is redefined later. */
+static void
+make_interleaved_defs_doc(struct buffer* out, size_t min_size)
+{
+    char line[256];
+    unsigned i = 0;
+
+    out->size = 0;
+    while(out->size < min_size) {
+        sprintf(line, "[d%u]: /dest%u \"Title %u\"\n\n"
+                      "Paragraph %u with [d%u], [far][d%u], [next][d%u] and [redef].\n\n"
+                      "[redef]: /redef%u\n\n",
+                i, i, i, i, i, i / 2, i + 1, i);
+        buffer_append(out, line, strlen(line));
+        i++;
+    }
+}
+
+static int
+test_threaded_executor(void)
+{
+    static const unsigned max_jobs[] = { 0, 1, 3 };
+    /* With MD_FLAG_EARLYBLOCKEMISSION, the jobs process the blocks emitted so
+     * far while the parser goes on with the analysis (and, with the stream,
+     * while the application feeds it more input). */
+    static const struct {
+        unsigned parser_flags;
+        size_t chunk_size;
+    } modes[] = {
+        { 0, 0 },
+        { MD_DIALECT_GITHUB, 0 },
+        { MD_DIALECT_GITHUB | MD_FLAG_EARLYBLOCKEMISSION, 0 },
+        { MD_DIALECT_GITHUB | MD_FLAG_EARLYBLOCKEMISSION, 4096 },
+    };
+    struct thread_executor te;
+    struct buffer doc = { 0 };
+    struct buffer big_tail = { 0 };
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    unsigned i, j, k;
+    int ret = 0;
+
+    for(k = 0; k < sizeof(max_jobs) / sizeof(max_jobs[0])  &&  ret == 0; k++) {
+        if(thread_executor_init(&te, max_jobs[k]) != 0)
+            return -1;
+
+        for(i = 0; i < 8  &&  ret == 0; i++) {
+            switch(i) {
+                case 0:
+                    /* Many blocks with links and reference definitions. */
+                    make_big_doc(&doc, 512 * 1024);
+                    break;
+
+                case 1:
+                case 2:
+                case 3:
+                    /* Links whose output is below the limit of the reference
+                     * definitions, and ones exceeding it, so the jobs give
+                     * up and the parser processes the blocks again. */
+                    make_ref_heavy_doc(&doc, (i == 1 ? -10 : (i == 2 ? 50 : 5000)));
+                    break;
+
+                case 4:
+                    /* Large enough for the block analysis to be split among
+                     * the jobs. Only top-level blocks, so each chunk ends at
+                     * the top level and the parser adopts the results of the
+                     * jobs. */
+                    doc.size = 0;
+                    while(doc.size < PARALLEL_DOC_SIZE)
+                        buffer_append(&doc, "# Header\n\nText with a [link][foo] and *emphasis*.\n\n[foo]: /url\n\n", 64);
+                    break;
+
+                case 5:
+                    /* A loose list over the whole document: The chunks end
+                     * inside it, so the parser analyzes them again. */
+                    doc.size = 0;
+                    while(doc.size < PARALLEL_DOC_SIZE)
+                        buffer_append(&doc, "1. item *text* with a [link][foo]\n\n", 35);
+                    buffer_append(&doc, "[foo]: /url\n", 12);
+                    break;
+
+                case 6:
+                    /* A fenced code block (with blank lines, which look like
+                     * a good place for a chunk to start) over most of the
+                     * document, between ordinary blocks. */
+                    make_big_doc(&doc, PARALLEL_DOC_SIZE / 4);
+                    buffer_append(&doc, "```\n", 4);
+                    while(doc.size < PARALLEL_DOC_SIZE)
+                        buffer_append(&doc, "code *not* [emphasis][foo]\n\n", 28);
+                    buffer_append(&doc, "```\n\n", 5);
+                    make_big_doc(&big_tail, PARALLEL_DOC_SIZE / 4);
+                    buffer_append(&doc, big_tail.data, big_tail.size);
+                    break;
+
+                case 7:
+                    /* Reference definitions between the blocks which use
+                     * them, so that new ones keep coming while the jobs
+                     * still process the blocks before them. */
+                    make_interleaved_defs_doc(&doc, 1024 * 1024);
+                    break;
+            }
+
+            for(j = 0; j < sizeof(modes) / sizeof(modes[0])  &&  ret == 0; j++) {
+                ret = check_threaded_doc(&te, doc.data, doc.size, modes[j].parser_flags,
+                                         modes[j].chunk_size, &expected, &got);
+                if(ret != 0) {
+                    fprintf(stderr, "  (document %u, flags 0x%x, chunk size %lu, max_jobs %u)\n",
+                            i, modes[j].parser_flags, (unsigned long) modes[j].chunk_size,
+                            max_jobs[k]);
+                }
+            }
+        }
+
+        thread_executor_fini(&te);
+    }
+
+    buffer_fini(&doc);
+    buffer_fini(&big_tail);
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+#endif  /* TEST_THREADS */
+
+
+/****************************
+ ***  Incremental Parsing  ***
+ ****************************/
+
+/* The MD_INCREMENTAL gets its userdata once, when created, while the renderer
+ * of md_html_render_events() lives only during the call. So the MD_INCREMENTAL
+ * calls these which forward to the current renderer. */
+struct incremental_proxy {
+    const MD_PARSER* renderer;
+    void* userdata;
+};
+
+static int
+proxy_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    struct incremental_proxy* proxy = (struct incremental_proxy*) userdata;
+    return proxy->renderer->enter_block(type, detail, proxy->userdata);
+}
+
+static int
+proxy_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    struct incremental_proxy* proxy = (struct incremental_proxy*) userdata;
+    return proxy->renderer->leave_block(type, detail, proxy->userdata);
+}
+
+static int
+proxy_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    struct incremental_proxy* proxy = (struct incremental_proxy*) userdata;
+    return proxy->renderer->enter_span(type, detail, proxy->userdata);
+}
+
+static int
+proxy_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    struct incremental_proxy* proxy = (struct incremental_proxy*) userdata;
+    return proxy->renderer->leave_span(type, detail, proxy->userdata);
+}
+
+static int
+proxy_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    struct incremental_proxy* proxy = (struct incremental_proxy*) userdata;
+    return proxy->renderer->text(type, text, size, proxy->userdata);
+}
+
+struct incremental_source {
+    MD_INCREMENTAL* inc;
+    struct incremental_proxy proxy;
+    const struct buffer* text;
+    unsigned first;
+    unsigned n;
+};
+
+static int
+produce_via_incremental(const MD_PARSER* renderer, void* userdata, void* source)
+{
+    struct incremental_source* src = (struct incremental_source*) source;
+
+    src->proxy.renderer = renderer;
+    src->proxy.userdata = userdata;
+    return md_incremental_render(src->inc, src->text->data, (MD_SIZE) src->text->size,
+                                 src->first, src->n);
+}
+
+/* Edits applied in turn to the document. Each either inserts new_text at the
+ * start of the given chunk, or (if chunk is negative) replaces the first
+ * occurrence of old_text with it. */
+static const struct {
+    int chunk;
+    const char* old_text;
+    const char* new_text;
+} incremental_edits[] = {
+    /* A new block between two chunks. */
+    {  3, NULL,                         "Inserted *paragraph*.\n\n" },
+    /* A new block continued (lazily) by the following one. */
+    {  5, NULL,                         "> quote\n" },
+    /* Edits inside a block. */
+    { -1, "tight\n",                   "tight and **edited**\n" },
+    { -1, "Entities:",                  "    Entities:" },
+    /* Removal of a whole block. */
+    { -1, "# Header\n\n",             "" },
+    /* Two chunks merged into one paragraph, and split again. */
+    { -1, "(/target)\n\n\nHello",    "(/target)\nHello" },
+    { -1, "(/target)\nHello",          "(/target)\n\nHello" },
+    /* An unclosed code fence swallowing the rest of the document, and its
+     * removal. */
+    {  2, NULL,                         "~~~~\n" },
+    { -1, "~~~~\n",                    "" },
+    /* A change of a link reference definition. */
+    { -1, "[ref]: /url \"Title\"\n", "[ref]: /changed\n" },
+    /* Removal spanning multiple blocks. */
+    { -1, "| a | b |",                  "" },
+    /* Insertion at the very start and at the very end of the document. */
+    {  0, NULL,                         "First\n=====\n" },
+    { -1, NULL,                         "\n[foo]: /new\n" },
+};
+
+/* Render chunks [first, first + n) one by one into separate buffers. */
+static int
+render_chunks(struct incremental_source* src, struct buffer* chunk_html, unsigned first, unsigned n)
+{
+    unsigned i;
+
+    for(i = first; i < first + n; i++) {
+        chunk_html[i].size = 0;
+        src->first = i;
+        src->n = 1;
+        if(md_html_render_events(produce_via_incremental, src, process_output, &chunk_html[i], 0) != 0) {
+            fprintf(stderr, "  md_incremental_render() failed for chunk %u\n", i);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* Check the chunks, rendered one by one as well as all at once, give the same
+ * output as md_html(). */
+static int
+check_chunks(struct incremental_source* src, const struct buffer* chunk_html, unsigned n_chunks,
+             unsigned parser_flags, struct buffer* expected, struct buffer* got)
+{
+    unsigned i;
+
+    CHECK(render_reference(src->text->data, src->text->size, parser_flags, expected) == 0);
+
+    got->size = 0;
+    for(i = 0; i < n_chunks; i++)
+        buffer_append(got, chunk_html[i].data, chunk_html[i].size);
+    if(check_output("md_incremental_render() by chunks", expected, got) != 0)
+        return -1;
+
+    got->size = 0;
+    src->first = 0;
+    src->n = n_chunks;
+    CHECK(md_html_render_events(produce_via_incremental, src, process_output, got, 0) == 0);
+    return check_output("md_incremental_render() of all chunks", expected, got);
+}
+
+static int
+test_incremental_with_flags(unsigned parser_flags)
+{
+    struct buffer text = { 0 };
+    struct buffer new_text = { 0 };
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct buffer* chunk_html = NULL;
+    struct buffer* new_chunk_html;
+    struct incremental_source src;
+    MD_PARSER parser;
+    MD_INCREMENTAL_CHANGE change;
+    unsigned n_chunks;
+    unsigned i, j;
+    int ret = -1;
+
+    memset(&parser, 0, sizeof(parser));
+    parser.flags = parser_flags;
+    parser.enter_block = proxy_enter_block;
+    parser.leave_block = proxy_leave_block;
+    parser.enter_span = proxy_enter_span;
+    parser.leave_span = proxy_leave_span;
+    parser.text = proxy_text;
+
+    memset(&src, 0, sizeof(src));
+    src.inc = md_incremental_create(&parser, &src.proxy);
+    src.text = &text;
+    if(src.inc == NULL)
+        goto out;
+
+    make_big_doc(&text, 2048);
+    if(md_incremental_parse(src.inc, text.data, (MD_SIZE) text.size) != 0) {
+        fprintf(stderr, "  md_incremental_parse() failed\n");
+        goto out;
+    }
+
+    n_chunks = md_incremental_chunk_count(src.inc);
+    if(n_chunks < 10) {
+        fprintf(stderr, "  only %u chunks\n", n_chunks);
+        goto out;
+    }
+    chunk_html = (struct buffer*) calloc(n_chunks, sizeof(struct buffer));
+    if(chunk_html == NULL)
+        goto out;
+    if(render_chunks(&src, chunk_html, 0, n_chunks) != 0  ||
+       check_chunks(&src, chunk_html, n_chunks, parser_flags, &expected, &got) != 0)
+        goto out;
+
+    for(i = 0; i < sizeof(incremental_edits) / sizeof(incremental_edits[0]); i++) {
+        const char* old_text = incremental_edits[i].old_text;
+        const char* ins = incremental_edits[i].new_text;
+        size_t edit_beg;
+        size_t old_size = 0;
+        unsigned n_new_chunks;
+
+        if(incremental_edits[i].chunk >= 0) {
+            edit_beg = md_incremental_chunk_offset(src.inc, (unsigned) incremental_edits[i].chunk);
+        } else if(old_text == NULL) {
+            edit_beg = text.size;
+        } else {
+            old_size = strlen(old_text);
+            for(edit_beg = 0; edit_beg + old_size <= text.size; edit_beg++) {
+                if(memcmp(text.data + edit_beg, old_text, old_size) == 0)
+                    break;
+            }
+            if(edit_beg + old_size > text.size) {
+                fprintf(stderr, "  edit %u: \"%s\" not found\n", i, old_text);
+                goto out;
+            }
+        }
+
+        new_text.size = 0;
+        buffer_append(&new_text, text.data, edit_beg);
+        buffer_append(&new_text, ins, strlen(ins));
+        buffer_append(&new_text, text.data + edit_beg + old_size, text.size - edit_beg - old_size);
+        text.size = 0;
+        buffer_append(&text, new_text.data, new_text.size);
+
+        if(md_incremental_update(src.inc, text.data, (MD_SIZE) text.size, (MD_OFFSET) edit_beg,
+                                 (MD_SIZE) old_size, (MD_SIZE) strlen(ins), &change) != 0)
+        {
+            fprintf(stderr, "  edit %u: md_incremental_update() failed\n", i);
+            goto out;
+        }
+
+        n_new_chunks = md_incremental_chunk_count(src.inc);
+        if(change.first + change.n_old > n_chunks  ||
+           n_new_chunks != n_chunks - change.n_old + change.n_new)
+        {
+            fprintf(stderr, "  edit %u: bad change (first %u, n_old %u, n_new %u) of %u -> %u chunks\n",
+                    i, change.first, change.n_old, change.n_new, n_chunks, n_new_chunks);
+            goto out;
+        }
+
+        /* Replace the HTML of the changed chunks, as an editor would do. */
+        new_chunk_html = (struct buffer*) calloc(n_new_chunks + 1, sizeof(struct buffer));
+        if(new_chunk_html == NULL)
+            goto out;
+        for(j = 0; j < change.first; j++)
+            new_chunk_html[j] = chunk_html[j];
+        for(j = change.first; j < change.first + change.n_old; j++)
+            buffer_fini(&chunk_html[j]);
+        for(j = change.first + change.n_old; j < n_chunks; j++)
+            new_chunk_html[j - change.n_old + change.n_new] = chunk_html[j];
+        free(chunk_html);
+        chunk_html = new_chunk_html;
+        n_chunks = n_new_chunks;
+
+        if(render_chunks(&src, chunk_html, change.first, change.n_new) != 0  ||
+           check_chunks(&src, chunk_html, n_chunks, parser_flags, &expected, &got) != 0)
+        {
+            fprintf(stderr, "  (edit %u)\n", i);
+            goto out;
+        }
+    }
+
+    ret = 0;
+
+out:
+    if(chunk_html != NULL) {
+        for(i = 0; i < n_chunks; i++)
+            buffer_fini(&chunk_html[i]);
+        free(chunk_html);
+    }
+    if(src.inc != NULL)
+        md_incremental_destroy(src.inc);
+    buffer_fini(&text);
+    buffer_fini(&new_text);
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+static int
+test_incremental(void)
+{
+    CHECK(test_incremental_with_flags(0) == 0);
+    CHECK(test_incremental_with_flags(MD_DIALECT_GITHUB) == 0);
+    return 0;
+}
+
+
+/*************************
+ ***  Parse Statistics  ***
+ *************************/
+
+/* Documents with known counts of the inline marks. Emphasis delimiter runs
+ * make one mark each. */
+static const struct {
+    const char* text;
+    unsigned parser_flags;
+    struct {
+        char ch;
+        unsigned collected;
+        unsigned resolved;
+    } marks[3];
+} stats_docs[] = {
+    { "Hello world.\n", 0,
+      { { 0 } } },
+    { "*a* **b** _c_ *d\n", 0,
+      { { '*', 5, 4 }, { '_', 2, 2 } } },
+    { "[x](/u) [y] `c`\n\n[y]: /v\n", 0,
+      { { '[', 2, 2 }, { ']', 2, 2 }, { '`', 2, 2 } } },
+    { "a ~~b~~ ~c~ ~~d\n", MD_DIALECT_GITHUB,
+      { { '~', 5, 4 } } },
+};
+
+static int
+parse_with_stats(const char* text, size_t size, unsigned parser_flags, MD_PARSE_STATS* stats)
+{
+    MD_PARSER parser;
+
+    memset(&parser, 0, sizeof(parser));
+    parser.abi_version = 1;
+    parser.flags = parser_flags;
+    parser.enter_block = nop_block;
+    parser.leave_block = nop_block;
+    parser.enter_span = nop_span;
+    parser.leave_span = nop_span;
+    parser.text = nop_text;
+    parser.stats = stats;
+    return md_parse(text, (MD_SIZE) size, &parser, NULL);
+}
+
+/* Check what holds for statistics of any document. */
+static int
+check_stats_consistency(const MD_PARSE_STATS* stats)
+{
+    unsigned i;
+
+    CHECK(stats->time_line_analysis >= 0.0);
+    CHECK(stats->time_label_tables >= 0.0);
+    CHECK(stats->time_block_emission >= 0.0);
+    CHECK(stats->time_mark_collection >= 0.0);
+    CHECK(stats->time_inline_analysis >= 0.0);
+    CHECK(stats->time_inline_emission >= 0.0);
+
+    /* A buffer has been allocated if and only if it has a size. */
+    CHECK((stats->block_bytes_size > 0) == (stats->block_bytes_reallocs > 0));
+    CHECK((stats->marks_size > 0) == (stats->marks_reallocs > 0));
+    CHECK((stats->containers_size > 0) == (stats->containers_reallocs > 0));
+    CHECK((stats->buffer_size > 0) == (stats->buffer_reallocs > 0));
+
+    for(i = 0; i < 128; i++)
+        CHECK(stats->marks_resolved[i] <= stats->marks_collected[i]);
+    return 0;
+}
+
+static int
+check_stats_marks(unsigned doc_index, const MD_PARSE_STATS* stats)
+{
+    unsigned collected[128];
+    unsigned resolved[128];
+    unsigned i;
+
+    memset(collected, 0, sizeof(collected));
+    memset(resolved, 0, sizeof(resolved));
+    for(i = 0; i < sizeof(stats_docs[0].marks) / sizeof(stats_docs[0].marks[0]); i++) {
+        unsigned ch = (unsigned char) stats_docs[doc_index].marks[i].ch;
+
+        collected[ch] = stats_docs[doc_index].marks[i].collected;
+        resolved[ch] = stats_docs[doc_index].marks[i].resolved;
+    }
+
+    for(i = 1; i < 128; i++) {
+        if(stats->marks_collected[i] != collected[i]  ||  stats->marks_resolved[i] != resolved[i]) {
+            fprintf(stderr, "  document %u: mark '%c' collected %u, resolved %u (expected %u, %u)\n",
+                    doc_index, (char) i, stats->marks_collected[i], stats->marks_resolved[i],
+                    collected[i], resolved[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+test_stats(void)
+{
+    MD_PARSE_STATS stats;
+    struct buffer big = { 0 };
+    unsigned i;
+    int ret = -1;
+
+    for(i = 0; i < sizeof(stats_docs) / sizeof(stats_docs[0]); i++) {
+        const char* text = stats_docs[i].text;
+
+        /* Garbage in the structure must not matter: The parser resets it. */
+        memset(&stats, 0xff, sizeof(stats));
+        CHECK(parse_with_stats(text, strlen(text), stats_docs[i].parser_flags, &stats) == 0);
+        CHECK(check_stats_consistency(&stats) == 0);
+        CHECK(check_stats_marks(i, &stats) == 0);
+        CHECK(stats.block_bytes_size > 0);
+        CHECK(stats.containers_size == 0);
+    }
+
+    /* Many marks (and nested containers) make the buffers grow several times. */
+    while(big.size < 4 * 20000)
+        buffer_append(&big, "*a* ", 4);
+    buffer_append(&big, "\n\n> > > - quote\n", 16);
+    if(parse_with_stats(big.data, big.size, 0, &stats) != 0)
+        goto out;
+    if(check_stats_consistency(&stats) != 0)
+        goto out;
+    if(stats.marks_collected['*'] != 40000  ||  stats.marks_resolved['*'] != 40000) {
+        fprintf(stderr, "  big document: '*' collected %u, resolved %u (expected 40000)\n",
+                stats.marks_collected['*'], stats.marks_resolved['*']);
+        goto out;
+    }
+    if(stats.marks_reallocs < 2  ||  stats.marks_size < 40000  ||  stats.containers_size == 0) {
+        fprintf(stderr, "  big document: marks buffer %lu B (%u reallocs), containers %lu B\n",
+                (unsigned long) stats.marks_size, stats.marks_reallocs,
+                (unsigned long) stats.containers_size);
+        goto out;
+    }
+
+    ret = 0;
+
+out:
+    buffer_fini(&big);
+    return ret;
+}
+
+
+/***********************
+ ***  Block Profiler  ***
+ ***********************/
+
+/* Document with leaf blocks of various kinds. */
+static const char profile_doc[] =
+        "# Title\n"
+        "\n"
+        "A *para*\n"
+        "graph.\n"
+        "\n"
+        "```c\n"
+        "code\n"
+        "```\n"
+        "\n"
+        "```\n"
+        "```\n"
+        "\n"
+        "- item\n"
+        "\n"
+        "***\n"
+        "\n"
+        "<div>\n"
+        "html\n"
+        "</div>\n"
+        "\n"
+        "| a | b |\n"
+        "|---|---|\n"
+        "| 1 | 2 |\n";
+
+/* Its leaf blocks, as the profiler should report them. */
+static const struct {
+    MD_BLOCKTYPE type;
+    MD_SIZE n_lines;
+    const char* contents;
+} profile_blocks[] = {
+    { MD_BLOCK_H,       1,  "Title" },
+    { MD_BLOCK_P,       2,  "A *para*\ngraph." },
+    { MD_BLOCK_CODE,    1,  "code" },
+    { MD_BLOCK_CODE,    0,  "" },
+    { MD_BLOCK_P,       1,  "item" },
+    { MD_BLOCK_HR,      1,  "***" },
+    { MD_BLOCK_HTML,    3,  "<div>\nhtml\n</div>" },
+    { MD_BLOCK_TABLE,   3,  "| a | b |\n|---|---|\n| 1 | 2 |" },
+};
+
+#define PROFILE_BLOCKS_MAX      16
+
+struct profile_log {
+    MD_BLOCK_PROFILE profiles[PROFILE_BLOCKS_MAX];
+    unsigned n_profiles;
+};
+
+static void
+log_slow_block(const MD_BLOCK_PROFILE* profile, void* data)
+{
+    struct profile_log* log = (struct profile_log*) data;
+
+    if(log->n_profiles < PROFILE_BLOCKS_MAX)
+        log->profiles[log->n_profiles] = *profile;
+    log->n_profiles++;
+}
+
+static int
+parse_with_profiler(unsigned abi_version, double threshold, struct profile_log* log)
+{
+    MD_PARSER parser;
+    MD_BLOCK_PROFILER profiler;
+
+    profiler.slow_block = log_slow_block;
+    profiler.threshold = threshold;
+    profiler.data = log;
+    log->n_profiles = 0;
+
+    memset(&parser, 0, sizeof(parser));
+    parser.abi_version = abi_version;
+    parser.flags = MD_DIALECT_GITHUB;
+    parser.enter_block = nop_block;
+    parser.leave_block = nop_block;
+    parser.enter_span = nop_span;
+    parser.leave_span = nop_span;
+    parser.text = nop_text;
+    parser.block_profiler = &profiler;
+    return md_parse(profile_doc, (MD_SIZE) strlen(profile_doc), &parser, NULL);
+}
+
+static int
+test_block_profiler(void)
+{
+    struct profile_log log;
+    unsigned n_expected = sizeof(profile_blocks) / sizeof(profile_blocks[0]);
+    unsigned i;
+
+    /* With zero threshold, each leaf block is reported once, in the document
+     * order. */
+    CHECK(parse_with_profiler(1, 0.0, &log) == 0);
+    if(log.n_profiles != n_expected) {
+        fprintf(stderr, "  threshold 0: %u blocks reported (expected %u)\n",
+                log.n_profiles, n_expected);
+        return -1;
+    }
+    for(i = 0; i < n_expected; i++) {
+        const MD_BLOCK_PROFILE* profile = &log.profiles[i];
+        const char* contents = profile_blocks[i].contents;
+
+        if(profile->type != profile_blocks[i].type  ||
+           profile->n_lines != profile_blocks[i].n_lines  ||
+           profile->beg > profile->end  ||  profile->end > strlen(profile_doc)  ||
+           profile->end - profile->beg != strlen(contents)  ||
+           strncmp(profile_doc + profile->beg, contents, strlen(contents)) != 0)
+        {
+            fprintf(stderr, "  block %u: type %d, %u lines, range [%u, %u) "
+                    "(expected type %d, %u lines, \"%s\")\n", i, (int) profile->type,
+                    (unsigned) profile->n_lines, (unsigned) profile->beg, (unsigned) profile->end,
+                    (int) profile_blocks[i].type, (unsigned) profile_blocks[i].n_lines, contents);
+            return -1;
+        }
+        CHECK(profile->time >= 0.0);
+
+        /* Verbatim blocks have no inline contents. */
+        if(profile->type == MD_BLOCK_CODE  ||  profile->type == MD_BLOCK_HTML  ||
+           profile->type == MD_BLOCK_HR)
+            CHECK(profile->n_marks == 0  &&  profile->n_passes == 0);
+    }
+    CHECK(log.profiles[1].n_marks >= 2);    /* The two '*' at least. */
+
+    /* No block takes that long. */
+    CHECK(parse_with_profiler(1, 1.0e9, &log) == 0);
+    CHECK(log.n_profiles == 0);
+
+    /* The profiler is ignored with abi_version 0. */
+    CHECK(parse_with_profiler(0, 0.0, &log) == 0);
+    CHECK(log.n_profiles == 0);
+
+    return 0;
+}
+
+
+#ifdef TEST_MD4C_AST
+
+/*****************
+ ***  MD4C-AST  ***
+ *****************/
+
+/* Check the links between the nodes are consistent. */
+static int
+check_ast_structure(const MD_AST* ast, const char* text, size_t size)
+{
+    const MD_AST_NODE* nodes = md_ast_nodes(ast);
+    unsigned n_nodes = md_ast_node_count(ast);
+    unsigned i, child, prev;
+
+    CHECK(n_nodes >= 1);
+    CHECK(nodes[0].kind == MD_AST_BLOCK  &&  nodes[0].type == MD_BLOCK_DOC);
+    CHECK(nodes[0].end == n_nodes);
+
+    for(i = 0; i < n_nodes; i++) {
+        const MD_AST_NODE* node = &nodes[i];
+
+        CHECK(node->end > i  &&  node->end <= n_nodes);
+        if(i > 0) {
+            CHECK(node->parent < i);
+            CHECK(nodes[node->parent].end >= node->end);
+        }
+
+        if(node->kind == MD_AST_TEXT) {
+            CHECK(node->first_child == 0);
+            CHECK(node->end == i + 1);
+            if(!(node->flags & MD_AST_NODE_FLAG_INTERNED_TEXT)) {
+                CHECK(node->u.text.off + node->u.text.size <= size);
+                CHECK(md_ast_text(ast, node) == text + node->u.text.off);
+            }
+        }
+
+        /* The children cover exactly the range of the descendants. */
+        prev = i;
+        for(child = node->first_child; child != 0; child = nodes[child].next_sibling) {
+            CHECK(child == (prev == i ? i + 1 : nodes[prev].end));
+            CHECK(nodes[child].parent == i);
+            prev = child;
+        }
+        CHECK((prev == i ? i + 1 : nodes[prev].end) == node->end);
+    }
+
+    return 0;
+}
+
+static int
+check_ast_doc(const char* text, size_t size, unsigned parser_flags,
+              struct buffer* expected, struct buffer* got)
+{
+    const MD_AST_NODE* nodes;
+    MD_AST* ast;
+    unsigned child;
+    int ret = -1;
+
+    CHECK(render_reference(text, size, parser_flags, expected) == 0);
+    ast = md_ast_parse(text, (MD_SIZE) size, parser_flags);
+    CHECK(ast != NULL);
+
+    if(check_ast_structure(ast, text, size) != 0)
+        goto out;
+
+    got->size = 0;
+    if(md_ast_html(ast, 0, process_output, got, 0) != 0  ||
+       check_output("md_ast_html()", expected, got) != 0)
+        goto out;
+
+    /* MD_BLOCK_DOC has no HTML of its own, so rendering the top-level blocks
+     * one by one has to give the same. */
+    got->size = 0;
+    nodes = md_ast_nodes(ast);
+    for(child = nodes[0].first_child; child != 0; child = nodes[child].next_sibling) {
+        if(md_ast_html(ast, child, process_output, got, 0) != 0)
+            goto out;
+    }
+    if(check_output("md_ast_html() of top-level blocks", expected, got) != 0)
+        goto out;
+
+    ret = 0;
+
+out:
+    md_ast_free(ast);
+    return ret;
+}
+
+static int
+test_ast(void)
+{
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct buffer big = { 0 };
+    unsigned i, j;
+    int ret = 0;
+
+    make_big_doc(&big, 64 * 1024);
+
+    for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+        for(i = 0; i <= SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+            if(i < SAMPLE_DOC_COUNT)
+                ret = check_ast_doc(sample_docs[i], strlen(sample_docs[i]), sample_flags[j], &expected, &got);
+            else
+                ret = check_ast_doc(big.data, big.size, sample_flags[j], &expected, &got);
+            if(ret != 0)
+                fprintf(stderr, "  (document %u, flags 0x%x)\n", i, sample_flags[j]);
+        }
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    buffer_fini(&big);
+    return ret;
+}
+
+#endif  /* TEST_MD4C_AST */
+
+
+#ifdef TEST_MD4C_EVLOG
+
+/*******************
+ ***  MD4C-EVLOG  ***
+ *******************/
+
+/* Format details (see md4c-evlog.c) needed to corrupt the logs on purpose. */
+#define EVLOG_HEADER_SIZE       3
+#define EVLOG_OP_ENTER_BLOCK    1
+#define EVLOG_OP_LEAVE_BLOCK    2
+#define EVLOG_OP_ENTER_SPAN     3
+#define EVLOG_OP_LEAVE_SPAN     4
+#define EVLOG_OP_TEXT           5
+#define EVLOG_OP_END            6
+
+static void
+process_log(const void* data, size_t size, void* userdata)
+{
+    buffer_append((struct buffer*) userdata, (const char*) data, size);
+}
+
+struct evlog_source {
+    const void* log;
+    size_t log_size;
+};
+
+static int
+produce_via_evlog(const MD_PARSER* renderer, void* userdata, void* source)
+{
+    struct evlog_source* src = (struct evlog_source*) source;
+    return md_evlog_replay(src->log, src->log_size, renderer, userdata);
+}
+
+static int
+check_evlog_doc(const char* text, size_t size, unsigned parser_flags,
+                struct buffer* log, struct buffer* expected, struct buffer* got)
+{
+    struct evlog_source src;
+    struct buffer log2 = { 0 };
+    MD_EVLOG_WRITER* writer;
+    MD_PARSER parser;
+    int ret;
+
+    CHECK(render_reference(text, size, parser_flags, expected) == 0);
+
+    log->size = 0;
+    CHECK(md_evlog_write(text, (MD_SIZE) size, parser_flags, process_log, log) == 0);
+    CHECK(log->size % sizeof(unsigned) == 0);
+
+    src.log = log->data;
+    src.log_size = log->size;
+    got->size = 0;
+    CHECK(md_html_render_events(produce_via_evlog, &src, process_output, got, 0) == 0);
+    if(check_output("md_evlog_replay()", expected, got) != 0)
+        return -1;
+
+    /* The lower level interface has to write the same log. */
+    writer = md_evlog_writer_create(process_log, &log2);
+    CHECK(writer != NULL);
+    md_evlog_writer_init_parser(&parser);
+    parser.flags = parser_flags;
+    ret = md_parse(text, (MD_SIZE) size, &parser, writer);
+    if(ret == 0)
+        ret = md_evlog_writer_finish(writer);
+    md_evlog_writer_destroy(writer);
+    if(ret == 0  &&  (log2.size != log->size  ||  memcmp(log2.data, log->data, log->size) != 0)) {
+        fprintf(stderr, "  md_evlog_writer_xxx() wrote a different log\n");
+        ret = -1;
+    }
+    buffer_fini(&log2);
+    return ret;
+}
+
+static int
+test_evlog(void)
+{
+    struct buffer log = { 0 };
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    struct buffer big = { 0 };
+    unsigned i, j;
+    int ret = 0;
+
+    make_big_doc(&big, 64 * 1024);
+
+    for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+        for(i = 0; i <= SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+            if(i < SAMPLE_DOC_COUNT)
+                ret = check_evlog_doc(sample_docs[i], strlen(sample_docs[i]), sample_flags[j], &log, &expected, &got);
+            else
+                ret = check_evlog_doc(big.data, big.size, sample_flags[j], &log, &expected, &got);
+            if(ret != 0)
+                fprintf(stderr, "  (document %u, flags 0x%x)\n", i, sample_flags[j]);
+        }
+    }
+
+    buffer_fini(&log);
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    buffer_fini(&big);
+    return ret;
+}
+
+/* Replay the log (its first log_size bytes) into callbacks which do nothing. */
+static int
+replay_log(const unsigned* log, size_t log_size)
+{
+    MD_PARSER parser;
+
+    memset(&parser, 0, sizeof(parser));
+    parser.enter_block = nop_block;
+    parser.leave_block = nop_block;
+    parser.enter_span = nop_span;
+    parser.leave_span = nop_span;
+    parser.text = nop_text;
+    return md_evlog_replay(log, log_size, &parser, NULL);
+}
+
+/* Replay a copy of the log with the word at index i replaced with value. */
+static int
+replay_modified_log(const unsigned* log, size_t n_words, size_t i, unsigned value)
+{
+    unsigned* copy;
+    int ret;
+
+    copy = (unsigned*) malloc(n_words * sizeof(unsigned));
+    if(copy == NULL)
+        return -2;
+    memcpy(copy, log, n_words * sizeof(unsigned));
+    copy[i] = value;
+    ret = replay_log(copy, n_words * sizeof(unsigned));
+    free(copy);
+    return ret;
+}
+
+static int
+test_evlog_invalid(void)
+{
+    struct buffer doc = { 0 };
+    struct buffer log = { 0 };
+    const unsigned* words;
+    size_t n_words;
+    size_t i;
+    unsigned n_checked[EVLOG_OP_END + 1] = { 0 };
+    int ret = -1;
+
+    make_big_doc(&doc, 4096);
+    ret = md_evlog_write(doc.data, (MD_SIZE) doc.size, MD_DIALECT_GITHUB, process_log, &log);
+    buffer_fini(&doc);
+    if(ret != 0) {
+        fprintf(stderr, "  md_evlog_write() failed\n");
+        goto out;
+    }
+    ret = -1;
+
+    words = (const unsigned*) log.data;
+    n_words = log.size / sizeof(unsigned);
+    if(replay_log(words, log.size) != 0) {
+        fprintf(stderr, "  the original log is not accepted\n");
+        goto out;
+    }
+
+    /* Truncated logs (including any incomplete last word). */
+    for(i = 0; i < log.size; i++) {
+        if(replay_log(words, i) != -1) {
+            fprintf(stderr, "  log truncated to %lu bytes (of %lu) accepted\n",
+                    (unsigned long) i, (unsigned long) log.size);
+            goto out;
+        }
+    }
+
+    /* Corrupted header. */
+    for(i = 0; i < EVLOG_HEADER_SIZE; i++) {
+        if(replay_modified_log(words, n_words, i, words[i] ^ 0x100) != -1) {
+            fprintf(stderr, "  log with corrupted header word %lu accepted\n", (unsigned long) i);
+            goto out;
+        }
+    }
+
+    /* Corrupted records: For each record, make it inconsistent with the rest
+     * of the log in a way specific to its kind. */
+    i = EVLOG_HEADER_SIZE;
+    while(i < n_words) {
+        unsigned op = words[i] & 0xff;
+        size_t next;
+        int r;
+
+        switch(op) {
+            case EVLOG_OP_ENTER_BLOCK:
+            case EVLOG_OP_ENTER_SPAN:
+                /* The detail does not fit into the log. */
+                r = replay_modified_log(words, n_words, i+1, (unsigned) (n_words - i));
+                next = i + 2 + words[i+1];
+                break;
+
+            case EVLOG_OP_LEAVE_BLOCK:
+            case EVLOG_OP_LEAVE_SPAN:
+                /* Points to a record which is not the matching enter one. */
+                r = replay_modified_log(words, n_words, i+1, words[i+1] - 2);
+                if(r == 0)  /* Maybe a sibling of the same type. */
+                    r = replay_modified_log(words, n_words, i+1, 0);
+                next = i + 2;
+                break;
+
+            case EVLOG_OP_TEXT:
+                /* Text longer than the log. */
+                r = replay_modified_log(words, n_words, i+1, (unsigned) (n_words * sizeof(unsigned)));
+                next = i + 2 + (words[i+1] * sizeof(MD_CHAR) + sizeof(unsigned) - 1) / sizeof(unsigned);
+                break;
+
+            case EVLOG_OP_END:
+                /* Missing end. */
+                r = replay_modified_log(words, n_words, i, EVLOG_OP_END + 1);
+                next = n_words;
+                break;
+
+            default:
+                fprintf(stderr, "  unexpected record at word %lu\n", (unsigned long) i);
+                goto out;
+        }
+
+        if(r != -1) {
+            fprintf(stderr, "  corrupted record %u at word %lu accepted\n", op, (unsigned long) i);
+            goto out;
+        }
+        n_checked[op]++;
+        i = next;
+    }
+
+    for(i = EVLOG_OP_ENTER_BLOCK; i <= EVLOG_OP_END; i++) {
+        if(n_checked[i] == 0) {
+            fprintf(stderr, "  no record of kind %lu checked\n", (unsigned long) i);
+            goto out;
+        }
+    }
+
+    /* Any other corruption may be undetectable (e.g. in a text), but the
+     * replaying must not crash nor read outside of the log. */
+    for(i = EVLOG_HEADER_SIZE; i < n_words; i++) {
+        static const unsigned values[] = { 0, 1, 0xff, 0x7fffffff, 0xffffffff };
+        unsigned k;
+
+        for(k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+            int r = replay_modified_log(words, n_words, i, values[k]);
+            if(r != 0  &&  r != -1) {
+                fprintf(stderr, "  unexpected return value %d\n", r);
+                goto out;
+            }
+        }
+    }
+
+    ret = 0;
+
+out:
+    buffer_fini(&log);
+    return ret;
+}
+
+#endif  /* TEST_MD4C_EVLOG */
+
+
+#ifdef TEST_MD4C_ALL
+
+/**************************
+ ***  Amalgamated Build  ***
+ **************************/
+
+/* In the amalgamated build, md_html() itself takes the direct calls, so
+ * compare md_html_direct() also with some output known in advance. */
+static const struct {
+    const char* input;
+    unsigned parser_flags;
+    const char* output;
+} direct_outputs[] = {
+    { "Hello *world*!\n", 0,
+      "<p>Hello <em>world</em>!</p>\n" },
+    { "# Title\n\n> [link](/url) & `code`\n", 0,
+      "<h1>Title</h1>\n<blockquote>\n<p><a href=\"/url\">link</a> &amp; <code>code</code></p>\n</blockquote>\n" },
+    { "| a |\n|---|\n| ~~b~~ |\n", MD_DIALECT_GITHUB,
+      "<table>\n<thead>\n<tr>\n<th>a</th>\n</tr>\n</thead>\n<tbody>\n<tr>\n<td><del>b</del></td>\n</tr>\n</tbody>\n</table>\n" },
+};
+
+static int
+test_html_direct(void)
+{
+    struct buffer expected = { 0 };
+    struct buffer got = { 0 };
+    unsigned i, j;
+    int ret = 0;
+
+    for(i = 0; i < SAMPLE_DOC_COUNT  &&  ret == 0; i++) {
+        for(j = 0; j < SAMPLE_FLAGS_COUNT  &&  ret == 0; j++) {
+            const char* text = sample_docs[i];
+
+            got.size = 0;
+            if(render_reference(text, strlen(text), sample_flags[j], &expected) != 0  ||
+               md_html_direct(text, (MD_SIZE) strlen(text), process_output, &got, sample_flags[j], 0) != 0)
+            {
+                fprintf(stderr, "  document %u: rendering failed\n", i);
+                ret = -1;
+                break;
+            }
+            ret = check_output("md_html_direct()", &expected, &got);
+            if(ret != 0)
+                fprintf(stderr, "  (document %u, flags 0x%x)\n", i, sample_flags[j]);
+        }
+    }
+
+    for(i = 0; i < sizeof(direct_outputs) / sizeof(direct_outputs[0])  &&  ret == 0; i++) {
+        const char* text = direct_outputs[i].input;
+
+        expected.size = 0;
+        buffer_append(&expected, direct_outputs[i].output, strlen(direct_outputs[i].output));
+        got.size = 0;
+        if(md_html_direct(text, (MD_SIZE) strlen(text), process_output, &got,
+                          direct_outputs[i].parser_flags, 0) != 0)
+        {
+            fprintf(stderr, "  input %u: md_html_direct() failed\n", i);
+            ret = -1;
+            break;
+        }
+        ret = check_output("md_html_direct()", &expected, &got);
+        if(ret != 0)
+            fprintf(stderr, "  (input %u)\n", i);
+    }
+
+    buffer_fini(&expected);
+    buffer_fini(&got);
+    return ret;
+}
+
+#endif  /* TEST_MD4C_ALL */
+
+
+/*********************
+ ***  Main program  ***
+ *********************/
+
+static const struct {
+    const char* name;
+    int (*func)(void);
+} tests[] = {
+    { "stream",                     test_stream },
+    { "stream destroy",             test_stream_destroy },
+    { "stream early",               test_stream_early },
+    { "session",                    test_session },
+    { "html session",               test_html_session },
+    { "html output buffer",         test_html_output_buffer },
+    { "html to buffer",             test_html_to_buffer },
+    { "allocator",                  test_allocator },
+    { "allocator failure",          test_allocator_failure },
+    { "stream memory",              test_stream_memory },
+    { "executor",                   test_executor },
+    { "executor ref. budget",       test_executor_ref_budget },
+#ifdef TEST_THREADS
+    { "threaded executor",          test_threaded_executor },
+#endif
+    { "incremental",                test_incremental },
+    { "stats",                      test_stats },
+    { "block profiler",             test_block_profiler },
+#ifdef TEST_MD4C_AST
+    { "ast",                        test_ast },
+#endif
+#ifdef TEST_MD4C_EVLOG
+    { "evlog",                      test_evlog },
+    { "evlog invalid",              test_evlog_invalid },
+#endif
+#ifdef TEST_MD4C_ALL
+    { "html direct",                test_html_direct },
+#endif
+};
+
+int
+main(int argc, char** argv)
+{
+    const char* filter = (argc > 1 ? argv[1] : NULL);
+    unsigned n_passed = 0;
+    unsigned n_failed = 0;
+    unsigned i;
+
+    for(i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        if(filter != NULL  &&  strstr(tests[i].name, filter) == NULL)
+            continue;
+
+        fflush(stdout);
+        if(tests[i].func() == 0) {
+            printf("%-45s [PASSED]\n", tests[i].name);
+            n_passed++;
+        } else {
+            printf("%-45s [FAILED]\n", tests[i].name);
+            n_failed++;
+        }
+        fflush(stdout);
+    }
+
+    printf("%u passed, %u failed\n", n_passed, n_failed);
+    return (n_failed > 0 ? 1 : 0);
+}
@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Check that the parsing time of pathological inputs scales linearly.
+#
+# pathological-tests.py checks the output for one fixed size of each input
+# (and that it does not take too long). Here, each input generator is run for
+# geometrically increasing sizes, and the exponent k of the time curve
+# (time ~ size^k) is estimated by least squares fit of log(time) against
+# log(size). A test fails if k exceeds 1 by more than the tolerance, i.e. if
+# the parser shows superlinear behavior on the input.
+#
+# The time is the one reported by md2html --stat, i.e. it does not include
+# the start of the process and the I/O.
+
+import argparse
+import math
+import re
+import subprocess
+import sys
+
+
+# Each test is a tuple (generator, options[, base]): The generator gets
+# a repetition count n and returns the input. It is called for n = base,
+# 2*base, 4*base, ... (The size used for the fit is the size of the input,
+# so the generator does not need to be linear in n.)
+DEFAULT_BASE = 10000
+
+scaling = {
+    # CommonMark
+    "nested strong emph":
+            (lambda n: ("*a **a " * n) + "b" + (" a** a*" * n), ""),
+    "many emph closers with no openers":
+            (lambda n: "a_ " * n, ""),
+    "many emph openers with no closers":
+            (lambda n: "_a " * n, ""),
+    "many 3-emph openers with no closers":
+            (lambda n: "a***" * n, ""),
+    "many link closers with no openers":
+            (lambda n: "a]" * n, ""),
+    "many link openers with no closers":
+            (lambda n: "[a" * n, ""),
+    "mismatched openers and closers":
+            (lambda n: "*a_ " * n, ""),
+    "openers and closers multiple of 3":
+            (lambda n: "a**b" + ("c* " * n), ""),
+    "link openers and emph closers":
+            (lambda n: "[ a_" * n, ""),
+    "nested brackets":
+            (lambda n: ("[" * n) + "a" + ("]" * n), ""),
+    "nested block quotes":
+            (lambda n: ("> " * n) + "a", ""),
+    "backticks":
+            (lambda n: "".join("e" + "`" * x for x in range(1, n)), "", 100),
+    "many backticks and escapes":
+            (lambda n: "\\``" * n, ""),
+    "many links":
+            (lambda n: "[t](/u) " * n, ""),
+    "many references":
+            (lambda n: "".join("[{}]: u\n".format(x) for x in range(n)) + "[0] " * n, ""),
+    "deeply nested lists":
+            (lambda n: "".join("  " * x + "* a\n" for x in range(n)), "", 60),
+    "broken thematic break":
+            (lambda n: "* " * n + "a", ""),
+    "many html openers and closers":
+            (lambda n: "<>" * n, ""),
+    "many html proc. inst. openers":
+            (lambda n: "x" + "<?" * n, ""),
+    "many html CDATA openers":
+            (lambda n: "x" + "<![CDATA[" * n, ""),
+    "many entity-like sequences":
+            (lambda n: "&#x" * n + "&a" * n, ""),
+    "many broken link titles":
+            (lambda n: "[ (](" * n, ""),
+    "many broken links":
+            (lambda n: "]([\n" * n, ""),
+    "nested invalid link references":
+            (lambda n: "[" * n + "]" * n + "\n\n[a]: /b", ""),
+
+    # Extensions
+    "many spoiler openers":
+            (lambda n: "||a " * n, "--fspoilers"),
+    "nested spoilers":
+            (lambda n: ("||a " * n) + "b" + (" a||" * n), "--fspoilers"),
+    "mismatched spoilers and pipes":
+            (lambda n: "||a |" * n, "--fspoilers --ftables"),
+    "many highlight openers":
+            (lambda n: "==a " * n, "--fhighlight"),
+    "nested highlights":
+            (lambda n: ("==a " * n) + "b" + (" a==" * n), "--fhighlight"),
+    "many subscript openers":
+            (lambda n: "~a " * n, "--fsubscripts"),
+    "many superscript openers":
+            (lambda n: "^a " * n, "--fsuperscripts"),
+    "mixed sub/superscripts and strike-through":
+            (lambda n: "~a^ ~~b " * n, "--fsubscripts --fsuperscripts --fstrikethrough"),
+    "many strike-through openers":
+            (lambda n: "~~a " * n, "--fstrikethrough"),
+    "many underline openers":
+            (lambda n: "_a " * n, "--funderline"),
+    "many latex math openers":
+            (lambda n: "$a $$b " * n, "--flatex-math"),
+    "many wiki link openers":
+            (lambda n: "[[a" * n, "--fwiki-links"),
+    "nested wiki links":
+            (lambda n: ("[[" * n) + "a" + ("]]" * n), "--fwiki-links"),
+    "many wiki links with pipes":
+            (lambda n: "[[a|" * n, "--fwiki-links"),
+    "many footnote reference openers":
+            (lambda n: "[^a" * n, "--ffootnotes"),
+    "many footnote references":
+            (lambda n: "".join("[^{}]: x\n".format(x) for x in range(n))
+                        + "".join("[^{}] ".format(x) for x in range(n)), "--ffootnotes"),
+    "many unresolved footnote references":
+            (lambda n: "[^x] " * n, "--ffootnotes"),
+    "table with many columns":
+            (lambda n: "|a" * n + "\n" + "|-" * n + "\n" + "|b" * n + "\n", "--ftables"),
+    "table with many rows":
+            (lambda n: "a|b\n-|-\n" + "c|d\n" * n, "--ftables"),
+    "table with many code spans":
+            (lambda n: "a|b\n-|-\n" + "`a|" * n + "\n", "--ftables"),
+    "many admonitions":
+            (lambda n: "> [!NOTE]\n> a\n\n" * n, "--fadmonitions"),
+    "nested admonitions":
+            (lambda n: "".join("> " * x + "[!NOTE]\n" for x in range(n)), "--fadmonitions", 60),
+    "many task list items":
+            (lambda n: "- [ ] a\n" * n, "--ftasklists"),
+    "many broken permissive www autolinks":
+            (lambda n: "www._" * n + "x", "--fpermissive-www-autolinks"),
+    "many broken permissive url autolinks":
+            (lambda n: "http://" * n, "--fpermissive-url-autolinks"),
+    "many broken permissive e-mail autolinks":
+            (lambda n: "a@" * n + "a@b." * n, "--fpermissive-email-autolinks"),
+    "permissive autolink with many parentheses":
+            (lambda n: "www.a" + "(" * n + ")" * n + " " + "http://a" + ")(" * n,
+             "--fpermissive-autolinks"),
+}
+
+
+TIME_RE = re.compile(r"Time spent on parsing: *([0-9.]+) (ms|s)\.")
+
+
+def measure(program, text, options, timeout):
+    cmdline = program.split() + [ "--stat" ] + options.split()
+    p = subprocess.run(cmdline, input=text.encode("utf-8"), stdout=subprocess.DEVNULL,
+                       stderr=subprocess.PIPE, timeout=timeout)
+    if p.returncode != 0:
+        raise RuntimeError("return code {}".format(p.returncode))
+    m = TIME_RE.search(p.stderr.decode("utf-8", "replace"))
+    if m is None:
+        raise RuntimeError("no time reported")
+    t = float(m.group(1))
+    return t / 1000.0 if m.group(2) == "ms" else t
+
+
+def fit_exponent(sizes, times):
+    xs = [ math.log(s) for s in sizes ]
+    ys = [ math.log(max(t, 1e-6)) for t in times ]
+    mx = sum(xs) / len(xs)
+    my = sum(ys) / len(ys)
+    sxx = sum((x - mx) ** 2 for x in xs)
+    sxy = sum((x - mx) * (y - my) for x, y in zip(xs, ys))
+    return sxy / sxx
+
+
+def run_tests(args):
+    passed = []
+    failed = []
+    errored = []
+
+    for description, test in scaling.items():
+        if args.filter is not None  and  args.filter not in description:
+            continue
+
+        gen, options = test[0], test[1]
+        base = test[2] if len(test) > 2 else DEFAULT_BASE
+        sizes = []
+        times = []
+
+        try:
+            for step in range(args.steps):
+                text = gen(base * 2 ** step)
+                t = min(measure(args.program, text, options, args.timeout)
+                        for _ in range(args.repeat))
+                sizes.append(len(text.encode("utf-8")))
+                times.append(t)
+        except subprocess.TimeoutExpired:
+            print("{:45} [TIMEOUT] at size {}".format(description, len(text)))
+            failed.append(description)
+            continue
+        except RuntimeError as e:
+            print("{:45} [ERRORED] ({})".format(description, e))
+            errored.append(description)
+            continue
+
+        k = fit_exponent(sizes, times)
+        details = "k = {:.2f} ({:.2f} ms for {} B .. {:.2f} ms for {} B)".format(
+                k, times[0] * 1e3, sizes[0], times[-1] * 1e3, sizes[-1])
+        if k > 1.0 + args.tolerance:
+            print("{:45} [FAILED] {}".format(description, details))
+            failed.append(description)
+        else:
+            print("{:45} [PASSED] {}".format(description, details))
+            passed.append(description)
+        sys.stdout.flush()
+
+    print("%d passed, %d failed, %d errored" %
+          (len(passed), len(failed), len(errored)))
+    if failed or errored:
+        exit(1)
+    else:
+        exit(0)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Check time complexity of parsing pathological inputs.")
+    parser.add_argument("-p", "--program", dest="program", default="md2html",
+                    help="program to test")
+    parser.add_argument("-t", "--tolerance", type=float, default=0.3,
+                    help="allowed excess of the exponent over 1 (default 0.3)")
+    parser.add_argument("-s", "--steps", type=int, default=5,
+                    help="count of sizes, each double the previous one (default 5)")
+    parser.add_argument("-r", "--repeat", type=int, default=3,
+                    help="count of runs for each size; the fastest one counts (default 3)")
+    parser.add_argument("-T", "--timeout", type=float, default=10.0,
+                    help="timeout of a single run in seconds (default 10)")
+    parser.add_argument("-f", "--filter", default=None,
+                    help="run only tests whose description contains this")
+    args = parser.parse_args(sys.argv[1:])
+    run_tests(args)